@@ -0,0 +1,399 @@
+/*
+  umcreader.c for UP3DTools
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcreader.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <pthread.h>
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// chunks decoded ahead of the one written, per thread
+#define UMCREADER_WINDOW_PER_THREAD 2
+
+static bool _umcreader_map(umcreader_t* r, const char* filename, bool write)
+{
+  r->blks = r->wblks = NULL;
+  r->count = 0;
+#if defined(_WIN32) || defined(_WIN64)
+  r->mapping = NULL;
+  r->file = CreateFileA( filename, write ? (GENERIC_READ|GENERIC_WRITE) : GENERIC_READ, write ? 0 : FILE_SHARE_READ,
+                         NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+  if( INVALID_HANDLE_VALUE == r->file )
+    return false;
+  LARGE_INTEGER size;
+  if( !GetFileSizeEx( r->file, &size ) )
+  {
+    CloseHandle( r->file );
+    return false;
+  }
+  r->count = (uint64_t)size.QuadPart/sizeof(UP3D_BLK);
+  if( !r->count ) //empty files can not be mapped
+    return true;
+  void* map = NULL;
+  r->mapping = CreateFileMappingA( r->file, NULL, write ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL );
+  if( r->mapping )
+    map = MapViewOfFile( r->mapping, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0 );
+  if( !r->mapping || !map )
+  {
+    if( r->mapping )
+      CloseHandle( r->mapping );
+    CloseHandle( r->file );
+    r->count = 0;
+    return false;
+  }
+#else
+  r->fd = open( filename, write ? O_RDWR : O_RDONLY );
+  if( r->fd<0 )
+    return false;
+  struct stat st;
+  if( fstat( r->fd, &st ) )
+  {
+    close( r->fd );
+    return false;
+  }
+  r->size = (size_t)st.st_size;
+  r->count = r->size/sizeof(UP3D_BLK);
+  if( !r->count ) //empty files can not be mapped
+    return true;
+  void* map = mmap( NULL, r->size, write ? (PROT_READ|PROT_WRITE) : PROT_READ, write ? MAP_SHARED : MAP_PRIVATE, r->fd, 0 );
+  if( MAP_FAILED == map )
+  {
+    close( r->fd );
+    r->count = 0;
+    return false;
+  }
+#ifdef POSIX_MADV_SEQUENTIAL
+  posix_madvise( map, r->size, POSIX_MADV_SEQUENTIAL );
+#endif
+#endif
+  r->blks = map;
+  if( write )
+    r->wblks = map;
+  return true;
+}
+
+bool umcreader_open(umcreader_t* r, const char* filename)
+{
+  return _umcreader_map( r, filename, false );
+}
+
+bool umcreader_open_write(umcreader_t* r, const char* filename)
+{
+  return _umcreader_map( r, filename, true );
+}
+
+void umcreader_close(umcreader_t* r)
+{
+#if defined(_WIN32) || defined(_WIN64)
+  if( r->wblks )
+    FlushViewOfFile( r->wblks, 0 );
+  if( r->blks )
+    UnmapViewOfFile( r->blks );
+  if( r->mapping )
+    CloseHandle( r->mapping );
+  CloseHandle( r->file );
+#else
+  if( r->wblks )
+    msync( r->wblks, r->size, MS_SYNC );
+  if( r->blks )
+    munmap( (void*)r->blks, r->size );
+  close( r->fd );
+#endif
+  r->blks = r->wblks = NULL;
+  r->count = 0;
+}
+
+void umcreader_iter_init(umcreader_iter_t* it, const umcreader_t* r, uint64_t first, uint64_t count, bool next_xy, uint32_t mask)
+{
+  if( first > r->count )
+    first = r->count;
+  if( count > r->count-first )
+    count = r->count-first;
+  it->base = r->blks;
+  it->next = r->blks + first;
+  it->end = it->next + count;
+  it->blk = NULL;
+  it->index = first;
+  it->mask = mask;
+  it->next_xy = next_xy;
+  it->movef_xy = false;
+}
+
+bool umcreader_iter_next(umcreader_iter_t* it)
+{
+  while( it->next < it->end )
+  {
+    const UP3D_BLK* b = it->next++;
+    uint32_t pcmd = b->pcmd;
+    bool xy = false;
+    if( UP3DPCMD_MoveF == pcmd )
+    {
+      xy = it->next_xy;
+      it->next_xy = !it->next_xy;
+    }
+    if( (pcmd < 32) ? !(it->mask & UMCREADER_CMD(pcmd)) : (UMCREADER_ALL != it->mask) )
+      continue;
+
+    it->blk = b;
+    it->index = (uint64_t)(b - it->base);
+    it->movef_xy = xy;
+    return true;
+  }
+  return false;
+}
+
+uint64_t umcreader_chunk_count(const umcreader_t* r)
+{
+  return (r->count + UMCREADER_CHUNK_BLOCKS-1)/UMCREADER_CHUNK_BLOCKS;
+}
+
+void umcreader_printf(umcreader_out_t* out, const char* fmt, ...)
+{
+  if( out->failed )
+    return;
+
+  for(;;)
+  {
+    va_list ap;
+    va_start( ap, fmt );
+    int n = vsnprintf( out->text + out->len, out->alloc - out->len, fmt, ap );
+    va_end( ap );
+    if( n < 0 )
+    {
+      out->failed = true;
+      return;
+    }
+    if( out->len + (size_t)n < out->alloc )
+    {
+      out->len += (size_t)n;
+      return;
+    }
+
+    size_t alloc = out->alloc ? out->alloc*2 : 65536;
+    while( alloc <= out->len + (size_t)n )
+      alloc *= 2;
+    char* text = realloc( out->text, alloc );
+    if( !text )
+    {
+      out->failed = true;
+      return;
+    }
+    out->text = text;
+    out->alloc = alloc;
+  }
+}
+
+typedef struct {
+  const umcreader_t* r;
+  umcreader_chunk_fn fn;
+  void*              user;
+
+  pthread_mutex_t    lock;
+  pthread_cond_t     cond;
+  uint64_t           chunks;
+  uint64_t           next;    // next chunk to decode
+  uint64_t           written; // next chunk to write
+  uint32_t           window;
+  umcreader_out_t*   outs;    // ring of window decoded chunks
+  bool*              ready;
+} umcreader_decode_t;
+
+static void _umcreader_decode_chunk(umcreader_decode_t* d, umcreader_out_t* out, uint64_t chunk)
+{
+  out->chunk = chunk;
+  out->first = chunk*UMCREADER_CHUNK_BLOCKS;
+  out->count = d->r->count - out->first;
+  if( out->count > UMCREADER_CHUNK_BLOCKS )
+    out->count = UMCREADER_CHUNK_BLOCKS;
+  out->len = 0;
+  d->fn( d->user, d->r, out );
+}
+
+static void* _umcreader_worker(void* arg)
+{
+  umcreader_decode_t* d = arg;
+  for(;;)
+  {
+    pthread_mutex_lock( &d->lock );
+    while( (d->next < d->chunks) && (d->next >= d->written + d->window) )
+      pthread_cond_wait( &d->cond, &d->lock );
+    uint64_t chunk = d->next++;
+    pthread_mutex_unlock( &d->lock );
+    if( chunk >= d->chunks )
+      break;
+
+    _umcreader_decode_chunk( d, &d->outs[chunk % d->window], chunk );
+
+    pthread_mutex_lock( &d->lock );
+    d->ready[chunk % d->window] = true;
+    pthread_cond_broadcast( &d->cond );
+    pthread_mutex_unlock( &d->lock );
+  }
+  return NULL;
+}
+
+static uint32_t _umcreader_cpus(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+  SYSTEM_INFO si;
+  GetSystemInfo( &si );
+  return si.dwNumberOfProcessors;
+#else
+  long n = sysconf( _SC_NPROCESSORS_ONLN );
+  return (n > 0) ? (uint32_t)n : 1;
+#endif
+}
+
+bool umcreader_decode(const umcreader_t* r, uint32_t threads, umcreader_chunk_fn fn, void* user, FILE* fout)
+{
+  umcreader_decode_t d = { .r = r, .fn = fn, .user = user, .chunks = umcreader_chunk_count(r) };
+  if( !threads )
+    threads = _umcreader_cpus();
+  if( threads > d.chunks )
+    threads = (uint32_t)d.chunks;
+  if( !threads )
+    return true;
+  d.window = (threads > 1) ? threads*UMCREADER_WINDOW_PER_THREAD : 1;
+
+  d.outs = calloc( d.window, sizeof(umcreader_out_t) );
+  d.ready = calloc( d.window, sizeof(bool) );
+  pthread_t* workers = calloc( threads, sizeof(pthread_t) );
+  if( !d.outs || !d.ready || !workers )
+  {
+    free( d.outs ); free( d.ready ); free( workers );
+    return false;
+  }
+
+  uint32_t t, started = 0;
+  if( threads > 1 )
+  {
+    pthread_mutex_init( &d.lock, NULL );
+    pthread_cond_init( &d.cond, NULL );
+    for( ; started<threads; started++ )
+      if( pthread_create( &workers[started], NULL, _umcreader_worker, &d ) )
+        break;
+  }
+
+  bool ok = true;
+  if( !started ) //decode in this thread
+  {
+    for( ; d.written < d.chunks; d.written++ )
+    {
+      _umcreader_decode_chunk( &d, d.outs, d.written );
+      ok = ok && !d.outs->failed && (d.outs->len == fwrite( d.outs->text, 1, d.outs->len, fout ));
+    }
+  }
+  else
+  {
+    while( d.written < d.chunks )
+    {
+      uint32_t slot = d.written % d.window;
+      pthread_mutex_lock( &d.lock );
+      while( !d.ready[slot] )
+        pthread_cond_wait( &d.cond, &d.lock );
+      pthread_mutex_unlock( &d.lock );
+
+      umcreader_out_t* out = &d.outs[slot];
+      ok = ok && !out->failed && (out->len == fwrite( out->text, 1, out->len, fout ));
+
+      pthread_mutex_lock( &d.lock );
+      d.ready[slot] = false;
+      d.written++;
+      pthread_cond_broadcast( &d.cond );
+      pthread_mutex_unlock( &d.lock );
+    }
+
+    for( t=0; t<started; t++ )
+      pthread_join( workers[t], NULL );
+  }
+  if( threads > 1 )
+  {
+    pthread_cond_destroy( &d.cond );
+    pthread_mutex_destroy( &d.lock );
+  }
+
+  uint32_t w;
+  for( w=0; w<d.window; w++ )
+    free( d.outs[w].text );
+  free( d.outs );
+  free( d.ready );
+  free( workers );
+  return ok;
+}
+
+typedef struct {
+  const umcreader_t* r;
+  umcreader_range_fn fn;
+  void*              user;
+  pthread_mutex_t    lock;
+  uint64_t           chunks;
+  uint64_t           next;
+} umcreader_for_t;
+
+static void* _umcreader_for_worker(void* arg)
+{
+  umcreader_for_t* f = arg;
+  for(;;)
+  {
+    pthread_mutex_lock( &f->lock );
+    uint64_t chunk = f->next++;
+    pthread_mutex_unlock( &f->lock );
+    if( chunk >= f->chunks )
+      break;
+
+    uint64_t first = chunk*UMCREADER_CHUNK_BLOCKS;
+    uint64_t count = f->r->count - first;
+    if( count > UMCREADER_CHUNK_BLOCKS )
+      count = UMCREADER_CHUNK_BLOCKS;
+    f->fn( f->user, f->r, chunk, first, count );
+  }
+  return NULL;
+}
+
+void umcreader_for_chunks(const umcreader_t* r, uint32_t threads, umcreader_range_fn fn, void* user)
+{
+  umcreader_for_t f = { .r = r, .fn = fn, .user = user, .chunks = umcreader_chunk_count(r) };
+  pthread_mutex_init( &f.lock, NULL );
+  if( !threads )
+    threads = _umcreader_cpus();
+  if( threads > f.chunks )
+    threads = (uint32_t)f.chunks;
+
+  pthread_t* workers = (threads > 1) ? calloc( threads-1, sizeof(pthread_t) ) : NULL;
+  uint32_t t, started = 0;
+  if( workers )
+    for( ; started<threads-1; started++ )
+      if( pthread_create( &workers[started], NULL, _umcreader_for_worker, &f ) )
+        break;
+
+  _umcreader_for_worker( &f ); //this thread helps
+  for( t=0; t<started; t++ )
+    pthread_join( workers[t], NULL );
+  free( workers );
+  pthread_mutex_destroy( &f.lock );
+}
@@ -0,0 +1,107 @@
+/*
+  umcreader.h for UP3DTools
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _UMCREADER_H_
+#define _UMCREADER_H_
+
+#include "up3ddata.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+// Read only access to an UMC (UP machine code) file: the file is mapped into memory and used as
+// array of UP3D_BLK. A partial block at the end of the file is ignored.
+// umcreader_open_write() maps the file writable, changes of wblks go to the file (in place, the
+// size stays), they are flushed by umcreader_close().
+
+typedef struct {
+  const UP3D_BLK* blks;
+  UP3D_BLK*       wblks;    // same as blks if opened with umcreader_open_write(), else NULL
+  uint64_t        count;
+#if defined(_WIN32) || defined(_WIN64)
+  HANDLE          file;
+  HANDLE          mapping;
+#else
+  int             fd;
+  size_t          size;
+#endif
+} umcreader_t;
+
+bool umcreader_open(umcreader_t* r, const char* filename);
+bool umcreader_open_write(umcreader_t* r, const char* filename);
+void umcreader_close(umcreader_t* r);
+
+// Iterator over a range of blocks. A MoveF is always sent as pair (X/Y, then Z/A), movef_xy tells
+// which half the current block is. Blocks with a command not in mask are skipped.
+#define UMCREADER_CMD(pcmd) (1UL<<(pcmd))
+#define UMCREADER_ALL       0xFFFFFFFFUL
+
+typedef struct {
+  const UP3D_BLK* blk;      // current block
+  uint64_t        index;    // its index in the file
+  bool            movef_xy; // current MoveF block is the X/Y half of the pair
+  bool            next_xy;  // next MoveF (also after the range) is the X/Y half
+
+  const UP3D_BLK* next;
+  const UP3D_BLK* end;
+  const UP3D_BLK* base;
+  uint32_t        mask;
+} umcreader_iter_t;
+
+// next_xy: the first MoveF in the range is the X/Y half (true at the start of a file)
+void umcreader_iter_init(umcreader_iter_t* it, const umcreader_t* r, uint64_t first, uint64_t count, bool next_xy, uint32_t mask);
+bool umcreader_iter_next(umcreader_iter_t* it);
+
+// Parallel decoding: the file is cut into chunks of UMCREADER_CHUNK_BLOCKS blocks, worker threads
+// decode them to text with fn and the text is written to fout in file order. Only a few chunks
+// are kept in memory at a time. State carried from block to block (positions, the MoveF half)
+// has to be known by fn for the start of its chunk, e.g. from a pass with an iterator over the moves.
+#define UMCREADER_CHUNK_BLOCKS 65536
+
+typedef struct {
+  uint64_t first;  // first block of the chunk
+  uint64_t count;  // blocks in the chunk
+  uint64_t chunk;  // chunk number
+  char*    text;
+  size_t   len;
+  size_t   alloc;
+  bool     failed; // out of memory
+} umcreader_out_t;
+
+typedef void (*umcreader_chunk_fn)(void* user, const umcreader_t* r, umcreader_out_t* out);
+
+uint64_t umcreader_chunk_count(const umcreader_t* r);
+
+// threads: 0 = number of cpus, returns false if a chunk ran out of memory or fout failed
+bool umcreader_decode(const umcreader_t* r, uint32_t threads, umcreader_chunk_fn fn, void* user, FILE* fout);
+
+// text output of a chunk
+void umcreader_printf(umcreader_out_t* out, const char* fmt, ...);
+
+// Runs fn for every chunk on worker threads (0 = number of cpus), in no particular order
+typedef void (*umcreader_range_fn)(void* user, const umcreader_t* r, uint64_t chunk, uint64_t first, uint64_t count);
+
+void umcreader_for_chunks(const umcreader_t* r, uint32_t threads, umcreader_range_fn fn, void* user);
+
+#endif //_UMCREADER_H_
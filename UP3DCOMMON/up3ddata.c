@@ -21,6 +21,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <math.h>
 
 void UP3D_PROG_BLK_Stop( UP3D_BLK *pupblk )
 {
@@ -93,3 +94,28 @@ void UP3D_PROG_BLK_WaitIfNot( UP3D_BLK *pupblk, uint8_t parameter, int32_t value
   pupblk->pdat3.l=compchar;
 }
 
+//reljump is counted from the block following this one (-1 jumps to itself)
+void UP3D_PROG_BLK_IfNotThenJmp( UP3D_BLK *pupblk, uint8_t parameter, int32_t value, char compchar, int32_t reljump )
+{
+  memset( pupblk, 0, sizeof(UP3D_BLK) );
+  pupblk->pcmd=UP3DPCMD_IfNotThenJmp; 
+  pupblk->pdat1.l=parameter;
+  pupblk->pdat2.l=value;
+  pupblk->pdat3.l=compchar;
+  pupblk->pdat4.l=reljump;
+}
+
+void UP3D_PROG_BLK_AddToParam( UP3D_BLK *pupblk, uint8_t parameter, int32_t value )
+{
+  memset( pupblk, 0, sizeof(UP3D_BLK) );
+  pupblk->pcmd=UP3DPCMD_AddToParam; 
+  pupblk->pdat1.l=parameter;
+  pupblk->pdat2.l=value;
+}
+
+int64_t UP3D_PROG_MoveL_Steps( uint16_t p1, int16_t speed, int16_t acc )
+{
+  int64_t n = p1;
+  //single precision like the mcu, the division by 512 is exact
+  return (int64_t)floorf( (float)(speed*n + acc*(n-1)*n/2) / 512.0f );
+}
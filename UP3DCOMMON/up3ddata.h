@@ -232,7 +232,7 @@ typedef enum PARA {
 
 //GET_NOZZLE1_TEMP 0x06 (float)
 //GET_NOZZLE2_TEMP 0x07 (float)
-//GET_BED_TEMP     0x08 (float)
+  PARA_GET_BED_TEMP        = 0x08, //current bed temperature (float)
 //GET_TEMP4_TEMP   0x09 (float)
 
   PARA_REPORT_LAYER        = 0x0A, //layer number 1 ..
@@ -339,7 +339,7 @@ typedef enum PARA {
 
 //0xBC light countdown timer
 
-  //0xC9, used as counter
+  PARA_COUNTER             = 0xC9, //used as loop counter by rom programs
 
 } PARA;
 
@@ -348,9 +348,15 @@ void UP3D_PROG_BLK_Power( UP3D_BLK *pupblk, bool on );
 void UP3D_PROG_BLK_Beeper( UP3D_BLK *pupblk, bool on );
 void UP3D_PROG_BLK_Pause( UP3D_BLK *pupblk, uint32_t msec );
 void UP3D_PROG_BLK_SetParameter( UP3D_BLK *pupblk, uint8_t parameter, int32_t value );
-void UP3D_PROG_BLK_Home( UP3D_BLK pupblks[2], UP3D_AXIS axis, float direction, float offset, float speed );
+void UP3D_PROG_BLK_Home( UP3D_BLK *pupblk, UP3D_AXIS axis, float direction, float offset, float speed );
 void UP3D_PROG_BLK_MoveF( UP3D_BLK pupblks[2], float speedX, float posX, float speedY, float posY, float speedZ, float posZ, float speedA, float posA );
 void UP3D_PROG_BLK_MoveL( UP3D_BLK *pupblk, uint16_t p1, uint16_t p2, int16_t p3, int16_t p4, int16_t p5, int16_t p6, int16_t p7, int16_t p8);
 void UP3D_PROG_BLK_WaitIfNot( UP3D_BLK *pupblk, uint8_t parameter, int32_t value, char compchar );
+void UP3D_PROG_BLK_IfNotThenJmp( UP3D_BLK *pupblk, uint8_t parameter, int32_t value, char compchar, int32_t reljump );
+void UP3D_PROG_BLK_AddToParam( UP3D_BLK *pupblk, uint8_t parameter, int32_t value );
+
+// Steps of one axis made by a MoveL: p1 periods, speed and acceleration in 1/512 steps per period.
+// Rounded like the mcu in the printer does (float, then floor).
+int64_t UP3D_PROG_MoveL_Steps( uint16_t p1, int16_t speed, int16_t acc );
 
 #endif //_UP3DDATA_H_
@@ -1,6 +1,9 @@
 //UP program to gcode converter
 //Author M.Stohn
 
+#include "up3ddata.h"
+#include "umcreader.h"
+
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -16,123 +19,96 @@
 #define ADD_Y   (120.0)
 #define ADD_Z   (123.1)
 
-typedef enum PCMD {
-  PCMD_Stop         = 0x00000001,
-  PCMD_2 = 2, //PAUSE 4/1 4/0
-  PCMD_MoveF        = 0x00000003,
-  PCMD_MoveL        = 0x00000004,
-  PCMD_5 = 5, //DELAY
-  PCMD_SetParameter = 0x00000006
-} PCMD;
-
-typedef enum PARA {
-  PARA_REPORT_LAYER        = 0x0A,
-  PARA_REPORT_HEIGHT       = 0x0B,
-
-  PARA_x0C                 = 0x0C, //PAUSE (1)
-  PARA_x10                 = 0x10, //PAUSE (3)
-  PARA_x11                 = 0x11, //AFTER EVERY LAYER (1)
-  PARA_x16                 = 0x16, //(0)AT END ==> RUN END PROGRAM
-
-  PARA_NOZZLE1_TEMP        = 0x39,
-  PARA_NOZZLE2_TEMP        = 0x3A,
-  PARA_BED_TEMP            = 0x3B,
-
-  PARA_REPORT_PERCENT      = 0x4C,
-  PARA_REPORT_TIME_REMAIN  = 0x4D,
-} PARA;
-
-#pragma pack(1)  
-typedef struct UPBLOCK {
-  uint32_t pcmd;
-  union UPBLOCKDAT {
-    struct UPBLOCKDATFLOATS { float f1; float f2; float f3; float f4; } floats;
-    struct UPBLOCKDATSHORTS { int16_t s1; int16_t s2; int16_t s3; int16_t s4; int16_t s5; int16_t s6; int16_t s7; int16_t s8; } shorts;
-    struct UPBLOCKDATLONGS  { int32_t l1; int32_t l2; int32_t l3; int32_t l4; } longs;
-  } pdat;
-} UPBLOCK;
-#pragma pack()
-
-static double _posX, _posY, _posZ, _posE;
-static int    _lastFeed = -1;
-static bool   _Xchange, _Ychange, _Zchange, _Echange;
-static int    _minFeed;
-static int    _maxFeed;
-
-void _dat_cmd_MoveF( float speed1, float pos1, float speed2, float pos2, bool isXY )
+// Positions, feed rate and the changed axes of a MoveF pair are carried from move to move. The file
+// is decoded in chunks (see umcreader.h), a quick pass over the moves finds the state at the start
+// of every chunk.
+typedef struct {
+  double posX, posY, posZ, posE;
+  int    lastFeed;
+  bool   Xchange, Ychange, Zchange, Echange;
+  int    minFeed;
+  int    maxFeed;
+  bool   movef_xy; // next MoveF is the X/Y half
+} convg_state_t;
+
+// out is NULL when only the state is needed
+#define PRINT(...) do { if( out ) umcreader_printf( out, __VA_ARGS__ ); } while(0)
+
+
+static void _dat_cmd_MoveF( convg_state_t* s, umcreader_out_t* out, float speed1, float pos1, float speed2, float pos2, bool isXY )
 {
   if( isXY )
   {
-    _Xchange = false;
-    _Ychange = false;
-    _Zchange = false;
-    _Echange = false;
-    _minFeed = 1000000;
-    _maxFeed = 0;
+    s->Xchange = false;
+    s->Ychange = false;
+    s->Zchange = false;
+    s->Echange = false;
+    s->minFeed = 1000000;
+    s->maxFeed = 0;
   
     if( speed1!=0 ) 
     {
-      _posX = pos1;
-      if( _minFeed>fabs(speed1) ) _minFeed = fabs(speed1);
-      if( _maxFeed<fabs(speed1) ) _maxFeed = fabs(speed1);
-      _Xchange = true;
+      s->posX = pos1;
+      if( s->minFeed>fabs(speed1) ) s->minFeed = fabs(speed1);
+      if( s->maxFeed<fabs(speed1) ) s->maxFeed = fabs(speed1);
+      s->Xchange = true;
     }
     if( speed2!=0 ) 
     {
-      _posY = pos2;
-      if( _minFeed>fabs(speed2) ) _minFeed = fabs(speed2);
-      if( _maxFeed<fabs(speed2) ) _maxFeed = fabs(speed2);
-      _Ychange = true;
+      s->posY = pos2;
+      if( s->minFeed>fabs(speed2) ) s->minFeed = fabs(speed2);
+      if( s->maxFeed<fabs(speed2) ) s->maxFeed = fabs(speed2);
+      s->Ychange = true;
     }
   }
   else
   {
     if( speed1!=0 )
     {
-      _posZ = pos1;
-      if( _minFeed>fabs(speed1) ) _minFeed = fabs(speed1);
-      if( _maxFeed<fabs(speed1) ) _maxFeed = fabs(speed1);
-      _Zchange = true;
+      s->posZ = pos1;
+      if( s->minFeed>fabs(speed1) ) s->minFeed = fabs(speed1);
+      if( s->maxFeed<fabs(speed1) ) s->maxFeed = fabs(speed1);
+      s->Zchange = true;
     }
     if( speed2!=0 ) 
     {
       if( speed2<0 )
-        _posE = pos2;
+        s->posE = pos2;
       else
-        _posE += pos2;
+        s->posE += pos2;
       
-      if( _minFeed>fabs(speed2) ) _minFeed = fabs(speed2);
-      if( _maxFeed<fabs(speed2) ) _maxFeed = fabs(speed2);
-      _Echange = true;
+      if( s->minFeed>fabs(speed2) ) s->minFeed = fabs(speed2);
+      if( s->maxFeed<fabs(speed2) ) s->maxFeed = fabs(speed2);
+      s->Echange = true;
     }
     
-    if( _Xchange || _Ychange || _Zchange || _Echange )
+    if( s->Xchange || s->Ychange || s->Zchange || s->Echange )
     {
-      printf("G1");
-      if( _Xchange ) printf(" X%.4f", _posY);
-      if( _Ychange ) printf(" Y%.4f", -_posX);
-      if( _Zchange ) printf(" Z%.4f", ADD_Z+_posZ);
-      if( _Echange ) printf(" E%.5f", _posE);
+      PRINT("G1");
+      if( s->Xchange ) PRINT(" X%.4f", s->posY);
+      if( s->Ychange ) PRINT(" Y%.4f", -s->posX);
+      if( s->Zchange ) PRINT(" Z%.4f", ADD_Z+s->posZ);
+      if( s->Echange ) PRINT(" E%.5f", s->posE);
 /*
-      if( _lastFeed != _minFeed )
+      if( s->lastFeed != s->minFeed )
       {
-        printf(" F%d", _minFeed);
-        _lastFeed = _minFeed;
+        PRINT(" F%d", s->minFeed);
+        s->lastFeed = s->minFeed;
       }
 */
-      if( _lastFeed != _maxFeed )
+      if( s->lastFeed != s->maxFeed )
       {
-        printf(" F%d", _maxFeed);
-        _lastFeed = _maxFeed;
+        PRINT(" F%d", s->maxFeed);
+        s->lastFeed = s->maxFeed;
       }
-      printf("\n");
+      PRINT("\n");
 
-//      if( _Echange ) printf("G92 E0\n");
+//      if( s->Echange ) PRINT("G92 E0\n");
     }
   }
 }
 
-void _dat_cmd_MoveL( uint16_t p1, uint16_t p2, int16_t p3, int16_t p4, int16_t p5, int16_t p6, int16_t p7, int16_t p8 )
+static void _dat_cmd_MoveL( convg_state_t* s, umcreader_out_t* out, uint16_t p1, uint16_t p2, int16_t p3, int16_t p4, int16_t p5, int16_t p6, int16_t p7, int16_t p8 )
 {
   int32_t sx = floor((float)((p3*p1+p6*(p1-1)*p1/2))/512);
   int32_t sy = floor((float)((p4*p1+p7*(p1-1)*p1/2))/512);
@@ -141,16 +117,16 @@ void _dat_cmd_MoveL( uint16_t p1, uint16_t p2, int16_t p3, int16_t p4, int16_t p
   double r2 = sy/STEPS_Y;
   double r3 = sa/STEPS_E;
 
-  _posX += r1;
-  _posY += r2;
-  _posE += r3;
+  s->posX += r1;
+  s->posY += r2;
+  s->posE += r3;
  
   if( (r1!=0) || (r2!=0) || (r3!=0) )
   {
-    printf("G1");
-    printf(" X%.4f",_posY);
-    printf(" Y%.4f",-_posX);
-    printf(" E%.5f",_posE);
+    PRINT("G1");
+    PRINT(" X%.4f",s->posY);
+    PRINT(" Y%.4f",-s->posX);
+    PRINT(" E%.5f",s->posE);
 
     if( p1>1 )
     {
@@ -166,59 +142,59 @@ void _dat_cmd_MoveL( uint16_t p1, uint16_t p2, int16_t p3, int16_t p4, int16_t p
     
       int32_t feed = f*60.0;
     
-      if( _lastFeed != feed )
+      if( s->lastFeed != feed )
       {
-        printf(" F%d", feed);
-        _lastFeed = feed;
+        PRINT(" F%d", feed);
+        s->lastFeed = feed;
       }
     }  
-    printf("\n");
+    PRINT("\n");
   }
 }
 
 
-void _dat_cmd_SetParameter( int32_t param, int32_t value )
+static void _dat_cmd_SetParameter( umcreader_out_t* out, int32_t param, int32_t value )
 {
-  printf( ";Set Parameter: " );
+  PRINT( ";Set Parameter: " );
   switch( param )
   {
     case PARA_REPORT_LAYER:
-      printf( "Report Layer: %"PRIi32, value );
+      PRINT( "Report Layer: %"PRIi32, value );
     break;
 
     case PARA_REPORT_HEIGHT:
-      printf( "Report Height: %.3f", *((float*)&value) );
+      PRINT( "Report Height: %.3f", *((float*)&value) );
     break;
 
     case PARA_NOZZLE1_TEMP:
-      printf( "Nozzle 1: %"PRIi32" C", value );
+      PRINT( "Nozzle 1: %"PRIi32" C", value );
     break;
     case  PARA_NOZZLE2_TEMP:
-      printf( "Nozzle 2: %"PRIi32" C", value );
+      PRINT( "Nozzle 2: %"PRIi32" C", value );
     break;
     case PARA_BED_TEMP:
-      printf( "Bed: %"PRIi32" C", value );
+      PRINT( "Bed: %"PRIi32" C", value );
     break;
 
     case PARA_REPORT_PERCENT:
-      printf( "Report Percent Done: %"PRIi32"%%", value );
+      PRINT( "Report Percent Done: %"PRIi32"%%", value );
     break;
     case PARA_REPORT_TIME_REMAIN:
-      printf( "Report Time Remaining: %"PRIi32" sec", value );
+      PRINT( "Report Time Remaining: %"PRIi32" sec", value );
     break;
   
     default:
     break;
   }
-  printf( "\n" );
+  PRINT( "\n" );
 
   switch( param )
   {
     case PARA_NOZZLE1_TEMP:
-      printf( "M104 S%"PRIi32" ;set extruder temp\n", value );
+      PRINT( "M104 S%"PRIi32" ;set extruder temp\n", value );
     break;
     case PARA_BED_TEMP:
-      printf( "M140 S%"PRIi32" ;set bed temp\n", value );
+      PRINT( "M140 S%"PRIi32" ;set bed temp\n", value );
     break;
 
     default:
@@ -226,60 +202,97 @@ void _dat_cmd_SetParameter( int32_t param, int32_t value )
   }
 }
 
-void _parse_dat_block( UPBLOCK* pBlock )
+static void _parse_dat_block( convg_state_t* s, const UP3D_BLK* pBlock, bool movef_xy, umcreader_out_t* out )
 {
-  static bool _cmd3_XY = true;
-
   switch( pBlock->pcmd )
   {
-    case PCMD_Stop:
-      printf( ";STOP\n");
+    case UP3DPCMD_Stop:
+      PRINT( ";STOP\n");
       break;
 
-    case PCMD_2: //PAUSE - USER INTERACTION 4/1 4/0
-      printf( ";CMD_2: %08X / %08X\n", pBlock->pdat.longs.l1, pBlock->pdat.longs.l2 );
+    case UP3DPCMD_SetState: //PAUSE - USER INTERACTION 4/1 4/0
+      PRINT( ";CMD_2: %08X / %08X\n", pBlock->pdat1.l, pBlock->pdat2.l );
       break;
       
-    case PCMD_MoveF:
-      _dat_cmd_MoveF( pBlock->pdat.floats.f1, pBlock->pdat.floats.f2, pBlock->pdat.floats.f3, pBlock->pdat.floats.f4, _cmd3_XY );
-      _cmd3_XY = !_cmd3_XY;
+    case UP3DPCMD_MoveF:
+      _dat_cmd_MoveF( s, out, pBlock->pdat1.f, pBlock->pdat2.f, pBlock->pdat3.f, pBlock->pdat4.f, movef_xy );
       break;
  
-    case PCMD_MoveL:
-      _dat_cmd_MoveL( pBlock->pdat.shorts.s1, pBlock->pdat.shorts.s2, pBlock->pdat.shorts.s3, pBlock->pdat.shorts.s4,
-                      pBlock->pdat.shorts.s5, pBlock->pdat.shorts.s6, pBlock->pdat.shorts.s7, pBlock->pdat.shorts.s8 );
+    case UP3DPCMD_MoveL:
+      _dat_cmd_MoveL( s, out, pBlock->pdat1.s.s1, pBlock->pdat1.s.s2, pBlock->pdat2.s.s1, pBlock->pdat2.s.s2,
+                      pBlock->pdat3.s.s1, pBlock->pdat3.s.s2, pBlock->pdat4.s.s1, pBlock->pdat4.s.s2 );
       break;
 
-    case PCMD_5:
-      printf( "G4 P%"PRIi32" ;delay %f sec\n", pBlock->pdat.longs.l1, (double)pBlock->pdat.longs.l1 / 1000.0);
+    case UP3DPCMD_Pause:
+      PRINT( "G4 P%"PRIi32" ;delay %f sec\n", pBlock->pdat1.l, (double)pBlock->pdat1.l / 1000.0);
       break;
 
-    case PCMD_SetParameter:
-      _dat_cmd_SetParameter( pBlock->pdat.longs.l1, pBlock->pdat.longs.l2 ); //l3 and l4 is junk
+    case UP3DPCMD_SetParameter:
+      _dat_cmd_SetParameter( out, pBlock->pdat1.l, pBlock->pdat2.l ); //l3 and l4 is junk
       break;
       
     default:
-      printf( ";UNKNOWN CMD: %08X : %08X %08X %08X %08X\n", 
-              pBlock->pcmd,
-              pBlock->pdat.longs.l1, pBlock->pdat.longs.l2, pBlock->pdat.longs.l3, pBlock->pdat.longs.l4
+      PRINT( ";UNKNOWN CMD: %08X : %08X %08X %08X %08X\n", 
+              (uint32_t)pBlock->pcmd,
+              pBlock->pdat1.l, pBlock->pdat2.l, pBlock->pdat3.l, pBlock->pdat4.l
             );
             
     break;
   }
 }
 
+static void _parse_chunk( void* user, const umcreader_t* r, umcreader_out_t* out )
+{
+  convg_state_t* starts = user;
+  convg_state_t s = starts[out->chunk];
+
+  umcreader_iter_t it;
+  umcreader_iter_init( &it, r, out->first, out->count, s.movef_xy, UMCREADER_ALL );
+  while( umcreader_iter_next( &it ) )
+    _parse_dat_block( &s, it.blk, it.movef_xy, out );
+}
+
 int main(int argc, char *argv[])
 {
+  uint32_t threads = 0;
+  if( (3 == argc) && ('-' == argv[1][0]) && ('j' == argv[1][1]) && (atoi( argv[1]+2 ) > 0) )
+  {
+    threads = atoi( argv[1]+2 );
+    argv++; argc--;
+  }
+
   if( argc != 2 )
   {
-    printf("Usage: %s program.dat\n\n", argv[0]);
+    printf("Usage: %s [-jN] program.dat\n\n", argv[0]);
+    printf("          -jN:          decode with N threads (default: number of cpus)\n\n");
     return 0;
   }
 
-  FILE* fdat = fopen( argv[1], "rb" );
-  if( !fdat )
+  umcreader_t r;
+  if( !umcreader_open( &r, argv[1] ) )
     return -1;
 
+  uint64_t c, chunks = umcreader_chunk_count( &r );
+  convg_state_t* starts = malloc( (chunks+1)*sizeof(convg_state_t) );
+  if( !starts )
+  {
+    umcreader_close( &r );
+    return -1;
+  }
+
+  //state at the start of every chunk, only moves change it
+  convg_state_t s = { .lastFeed = -1, .movef_xy = true };
+  for( c=0; c<chunks; c++ )
+  {
+    starts[c] = s;
+    umcreader_iter_t it;
+    umcreader_iter_init( &it, &r, c*UMCREADER_CHUNK_BLOCKS, UMCREADER_CHUNK_BLOCKS, s.movef_xy,
+                         UMCREADER_CMD(UP3DPCMD_MoveF) | UMCREADER_CMD(UP3DPCMD_MoveL) );
+    while( umcreader_iter_next( &it ) )
+      _parse_dat_block( &s, it.blk, it.movef_xy, NULL );
+    s.movef_xy = it.next_xy;
+  }
+
   printf( ";UP converted GCODE\n\n" );
   printf( "G21 ;set units to millimeter\n" );
   printf( "G90 ;absoulte coordinates\n" );
@@ -287,18 +300,12 @@ int main(int argc, char *argv[])
   printf( "M82 ;use absolute distances for extrusion\n" );
   printf( "G1 Z0;make gcode viewer happy --> layer 0 = Z0\n" );
   printf( "\n" );
+  fflush( stdout );
 
-  for( ;; )
-  {
-    UPBLOCK block;
-    
-    if( sizeof(UPBLOCK) != fread( &block, 1, sizeof(UPBLOCK), fdat ) )
-      break;
-      
-    _parse_dat_block( &block );
-  }
+  bool ok = umcreader_decode( &r, threads, _parse_chunk, starts, stdout );
 
-  fclose( fdat );
+  free( starts );
+  umcreader_close( &r );
 
-  return 0; 
+  return ok ? 0 : -1; 
 }
@@ -1,7 +1,7 @@
 #!/bin/bash
 
-gcc -std=c99 -Os -o parse parse.c
-gcc -std=c99 -Os -o convg convg.c
+gcc -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o parse parse.c ../UP3DCOMMON/umcreader.c -lm -pthread
+gcc -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o convg convg.c ../UP3DCOMMON/umcreader.c -lm -pthread
 
 if [[ "$OSTYPE" == "msys" ]]; then
 strip parse.exe
@@ -0,0 +1,9104 @@
+; generated by test
+M190 S60 ; set bed temperature
+M104 S210 ; set temperature
+G28 ; home all axes
+G1 Z5 F5000 ; lift nozzle
+M109 S210 ; wait for temperature to be reached
+G21 ; set units to millimeters
+G90 ; use absolute coordinates
+M82 ; use absolute distances for extrusion
+G92 E0
+G1 Z0.300 F7800
+G1 X30 Y0 F7800
+G1 X29.836 Y3.136 E0.05000 F1800
+G1 X29.344 Y6.237 E0.10000
+G1 X28.532 Y9.271 E0.15000
+G1 X27.406 Y12.202 E0.20000
+G1 X25.981 Y15.000 E0.25000
+G1 X24.271 Y17.634 E0.30000
+G1 X22.294 Y20.074 E0.35000
+G1 X20.074 Y22.294 E0.40000
+G1 X17.634 Y24.271 E0.45000
+G1 X15.000 Y25.981 E0.50000
+G1 X12.202 Y27.406 E0.55000
+G1 X9.271 Y28.532 E0.60000
+G1 X6.237 Y29.344 E0.65000
+G1 X3.136 Y29.836 E0.70000
+G1 X0.000 Y30.000 E0.75000
+G1 X-3.136 Y29.836 E0.80000
+G1 X-6.237 Y29.344 E0.85000
+G1 X-9.271 Y28.532 E0.90000
+G1 X-12.202 Y27.406 E0.95000
+G1 X-15.000 Y25.981 E1.00000
+G1 X-17.634 Y24.271 E1.05000
+G1 X-20.074 Y22.294 E1.10000
+G1 X-22.294 Y20.074 E1.15000
+G1 X-24.271 Y17.634 E1.20000
+G1 X-25.981 Y15.000 E1.25000
+G1 X-27.406 Y12.202 E1.30000
+G1 X-28.532 Y9.271 E1.35000
+G1 X-29.344 Y6.237 E1.40000
+G1 X-29.836 Y3.136 E1.45000
+G1 X-30.000 Y0.000 E1.50000
+G1 X-29.836 Y-3.136 E1.55000
+G1 X-29.344 Y-6.237 E1.60000
+G1 X-28.532 Y-9.271 E1.65000
+G1 X-27.406 Y-12.202 E1.70000
+G1 X-25.981 Y-15.000 E1.75000
+G1 X-24.271 Y-17.634 E1.80000
+G1 X-22.294 Y-20.074 E1.85000
+G1 X-20.074 Y-22.294 E1.90000
+G1 X-17.634 Y-24.271 E1.95000
+G1 X-15.000 Y-25.981 E2.00000
+G1 X-12.202 Y-27.406 E2.05000
+G1 X-9.271 Y-28.532 E2.10000
+G1 X-6.237 Y-29.344 E2.15000
+G1 X-3.136 Y-29.836 E2.20000
+G1 X-0.000 Y-30.000 E2.25000
+G1 X3.136 Y-29.836 E2.30000
+G1 X6.237 Y-29.344 E2.35000
+G1 X9.271 Y-28.532 E2.40000
+G1 X12.202 Y-27.406 E2.45000
+G1 X15.000 Y-25.981 E2.50000
+G1 X17.634 Y-24.271 E2.55000
+G1 X20.074 Y-22.294 E2.60000
+G1 X22.294 Y-20.074 E2.65000
+G1 X24.271 Y-17.634 E2.70000
+G1 X25.981 Y-15.000 E2.75000
+G1 X27.406 Y-12.202 E2.80000
+G1 X28.532 Y-9.271 E2.85000
+G1 X29.344 Y-6.237 E2.90000
+G1 X29.836 Y-3.136 E2.95000
+G1 X30.000 Y-0.000 E3.00000
+G1 E2.00000 F2400
+G1 E3.00000 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E3.02000 F1800
+G1 X14.918 Y1.568 E3.04000
+G1 X14.815 Y2.347 E3.06000
+G1 X14.672 Y3.119 E3.08000
+G1 X14.489 Y3.882 E3.10000
+G1 X14.266 Y4.635 E3.12000
+G1 X14.004 Y5.376 E3.14000
+G1 X13.703 Y6.101 E3.16000
+G1 X13.365 Y6.810 E3.18000
+G1 X12.990 Y7.500 E3.20000
+G1 X12.580 Y8.170 E3.22000
+G1 X12.135 Y8.817 E3.24000
+G1 X11.657 Y9.440 E3.26000
+G1 X11.147 Y10.037 E3.28000
+G1 X10.607 Y10.607 E3.30000
+G1 X10.037 Y11.147 E3.32000
+G1 X9.440 Y11.657 E3.34000
+G1 X8.817 Y12.135 E3.36000
+G1 X8.170 Y12.580 E3.38000
+G1 X7.500 Y12.990 E3.40000
+G1 X6.810 Y13.365 E3.42000
+G1 X6.101 Y13.703 E3.44000
+G1 X5.376 Y14.004 E3.46000
+G1 X4.635 Y14.266 E3.48000
+G1 X3.882 Y14.489 E3.50000
+G1 X3.119 Y14.672 E3.52000
+G1 X2.347 Y14.815 E3.54000
+G1 X1.568 Y14.918 E3.56000
+G1 X0.785 Y14.979 E3.58000
+G1 X0.000 Y15.000 E3.60000
+G1 X-0.785 Y14.979 E3.62000
+G1 X-1.568 Y14.918 E3.64000
+G1 X-2.347 Y14.815 E3.66000
+G1 X-3.119 Y14.672 E3.68000
+G1 X-3.882 Y14.489 E3.70000
+G1 X-4.635 Y14.266 E3.72000
+G1 X-5.376 Y14.004 E3.74000
+G1 X-6.101 Y13.703 E3.76000
+G1 X-6.810 Y13.365 E3.78000
+G1 X-7.500 Y12.990 E3.80000
+G1 X-8.170 Y12.580 E3.82000
+G1 X-8.817 Y12.135 E3.84000
+G1 X-9.440 Y11.657 E3.86000
+G1 X-10.037 Y11.147 E3.88000
+G1 X-10.607 Y10.607 E3.90000
+G1 X-11.147 Y10.037 E3.92000
+G1 X-11.657 Y9.440 E3.94000
+G1 X-12.135 Y8.817 E3.96000
+G1 X-12.580 Y8.170 E3.98000
+G1 X-12.990 Y7.500 E4.00000
+G1 X-13.365 Y6.810 E4.02000
+G1 X-13.703 Y6.101 E4.04000
+G1 X-14.004 Y5.376 E4.06000
+G1 X-14.266 Y4.635 E4.08000
+G1 X-14.489 Y3.882 E4.10000
+G1 X-14.672 Y3.119 E4.12000
+G1 X-14.815 Y2.347 E4.14000
+G1 X-14.918 Y1.568 E4.16000
+G1 X-14.979 Y0.785 E4.18000
+G1 X-15.000 Y0.000 E4.20000
+G1 X-14.979 Y-0.785 E4.22000
+G1 X-14.918 Y-1.568 E4.24000
+G1 X-14.815 Y-2.347 E4.26000
+G1 X-14.672 Y-3.119 E4.28000
+G1 X-14.489 Y-3.882 E4.30000
+G1 X-14.266 Y-4.635 E4.32000
+G1 X-14.004 Y-5.376 E4.34000
+G1 X-13.703 Y-6.101 E4.36000
+G1 X-13.365 Y-6.810 E4.38000
+G1 X-12.990 Y-7.500 E4.40000
+G1 X-12.580 Y-8.170 E4.42000
+G1 X-12.135 Y-8.817 E4.44000
+G1 X-11.657 Y-9.440 E4.46000
+G1 X-11.147 Y-10.037 E4.48000
+G1 X-10.607 Y-10.607 E4.50000
+G1 X-10.037 Y-11.147 E4.52000
+G1 X-9.440 Y-11.657 E4.54000
+G1 X-8.817 Y-12.135 E4.56000
+G1 X-8.170 Y-12.580 E4.58000
+G1 X-7.500 Y-12.990 E4.60000
+G1 X-6.810 Y-13.365 E4.62000
+G1 X-6.101 Y-13.703 E4.64000
+G1 X-5.376 Y-14.004 E4.66000
+G1 X-4.635 Y-14.266 E4.68000
+G1 X-3.882 Y-14.489 E4.70000
+G1 X-3.119 Y-14.672 E4.72000
+G1 X-2.347 Y-14.815 E4.74000
+G1 X-1.568 Y-14.918 E4.76000
+G1 X-0.785 Y-14.979 E4.78000
+G1 X-0.000 Y-15.000 E4.80000
+G1 X0.785 Y-14.979 E4.82000
+G1 X1.568 Y-14.918 E4.84000
+G1 X2.347 Y-14.815 E4.86000
+G1 X3.119 Y-14.672 E4.88000
+G1 X3.882 Y-14.489 E4.90000
+G1 X4.635 Y-14.266 E4.92000
+G1 X5.376 Y-14.004 E4.94000
+G1 X6.101 Y-13.703 E4.96000
+G1 X6.810 Y-13.365 E4.98000
+G1 X7.500 Y-12.990 E5.00000
+G1 X8.170 Y-12.580 E5.02000
+G1 X8.817 Y-12.135 E5.04000
+G1 X9.440 Y-11.657 E5.06000
+G1 X10.037 Y-11.147 E5.08000
+G1 X10.607 Y-10.607 E5.10000
+G1 X11.147 Y-10.037 E5.12000
+G1 X11.657 Y-9.440 E5.14000
+G1 X12.135 Y-8.817 E5.16000
+G1 X12.580 Y-8.170 E5.18000
+G1 X12.990 Y-7.500 E5.20000
+G1 X13.365 Y-6.810 E5.22000
+G1 X13.703 Y-6.101 E5.24000
+G1 X14.004 Y-5.376 E5.26000
+G1 X14.266 Y-4.635 E5.28000
+G1 X14.489 Y-3.882 E5.30000
+G1 X14.672 Y-3.119 E5.32000
+G1 X14.815 Y-2.347 E5.34000
+G1 X14.918 Y-1.568 E5.36000
+G1 X14.979 Y-0.785 E5.38000
+G1 X15.000 Y-0.000 E5.40000
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E5.42000 F1800
+G1 X14.520 Y1.526 E5.44000
+G1 X14.420 Y2.284 E5.46000
+G1 X14.281 Y3.036 E5.48000
+G1 X14.103 Y3.779 E5.50000
+G1 X13.885 Y4.512 E5.52000
+G1 X13.630 Y5.232 E5.54000
+G1 X13.338 Y5.938 E5.56000
+G1 X13.009 Y6.628 E5.58000
+G1 X12.644 Y7.300 E5.60000
+G1 X12.245 Y7.952 E5.62000
+G1 X11.812 Y8.582 E5.64000
+G1 X11.346 Y9.188 E5.66000
+G1 X10.850 Y9.769 E5.68000
+G1 X10.324 Y10.324 E5.70000
+G1 X9.769 Y10.850 E5.72000
+G1 X9.188 Y11.346 E5.74000
+G1 X8.582 Y11.812 E5.76000
+G1 X7.952 Y12.245 E5.78000
+G1 X7.300 Y12.644 E5.80000
+G1 X6.628 Y13.009 E5.82000
+G1 X5.938 Y13.338 E5.84000
+G1 X5.232 Y13.630 E5.86000
+G1 X4.512 Y13.885 E5.88000
+G1 X3.779 Y14.103 E5.90000
+G1 X3.036 Y14.281 E5.92000
+G1 X2.284 Y14.420 E5.94000
+G1 X1.526 Y14.520 E5.96000
+G1 X0.764 Y14.580 E5.98000
+G1 X0.000 Y14.600 E6.00000
+G1 X-0.764 Y14.580 E6.02000
+G1 X-1.526 Y14.520 E6.04000
+G1 X-2.284 Y14.420 E6.06000
+G1 X-3.036 Y14.281 E6.08000
+G1 X-3.779 Y14.103 E6.10000
+G1 X-4.512 Y13.885 E6.12000
+G1 X-5.232 Y13.630 E6.14000
+G1 X-5.938 Y13.338 E6.16000
+G1 X-6.628 Y13.009 E6.18000
+G1 X-7.300 Y12.644 E6.20000
+G1 X-7.952 Y12.245 E6.22000
+G1 X-8.582 Y11.812 E6.24000
+G1 X-9.188 Y11.346 E6.26000
+G1 X-9.769 Y10.850 E6.28000
+G1 X-10.324 Y10.324 E6.30000
+G1 X-10.850 Y9.769 E6.32000
+G1 X-11.346 Y9.188 E6.34000
+G1 X-11.812 Y8.582 E6.36000
+G1 X-12.245 Y7.952 E6.38000
+G1 X-12.644 Y7.300 E6.40000
+G1 X-13.009 Y6.628 E6.42000
+G1 X-13.338 Y5.938 E6.44000
+G1 X-13.630 Y5.232 E6.46000
+G1 X-13.885 Y4.512 E6.48000
+G1 X-14.103 Y3.779 E6.50000
+G1 X-14.281 Y3.036 E6.52000
+G1 X-14.420 Y2.284 E6.54000
+G1 X-14.520 Y1.526 E6.56000
+G1 X-14.580 Y0.764 E6.58000
+G1 X-14.600 Y0.000 E6.60000
+G1 X-14.580 Y-0.764 E6.62000
+G1 X-14.520 Y-1.526 E6.64000
+G1 X-14.420 Y-2.284 E6.66000
+G1 X-14.281 Y-3.036 E6.68000
+G1 X-14.103 Y-3.779 E6.70000
+G1 X-13.885 Y-4.512 E6.72000
+G1 X-13.630 Y-5.232 E6.74000
+G1 X-13.338 Y-5.938 E6.76000
+G1 X-13.009 Y-6.628 E6.78000
+G1 X-12.644 Y-7.300 E6.80000
+G1 X-12.245 Y-7.952 E6.82000
+G1 X-11.812 Y-8.582 E6.84000
+G1 X-11.346 Y-9.188 E6.86000
+G1 X-10.850 Y-9.769 E6.88000
+G1 X-10.324 Y-10.324 E6.90000
+G1 X-9.769 Y-10.850 E6.92000
+G1 X-9.188 Y-11.346 E6.94000
+G1 X-8.582 Y-11.812 E6.96000
+G1 X-7.952 Y-12.245 E6.98000
+G1 X-7.300 Y-12.644 E7.00000
+G1 X-6.628 Y-13.009 E7.02000
+G1 X-5.938 Y-13.338 E7.04000
+G1 X-5.232 Y-13.630 E7.06000
+G1 X-4.512 Y-13.885 E7.08000
+G1 X-3.779 Y-14.103 E7.10000
+G1 X-3.036 Y-14.281 E7.12000
+G1 X-2.284 Y-14.420 E7.14000
+G1 X-1.526 Y-14.520 E7.16000
+G1 X-0.764 Y-14.580 E7.18000
+G1 X-0.000 Y-14.600 E7.20000
+G1 X0.764 Y-14.580 E7.22000
+G1 X1.526 Y-14.520 E7.24000
+G1 X2.284 Y-14.420 E7.26000
+G1 X3.036 Y-14.281 E7.28000
+G1 X3.779 Y-14.103 E7.30000
+G1 X4.512 Y-13.885 E7.32000
+G1 X5.232 Y-13.630 E7.34000
+G1 X5.938 Y-13.338 E7.36000
+G1 X6.628 Y-13.009 E7.38000
+G1 X7.300 Y-12.644 E7.40000
+G1 X7.952 Y-12.245 E7.42000
+G1 X8.582 Y-11.812 E7.44000
+G1 X9.188 Y-11.346 E7.46000
+G1 X9.769 Y-10.850 E7.48000
+G1 X10.324 Y-10.324 E7.50000
+G1 X10.850 Y-9.769 E7.52000
+G1 X11.346 Y-9.188 E7.54000
+G1 X11.812 Y-8.582 E7.56000
+G1 X12.245 Y-7.952 E7.58000
+G1 X12.644 Y-7.300 E7.60000
+G1 X13.009 Y-6.628 E7.62000
+G1 X13.338 Y-5.938 E7.64000
+G1 X13.630 Y-5.232 E7.66000
+G1 X13.885 Y-4.512 E7.68000
+G1 X14.103 Y-3.779 E7.70000
+G1 X14.281 Y-3.036 E7.72000
+G1 X14.420 Y-2.284 E7.74000
+G1 X14.520 Y-1.526 E7.76000
+G1 X14.580 Y-0.764 E7.78000
+G1 X14.600 Y-0.000 E7.80000
+G1 X5.713 Y-13.000 E7.80000 F7800
+G1 X-5.713 Y-13.000 E8.25705 F3600
+G1 X-7.592 Y-12.000 E8.25705 F7800
+G1 X7.592 Y-12.000 E8.86442 F3600
+G1 X8.980 Y-11.000 E8.86442 F7800
+G1 X-8.980 Y-11.000 E9.58282 F3600
+G1 X-10.082 Y-10.000 E9.58282 F7800
+G1 X10.082 Y-10.000 E10.38935 F3600
+G1 X10.984 Y-9.000 E10.38935 F7800
+G1 X-10.984 Y-9.000 E11.26804 F3600
+G1 X-11.732 Y-8.000 E11.26804 F7800
+G1 X11.732 Y-8.000 E12.20660 F3600
+G1 X12.355 Y-7.000 E12.20660 F7800
+G1 X-12.355 Y-7.000 E13.19498 F3600
+G1 X-12.870 Y-6.000 E13.19498 F7800
+G1 X12.870 Y-6.000 E14.22459 F3600
+G1 X13.291 Y-5.000 E14.22459 F7800
+G1 X-13.291 Y-5.000 E15.28784 F3600
+G1 X-13.625 Y-4.000 E15.28784 F7800
+G1 X13.625 Y-4.000 E16.37784 F3600
+G1 X13.879 Y-3.000 E16.37784 F7800
+G1 X-13.879 Y-3.000 E17.48820 F3600
+G1 X-14.058 Y-2.000 E17.48820 F7800
+G1 X14.058 Y-2.000 E18.61287 F3600
+G1 X14.165 Y-1.000 E18.61287 F7800
+G1 X-14.165 Y-1.000 E19.74605 F3600
+G1 X-14.200 Y0.000 E19.74605 F7800
+G1 X14.200 Y0.000 E20.88205 F3600
+G1 X14.165 Y1.000 E20.88205 F7800
+G1 X-14.165 Y1.000 E22.01523 F3600
+G1 X-14.058 Y2.000 E22.01523 F7800
+G1 X14.058 Y2.000 E23.13991 F3600
+G1 X13.879 Y3.000 E23.13991 F7800
+G1 X-13.879 Y3.000 E24.25027 F3600
+G1 X-13.625 Y4.000 E24.25027 F7800
+G1 X13.625 Y4.000 E25.34026 F3600
+G1 X13.291 Y5.000 E25.34026 F7800
+G1 X-13.291 Y5.000 E26.40351 F3600
+G1 X-12.870 Y6.000 E26.40351 F7800
+G1 X12.870 Y6.000 E27.43312 F3600
+G1 X12.355 Y7.000 E27.43312 F7800
+G1 X-12.355 Y7.000 E28.42150 F3600
+G1 X-11.732 Y8.000 E28.42150 F7800
+G1 X11.732 Y8.000 E29.36006 F3600
+G1 X10.984 Y9.000 E29.36006 F7800
+G1 X-10.984 Y9.000 E30.23875 F3600
+G1 X-10.082 Y10.000 E30.23875 F7800
+G1 X10.082 Y10.000 E31.04529 F3600
+G1 X8.980 Y11.000 E31.04529 F7800
+G1 X-8.980 Y11.000 E31.76368 F3600
+G1 X-7.592 Y12.000 E31.76368 F7800
+G1 X7.592 Y12.000 E32.37105 F3600
+G1 X5.713 Y13.000 E32.37105 F7800
+G1 X-5.713 Y13.000 E32.82810 F3600
+G1 Z0.500 F7800
+G1 E31.82810 F2400
+G1 E32.82810 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E32.84810 F1800
+G1 X14.918 Y1.568 E32.86810
+G1 X14.815 Y2.347 E32.88810
+G1 X14.672 Y3.119 E32.90810
+G1 X14.489 Y3.882 E32.92810
+G1 X14.266 Y4.635 E32.94810
+G1 X14.004 Y5.376 E32.96810
+G1 X13.703 Y6.101 E32.98810
+G1 X13.365 Y6.810 E33.00810
+G1 X12.990 Y7.500 E33.02810
+G1 X12.580 Y8.170 E33.04810
+G1 X12.135 Y8.817 E33.06810
+G1 X11.657 Y9.440 E33.08810
+G1 X11.147 Y10.037 E33.10810
+G1 X10.607 Y10.607 E33.12810
+G1 X10.037 Y11.147 E33.14810
+G1 X9.440 Y11.657 E33.16810
+G1 X8.817 Y12.135 E33.18810
+G1 X8.170 Y12.580 E33.20810
+G1 X7.500 Y12.990 E33.22810
+G1 X6.810 Y13.365 E33.24810
+G1 X6.101 Y13.703 E33.26810
+G1 X5.376 Y14.004 E33.28810
+G1 X4.635 Y14.266 E33.30810
+G1 X3.882 Y14.489 E33.32810
+G1 X3.119 Y14.672 E33.34810
+G1 X2.347 Y14.815 E33.36810
+G1 X1.568 Y14.918 E33.38810
+G1 X0.785 Y14.979 E33.40810
+G1 X0.000 Y15.000 E33.42810
+G1 X-0.785 Y14.979 E33.44810
+G1 X-1.568 Y14.918 E33.46810
+G1 X-2.347 Y14.815 E33.48810
+G1 X-3.119 Y14.672 E33.50810
+G1 X-3.882 Y14.489 E33.52810
+G1 X-4.635 Y14.266 E33.54810
+G1 X-5.376 Y14.004 E33.56810
+G1 X-6.101 Y13.703 E33.58810
+G1 X-6.810 Y13.365 E33.60810
+G1 X-7.500 Y12.990 E33.62810
+G1 X-8.170 Y12.580 E33.64810
+G1 X-8.817 Y12.135 E33.66810
+G1 X-9.440 Y11.657 E33.68810
+G1 X-10.037 Y11.147 E33.70810
+G1 X-10.607 Y10.607 E33.72810
+G1 X-11.147 Y10.037 E33.74810
+G1 X-11.657 Y9.440 E33.76810
+G1 X-12.135 Y8.817 E33.78810
+G1 X-12.580 Y8.170 E33.80810
+G1 X-12.990 Y7.500 E33.82810
+G1 X-13.365 Y6.810 E33.84810
+G1 X-13.703 Y6.101 E33.86810
+G1 X-14.004 Y5.376 E33.88810
+G1 X-14.266 Y4.635 E33.90810
+G1 X-14.489 Y3.882 E33.92810
+G1 X-14.672 Y3.119 E33.94810
+G1 X-14.815 Y2.347 E33.96810
+G1 X-14.918 Y1.568 E33.98810
+G1 X-14.979 Y0.785 E34.00810
+G1 X-15.000 Y0.000 E34.02810
+G1 X-14.979 Y-0.785 E34.04810
+G1 X-14.918 Y-1.568 E34.06810
+G1 X-14.815 Y-2.347 E34.08810
+G1 X-14.672 Y-3.119 E34.10810
+G1 X-14.489 Y-3.882 E34.12810
+G1 X-14.266 Y-4.635 E34.14810
+G1 X-14.004 Y-5.376 E34.16810
+G1 X-13.703 Y-6.101 E34.18810
+G1 X-13.365 Y-6.810 E34.20810
+G1 X-12.990 Y-7.500 E34.22810
+G1 X-12.580 Y-8.170 E34.24810
+G1 X-12.135 Y-8.817 E34.26810
+G1 X-11.657 Y-9.440 E34.28810
+G1 X-11.147 Y-10.037 E34.30810
+G1 X-10.607 Y-10.607 E34.32810
+G1 X-10.037 Y-11.147 E34.34810
+G1 X-9.440 Y-11.657 E34.36810
+G1 X-8.817 Y-12.135 E34.38810
+G1 X-8.170 Y-12.580 E34.40810
+G1 X-7.500 Y-12.990 E34.42810
+G1 X-6.810 Y-13.365 E34.44810
+G1 X-6.101 Y-13.703 E34.46810
+G1 X-5.376 Y-14.004 E34.48810
+G1 X-4.635 Y-14.266 E34.50810
+G1 X-3.882 Y-14.489 E34.52810
+G1 X-3.119 Y-14.672 E34.54810
+G1 X-2.347 Y-14.815 E34.56810
+G1 X-1.568 Y-14.918 E34.58810
+G1 X-0.785 Y-14.979 E34.60810
+G1 X-0.000 Y-15.000 E34.62810
+G1 X0.785 Y-14.979 E34.64810
+G1 X1.568 Y-14.918 E34.66810
+G1 X2.347 Y-14.815 E34.68810
+G1 X3.119 Y-14.672 E34.70810
+G1 X3.882 Y-14.489 E34.72810
+G1 X4.635 Y-14.266 E34.74810
+G1 X5.376 Y-14.004 E34.76810
+G1 X6.101 Y-13.703 E34.78810
+G1 X6.810 Y-13.365 E34.80810
+G1 X7.500 Y-12.990 E34.82810
+G1 X8.170 Y-12.580 E34.84810
+G1 X8.817 Y-12.135 E34.86810
+G1 X9.440 Y-11.657 E34.88810
+G1 X10.037 Y-11.147 E34.90810
+G1 X10.607 Y-10.607 E34.92810
+G1 X11.147 Y-10.037 E34.94810
+G1 X11.657 Y-9.440 E34.96810
+G1 X12.135 Y-8.817 E34.98810
+G1 X12.580 Y-8.170 E35.00810
+G1 X12.990 Y-7.500 E35.02810
+G1 X13.365 Y-6.810 E35.04810
+G1 X13.703 Y-6.101 E35.06810
+G1 X14.004 Y-5.376 E35.08810
+G1 X14.266 Y-4.635 E35.10810
+G1 X14.489 Y-3.882 E35.12810
+G1 X14.672 Y-3.119 E35.14810
+G1 X14.815 Y-2.347 E35.16810
+G1 X14.918 Y-1.568 E35.18810
+G1 X14.979 Y-0.785 E35.20810
+G1 X15.000 Y-0.000 E35.22810
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E35.24810 F1800
+G1 X14.520 Y1.526 E35.26810
+G1 X14.420 Y2.284 E35.28810
+G1 X14.281 Y3.036 E35.30810
+G1 X14.103 Y3.779 E35.32810
+G1 X13.885 Y4.512 E35.34810
+G1 X13.630 Y5.232 E35.36810
+G1 X13.338 Y5.938 E35.38810
+G1 X13.009 Y6.628 E35.40810
+G1 X12.644 Y7.300 E35.42810
+G1 X12.245 Y7.952 E35.44810
+G1 X11.812 Y8.582 E35.46810
+G1 X11.346 Y9.188 E35.48810
+G1 X10.850 Y9.769 E35.50810
+G1 X10.324 Y10.324 E35.52810
+G1 X9.769 Y10.850 E35.54810
+G1 X9.188 Y11.346 E35.56810
+G1 X8.582 Y11.812 E35.58810
+G1 X7.952 Y12.245 E35.60810
+G1 X7.300 Y12.644 E35.62810
+G1 X6.628 Y13.009 E35.64810
+G1 X5.938 Y13.338 E35.66810
+G1 X5.232 Y13.630 E35.68810
+G1 X4.512 Y13.885 E35.70810
+G1 X3.779 Y14.103 E35.72810
+G1 X3.036 Y14.281 E35.74810
+G1 X2.284 Y14.420 E35.76810
+G1 X1.526 Y14.520 E35.78810
+G1 X0.764 Y14.580 E35.80810
+G1 X0.000 Y14.600 E35.82810
+G1 X-0.764 Y14.580 E35.84810
+G1 X-1.526 Y14.520 E35.86810
+G1 X-2.284 Y14.420 E35.88810
+G1 X-3.036 Y14.281 E35.90810
+G1 X-3.779 Y14.103 E35.92810
+G1 X-4.512 Y13.885 E35.94810
+G1 X-5.232 Y13.630 E35.96810
+G1 X-5.938 Y13.338 E35.98810
+G1 X-6.628 Y13.009 E36.00810
+G1 X-7.300 Y12.644 E36.02810
+G1 X-7.952 Y12.245 E36.04810
+G1 X-8.582 Y11.812 E36.06810
+G1 X-9.188 Y11.346 E36.08810
+G1 X-9.769 Y10.850 E36.10810
+G1 X-10.324 Y10.324 E36.12810
+G1 X-10.850 Y9.769 E36.14810
+G1 X-11.346 Y9.188 E36.16810
+G1 X-11.812 Y8.582 E36.18810
+G1 X-12.245 Y7.952 E36.20810
+G1 X-12.644 Y7.300 E36.22810
+G1 X-13.009 Y6.628 E36.24810
+G1 X-13.338 Y5.938 E36.26810
+G1 X-13.630 Y5.232 E36.28810
+G1 X-13.885 Y4.512 E36.30810
+G1 X-14.103 Y3.779 E36.32810
+G1 X-14.281 Y3.036 E36.34810
+G1 X-14.420 Y2.284 E36.36810
+G1 X-14.520 Y1.526 E36.38810
+G1 X-14.580 Y0.764 E36.40810
+G1 X-14.600 Y0.000 E36.42810
+G1 X-14.580 Y-0.764 E36.44810
+G1 X-14.520 Y-1.526 E36.46810
+G1 X-14.420 Y-2.284 E36.48810
+G1 X-14.281 Y-3.036 E36.50810
+G1 X-14.103 Y-3.779 E36.52810
+G1 X-13.885 Y-4.512 E36.54810
+G1 X-13.630 Y-5.232 E36.56810
+G1 X-13.338 Y-5.938 E36.58810
+G1 X-13.009 Y-6.628 E36.60810
+G1 X-12.644 Y-7.300 E36.62810
+G1 X-12.245 Y-7.952 E36.64810
+G1 X-11.812 Y-8.582 E36.66810
+G1 X-11.346 Y-9.188 E36.68810
+G1 X-10.850 Y-9.769 E36.70810
+G1 X-10.324 Y-10.324 E36.72810
+G1 X-9.769 Y-10.850 E36.74810
+G1 X-9.188 Y-11.346 E36.76810
+G1 X-8.582 Y-11.812 E36.78810
+G1 X-7.952 Y-12.245 E36.80810
+G1 X-7.300 Y-12.644 E36.82810
+G1 X-6.628 Y-13.009 E36.84810
+G1 X-5.938 Y-13.338 E36.86810
+G1 X-5.232 Y-13.630 E36.88810
+G1 X-4.512 Y-13.885 E36.90810
+G1 X-3.779 Y-14.103 E36.92810
+G1 X-3.036 Y-14.281 E36.94810
+G1 X-2.284 Y-14.420 E36.96810
+G1 X-1.526 Y-14.520 E36.98810
+G1 X-0.764 Y-14.580 E37.00810
+G1 X-0.000 Y-14.600 E37.02810
+G1 X0.764 Y-14.580 E37.04810
+G1 X1.526 Y-14.520 E37.06810
+G1 X2.284 Y-14.420 E37.08810
+G1 X3.036 Y-14.281 E37.10810
+G1 X3.779 Y-14.103 E37.12810
+G1 X4.512 Y-13.885 E37.14810
+G1 X5.232 Y-13.630 E37.16810
+G1 X5.938 Y-13.338 E37.18810
+G1 X6.628 Y-13.009 E37.20810
+G1 X7.300 Y-12.644 E37.22810
+G1 X7.952 Y-12.245 E37.24810
+G1 X8.582 Y-11.812 E37.26810
+G1 X9.188 Y-11.346 E37.28810
+G1 X9.769 Y-10.850 E37.30810
+G1 X10.324 Y-10.324 E37.32810
+G1 X10.850 Y-9.769 E37.34810
+G1 X11.346 Y-9.188 E37.36810
+G1 X11.812 Y-8.582 E37.38810
+G1 X12.245 Y-7.952 E37.40810
+G1 X12.644 Y-7.300 E37.42810
+G1 X13.009 Y-6.628 E37.44810
+G1 X13.338 Y-5.938 E37.46810
+G1 X13.630 Y-5.232 E37.48810
+G1 X13.885 Y-4.512 E37.50810
+G1 X14.103 Y-3.779 E37.52810
+G1 X14.281 Y-3.036 E37.54810
+G1 X14.420 Y-2.284 E37.56810
+G1 X14.520 Y-1.526 E37.58810
+G1 X14.580 Y-0.764 E37.60810
+G1 X14.600 Y-0.000 E37.62810
+G1 X5.713 Y-13.000 E37.62810 F7800
+G1 X-5.713 Y-13.000 E38.08515 F3600
+G1 X-7.592 Y-12.000 E38.08515 F7800
+G1 X7.592 Y-12.000 E38.69252 F3600
+G1 X8.980 Y-11.000 E38.69252 F7800
+G1 X-8.980 Y-11.000 E39.41092 F3600
+G1 X-10.082 Y-10.000 E39.41092 F7800
+G1 X10.082 Y-10.000 E40.21745 F3600
+G1 X10.984 Y-9.000 E40.21745 F7800
+G1 X-10.984 Y-9.000 E41.09614 F3600
+G1 X-11.732 Y-8.000 E41.09614 F7800
+G1 X11.732 Y-8.000 E42.03471 F3600
+G1 X12.355 Y-7.000 E42.03471 F7800
+G1 X-12.355 Y-7.000 E43.02309 F3600
+G1 X-12.870 Y-6.000 E43.02309 F7800
+G1 X12.870 Y-6.000 E44.05270 F3600
+G1 X13.291 Y-5.000 E44.05270 F7800
+G1 X-13.291 Y-5.000 E45.11594 F3600
+G1 X-13.625 Y-4.000 E45.11594 F7800
+G1 X13.625 Y-4.000 E46.20594 F3600
+G1 X13.879 Y-3.000 E46.20594 F7800
+G1 X-13.879 Y-3.000 E47.31630 F3600
+G1 X-14.058 Y-2.000 E47.31630 F7800
+G1 X14.058 Y-2.000 E48.44098 F3600
+G1 X14.165 Y-1.000 E48.44098 F7800
+G1 X-14.165 Y-1.000 E49.57416 F3600
+G1 X-14.200 Y0.000 E49.57416 F7800
+G1 X14.200 Y0.000 E50.71016 F3600
+G1 X14.165 Y1.000 E50.71016 F7800
+G1 X-14.165 Y1.000 E51.84333 F3600
+G1 X-14.058 Y2.000 E51.84333 F7800
+G1 X14.058 Y2.000 E52.96801 F3600
+G1 X13.879 Y3.000 E52.96801 F7800
+G1 X-13.879 Y3.000 E54.07837 F3600
+G1 X-13.625 Y4.000 E54.07837 F7800
+G1 X13.625 Y4.000 E55.16837 F3600
+G1 X13.291 Y5.000 E55.16837 F7800
+G1 X-13.291 Y5.000 E56.23162 F3600
+G1 X-12.870 Y6.000 E56.23162 F7800
+G1 X12.870 Y6.000 E57.26123 F3600
+G1 X12.355 Y7.000 E57.26123 F7800
+G1 X-12.355 Y7.000 E58.24961 F3600
+G1 X-11.732 Y8.000 E58.24961 F7800
+G1 X11.732 Y8.000 E59.18817 F3600
+G1 X10.984 Y9.000 E59.18817 F7800
+G1 X-10.984 Y9.000 E60.06686 F3600
+G1 X-10.082 Y10.000 E60.06686 F7800
+G1 X10.082 Y10.000 E60.87339 F3600
+G1 X8.980 Y11.000 E60.87339 F7800
+G1 X-8.980 Y11.000 E61.59179 F3600
+G1 X-7.592 Y12.000 E61.59179 F7800
+G1 X7.592 Y12.000 E62.19916 F3600
+G1 X5.713 Y13.000 E62.19916 F7800
+G1 X-5.713 Y13.000 E62.65621 F3600
+G1 Z0.700 F7800
+G1 E61.65621 F2400
+G1 E62.65621 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E62.67621 F1800
+G1 X14.918 Y1.568 E62.69621
+G1 X14.815 Y2.347 E62.71621
+G1 X14.672 Y3.119 E62.73621
+G1 X14.489 Y3.882 E62.75621
+G1 X14.266 Y4.635 E62.77621
+G1 X14.004 Y5.376 E62.79621
+G1 X13.703 Y6.101 E62.81621
+G1 X13.365 Y6.810 E62.83621
+G1 X12.990 Y7.500 E62.85621
+G1 X12.580 Y8.170 E62.87621
+G1 X12.135 Y8.817 E62.89621
+G1 X11.657 Y9.440 E62.91621
+G1 X11.147 Y10.037 E62.93621
+G1 X10.607 Y10.607 E62.95621
+G1 X10.037 Y11.147 E62.97621
+G1 X9.440 Y11.657 E62.99621
+G1 X8.817 Y12.135 E63.01621
+G1 X8.170 Y12.580 E63.03621
+G1 X7.500 Y12.990 E63.05621
+G1 X6.810 Y13.365 E63.07621
+G1 X6.101 Y13.703 E63.09621
+G1 X5.376 Y14.004 E63.11621
+G1 X4.635 Y14.266 E63.13621
+G1 X3.882 Y14.489 E63.15621
+G1 X3.119 Y14.672 E63.17621
+G1 X2.347 Y14.815 E63.19621
+G1 X1.568 Y14.918 E63.21621
+G1 X0.785 Y14.979 E63.23621
+G1 X0.000 Y15.000 E63.25621
+G1 X-0.785 Y14.979 E63.27621
+G1 X-1.568 Y14.918 E63.29621
+G1 X-2.347 Y14.815 E63.31621
+G1 X-3.119 Y14.672 E63.33621
+G1 X-3.882 Y14.489 E63.35621
+G1 X-4.635 Y14.266 E63.37621
+G1 X-5.376 Y14.004 E63.39621
+G1 X-6.101 Y13.703 E63.41621
+G1 X-6.810 Y13.365 E63.43621
+G1 X-7.500 Y12.990 E63.45621
+G1 X-8.170 Y12.580 E63.47621
+G1 X-8.817 Y12.135 E63.49621
+G1 X-9.440 Y11.657 E63.51621
+G1 X-10.037 Y11.147 E63.53621
+G1 X-10.607 Y10.607 E63.55621
+G1 X-11.147 Y10.037 E63.57621
+G1 X-11.657 Y9.440 E63.59621
+G1 X-12.135 Y8.817 E63.61621
+G1 X-12.580 Y8.170 E63.63621
+G1 X-12.990 Y7.500 E63.65621
+G1 X-13.365 Y6.810 E63.67621
+G1 X-13.703 Y6.101 E63.69621
+G1 X-14.004 Y5.376 E63.71621
+G1 X-14.266 Y4.635 E63.73621
+G1 X-14.489 Y3.882 E63.75621
+G1 X-14.672 Y3.119 E63.77621
+G1 X-14.815 Y2.347 E63.79621
+G1 X-14.918 Y1.568 E63.81621
+G1 X-14.979 Y0.785 E63.83621
+G1 X-15.000 Y0.000 E63.85621
+G1 X-14.979 Y-0.785 E63.87621
+G1 X-14.918 Y-1.568 E63.89621
+G1 X-14.815 Y-2.347 E63.91621
+G1 X-14.672 Y-3.119 E63.93621
+G1 X-14.489 Y-3.882 E63.95621
+G1 X-14.266 Y-4.635 E63.97621
+G1 X-14.004 Y-5.376 E63.99621
+G1 X-13.703 Y-6.101 E64.01621
+G1 X-13.365 Y-6.810 E64.03621
+G1 X-12.990 Y-7.500 E64.05621
+G1 X-12.580 Y-8.170 E64.07621
+G1 X-12.135 Y-8.817 E64.09621
+G1 X-11.657 Y-9.440 E64.11621
+G1 X-11.147 Y-10.037 E64.13621
+G1 X-10.607 Y-10.607 E64.15621
+G1 X-10.037 Y-11.147 E64.17621
+G1 X-9.440 Y-11.657 E64.19621
+G1 X-8.817 Y-12.135 E64.21621
+G1 X-8.170 Y-12.580 E64.23621
+G1 X-7.500 Y-12.990 E64.25621
+G1 X-6.810 Y-13.365 E64.27621
+G1 X-6.101 Y-13.703 E64.29621
+G1 X-5.376 Y-14.004 E64.31621
+G1 X-4.635 Y-14.266 E64.33621
+G1 X-3.882 Y-14.489 E64.35621
+G1 X-3.119 Y-14.672 E64.37621
+G1 X-2.347 Y-14.815 E64.39621
+G1 X-1.568 Y-14.918 E64.41621
+G1 X-0.785 Y-14.979 E64.43621
+G1 X-0.000 Y-15.000 E64.45621
+G1 X0.785 Y-14.979 E64.47621
+G1 X1.568 Y-14.918 E64.49621
+G1 X2.347 Y-14.815 E64.51621
+G1 X3.119 Y-14.672 E64.53621
+G1 X3.882 Y-14.489 E64.55621
+G1 X4.635 Y-14.266 E64.57621
+G1 X5.376 Y-14.004 E64.59621
+G1 X6.101 Y-13.703 E64.61621
+G1 X6.810 Y-13.365 E64.63621
+G1 X7.500 Y-12.990 E64.65621
+G1 X8.170 Y-12.580 E64.67621
+G1 X8.817 Y-12.135 E64.69621
+G1 X9.440 Y-11.657 E64.71621
+G1 X10.037 Y-11.147 E64.73621
+G1 X10.607 Y-10.607 E64.75621
+G1 X11.147 Y-10.037 E64.77621
+G1 X11.657 Y-9.440 E64.79621
+G1 X12.135 Y-8.817 E64.81621
+G1 X12.580 Y-8.170 E64.83621
+G1 X12.990 Y-7.500 E64.85621
+G1 X13.365 Y-6.810 E64.87621
+G1 X13.703 Y-6.101 E64.89621
+G1 X14.004 Y-5.376 E64.91621
+G1 X14.266 Y-4.635 E64.93621
+G1 X14.489 Y-3.882 E64.95621
+G1 X14.672 Y-3.119 E64.97621
+G1 X14.815 Y-2.347 E64.99621
+G1 X14.918 Y-1.568 E65.01621
+G1 X14.979 Y-0.785 E65.03621
+G1 X15.000 Y-0.000 E65.05621
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E65.07621 F1800
+G1 X14.520 Y1.526 E65.09621
+G1 X14.420 Y2.284 E65.11621
+G1 X14.281 Y3.036 E65.13621
+G1 X14.103 Y3.779 E65.15621
+G1 X13.885 Y4.512 E65.17621
+G1 X13.630 Y5.232 E65.19621
+G1 X13.338 Y5.938 E65.21621
+G1 X13.009 Y6.628 E65.23621
+G1 X12.644 Y7.300 E65.25621
+G1 X12.245 Y7.952 E65.27621
+G1 X11.812 Y8.582 E65.29621
+G1 X11.346 Y9.188 E65.31621
+G1 X10.850 Y9.769 E65.33621
+G1 X10.324 Y10.324 E65.35621
+G1 X9.769 Y10.850 E65.37621
+G1 X9.188 Y11.346 E65.39621
+G1 X8.582 Y11.812 E65.41621
+G1 X7.952 Y12.245 E65.43621
+G1 X7.300 Y12.644 E65.45621
+G1 X6.628 Y13.009 E65.47621
+G1 X5.938 Y13.338 E65.49621
+G1 X5.232 Y13.630 E65.51621
+G1 X4.512 Y13.885 E65.53621
+G1 X3.779 Y14.103 E65.55621
+G1 X3.036 Y14.281 E65.57621
+G1 X2.284 Y14.420 E65.59621
+G1 X1.526 Y14.520 E65.61621
+G1 X0.764 Y14.580 E65.63621
+G1 X0.000 Y14.600 E65.65621
+G1 X-0.764 Y14.580 E65.67621
+G1 X-1.526 Y14.520 E65.69621
+G1 X-2.284 Y14.420 E65.71621
+G1 X-3.036 Y14.281 E65.73621
+G1 X-3.779 Y14.103 E65.75621
+G1 X-4.512 Y13.885 E65.77621
+G1 X-5.232 Y13.630 E65.79621
+G1 X-5.938 Y13.338 E65.81621
+G1 X-6.628 Y13.009 E65.83621
+G1 X-7.300 Y12.644 E65.85621
+G1 X-7.952 Y12.245 E65.87621
+G1 X-8.582 Y11.812 E65.89621
+G1 X-9.188 Y11.346 E65.91621
+G1 X-9.769 Y10.850 E65.93621
+G1 X-10.324 Y10.324 E65.95621
+G1 X-10.850 Y9.769 E65.97621
+G1 X-11.346 Y9.188 E65.99621
+G1 X-11.812 Y8.582 E66.01621
+G1 X-12.245 Y7.952 E66.03621
+G1 X-12.644 Y7.300 E66.05621
+G1 X-13.009 Y6.628 E66.07621
+G1 X-13.338 Y5.938 E66.09621
+G1 X-13.630 Y5.232 E66.11621
+G1 X-13.885 Y4.512 E66.13621
+G1 X-14.103 Y3.779 E66.15621
+G1 X-14.281 Y3.036 E66.17621
+G1 X-14.420 Y2.284 E66.19621
+G1 X-14.520 Y1.526 E66.21621
+G1 X-14.580 Y0.764 E66.23621
+G1 X-14.600 Y0.000 E66.25621
+G1 X-14.580 Y-0.764 E66.27621
+G1 X-14.520 Y-1.526 E66.29621
+G1 X-14.420 Y-2.284 E66.31621
+G1 X-14.281 Y-3.036 E66.33621
+G1 X-14.103 Y-3.779 E66.35621
+G1 X-13.885 Y-4.512 E66.37621
+G1 X-13.630 Y-5.232 E66.39621
+G1 X-13.338 Y-5.938 E66.41621
+G1 X-13.009 Y-6.628 E66.43621
+G1 X-12.644 Y-7.300 E66.45621
+G1 X-12.245 Y-7.952 E66.47621
+G1 X-11.812 Y-8.582 E66.49621
+G1 X-11.346 Y-9.188 E66.51621
+G1 X-10.850 Y-9.769 E66.53621
+G1 X-10.324 Y-10.324 E66.55621
+G1 X-9.769 Y-10.850 E66.57621
+G1 X-9.188 Y-11.346 E66.59621
+G1 X-8.582 Y-11.812 E66.61621
+G1 X-7.952 Y-12.245 E66.63621
+G1 X-7.300 Y-12.644 E66.65621
+G1 X-6.628 Y-13.009 E66.67621
+G1 X-5.938 Y-13.338 E66.69621
+G1 X-5.232 Y-13.630 E66.71621
+G1 X-4.512 Y-13.885 E66.73621
+G1 X-3.779 Y-14.103 E66.75621
+G1 X-3.036 Y-14.281 E66.77621
+G1 X-2.284 Y-14.420 E66.79621
+G1 X-1.526 Y-14.520 E66.81621
+G1 X-0.764 Y-14.580 E66.83621
+G1 X-0.000 Y-14.600 E66.85621
+G1 X0.764 Y-14.580 E66.87621
+G1 X1.526 Y-14.520 E66.89621
+G1 X2.284 Y-14.420 E66.91621
+G1 X3.036 Y-14.281 E66.93621
+G1 X3.779 Y-14.103 E66.95621
+G1 X4.512 Y-13.885 E66.97621
+G1 X5.232 Y-13.630 E66.99621
+G1 X5.938 Y-13.338 E67.01621
+G1 X6.628 Y-13.009 E67.03621
+G1 X7.300 Y-12.644 E67.05621
+G1 X7.952 Y-12.245 E67.07621
+G1 X8.582 Y-11.812 E67.09621
+G1 X9.188 Y-11.346 E67.11621
+G1 X9.769 Y-10.850 E67.13621
+G1 X10.324 Y-10.324 E67.15621
+G1 X10.850 Y-9.769 E67.17621
+G1 X11.346 Y-9.188 E67.19621
+G1 X11.812 Y-8.582 E67.21621
+G1 X12.245 Y-7.952 E67.23621
+G1 X12.644 Y-7.300 E67.25621
+G1 X13.009 Y-6.628 E67.27621
+G1 X13.338 Y-5.938 E67.29621
+G1 X13.630 Y-5.232 E67.31621
+G1 X13.885 Y-4.512 E67.33621
+G1 X14.103 Y-3.779 E67.35621
+G1 X14.281 Y-3.036 E67.37621
+G1 X14.420 Y-2.284 E67.39621
+G1 X14.520 Y-1.526 E67.41621
+G1 X14.580 Y-0.764 E67.43621
+G1 X14.600 Y-0.000 E67.45621
+G1 X5.713 Y-13.000 E67.45621 F7800
+G1 X-5.713 Y-13.000 E67.91326 F3600
+G1 X-7.592 Y-12.000 E67.91326 F7800
+G1 X7.592 Y-12.000 E68.52063 F3600
+G1 X8.980 Y-11.000 E68.52063 F7800
+G1 X-8.980 Y-11.000 E69.23902 F3600
+G1 X-10.082 Y-10.000 E69.23902 F7800
+G1 X10.082 Y-10.000 E70.04556 F3600
+G1 X10.984 Y-9.000 E70.04556 F7800
+G1 X-10.984 Y-9.000 E70.92425 F3600
+G1 X-11.732 Y-8.000 E70.92425 F7800
+G1 X11.732 Y-8.000 E71.86281 F3600
+G1 X12.355 Y-7.000 E71.86281 F7800
+G1 X-12.355 Y-7.000 E72.85119 F3600
+G1 X-12.870 Y-6.000 E72.85119 F7800
+G1 X12.870 Y-6.000 E73.88080 F3600
+G1 X13.291 Y-5.000 E73.88080 F7800
+G1 X-13.291 Y-5.000 E74.94405 F3600
+G1 X-13.625 Y-4.000 E74.94405 F7800
+G1 X13.625 Y-4.000 E76.03404 F3600
+G1 X13.879 Y-3.000 E76.03404 F7800
+G1 X-13.879 Y-3.000 E77.14440 F3600
+G1 X-14.058 Y-2.000 E77.14440 F7800
+G1 X14.058 Y-2.000 E78.26908 F3600
+G1 X14.165 Y-1.000 E78.26908 F7800
+G1 X-14.165 Y-1.000 E79.40226 F3600
+G1 X-14.200 Y0.000 E79.40226 F7800
+G1 X14.200 Y0.000 E80.53826 F3600
+G1 X14.165 Y1.000 E80.53826 F7800
+G1 X-14.165 Y1.000 E81.67144 F3600
+G1 X-14.058 Y2.000 E81.67144 F7800
+G1 X14.058 Y2.000 E82.79611 F3600
+G1 X13.879 Y3.000 E82.79611 F7800
+G1 X-13.879 Y3.000 E83.90647 F3600
+G1 X-13.625 Y4.000 E83.90647 F7800
+G1 X13.625 Y4.000 E84.99647 F3600
+G1 X13.291 Y5.000 E84.99647 F7800
+G1 X-13.291 Y5.000 E86.05972 F3600
+G1 X-12.870 Y6.000 E86.05972 F7800
+G1 X12.870 Y6.000 E87.08933 F3600
+G1 X12.355 Y7.000 E87.08933 F7800
+G1 X-12.355 Y7.000 E88.07771 F3600
+G1 X-11.732 Y8.000 E88.07771 F7800
+G1 X11.732 Y8.000 E89.01627 F3600
+G1 X10.984 Y9.000 E89.01627 F7800
+G1 X-10.984 Y9.000 E89.89496 F3600
+G1 X-10.082 Y10.000 E89.89496 F7800
+G1 X10.082 Y10.000 E90.70149 F3600
+G1 X8.980 Y11.000 E90.70149 F7800
+G1 X-8.980 Y11.000 E91.41989 F3600
+G1 X-7.592 Y12.000 E91.41989 F7800
+G1 X7.592 Y12.000 E92.02726 F3600
+G1 X5.713 Y13.000 E92.02726 F7800
+G1 X-5.713 Y13.000 E92.48431 F3600
+G1 Z0.900 F7800
+G1 E91.48431 F2400
+G1 E92.48431 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E92.50431 F1800
+G1 X14.918 Y1.568 E92.52431
+G1 X14.815 Y2.347 E92.54431
+G1 X14.672 Y3.119 E92.56431
+G1 X14.489 Y3.882 E92.58431
+G1 X14.266 Y4.635 E92.60431
+G1 X14.004 Y5.376 E92.62431
+G1 X13.703 Y6.101 E92.64431
+G1 X13.365 Y6.810 E92.66431
+G1 X12.990 Y7.500 E92.68431
+G1 X12.580 Y8.170 E92.70431
+G1 X12.135 Y8.817 E92.72431
+G1 X11.657 Y9.440 E92.74431
+G1 X11.147 Y10.037 E92.76431
+G1 X10.607 Y10.607 E92.78431
+G1 X10.037 Y11.147 E92.80431
+G1 X9.440 Y11.657 E92.82431
+G1 X8.817 Y12.135 E92.84431
+G1 X8.170 Y12.580 E92.86431
+G1 X7.500 Y12.990 E92.88431
+G1 X6.810 Y13.365 E92.90431
+G1 X6.101 Y13.703 E92.92431
+G1 X5.376 Y14.004 E92.94431
+G1 X4.635 Y14.266 E92.96431
+G1 X3.882 Y14.489 E92.98431
+G1 X3.119 Y14.672 E93.00431
+G1 X2.347 Y14.815 E93.02431
+G1 X1.568 Y14.918 E93.04431
+G1 X0.785 Y14.979 E93.06431
+G1 X0.000 Y15.000 E93.08431
+G1 X-0.785 Y14.979 E93.10431
+G1 X-1.568 Y14.918 E93.12431
+G1 X-2.347 Y14.815 E93.14431
+G1 X-3.119 Y14.672 E93.16431
+G1 X-3.882 Y14.489 E93.18431
+G1 X-4.635 Y14.266 E93.20431
+G1 X-5.376 Y14.004 E93.22431
+G1 X-6.101 Y13.703 E93.24431
+G1 X-6.810 Y13.365 E93.26431
+G1 X-7.500 Y12.990 E93.28431
+G1 X-8.170 Y12.580 E93.30431
+G1 X-8.817 Y12.135 E93.32431
+G1 X-9.440 Y11.657 E93.34431
+G1 X-10.037 Y11.147 E93.36431
+G1 X-10.607 Y10.607 E93.38431
+G1 X-11.147 Y10.037 E93.40431
+G1 X-11.657 Y9.440 E93.42431
+G1 X-12.135 Y8.817 E93.44431
+G1 X-12.580 Y8.170 E93.46431
+G1 X-12.990 Y7.500 E93.48431
+G1 X-13.365 Y6.810 E93.50431
+G1 X-13.703 Y6.101 E93.52431
+G1 X-14.004 Y5.376 E93.54431
+G1 X-14.266 Y4.635 E93.56431
+G1 X-14.489 Y3.882 E93.58431
+G1 X-14.672 Y3.119 E93.60431
+G1 X-14.815 Y2.347 E93.62431
+G1 X-14.918 Y1.568 E93.64431
+G1 X-14.979 Y0.785 E93.66431
+G1 X-15.000 Y0.000 E93.68431
+G1 X-14.979 Y-0.785 E93.70431
+G1 X-14.918 Y-1.568 E93.72431
+G1 X-14.815 Y-2.347 E93.74431
+G1 X-14.672 Y-3.119 E93.76431
+G1 X-14.489 Y-3.882 E93.78431
+G1 X-14.266 Y-4.635 E93.80431
+G1 X-14.004 Y-5.376 E93.82431
+G1 X-13.703 Y-6.101 E93.84431
+G1 X-13.365 Y-6.810 E93.86431
+G1 X-12.990 Y-7.500 E93.88431
+G1 X-12.580 Y-8.170 E93.90431
+G1 X-12.135 Y-8.817 E93.92431
+G1 X-11.657 Y-9.440 E93.94431
+G1 X-11.147 Y-10.037 E93.96431
+G1 X-10.607 Y-10.607 E93.98431
+G1 X-10.037 Y-11.147 E94.00431
+G1 X-9.440 Y-11.657 E94.02431
+G1 X-8.817 Y-12.135 E94.04431
+G1 X-8.170 Y-12.580 E94.06431
+G1 X-7.500 Y-12.990 E94.08431
+G1 X-6.810 Y-13.365 E94.10431
+G1 X-6.101 Y-13.703 E94.12431
+G1 X-5.376 Y-14.004 E94.14431
+G1 X-4.635 Y-14.266 E94.16431
+G1 X-3.882 Y-14.489 E94.18431
+G1 X-3.119 Y-14.672 E94.20431
+G1 X-2.347 Y-14.815 E94.22431
+G1 X-1.568 Y-14.918 E94.24431
+G1 X-0.785 Y-14.979 E94.26431
+G1 X-0.000 Y-15.000 E94.28431
+G1 X0.785 Y-14.979 E94.30431
+G1 X1.568 Y-14.918 E94.32431
+G1 X2.347 Y-14.815 E94.34431
+G1 X3.119 Y-14.672 E94.36431
+G1 X3.882 Y-14.489 E94.38431
+G1 X4.635 Y-14.266 E94.40431
+G1 X5.376 Y-14.004 E94.42431
+G1 X6.101 Y-13.703 E94.44431
+G1 X6.810 Y-13.365 E94.46431
+G1 X7.500 Y-12.990 E94.48431
+G1 X8.170 Y-12.580 E94.50431
+G1 X8.817 Y-12.135 E94.52431
+G1 X9.440 Y-11.657 E94.54431
+G1 X10.037 Y-11.147 E94.56431
+G1 X10.607 Y-10.607 E94.58431
+G1 X11.147 Y-10.037 E94.60431
+G1 X11.657 Y-9.440 E94.62431
+G1 X12.135 Y-8.817 E94.64431
+G1 X12.580 Y-8.170 E94.66431
+G1 X12.990 Y-7.500 E94.68431
+G1 X13.365 Y-6.810 E94.70431
+G1 X13.703 Y-6.101 E94.72431
+G1 X14.004 Y-5.376 E94.74431
+G1 X14.266 Y-4.635 E94.76431
+G1 X14.489 Y-3.882 E94.78431
+G1 X14.672 Y-3.119 E94.80431
+G1 X14.815 Y-2.347 E94.82431
+G1 X14.918 Y-1.568 E94.84431
+G1 X14.979 Y-0.785 E94.86431
+G1 X15.000 Y-0.000 E94.88431
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E94.90431 F1800
+G1 X14.520 Y1.526 E94.92431
+G1 X14.420 Y2.284 E94.94431
+G1 X14.281 Y3.036 E94.96431
+G1 X14.103 Y3.779 E94.98431
+G1 X13.885 Y4.512 E95.00431
+G1 X13.630 Y5.232 E95.02431
+G1 X13.338 Y5.938 E95.04431
+G1 X13.009 Y6.628 E95.06431
+G1 X12.644 Y7.300 E95.08431
+G1 X12.245 Y7.952 E95.10431
+G1 X11.812 Y8.582 E95.12431
+G1 X11.346 Y9.188 E95.14431
+G1 X10.850 Y9.769 E95.16431
+G1 X10.324 Y10.324 E95.18431
+G1 X9.769 Y10.850 E95.20431
+G1 X9.188 Y11.346 E95.22431
+G1 X8.582 Y11.812 E95.24431
+G1 X7.952 Y12.245 E95.26431
+G1 X7.300 Y12.644 E95.28431
+G1 X6.628 Y13.009 E95.30431
+G1 X5.938 Y13.338 E95.32431
+G1 X5.232 Y13.630 E95.34431
+G1 X4.512 Y13.885 E95.36431
+G1 X3.779 Y14.103 E95.38431
+G1 X3.036 Y14.281 E95.40431
+G1 X2.284 Y14.420 E95.42431
+G1 X1.526 Y14.520 E95.44431
+G1 X0.764 Y14.580 E95.46431
+G1 X0.000 Y14.600 E95.48431
+G1 X-0.764 Y14.580 E95.50431
+G1 X-1.526 Y14.520 E95.52431
+G1 X-2.284 Y14.420 E95.54431
+G1 X-3.036 Y14.281 E95.56431
+G1 X-3.779 Y14.103 E95.58431
+G1 X-4.512 Y13.885 E95.60431
+G1 X-5.232 Y13.630 E95.62431
+G1 X-5.938 Y13.338 E95.64431
+G1 X-6.628 Y13.009 E95.66431
+G1 X-7.300 Y12.644 E95.68431
+G1 X-7.952 Y12.245 E95.70431
+G1 X-8.582 Y11.812 E95.72431
+G1 X-9.188 Y11.346 E95.74431
+G1 X-9.769 Y10.850 E95.76431
+G1 X-10.324 Y10.324 E95.78431
+G1 X-10.850 Y9.769 E95.80431
+G1 X-11.346 Y9.188 E95.82431
+G1 X-11.812 Y8.582 E95.84431
+G1 X-12.245 Y7.952 E95.86431
+G1 X-12.644 Y7.300 E95.88431
+G1 X-13.009 Y6.628 E95.90431
+G1 X-13.338 Y5.938 E95.92431
+G1 X-13.630 Y5.232 E95.94431
+G1 X-13.885 Y4.512 E95.96431
+G1 X-14.103 Y3.779 E95.98431
+G1 X-14.281 Y3.036 E96.00431
+G1 X-14.420 Y2.284 E96.02431
+G1 X-14.520 Y1.526 E96.04431
+G1 X-14.580 Y0.764 E96.06431
+G1 X-14.600 Y0.000 E96.08431
+G1 X-14.580 Y-0.764 E96.10431
+G1 X-14.520 Y-1.526 E96.12431
+G1 X-14.420 Y-2.284 E96.14431
+G1 X-14.281 Y-3.036 E96.16431
+G1 X-14.103 Y-3.779 E96.18431
+G1 X-13.885 Y-4.512 E96.20431
+G1 X-13.630 Y-5.232 E96.22431
+G1 X-13.338 Y-5.938 E96.24431
+G1 X-13.009 Y-6.628 E96.26431
+G1 X-12.644 Y-7.300 E96.28431
+G1 X-12.245 Y-7.952 E96.30431
+G1 X-11.812 Y-8.582 E96.32431
+G1 X-11.346 Y-9.188 E96.34431
+G1 X-10.850 Y-9.769 E96.36431
+G1 X-10.324 Y-10.324 E96.38431
+G1 X-9.769 Y-10.850 E96.40431
+G1 X-9.188 Y-11.346 E96.42431
+G1 X-8.582 Y-11.812 E96.44431
+G1 X-7.952 Y-12.245 E96.46431
+G1 X-7.300 Y-12.644 E96.48431
+G1 X-6.628 Y-13.009 E96.50431
+G1 X-5.938 Y-13.338 E96.52431
+G1 X-5.232 Y-13.630 E96.54431
+G1 X-4.512 Y-13.885 E96.56431
+G1 X-3.779 Y-14.103 E96.58431
+G1 X-3.036 Y-14.281 E96.60431
+G1 X-2.284 Y-14.420 E96.62431
+G1 X-1.526 Y-14.520 E96.64431
+G1 X-0.764 Y-14.580 E96.66431
+G1 X-0.000 Y-14.600 E96.68431
+G1 X0.764 Y-14.580 E96.70431
+G1 X1.526 Y-14.520 E96.72431
+G1 X2.284 Y-14.420 E96.74431
+G1 X3.036 Y-14.281 E96.76431
+G1 X3.779 Y-14.103 E96.78431
+G1 X4.512 Y-13.885 E96.80431
+G1 X5.232 Y-13.630 E96.82431
+G1 X5.938 Y-13.338 E96.84431
+G1 X6.628 Y-13.009 E96.86431
+G1 X7.300 Y-12.644 E96.88431
+G1 X7.952 Y-12.245 E96.90431
+G1 X8.582 Y-11.812 E96.92431
+G1 X9.188 Y-11.346 E96.94431
+G1 X9.769 Y-10.850 E96.96431
+G1 X10.324 Y-10.324 E96.98431
+G1 X10.850 Y-9.769 E97.00431
+G1 X11.346 Y-9.188 E97.02431
+G1 X11.812 Y-8.582 E97.04431
+G1 X12.245 Y-7.952 E97.06431
+G1 X12.644 Y-7.300 E97.08431
+G1 X13.009 Y-6.628 E97.10431
+G1 X13.338 Y-5.938 E97.12431
+G1 X13.630 Y-5.232 E97.14431
+G1 X13.885 Y-4.512 E97.16431
+G1 X14.103 Y-3.779 E97.18431
+G1 X14.281 Y-3.036 E97.20431
+G1 X14.420 Y-2.284 E97.22431
+G1 X14.520 Y-1.526 E97.24431
+G1 X14.580 Y-0.764 E97.26431
+G1 X14.600 Y-0.000 E97.28431
+G1 X5.713 Y-13.000 E97.28431 F7800
+G1 X-5.713 Y-13.000 E97.74136 F3600
+G1 X-7.592 Y-12.000 E97.74136 F7800
+G1 X7.592 Y-12.000 E98.34873 F3600
+G1 X8.980 Y-11.000 E98.34873 F7800
+G1 X-8.980 Y-11.000 E99.06713 F3600
+G1 X-10.082 Y-10.000 E99.06713 F7800
+G1 X10.082 Y-10.000 E99.87366 F3600
+G1 X10.984 Y-9.000 E99.87366 F7800
+G1 X-10.984 Y-9.000 E100.75235 F3600
+G1 X-11.732 Y-8.000 E100.75235 F7800
+G1 X11.732 Y-8.000 E101.69091 F3600
+G1 X12.355 Y-7.000 E101.69091 F7800
+G1 X-12.355 Y-7.000 E102.67929 F3600
+G1 X-12.870 Y-6.000 E102.67929 F7800
+G1 X12.870 Y-6.000 E103.70890 F3600
+G1 X13.291 Y-5.000 E103.70890 F7800
+G1 X-13.291 Y-5.000 E104.77215 F3600
+G1 X-13.625 Y-4.000 E104.77215 F7800
+G1 X13.625 Y-4.000 E105.86215 F3600
+G1 X13.879 Y-3.000 E105.86215 F7800
+G1 X-13.879 Y-3.000 E106.97251 F3600
+G1 X-14.058 Y-2.000 E106.97251 F7800
+G1 X14.058 Y-2.000 E108.09718 F3600
+G1 X14.165 Y-1.000 E108.09718 F7800
+G1 X-14.165 Y-1.000 E109.23036 F3600
+G1 X-14.200 Y0.000 E109.23036 F7800
+G1 X14.200 Y0.000 E110.36636 F3600
+G1 X14.165 Y1.000 E110.36636 F7800
+G1 X-14.165 Y1.000 E111.49954 F3600
+G1 X-14.058 Y2.000 E111.49954 F7800
+G1 X14.058 Y2.000 E112.62422 F3600
+G1 X13.879 Y3.000 E112.62422 F7800
+G1 X-13.879 Y3.000 E113.73458 F3600
+G1 X-13.625 Y4.000 E113.73458 F7800
+G1 X13.625 Y4.000 E114.82457 F3600
+G1 X13.291 Y5.000 E114.82457 F7800
+G1 X-13.291 Y5.000 E115.88782 F3600
+G1 X-12.870 Y6.000 E115.88782 F7800
+G1 X12.870 Y6.000 E116.91743 F3600
+G1 X12.355 Y7.000 E116.91743 F7800
+G1 X-12.355 Y7.000 E117.90581 F3600
+G1 X-11.732 Y8.000 E117.90581 F7800
+G1 X11.732 Y8.000 E118.84437 F3600
+G1 X10.984 Y9.000 E118.84437 F7800
+G1 X-10.984 Y9.000 E119.72306 F3600
+G1 X-10.082 Y10.000 E119.72306 F7800
+G1 X10.082 Y10.000 E120.52960 F3600
+G1 X8.980 Y11.000 E120.52960 F7800
+G1 X-8.980 Y11.000 E121.24799 F3600
+G1 X-7.592 Y12.000 E121.24799 F7800
+G1 X7.592 Y12.000 E121.85536 F3600
+G1 X5.713 Y13.000 E121.85536 F7800
+G1 X-5.713 Y13.000 E122.31241 F3600
+G1 Z1.100 F7800
+G1 E121.31241 F2400
+G1 E122.31241 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E122.33241 F1800
+G1 X14.918 Y1.568 E122.35241
+G1 X14.815 Y2.347 E122.37241
+G1 X14.672 Y3.119 E122.39241
+G1 X14.489 Y3.882 E122.41241
+G1 X14.266 Y4.635 E122.43241
+G1 X14.004 Y5.376 E122.45241
+G1 X13.703 Y6.101 E122.47241
+G1 X13.365 Y6.810 E122.49241
+G1 X12.990 Y7.500 E122.51241
+G1 X12.580 Y8.170 E122.53241
+G1 X12.135 Y8.817 E122.55241
+G1 X11.657 Y9.440 E122.57241
+G1 X11.147 Y10.037 E122.59241
+G1 X10.607 Y10.607 E122.61241
+G1 X10.037 Y11.147 E122.63241
+G1 X9.440 Y11.657 E122.65241
+G1 X8.817 Y12.135 E122.67241
+G1 X8.170 Y12.580 E122.69241
+G1 X7.500 Y12.990 E122.71241
+G1 X6.810 Y13.365 E122.73241
+G1 X6.101 Y13.703 E122.75241
+G1 X5.376 Y14.004 E122.77241
+G1 X4.635 Y14.266 E122.79241
+G1 X3.882 Y14.489 E122.81241
+G1 X3.119 Y14.672 E122.83241
+G1 X2.347 Y14.815 E122.85241
+G1 X1.568 Y14.918 E122.87241
+G1 X0.785 Y14.979 E122.89241
+G1 X0.000 Y15.000 E122.91241
+G1 X-0.785 Y14.979 E122.93241
+G1 X-1.568 Y14.918 E122.95241
+G1 X-2.347 Y14.815 E122.97241
+G1 X-3.119 Y14.672 E122.99241
+G1 X-3.882 Y14.489 E123.01241
+G1 X-4.635 Y14.266 E123.03241
+G1 X-5.376 Y14.004 E123.05241
+G1 X-6.101 Y13.703 E123.07241
+G1 X-6.810 Y13.365 E123.09241
+G1 X-7.500 Y12.990 E123.11241
+G1 X-8.170 Y12.580 E123.13241
+G1 X-8.817 Y12.135 E123.15241
+G1 X-9.440 Y11.657 E123.17241
+G1 X-10.037 Y11.147 E123.19241
+G1 X-10.607 Y10.607 E123.21241
+G1 X-11.147 Y10.037 E123.23241
+G1 X-11.657 Y9.440 E123.25241
+G1 X-12.135 Y8.817 E123.27241
+G1 X-12.580 Y8.170 E123.29241
+G1 X-12.990 Y7.500 E123.31241
+G1 X-13.365 Y6.810 E123.33241
+G1 X-13.703 Y6.101 E123.35241
+G1 X-14.004 Y5.376 E123.37241
+G1 X-14.266 Y4.635 E123.39241
+G1 X-14.489 Y3.882 E123.41241
+G1 X-14.672 Y3.119 E123.43241
+G1 X-14.815 Y2.347 E123.45241
+G1 X-14.918 Y1.568 E123.47241
+G1 X-14.979 Y0.785 E123.49241
+G1 X-15.000 Y0.000 E123.51241
+G1 X-14.979 Y-0.785 E123.53241
+G1 X-14.918 Y-1.568 E123.55241
+G1 X-14.815 Y-2.347 E123.57241
+G1 X-14.672 Y-3.119 E123.59241
+G1 X-14.489 Y-3.882 E123.61241
+G1 X-14.266 Y-4.635 E123.63241
+G1 X-14.004 Y-5.376 E123.65241
+G1 X-13.703 Y-6.101 E123.67241
+G1 X-13.365 Y-6.810 E123.69241
+G1 X-12.990 Y-7.500 E123.71241
+G1 X-12.580 Y-8.170 E123.73241
+G1 X-12.135 Y-8.817 E123.75241
+G1 X-11.657 Y-9.440 E123.77241
+G1 X-11.147 Y-10.037 E123.79241
+G1 X-10.607 Y-10.607 E123.81241
+G1 X-10.037 Y-11.147 E123.83241
+G1 X-9.440 Y-11.657 E123.85241
+G1 X-8.817 Y-12.135 E123.87241
+G1 X-8.170 Y-12.580 E123.89241
+G1 X-7.500 Y-12.990 E123.91241
+G1 X-6.810 Y-13.365 E123.93241
+G1 X-6.101 Y-13.703 E123.95241
+G1 X-5.376 Y-14.004 E123.97241
+G1 X-4.635 Y-14.266 E123.99241
+G1 X-3.882 Y-14.489 E124.01241
+G1 X-3.119 Y-14.672 E124.03241
+G1 X-2.347 Y-14.815 E124.05241
+G1 X-1.568 Y-14.918 E124.07241
+G1 X-0.785 Y-14.979 E124.09241
+G1 X-0.000 Y-15.000 E124.11241
+G1 X0.785 Y-14.979 E124.13241
+G1 X1.568 Y-14.918 E124.15241
+G1 X2.347 Y-14.815 E124.17241
+G1 X3.119 Y-14.672 E124.19241
+G1 X3.882 Y-14.489 E124.21241
+G1 X4.635 Y-14.266 E124.23241
+G1 X5.376 Y-14.004 E124.25241
+G1 X6.101 Y-13.703 E124.27241
+G1 X6.810 Y-13.365 E124.29241
+G1 X7.500 Y-12.990 E124.31241
+G1 X8.170 Y-12.580 E124.33241
+G1 X8.817 Y-12.135 E124.35241
+G1 X9.440 Y-11.657 E124.37241
+G1 X10.037 Y-11.147 E124.39241
+G1 X10.607 Y-10.607 E124.41241
+G1 X11.147 Y-10.037 E124.43241
+G1 X11.657 Y-9.440 E124.45241
+G1 X12.135 Y-8.817 E124.47241
+G1 X12.580 Y-8.170 E124.49241
+G1 X12.990 Y-7.500 E124.51241
+G1 X13.365 Y-6.810 E124.53241
+G1 X13.703 Y-6.101 E124.55241
+G1 X14.004 Y-5.376 E124.57241
+G1 X14.266 Y-4.635 E124.59241
+G1 X14.489 Y-3.882 E124.61241
+G1 X14.672 Y-3.119 E124.63241
+G1 X14.815 Y-2.347 E124.65241
+G1 X14.918 Y-1.568 E124.67241
+G1 X14.979 Y-0.785 E124.69241
+G1 X15.000 Y-0.000 E124.71241
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E124.73241 F1800
+G1 X14.520 Y1.526 E124.75241
+G1 X14.420 Y2.284 E124.77241
+G1 X14.281 Y3.036 E124.79241
+G1 X14.103 Y3.779 E124.81241
+G1 X13.885 Y4.512 E124.83241
+G1 X13.630 Y5.232 E124.85241
+G1 X13.338 Y5.938 E124.87241
+G1 X13.009 Y6.628 E124.89241
+G1 X12.644 Y7.300 E124.91241
+G1 X12.245 Y7.952 E124.93241
+G1 X11.812 Y8.582 E124.95241
+G1 X11.346 Y9.188 E124.97241
+G1 X10.850 Y9.769 E124.99241
+G1 X10.324 Y10.324 E125.01241
+G1 X9.769 Y10.850 E125.03241
+G1 X9.188 Y11.346 E125.05241
+G1 X8.582 Y11.812 E125.07241
+G1 X7.952 Y12.245 E125.09241
+G1 X7.300 Y12.644 E125.11241
+G1 X6.628 Y13.009 E125.13241
+G1 X5.938 Y13.338 E125.15241
+G1 X5.232 Y13.630 E125.17241
+G1 X4.512 Y13.885 E125.19241
+G1 X3.779 Y14.103 E125.21241
+G1 X3.036 Y14.281 E125.23241
+G1 X2.284 Y14.420 E125.25241
+G1 X1.526 Y14.520 E125.27241
+G1 X0.764 Y14.580 E125.29241
+G1 X0.000 Y14.600 E125.31241
+G1 X-0.764 Y14.580 E125.33241
+G1 X-1.526 Y14.520 E125.35241
+G1 X-2.284 Y14.420 E125.37241
+G1 X-3.036 Y14.281 E125.39241
+G1 X-3.779 Y14.103 E125.41241
+G1 X-4.512 Y13.885 E125.43241
+G1 X-5.232 Y13.630 E125.45241
+G1 X-5.938 Y13.338 E125.47241
+G1 X-6.628 Y13.009 E125.49241
+G1 X-7.300 Y12.644 E125.51241
+G1 X-7.952 Y12.245 E125.53241
+G1 X-8.582 Y11.812 E125.55241
+G1 X-9.188 Y11.346 E125.57241
+G1 X-9.769 Y10.850 E125.59241
+G1 X-10.324 Y10.324 E125.61241
+G1 X-10.850 Y9.769 E125.63241
+G1 X-11.346 Y9.188 E125.65241
+G1 X-11.812 Y8.582 E125.67241
+G1 X-12.245 Y7.952 E125.69241
+G1 X-12.644 Y7.300 E125.71241
+G1 X-13.009 Y6.628 E125.73241
+G1 X-13.338 Y5.938 E125.75241
+G1 X-13.630 Y5.232 E125.77241
+G1 X-13.885 Y4.512 E125.79241
+G1 X-14.103 Y3.779 E125.81241
+G1 X-14.281 Y3.036 E125.83241
+G1 X-14.420 Y2.284 E125.85241
+G1 X-14.520 Y1.526 E125.87241
+G1 X-14.580 Y0.764 E125.89241
+G1 X-14.600 Y0.000 E125.91241
+G1 X-14.580 Y-0.764 E125.93241
+G1 X-14.520 Y-1.526 E125.95241
+G1 X-14.420 Y-2.284 E125.97241
+G1 X-14.281 Y-3.036 E125.99241
+G1 X-14.103 Y-3.779 E126.01241
+G1 X-13.885 Y-4.512 E126.03241
+G1 X-13.630 Y-5.232 E126.05241
+G1 X-13.338 Y-5.938 E126.07241
+G1 X-13.009 Y-6.628 E126.09241
+G1 X-12.644 Y-7.300 E126.11241
+G1 X-12.245 Y-7.952 E126.13241
+G1 X-11.812 Y-8.582 E126.15241
+G1 X-11.346 Y-9.188 E126.17241
+G1 X-10.850 Y-9.769 E126.19241
+G1 X-10.324 Y-10.324 E126.21241
+G1 X-9.769 Y-10.850 E126.23241
+G1 X-9.188 Y-11.346 E126.25241
+G1 X-8.582 Y-11.812 E126.27241
+G1 X-7.952 Y-12.245 E126.29241
+G1 X-7.300 Y-12.644 E126.31241
+G1 X-6.628 Y-13.009 E126.33241
+G1 X-5.938 Y-13.338 E126.35241
+G1 X-5.232 Y-13.630 E126.37241
+G1 X-4.512 Y-13.885 E126.39241
+G1 X-3.779 Y-14.103 E126.41241
+G1 X-3.036 Y-14.281 E126.43241
+G1 X-2.284 Y-14.420 E126.45241
+G1 X-1.526 Y-14.520 E126.47241
+G1 X-0.764 Y-14.580 E126.49241
+G1 X-0.000 Y-14.600 E126.51241
+G1 X0.764 Y-14.580 E126.53241
+G1 X1.526 Y-14.520 E126.55241
+G1 X2.284 Y-14.420 E126.57241
+G1 X3.036 Y-14.281 E126.59241
+G1 X3.779 Y-14.103 E126.61241
+G1 X4.512 Y-13.885 E126.63241
+G1 X5.232 Y-13.630 E126.65241
+G1 X5.938 Y-13.338 E126.67241
+G1 X6.628 Y-13.009 E126.69241
+G1 X7.300 Y-12.644 E126.71241
+G1 X7.952 Y-12.245 E126.73241
+G1 X8.582 Y-11.812 E126.75241
+G1 X9.188 Y-11.346 E126.77241
+G1 X9.769 Y-10.850 E126.79241
+G1 X10.324 Y-10.324 E126.81241
+G1 X10.850 Y-9.769 E126.83241
+G1 X11.346 Y-9.188 E126.85241
+G1 X11.812 Y-8.582 E126.87241
+G1 X12.245 Y-7.952 E126.89241
+G1 X12.644 Y-7.300 E126.91241
+G1 X13.009 Y-6.628 E126.93241
+G1 X13.338 Y-5.938 E126.95241
+G1 X13.630 Y-5.232 E126.97241
+G1 X13.885 Y-4.512 E126.99241
+G1 X14.103 Y-3.779 E127.01241
+G1 X14.281 Y-3.036 E127.03241
+G1 X14.420 Y-2.284 E127.05241
+G1 X14.520 Y-1.526 E127.07241
+G1 X14.580 Y-0.764 E127.09241
+G1 X14.600 Y-0.000 E127.11241
+G1 X5.713 Y-13.000 E127.11241 F7800
+G1 X-5.713 Y-13.000 E127.56947 F3600
+G1 X-7.592 Y-12.000 E127.56947 F7800
+G1 X7.592 Y-12.000 E128.17683 F3600
+G1 X8.980 Y-11.000 E128.17683 F7800
+G1 X-8.980 Y-11.000 E128.89523 F3600
+G1 X-10.082 Y-10.000 E128.89523 F7800
+G1 X10.082 Y-10.000 E129.70177 F3600
+G1 X10.984 Y-9.000 E129.70177 F7800
+G1 X-10.984 Y-9.000 E130.58046 F3600
+G1 X-11.732 Y-8.000 E130.58046 F7800
+G1 X11.732 Y-8.000 E131.51902 F3600
+G1 X12.355 Y-7.000 E131.51902 F7800
+G1 X-12.355 Y-7.000 E132.50740 F3600
+G1 X-12.870 Y-6.000 E132.50740 F7800
+G1 X12.870 Y-6.000 E133.53701 F3600
+G1 X13.291 Y-5.000 E133.53701 F7800
+G1 X-13.291 Y-5.000 E134.60025 F3600
+G1 X-13.625 Y-4.000 E134.60025 F7800
+G1 X13.625 Y-4.000 E135.69025 F3600
+G1 X13.879 Y-3.000 E135.69025 F7800
+G1 X-13.879 Y-3.000 E136.80061 F3600
+G1 X-14.058 Y-2.000 E136.80061 F7800
+G1 X14.058 Y-2.000 E137.92529 F3600
+G1 X14.165 Y-1.000 E137.92529 F7800
+G1 X-14.165 Y-1.000 E139.05847 F3600
+G1 X-14.200 Y0.000 E139.05847 F7800
+G1 X14.200 Y0.000 E140.19447 F3600
+G1 X14.165 Y1.000 E140.19447 F7800
+G1 X-14.165 Y1.000 E141.32765 F3600
+G1 X-14.058 Y2.000 E141.32765 F7800
+G1 X14.058 Y2.000 E142.45232 F3600
+G1 X13.879 Y3.000 E142.45232 F7800
+G1 X-13.879 Y3.000 E143.56268 F3600
+G1 X-13.625 Y4.000 E143.56268 F7800
+G1 X13.625 Y4.000 E144.65268 F3600
+G1 X13.291 Y5.000 E144.65268 F7800
+G1 X-13.291 Y5.000 E145.71593 F3600
+G1 X-12.870 Y6.000 E145.71593 F7800
+G1 X12.870 Y6.000 E146.74554 F3600
+G1 X12.355 Y7.000 E146.74554 F7800
+G1 X-12.355 Y7.000 E147.73392 F3600
+G1 X-11.732 Y8.000 E147.73392 F7800
+G1 X11.732 Y8.000 E148.67248 F3600
+G1 X10.984 Y9.000 E148.67248 F7800
+G1 X-10.984 Y9.000 E149.55117 F3600
+G1 X-10.082 Y10.000 E149.55117 F7800
+G1 X10.082 Y10.000 E150.35770 F3600
+G1 X8.980 Y11.000 E150.35770 F7800
+G1 X-8.980 Y11.000 E151.07610 F3600
+G1 X-7.592 Y12.000 E151.07610 F7800
+G1 X7.592 Y12.000 E151.68347 F3600
+G1 X5.713 Y13.000 E151.68347 F7800
+G1 X-5.713 Y13.000 E152.14052 F3600
+G1 Z1.300 F7800
+G1 E151.14052 F2400
+G1 E152.14052 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E152.16052 F1800
+G1 X14.918 Y1.568 E152.18052
+G1 X14.815 Y2.347 E152.20052
+G1 X14.672 Y3.119 E152.22052
+G1 X14.489 Y3.882 E152.24052
+G1 X14.266 Y4.635 E152.26052
+G1 X14.004 Y5.376 E152.28052
+G1 X13.703 Y6.101 E152.30052
+G1 X13.365 Y6.810 E152.32052
+G1 X12.990 Y7.500 E152.34052
+G1 X12.580 Y8.170 E152.36052
+G1 X12.135 Y8.817 E152.38052
+G1 X11.657 Y9.440 E152.40052
+G1 X11.147 Y10.037 E152.42052
+G1 X10.607 Y10.607 E152.44052
+G1 X10.037 Y11.147 E152.46052
+G1 X9.440 Y11.657 E152.48052
+G1 X8.817 Y12.135 E152.50052
+G1 X8.170 Y12.580 E152.52052
+G1 X7.500 Y12.990 E152.54052
+G1 X6.810 Y13.365 E152.56052
+G1 X6.101 Y13.703 E152.58052
+G1 X5.376 Y14.004 E152.60052
+G1 X4.635 Y14.266 E152.62052
+G1 X3.882 Y14.489 E152.64052
+G1 X3.119 Y14.672 E152.66052
+G1 X2.347 Y14.815 E152.68052
+G1 X1.568 Y14.918 E152.70052
+G1 X0.785 Y14.979 E152.72052
+G1 X0.000 Y15.000 E152.74052
+G1 X-0.785 Y14.979 E152.76052
+G1 X-1.568 Y14.918 E152.78052
+G1 X-2.347 Y14.815 E152.80052
+G1 X-3.119 Y14.672 E152.82052
+G1 X-3.882 Y14.489 E152.84052
+G1 X-4.635 Y14.266 E152.86052
+G1 X-5.376 Y14.004 E152.88052
+G1 X-6.101 Y13.703 E152.90052
+G1 X-6.810 Y13.365 E152.92052
+G1 X-7.500 Y12.990 E152.94052
+G1 X-8.170 Y12.580 E152.96052
+G1 X-8.817 Y12.135 E152.98052
+G1 X-9.440 Y11.657 E153.00052
+G1 X-10.037 Y11.147 E153.02052
+G1 X-10.607 Y10.607 E153.04052
+G1 X-11.147 Y10.037 E153.06052
+G1 X-11.657 Y9.440 E153.08052
+G1 X-12.135 Y8.817 E153.10052
+G1 X-12.580 Y8.170 E153.12052
+G1 X-12.990 Y7.500 E153.14052
+G1 X-13.365 Y6.810 E153.16052
+G1 X-13.703 Y6.101 E153.18052
+G1 X-14.004 Y5.376 E153.20052
+G1 X-14.266 Y4.635 E153.22052
+G1 X-14.489 Y3.882 E153.24052
+G1 X-14.672 Y3.119 E153.26052
+G1 X-14.815 Y2.347 E153.28052
+G1 X-14.918 Y1.568 E153.30052
+G1 X-14.979 Y0.785 E153.32052
+G1 X-15.000 Y0.000 E153.34052
+G1 X-14.979 Y-0.785 E153.36052
+G1 X-14.918 Y-1.568 E153.38052
+G1 X-14.815 Y-2.347 E153.40052
+G1 X-14.672 Y-3.119 E153.42052
+G1 X-14.489 Y-3.882 E153.44052
+G1 X-14.266 Y-4.635 E153.46052
+G1 X-14.004 Y-5.376 E153.48052
+G1 X-13.703 Y-6.101 E153.50052
+G1 X-13.365 Y-6.810 E153.52052
+G1 X-12.990 Y-7.500 E153.54052
+G1 X-12.580 Y-8.170 E153.56052
+G1 X-12.135 Y-8.817 E153.58052
+G1 X-11.657 Y-9.440 E153.60052
+G1 X-11.147 Y-10.037 E153.62052
+G1 X-10.607 Y-10.607 E153.64052
+G1 X-10.037 Y-11.147 E153.66052
+G1 X-9.440 Y-11.657 E153.68052
+G1 X-8.817 Y-12.135 E153.70052
+G1 X-8.170 Y-12.580 E153.72052
+G1 X-7.500 Y-12.990 E153.74052
+G1 X-6.810 Y-13.365 E153.76052
+G1 X-6.101 Y-13.703 E153.78052
+G1 X-5.376 Y-14.004 E153.80052
+G1 X-4.635 Y-14.266 E153.82052
+G1 X-3.882 Y-14.489 E153.84052
+G1 X-3.119 Y-14.672 E153.86052
+G1 X-2.347 Y-14.815 E153.88052
+G1 X-1.568 Y-14.918 E153.90052
+G1 X-0.785 Y-14.979 E153.92052
+G1 X-0.000 Y-15.000 E153.94052
+G1 X0.785 Y-14.979 E153.96052
+G1 X1.568 Y-14.918 E153.98052
+G1 X2.347 Y-14.815 E154.00052
+G1 X3.119 Y-14.672 E154.02052
+G1 X3.882 Y-14.489 E154.04052
+G1 X4.635 Y-14.266 E154.06052
+G1 X5.376 Y-14.004 E154.08052
+G1 X6.101 Y-13.703 E154.10052
+G1 X6.810 Y-13.365 E154.12052
+G1 X7.500 Y-12.990 E154.14052
+G1 X8.170 Y-12.580 E154.16052
+G1 X8.817 Y-12.135 E154.18052
+G1 X9.440 Y-11.657 E154.20052
+G1 X10.037 Y-11.147 E154.22052
+G1 X10.607 Y-10.607 E154.24052
+G1 X11.147 Y-10.037 E154.26052
+G1 X11.657 Y-9.440 E154.28052
+G1 X12.135 Y-8.817 E154.30052
+G1 X12.580 Y-8.170 E154.32052
+G1 X12.990 Y-7.500 E154.34052
+G1 X13.365 Y-6.810 E154.36052
+G1 X13.703 Y-6.101 E154.38052
+G1 X14.004 Y-5.376 E154.40052
+G1 X14.266 Y-4.635 E154.42052
+G1 X14.489 Y-3.882 E154.44052
+G1 X14.672 Y-3.119 E154.46052
+G1 X14.815 Y-2.347 E154.48052
+G1 X14.918 Y-1.568 E154.50052
+G1 X14.979 Y-0.785 E154.52052
+G1 X15.000 Y-0.000 E154.54052
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E154.56052 F1800
+G1 X14.520 Y1.526 E154.58052
+G1 X14.420 Y2.284 E154.60052
+G1 X14.281 Y3.036 E154.62052
+G1 X14.103 Y3.779 E154.64052
+G1 X13.885 Y4.512 E154.66052
+G1 X13.630 Y5.232 E154.68052
+G1 X13.338 Y5.938 E154.70052
+G1 X13.009 Y6.628 E154.72052
+G1 X12.644 Y7.300 E154.74052
+G1 X12.245 Y7.952 E154.76052
+G1 X11.812 Y8.582 E154.78052
+G1 X11.346 Y9.188 E154.80052
+G1 X10.850 Y9.769 E154.82052
+G1 X10.324 Y10.324 E154.84052
+G1 X9.769 Y10.850 E154.86052
+G1 X9.188 Y11.346 E154.88052
+G1 X8.582 Y11.812 E154.90052
+G1 X7.952 Y12.245 E154.92052
+G1 X7.300 Y12.644 E154.94052
+G1 X6.628 Y13.009 E154.96052
+G1 X5.938 Y13.338 E154.98052
+G1 X5.232 Y13.630 E155.00052
+G1 X4.512 Y13.885 E155.02052
+G1 X3.779 Y14.103 E155.04052
+G1 X3.036 Y14.281 E155.06052
+G1 X2.284 Y14.420 E155.08052
+G1 X1.526 Y14.520 E155.10052
+G1 X0.764 Y14.580 E155.12052
+G1 X0.000 Y14.600 E155.14052
+G1 X-0.764 Y14.580 E155.16052
+G1 X-1.526 Y14.520 E155.18052
+G1 X-2.284 Y14.420 E155.20052
+G1 X-3.036 Y14.281 E155.22052
+G1 X-3.779 Y14.103 E155.24052
+G1 X-4.512 Y13.885 E155.26052
+G1 X-5.232 Y13.630 E155.28052
+G1 X-5.938 Y13.338 E155.30052
+G1 X-6.628 Y13.009 E155.32052
+G1 X-7.300 Y12.644 E155.34052
+G1 X-7.952 Y12.245 E155.36052
+G1 X-8.582 Y11.812 E155.38052
+G1 X-9.188 Y11.346 E155.40052
+G1 X-9.769 Y10.850 E155.42052
+G1 X-10.324 Y10.324 E155.44052
+G1 X-10.850 Y9.769 E155.46052
+G1 X-11.346 Y9.188 E155.48052
+G1 X-11.812 Y8.582 E155.50052
+G1 X-12.245 Y7.952 E155.52052
+G1 X-12.644 Y7.300 E155.54052
+G1 X-13.009 Y6.628 E155.56052
+G1 X-13.338 Y5.938 E155.58052
+G1 X-13.630 Y5.232 E155.60052
+G1 X-13.885 Y4.512 E155.62052
+G1 X-14.103 Y3.779 E155.64052
+G1 X-14.281 Y3.036 E155.66052
+G1 X-14.420 Y2.284 E155.68052
+G1 X-14.520 Y1.526 E155.70052
+G1 X-14.580 Y0.764 E155.72052
+G1 X-14.600 Y0.000 E155.74052
+G1 X-14.580 Y-0.764 E155.76052
+G1 X-14.520 Y-1.526 E155.78052
+G1 X-14.420 Y-2.284 E155.80052
+G1 X-14.281 Y-3.036 E155.82052
+G1 X-14.103 Y-3.779 E155.84052
+G1 X-13.885 Y-4.512 E155.86052
+G1 X-13.630 Y-5.232 E155.88052
+G1 X-13.338 Y-5.938 E155.90052
+G1 X-13.009 Y-6.628 E155.92052
+G1 X-12.644 Y-7.300 E155.94052
+G1 X-12.245 Y-7.952 E155.96052
+G1 X-11.812 Y-8.582 E155.98052
+G1 X-11.346 Y-9.188 E156.00052
+G1 X-10.850 Y-9.769 E156.02052
+G1 X-10.324 Y-10.324 E156.04052
+G1 X-9.769 Y-10.850 E156.06052
+G1 X-9.188 Y-11.346 E156.08052
+G1 X-8.582 Y-11.812 E156.10052
+G1 X-7.952 Y-12.245 E156.12052
+G1 X-7.300 Y-12.644 E156.14052
+G1 X-6.628 Y-13.009 E156.16052
+G1 X-5.938 Y-13.338 E156.18052
+G1 X-5.232 Y-13.630 E156.20052
+G1 X-4.512 Y-13.885 E156.22052
+G1 X-3.779 Y-14.103 E156.24052
+G1 X-3.036 Y-14.281 E156.26052
+G1 X-2.284 Y-14.420 E156.28052
+G1 X-1.526 Y-14.520 E156.30052
+G1 X-0.764 Y-14.580 E156.32052
+G1 X-0.000 Y-14.600 E156.34052
+G1 X0.764 Y-14.580 E156.36052
+G1 X1.526 Y-14.520 E156.38052
+G1 X2.284 Y-14.420 E156.40052
+G1 X3.036 Y-14.281 E156.42052
+G1 X3.779 Y-14.103 E156.44052
+G1 X4.512 Y-13.885 E156.46052
+G1 X5.232 Y-13.630 E156.48052
+G1 X5.938 Y-13.338 E156.50052
+G1 X6.628 Y-13.009 E156.52052
+G1 X7.300 Y-12.644 E156.54052
+G1 X7.952 Y-12.245 E156.56052
+G1 X8.582 Y-11.812 E156.58052
+G1 X9.188 Y-11.346 E156.60052
+G1 X9.769 Y-10.850 E156.62052
+G1 X10.324 Y-10.324 E156.64052
+G1 X10.850 Y-9.769 E156.66052
+G1 X11.346 Y-9.188 E156.68052
+G1 X11.812 Y-8.582 E156.70052
+G1 X12.245 Y-7.952 E156.72052
+G1 X12.644 Y-7.300 E156.74052
+G1 X13.009 Y-6.628 E156.76052
+G1 X13.338 Y-5.938 E156.78052
+G1 X13.630 Y-5.232 E156.80052
+G1 X13.885 Y-4.512 E156.82052
+G1 X14.103 Y-3.779 E156.84052
+G1 X14.281 Y-3.036 E156.86052
+G1 X14.420 Y-2.284 E156.88052
+G1 X14.520 Y-1.526 E156.90052
+G1 X14.580 Y-0.764 E156.92052
+G1 X14.600 Y-0.000 E156.94052
+G1 X5.713 Y-13.000 E156.94052 F7800
+G1 X-5.713 Y-13.000 E157.39757 F3600
+G1 X-7.592 Y-12.000 E157.39757 F7800
+G1 X7.592 Y-12.000 E158.00494 F3600
+G1 X8.980 Y-11.000 E158.00494 F7800
+G1 X-8.980 Y-11.000 E158.72334 F3600
+G1 X-10.082 Y-10.000 E158.72334 F7800
+G1 X10.082 Y-10.000 E159.52987 F3600
+G1 X10.984 Y-9.000 E159.52987 F7800
+G1 X-10.984 Y-9.000 E160.40856 F3600
+G1 X-11.732 Y-8.000 E160.40856 F7800
+G1 X11.732 Y-8.000 E161.34712 F3600
+G1 X12.355 Y-7.000 E161.34712 F7800
+G1 X-12.355 Y-7.000 E162.33550 F3600
+G1 X-12.870 Y-6.000 E162.33550 F7800
+G1 X12.870 Y-6.000 E163.36511 F3600
+G1 X13.291 Y-5.000 E163.36511 F7800
+G1 X-13.291 Y-5.000 E164.42836 F3600
+G1 X-13.625 Y-4.000 E164.42836 F7800
+G1 X13.625 Y-4.000 E165.51836 F3600
+G1 X13.879 Y-3.000 E165.51836 F7800
+G1 X-13.879 Y-3.000 E166.62871 F3600
+G1 X-14.058 Y-2.000 E166.62871 F7800
+G1 X14.058 Y-2.000 E167.75339 F3600
+G1 X14.165 Y-1.000 E167.75339 F7800
+G1 X-14.165 Y-1.000 E168.88657 F3600
+G1 X-14.200 Y0.000 E168.88657 F7800
+G1 X14.200 Y0.000 E170.02257 F3600
+G1 X14.165 Y1.000 E170.02257 F7800
+G1 X-14.165 Y1.000 E171.15575 F3600
+G1 X-14.058 Y2.000 E171.15575 F7800
+G1 X14.058 Y2.000 E172.28043 F3600
+G1 X13.879 Y3.000 E172.28043 F7800
+G1 X-13.879 Y3.000 E173.39078 F3600
+G1 X-13.625 Y4.000 E173.39078 F7800
+G1 X13.625 Y4.000 E174.48078 F3600
+G1 X13.291 Y5.000 E174.48078 F7800
+G1 X-13.291 Y5.000 E175.54403 F3600
+G1 X-12.870 Y6.000 E175.54403 F7800
+G1 X12.870 Y6.000 E176.57364 F3600
+G1 X12.355 Y7.000 E176.57364 F7800
+G1 X-12.355 Y7.000 E177.56202 F3600
+G1 X-11.732 Y8.000 E177.56202 F7800
+G1 X11.732 Y8.000 E178.50058 F3600
+G1 X10.984 Y9.000 E178.50058 F7800
+G1 X-10.984 Y9.000 E179.37927 F3600
+G1 X-10.082 Y10.000 E179.37927 F7800
+G1 X10.082 Y10.000 E180.18580 F3600
+G1 X8.980 Y11.000 E180.18580 F7800
+G1 X-8.980 Y11.000 E180.90420 F3600
+G1 X-7.592 Y12.000 E180.90420 F7800
+G1 X7.592 Y12.000 E181.51157 F3600
+G1 X5.713 Y13.000 E181.51157 F7800
+G1 X-5.713 Y13.000 E181.96862 F3600
+G1 X20.000 Y-10.000 E182.26862 F3000
+G1 X24.000 Y-10.000 E182.56862
+G1 X20.000 Y-8.000 E182.86862 F3000
+G1 X24.000 Y-8.000 E183.16862
+G1 X20.000 Y-6.000 E183.46862 F3000
+G1 X24.000 Y-6.000 E183.76862
+G1 X20.000 Y-4.000 E184.06862 F3000
+G1 X24.000 Y-4.000 E184.36862
+G1 X20.000 Y-2.000 E184.66862 F3000
+G1 X24.000 Y-2.000 E184.96862
+G1 X20.000 Y0.000 E185.26862 F3000
+G1 X24.000 Y0.000 E185.56862
+G1 X20.000 Y2.000 E185.86862 F3000
+G1 X24.000 Y2.000 E186.16862
+G1 X20.000 Y4.000 E186.46862 F3000
+G1 X24.000 Y4.000 E186.76862
+G1 X20.000 Y6.000 E187.06862 F3000
+G1 X24.000 Y6.000 E187.36862
+G1 X20.000 Y8.000 E187.66862 F3000
+G1 X24.000 Y8.000 E187.96862
+G1 Z1.500 F7800
+G1 E186.96862 F2400
+G1 E187.96862 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E187.98862 F1800
+G1 X14.918 Y1.568 E188.00862
+G1 X14.815 Y2.347 E188.02862
+G1 X14.672 Y3.119 E188.04862
+G1 X14.489 Y3.882 E188.06862
+G1 X14.266 Y4.635 E188.08862
+G1 X14.004 Y5.376 E188.10862
+G1 X13.703 Y6.101 E188.12862
+G1 X13.365 Y6.810 E188.14862
+G1 X12.990 Y7.500 E188.16862
+G1 X12.580 Y8.170 E188.18862
+G1 X12.135 Y8.817 E188.20862
+G1 X11.657 Y9.440 E188.22862
+G1 X11.147 Y10.037 E188.24862
+G1 X10.607 Y10.607 E188.26862
+G1 X10.037 Y11.147 E188.28862
+G1 X9.440 Y11.657 E188.30862
+G1 X8.817 Y12.135 E188.32862
+G1 X8.170 Y12.580 E188.34862
+G1 X7.500 Y12.990 E188.36862
+G1 X6.810 Y13.365 E188.38862
+G1 X6.101 Y13.703 E188.40862
+G1 X5.376 Y14.004 E188.42862
+G1 X4.635 Y14.266 E188.44862
+G1 X3.882 Y14.489 E188.46862
+G1 X3.119 Y14.672 E188.48862
+G1 X2.347 Y14.815 E188.50862
+G1 X1.568 Y14.918 E188.52862
+G1 X0.785 Y14.979 E188.54862
+G1 X0.000 Y15.000 E188.56862
+G1 X-0.785 Y14.979 E188.58862
+G1 X-1.568 Y14.918 E188.60862
+G1 X-2.347 Y14.815 E188.62862
+G1 X-3.119 Y14.672 E188.64862
+G1 X-3.882 Y14.489 E188.66862
+G1 X-4.635 Y14.266 E188.68862
+G1 X-5.376 Y14.004 E188.70862
+G1 X-6.101 Y13.703 E188.72862
+G1 X-6.810 Y13.365 E188.74862
+G1 X-7.500 Y12.990 E188.76862
+G1 X-8.170 Y12.580 E188.78862
+G1 X-8.817 Y12.135 E188.80862
+G1 X-9.440 Y11.657 E188.82862
+G1 X-10.037 Y11.147 E188.84862
+G1 X-10.607 Y10.607 E188.86862
+G1 X-11.147 Y10.037 E188.88862
+G1 X-11.657 Y9.440 E188.90862
+G1 X-12.135 Y8.817 E188.92862
+G1 X-12.580 Y8.170 E188.94862
+G1 X-12.990 Y7.500 E188.96862
+G1 X-13.365 Y6.810 E188.98862
+G1 X-13.703 Y6.101 E189.00862
+G1 X-14.004 Y5.376 E189.02862
+G1 X-14.266 Y4.635 E189.04862
+G1 X-14.489 Y3.882 E189.06862
+G1 X-14.672 Y3.119 E189.08862
+G1 X-14.815 Y2.347 E189.10862
+G1 X-14.918 Y1.568 E189.12862
+G1 X-14.979 Y0.785 E189.14862
+G1 X-15.000 Y0.000 E189.16862
+G1 X-14.979 Y-0.785 E189.18862
+G1 X-14.918 Y-1.568 E189.20862
+G1 X-14.815 Y-2.347 E189.22862
+G1 X-14.672 Y-3.119 E189.24862
+G1 X-14.489 Y-3.882 E189.26862
+G1 X-14.266 Y-4.635 E189.28862
+G1 X-14.004 Y-5.376 E189.30862
+G1 X-13.703 Y-6.101 E189.32862
+G1 X-13.365 Y-6.810 E189.34862
+G1 X-12.990 Y-7.500 E189.36862
+G1 X-12.580 Y-8.170 E189.38862
+G1 X-12.135 Y-8.817 E189.40862
+G1 X-11.657 Y-9.440 E189.42862
+G1 X-11.147 Y-10.037 E189.44862
+G1 X-10.607 Y-10.607 E189.46862
+G1 X-10.037 Y-11.147 E189.48862
+G1 X-9.440 Y-11.657 E189.50862
+G1 X-8.817 Y-12.135 E189.52862
+G1 X-8.170 Y-12.580 E189.54862
+G1 X-7.500 Y-12.990 E189.56862
+G1 X-6.810 Y-13.365 E189.58862
+G1 X-6.101 Y-13.703 E189.60862
+G1 X-5.376 Y-14.004 E189.62862
+G1 X-4.635 Y-14.266 E189.64862
+G1 X-3.882 Y-14.489 E189.66862
+G1 X-3.119 Y-14.672 E189.68862
+G1 X-2.347 Y-14.815 E189.70862
+G1 X-1.568 Y-14.918 E189.72862
+G1 X-0.785 Y-14.979 E189.74862
+G1 X-0.000 Y-15.000 E189.76862
+G1 X0.785 Y-14.979 E189.78862
+G1 X1.568 Y-14.918 E189.80862
+G1 X2.347 Y-14.815 E189.82862
+G1 X3.119 Y-14.672 E189.84862
+G1 X3.882 Y-14.489 E189.86862
+G1 X4.635 Y-14.266 E189.88862
+G1 X5.376 Y-14.004 E189.90862
+G1 X6.101 Y-13.703 E189.92862
+G1 X6.810 Y-13.365 E189.94862
+G1 X7.500 Y-12.990 E189.96862
+G1 X8.170 Y-12.580 E189.98862
+G1 X8.817 Y-12.135 E190.00862
+G1 X9.440 Y-11.657 E190.02862
+G1 X10.037 Y-11.147 E190.04862
+G1 X10.607 Y-10.607 E190.06862
+G1 X11.147 Y-10.037 E190.08862
+G1 X11.657 Y-9.440 E190.10862
+G1 X12.135 Y-8.817 E190.12862
+G1 X12.580 Y-8.170 E190.14862
+G1 X12.990 Y-7.500 E190.16862
+G1 X13.365 Y-6.810 E190.18862
+G1 X13.703 Y-6.101 E190.20862
+G1 X14.004 Y-5.376 E190.22862
+G1 X14.266 Y-4.635 E190.24862
+G1 X14.489 Y-3.882 E190.26862
+G1 X14.672 Y-3.119 E190.28862
+G1 X14.815 Y-2.347 E190.30862
+G1 X14.918 Y-1.568 E190.32862
+G1 X14.979 Y-0.785 E190.34862
+G1 X15.000 Y-0.000 E190.36862
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E190.38862 F1800
+G1 X14.520 Y1.526 E190.40862
+G1 X14.420 Y2.284 E190.42862
+G1 X14.281 Y3.036 E190.44862
+G1 X14.103 Y3.779 E190.46862
+G1 X13.885 Y4.512 E190.48862
+G1 X13.630 Y5.232 E190.50862
+G1 X13.338 Y5.938 E190.52862
+G1 X13.009 Y6.628 E190.54862
+G1 X12.644 Y7.300 E190.56862
+G1 X12.245 Y7.952 E190.58862
+G1 X11.812 Y8.582 E190.60862
+G1 X11.346 Y9.188 E190.62862
+G1 X10.850 Y9.769 E190.64862
+G1 X10.324 Y10.324 E190.66862
+G1 X9.769 Y10.850 E190.68862
+G1 X9.188 Y11.346 E190.70862
+G1 X8.582 Y11.812 E190.72862
+G1 X7.952 Y12.245 E190.74862
+G1 X7.300 Y12.644 E190.76862
+G1 X6.628 Y13.009 E190.78862
+G1 X5.938 Y13.338 E190.80862
+G1 X5.232 Y13.630 E190.82862
+G1 X4.512 Y13.885 E190.84862
+G1 X3.779 Y14.103 E190.86862
+G1 X3.036 Y14.281 E190.88862
+G1 X2.284 Y14.420 E190.90862
+G1 X1.526 Y14.520 E190.92862
+G1 X0.764 Y14.580 E190.94862
+G1 X0.000 Y14.600 E190.96862
+G1 X-0.764 Y14.580 E190.98862
+G1 X-1.526 Y14.520 E191.00862
+G1 X-2.284 Y14.420 E191.02862
+G1 X-3.036 Y14.281 E191.04862
+G1 X-3.779 Y14.103 E191.06862
+G1 X-4.512 Y13.885 E191.08862
+G1 X-5.232 Y13.630 E191.10862
+G1 X-5.938 Y13.338 E191.12862
+G1 X-6.628 Y13.009 E191.14862
+G1 X-7.300 Y12.644 E191.16862
+G1 X-7.952 Y12.245 E191.18862
+G1 X-8.582 Y11.812 E191.20862
+G1 X-9.188 Y11.346 E191.22862
+G1 X-9.769 Y10.850 E191.24862
+G1 X-10.324 Y10.324 E191.26862
+G1 X-10.850 Y9.769 E191.28862
+G1 X-11.346 Y9.188 E191.30862
+G1 X-11.812 Y8.582 E191.32862
+G1 X-12.245 Y7.952 E191.34862
+G1 X-12.644 Y7.300 E191.36862
+G1 X-13.009 Y6.628 E191.38862
+G1 X-13.338 Y5.938 E191.40862
+G1 X-13.630 Y5.232 E191.42862
+G1 X-13.885 Y4.512 E191.44862
+G1 X-14.103 Y3.779 E191.46862
+G1 X-14.281 Y3.036 E191.48862
+G1 X-14.420 Y2.284 E191.50862
+G1 X-14.520 Y1.526 E191.52862
+G1 X-14.580 Y0.764 E191.54862
+G1 X-14.600 Y0.000 E191.56862
+G1 X-14.580 Y-0.764 E191.58862
+G1 X-14.520 Y-1.526 E191.60862
+G1 X-14.420 Y-2.284 E191.62862
+G1 X-14.281 Y-3.036 E191.64862
+G1 X-14.103 Y-3.779 E191.66862
+G1 X-13.885 Y-4.512 E191.68862
+G1 X-13.630 Y-5.232 E191.70862
+G1 X-13.338 Y-5.938 E191.72862
+G1 X-13.009 Y-6.628 E191.74862
+G1 X-12.644 Y-7.300 E191.76862
+G1 X-12.245 Y-7.952 E191.78862
+G1 X-11.812 Y-8.582 E191.80862
+G1 X-11.346 Y-9.188 E191.82862
+G1 X-10.850 Y-9.769 E191.84862
+G1 X-10.324 Y-10.324 E191.86862
+G1 X-9.769 Y-10.850 E191.88862
+G1 X-9.188 Y-11.346 E191.90862
+G1 X-8.582 Y-11.812 E191.92862
+G1 X-7.952 Y-12.245 E191.94862
+G1 X-7.300 Y-12.644 E191.96862
+G1 X-6.628 Y-13.009 E191.98862
+G1 X-5.938 Y-13.338 E192.00862
+G1 X-5.232 Y-13.630 E192.02862
+G1 X-4.512 Y-13.885 E192.04862
+G1 X-3.779 Y-14.103 E192.06862
+G1 X-3.036 Y-14.281 E192.08862
+G1 X-2.284 Y-14.420 E192.10862
+G1 X-1.526 Y-14.520 E192.12862
+G1 X-0.764 Y-14.580 E192.14862
+G1 X-0.000 Y-14.600 E192.16862
+G1 X0.764 Y-14.580 E192.18862
+G1 X1.526 Y-14.520 E192.20862
+G1 X2.284 Y-14.420 E192.22862
+G1 X3.036 Y-14.281 E192.24862
+G1 X3.779 Y-14.103 E192.26862
+G1 X4.512 Y-13.885 E192.28862
+G1 X5.232 Y-13.630 E192.30862
+G1 X5.938 Y-13.338 E192.32862
+G1 X6.628 Y-13.009 E192.34862
+G1 X7.300 Y-12.644 E192.36862
+G1 X7.952 Y-12.245 E192.38862
+G1 X8.582 Y-11.812 E192.40862
+G1 X9.188 Y-11.346 E192.42862
+G1 X9.769 Y-10.850 E192.44862
+G1 X10.324 Y-10.324 E192.46862
+G1 X10.850 Y-9.769 E192.48862
+G1 X11.346 Y-9.188 E192.50862
+G1 X11.812 Y-8.582 E192.52862
+G1 X12.245 Y-7.952 E192.54862
+G1 X12.644 Y-7.300 E192.56862
+G1 X13.009 Y-6.628 E192.58862
+G1 X13.338 Y-5.938 E192.60862
+G1 X13.630 Y-5.232 E192.62862
+G1 X13.885 Y-4.512 E192.64862
+G1 X14.103 Y-3.779 E192.66862
+G1 X14.281 Y-3.036 E192.68862
+G1 X14.420 Y-2.284 E192.70862
+G1 X14.520 Y-1.526 E192.72862
+G1 X14.580 Y-0.764 E192.74862
+G1 X14.600 Y-0.000 E192.76862
+G1 X5.713 Y-13.000 E192.76862 F7800
+G1 X-5.713 Y-13.000 E193.22567 F3600
+G1 X-7.592 Y-12.000 E193.22567 F7800
+G1 X7.592 Y-12.000 E193.83304 F3600
+G1 X8.980 Y-11.000 E193.83304 F7800
+G1 X-8.980 Y-11.000 E194.55144 F3600
+G1 X-10.082 Y-10.000 E194.55144 F7800
+G1 X10.082 Y-10.000 E195.35797 F3600
+G1 X10.984 Y-9.000 E195.35797 F7800
+G1 X-10.984 Y-9.000 E196.23666 F3600
+G1 X-11.732 Y-8.000 E196.23666 F7800
+G1 X11.732 Y-8.000 E197.17522 F3600
+G1 X12.355 Y-7.000 E197.17522 F7800
+G1 X-12.355 Y-7.000 E198.16360 F3600
+G1 X-12.870 Y-6.000 E198.16360 F7800
+G1 X12.870 Y-6.000 E199.19321 F3600
+G1 X13.291 Y-5.000 E199.19321 F7800
+G1 X-13.291 Y-5.000 E200.25646 F3600
+G1 X-13.625 Y-4.000 E200.25646 F7800
+G1 X13.625 Y-4.000 E201.34646 F3600
+G1 X13.879 Y-3.000 E201.34646 F7800
+G1 X-13.879 Y-3.000 E202.45682 F3600
+G1 X-14.058 Y-2.000 E202.45682 F7800
+G1 X14.058 Y-2.000 E203.58149 F3600
+G1 X14.165 Y-1.000 E203.58149 F7800
+G1 X-14.165 Y-1.000 E204.71467 F3600
+G1 X-14.200 Y0.000 E204.71467 F7800
+G1 X14.200 Y0.000 E205.85067 F3600
+G1 X14.165 Y1.000 E205.85067 F7800
+G1 X-14.165 Y1.000 E206.98385 F3600
+G1 X-14.058 Y2.000 E206.98385 F7800
+G1 X14.058 Y2.000 E208.10853 F3600
+G1 X13.879 Y3.000 E208.10853 F7800
+G1 X-13.879 Y3.000 E209.21889 F3600
+G1 X-13.625 Y4.000 E209.21889 F7800
+G1 X13.625 Y4.000 E210.30889 F3600
+G1 X13.291 Y5.000 E210.30889 F7800
+G1 X-13.291 Y5.000 E211.37213 F3600
+G1 X-12.870 Y6.000 E211.37213 F7800
+G1 X12.870 Y6.000 E212.40174 F3600
+G1 X12.355 Y7.000 E212.40174 F7800
+G1 X-12.355 Y7.000 E213.39012 F3600
+G1 X-11.732 Y8.000 E213.39012 F7800
+G1 X11.732 Y8.000 E214.32868 F3600
+G1 X10.984 Y9.000 E214.32868 F7800
+G1 X-10.984 Y9.000 E215.20737 F3600
+G1 X-10.082 Y10.000 E215.20737 F7800
+G1 X10.082 Y10.000 E216.01391 F3600
+G1 X8.980 Y11.000 E216.01391 F7800
+G1 X-8.980 Y11.000 E216.73231 F3600
+G1 X-7.592 Y12.000 E216.73231 F7800
+G1 X7.592 Y12.000 E217.33967 F3600
+G1 X5.713 Y13.000 E217.33967 F7800
+G1 X-5.713 Y13.000 E217.79673 F3600
+G1 Z1.700 F7800
+G1 E216.79673 F2400
+G1 E217.79673 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E217.81673 F1800
+G1 X14.918 Y1.568 E217.83673
+G1 X14.815 Y2.347 E217.85673
+G1 X14.672 Y3.119 E217.87673
+G1 X14.489 Y3.882 E217.89673
+G1 X14.266 Y4.635 E217.91673
+G1 X14.004 Y5.376 E217.93673
+G1 X13.703 Y6.101 E217.95673
+G1 X13.365 Y6.810 E217.97673
+G1 X12.990 Y7.500 E217.99673
+G1 X12.580 Y8.170 E218.01673
+G1 X12.135 Y8.817 E218.03673
+G1 X11.657 Y9.440 E218.05673
+G1 X11.147 Y10.037 E218.07673
+G1 X10.607 Y10.607 E218.09673
+G1 X10.037 Y11.147 E218.11673
+G1 X9.440 Y11.657 E218.13673
+G1 X8.817 Y12.135 E218.15673
+G1 X8.170 Y12.580 E218.17673
+G1 X7.500 Y12.990 E218.19673
+G1 X6.810 Y13.365 E218.21673
+G1 X6.101 Y13.703 E218.23673
+G1 X5.376 Y14.004 E218.25673
+G1 X4.635 Y14.266 E218.27673
+G1 X3.882 Y14.489 E218.29673
+G1 X3.119 Y14.672 E218.31673
+G1 X2.347 Y14.815 E218.33673
+G1 X1.568 Y14.918 E218.35673
+G1 X0.785 Y14.979 E218.37673
+G1 X0.000 Y15.000 E218.39673
+G1 X-0.785 Y14.979 E218.41673
+G1 X-1.568 Y14.918 E218.43673
+G1 X-2.347 Y14.815 E218.45673
+G1 X-3.119 Y14.672 E218.47673
+G1 X-3.882 Y14.489 E218.49673
+G1 X-4.635 Y14.266 E218.51673
+G1 X-5.376 Y14.004 E218.53673
+G1 X-6.101 Y13.703 E218.55673
+G1 X-6.810 Y13.365 E218.57673
+G1 X-7.500 Y12.990 E218.59673
+G1 X-8.170 Y12.580 E218.61673
+G1 X-8.817 Y12.135 E218.63673
+G1 X-9.440 Y11.657 E218.65673
+G1 X-10.037 Y11.147 E218.67673
+G1 X-10.607 Y10.607 E218.69673
+G1 X-11.147 Y10.037 E218.71673
+G1 X-11.657 Y9.440 E218.73673
+G1 X-12.135 Y8.817 E218.75673
+G1 X-12.580 Y8.170 E218.77673
+G1 X-12.990 Y7.500 E218.79673
+G1 X-13.365 Y6.810 E218.81673
+G1 X-13.703 Y6.101 E218.83673
+G1 X-14.004 Y5.376 E218.85673
+G1 X-14.266 Y4.635 E218.87673
+G1 X-14.489 Y3.882 E218.89673
+G1 X-14.672 Y3.119 E218.91673
+G1 X-14.815 Y2.347 E218.93673
+G1 X-14.918 Y1.568 E218.95673
+G1 X-14.979 Y0.785 E218.97673
+G1 X-15.000 Y0.000 E218.99673
+G1 X-14.979 Y-0.785 E219.01673
+G1 X-14.918 Y-1.568 E219.03673
+G1 X-14.815 Y-2.347 E219.05673
+G1 X-14.672 Y-3.119 E219.07673
+G1 X-14.489 Y-3.882 E219.09673
+G1 X-14.266 Y-4.635 E219.11673
+G1 X-14.004 Y-5.376 E219.13673
+G1 X-13.703 Y-6.101 E219.15673
+G1 X-13.365 Y-6.810 E219.17673
+G1 X-12.990 Y-7.500 E219.19673
+G1 X-12.580 Y-8.170 E219.21673
+G1 X-12.135 Y-8.817 E219.23673
+G1 X-11.657 Y-9.440 E219.25673
+G1 X-11.147 Y-10.037 E219.27673
+G1 X-10.607 Y-10.607 E219.29673
+G1 X-10.037 Y-11.147 E219.31673
+G1 X-9.440 Y-11.657 E219.33673
+G1 X-8.817 Y-12.135 E219.35673
+G1 X-8.170 Y-12.580 E219.37673
+G1 X-7.500 Y-12.990 E219.39673
+G1 X-6.810 Y-13.365 E219.41673
+G1 X-6.101 Y-13.703 E219.43673
+G1 X-5.376 Y-14.004 E219.45673
+G1 X-4.635 Y-14.266 E219.47673
+G1 X-3.882 Y-14.489 E219.49673
+G1 X-3.119 Y-14.672 E219.51673
+G1 X-2.347 Y-14.815 E219.53673
+G1 X-1.568 Y-14.918 E219.55673
+G1 X-0.785 Y-14.979 E219.57673
+G1 X-0.000 Y-15.000 E219.59673
+G1 X0.785 Y-14.979 E219.61673
+G1 X1.568 Y-14.918 E219.63673
+G1 X2.347 Y-14.815 E219.65673
+G1 X3.119 Y-14.672 E219.67673
+G1 X3.882 Y-14.489 E219.69673
+G1 X4.635 Y-14.266 E219.71673
+G1 X5.376 Y-14.004 E219.73673
+G1 X6.101 Y-13.703 E219.75673
+G1 X6.810 Y-13.365 E219.77673
+G1 X7.500 Y-12.990 E219.79673
+G1 X8.170 Y-12.580 E219.81673
+G1 X8.817 Y-12.135 E219.83673
+G1 X9.440 Y-11.657 E219.85673
+G1 X10.037 Y-11.147 E219.87673
+G1 X10.607 Y-10.607 E219.89673
+G1 X11.147 Y-10.037 E219.91673
+G1 X11.657 Y-9.440 E219.93673
+G1 X12.135 Y-8.817 E219.95673
+G1 X12.580 Y-8.170 E219.97673
+G1 X12.990 Y-7.500 E219.99673
+G1 X13.365 Y-6.810 E220.01673
+G1 X13.703 Y-6.101 E220.03673
+G1 X14.004 Y-5.376 E220.05673
+G1 X14.266 Y-4.635 E220.07673
+G1 X14.489 Y-3.882 E220.09673
+G1 X14.672 Y-3.119 E220.11673
+G1 X14.815 Y-2.347 E220.13673
+G1 X14.918 Y-1.568 E220.15673
+G1 X14.979 Y-0.785 E220.17673
+G1 X15.000 Y-0.000 E220.19673
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E220.21673 F1800
+G1 X14.520 Y1.526 E220.23673
+G1 X14.420 Y2.284 E220.25673
+G1 X14.281 Y3.036 E220.27673
+G1 X14.103 Y3.779 E220.29673
+G1 X13.885 Y4.512 E220.31673
+G1 X13.630 Y5.232 E220.33673
+G1 X13.338 Y5.938 E220.35673
+G1 X13.009 Y6.628 E220.37673
+G1 X12.644 Y7.300 E220.39673
+G1 X12.245 Y7.952 E220.41673
+G1 X11.812 Y8.582 E220.43673
+G1 X11.346 Y9.188 E220.45673
+G1 X10.850 Y9.769 E220.47673
+G1 X10.324 Y10.324 E220.49673
+G1 X9.769 Y10.850 E220.51673
+G1 X9.188 Y11.346 E220.53673
+G1 X8.582 Y11.812 E220.55673
+G1 X7.952 Y12.245 E220.57673
+G1 X7.300 Y12.644 E220.59673
+G1 X6.628 Y13.009 E220.61673
+G1 X5.938 Y13.338 E220.63673
+G1 X5.232 Y13.630 E220.65673
+G1 X4.512 Y13.885 E220.67673
+G1 X3.779 Y14.103 E220.69673
+G1 X3.036 Y14.281 E220.71673
+G1 X2.284 Y14.420 E220.73673
+G1 X1.526 Y14.520 E220.75673
+G1 X0.764 Y14.580 E220.77673
+G1 X0.000 Y14.600 E220.79673
+G1 X-0.764 Y14.580 E220.81673
+G1 X-1.526 Y14.520 E220.83673
+G1 X-2.284 Y14.420 E220.85673
+G1 X-3.036 Y14.281 E220.87673
+G1 X-3.779 Y14.103 E220.89673
+G1 X-4.512 Y13.885 E220.91673
+G1 X-5.232 Y13.630 E220.93673
+G1 X-5.938 Y13.338 E220.95673
+G1 X-6.628 Y13.009 E220.97673
+G1 X-7.300 Y12.644 E220.99673
+G1 X-7.952 Y12.245 E221.01673
+G1 X-8.582 Y11.812 E221.03673
+G1 X-9.188 Y11.346 E221.05673
+G1 X-9.769 Y10.850 E221.07673
+G1 X-10.324 Y10.324 E221.09673
+G1 X-10.850 Y9.769 E221.11673
+G1 X-11.346 Y9.188 E221.13673
+G1 X-11.812 Y8.582 E221.15673
+G1 X-12.245 Y7.952 E221.17673
+G1 X-12.644 Y7.300 E221.19673
+G1 X-13.009 Y6.628 E221.21673
+G1 X-13.338 Y5.938 E221.23673
+G1 X-13.630 Y5.232 E221.25673
+G1 X-13.885 Y4.512 E221.27673
+G1 X-14.103 Y3.779 E221.29673
+G1 X-14.281 Y3.036 E221.31673
+G1 X-14.420 Y2.284 E221.33673
+G1 X-14.520 Y1.526 E221.35673
+G1 X-14.580 Y0.764 E221.37673
+G1 X-14.600 Y0.000 E221.39673
+G1 X-14.580 Y-0.764 E221.41673
+G1 X-14.520 Y-1.526 E221.43673
+G1 X-14.420 Y-2.284 E221.45673
+G1 X-14.281 Y-3.036 E221.47673
+G1 X-14.103 Y-3.779 E221.49673
+G1 X-13.885 Y-4.512 E221.51673
+G1 X-13.630 Y-5.232 E221.53673
+G1 X-13.338 Y-5.938 E221.55673
+G1 X-13.009 Y-6.628 E221.57673
+G1 X-12.644 Y-7.300 E221.59673
+G1 X-12.245 Y-7.952 E221.61673
+G1 X-11.812 Y-8.582 E221.63673
+G1 X-11.346 Y-9.188 E221.65673
+G1 X-10.850 Y-9.769 E221.67673
+G1 X-10.324 Y-10.324 E221.69673
+G1 X-9.769 Y-10.850 E221.71673
+G1 X-9.188 Y-11.346 E221.73673
+G1 X-8.582 Y-11.812 E221.75673
+G1 X-7.952 Y-12.245 E221.77673
+G1 X-7.300 Y-12.644 E221.79673
+G1 X-6.628 Y-13.009 E221.81673
+G1 X-5.938 Y-13.338 E221.83673
+G1 X-5.232 Y-13.630 E221.85673
+G1 X-4.512 Y-13.885 E221.87673
+G1 X-3.779 Y-14.103 E221.89673
+G1 X-3.036 Y-14.281 E221.91673
+G1 X-2.284 Y-14.420 E221.93673
+G1 X-1.526 Y-14.520 E221.95673
+G1 X-0.764 Y-14.580 E221.97673
+G1 X-0.000 Y-14.600 E221.99673
+G1 X0.764 Y-14.580 E222.01673
+G1 X1.526 Y-14.520 E222.03673
+G1 X2.284 Y-14.420 E222.05673
+G1 X3.036 Y-14.281 E222.07673
+G1 X3.779 Y-14.103 E222.09673
+G1 X4.512 Y-13.885 E222.11673
+G1 X5.232 Y-13.630 E222.13673
+G1 X5.938 Y-13.338 E222.15673
+G1 X6.628 Y-13.009 E222.17673
+G1 X7.300 Y-12.644 E222.19673
+G1 X7.952 Y-12.245 E222.21673
+G1 X8.582 Y-11.812 E222.23673
+G1 X9.188 Y-11.346 E222.25673
+G1 X9.769 Y-10.850 E222.27673
+G1 X10.324 Y-10.324 E222.29673
+G1 X10.850 Y-9.769 E222.31673
+G1 X11.346 Y-9.188 E222.33673
+G1 X11.812 Y-8.582 E222.35673
+G1 X12.245 Y-7.952 E222.37673
+G1 X12.644 Y-7.300 E222.39673
+G1 X13.009 Y-6.628 E222.41673
+G1 X13.338 Y-5.938 E222.43673
+G1 X13.630 Y-5.232 E222.45673
+G1 X13.885 Y-4.512 E222.47673
+G1 X14.103 Y-3.779 E222.49673
+G1 X14.281 Y-3.036 E222.51673
+G1 X14.420 Y-2.284 E222.53673
+G1 X14.520 Y-1.526 E222.55673
+G1 X14.580 Y-0.764 E222.57673
+G1 X14.600 Y-0.000 E222.59673
+G1 X5.713 Y-13.000 E222.59673 F7800
+G1 X-5.713 Y-13.000 E223.05378 F3600
+G1 X-7.592 Y-12.000 E223.05378 F7800
+G1 X7.592 Y-12.000 E223.66114 F3600
+G1 X8.980 Y-11.000 E223.66114 F7800
+G1 X-8.980 Y-11.000 E224.37954 F3600
+G1 X-10.082 Y-10.000 E224.37954 F7800
+G1 X10.082 Y-10.000 E225.18608 F3600
+G1 X10.984 Y-9.000 E225.18608 F7800
+G1 X-10.984 Y-9.000 E226.06477 F3600
+G1 X-11.732 Y-8.000 E226.06477 F7800
+G1 X11.732 Y-8.000 E227.00333 F3600
+G1 X12.355 Y-7.000 E227.00333 F7800
+G1 X-12.355 Y-7.000 E227.99171 F3600
+G1 X-12.870 Y-6.000 E227.99171 F7800
+G1 X12.870 Y-6.000 E229.02132 F3600
+G1 X13.291 Y-5.000 E229.02132 F7800
+G1 X-13.291 Y-5.000 E230.08456 F3600
+G1 X-13.625 Y-4.000 E230.08456 F7800
+G1 X13.625 Y-4.000 E231.17456 F3600
+G1 X13.879 Y-3.000 E231.17456 F7800
+G1 X-13.879 Y-3.000 E232.28492 F3600
+G1 X-14.058 Y-2.000 E232.28492 F7800
+G1 X14.058 Y-2.000 E233.40960 F3600
+G1 X14.165 Y-1.000 E233.40960 F7800
+G1 X-14.165 Y-1.000 E234.54278 F3600
+G1 X-14.200 Y0.000 E234.54278 F7800
+G1 X14.200 Y0.000 E235.67878 F3600
+G1 X14.165 Y1.000 E235.67878 F7800
+G1 X-14.165 Y1.000 E236.81196 F3600
+G1 X-14.058 Y2.000 E236.81196 F7800
+G1 X14.058 Y2.000 E237.93663 F3600
+G1 X13.879 Y3.000 E237.93663 F7800
+G1 X-13.879 Y3.000 E239.04699 F3600
+G1 X-13.625 Y4.000 E239.04699 F7800
+G1 X13.625 Y4.000 E240.13699 F3600
+G1 X13.291 Y5.000 E240.13699 F7800
+G1 X-13.291 Y5.000 E241.20024 F3600
+G1 X-12.870 Y6.000 E241.20024 F7800
+G1 X12.870 Y6.000 E242.22985 F3600
+G1 X12.355 Y7.000 E242.22985 F7800
+G1 X-12.355 Y7.000 E243.21823 F3600
+G1 X-11.732 Y8.000 E243.21823 F7800
+G1 X11.732 Y8.000 E244.15679 F3600
+G1 X10.984 Y9.000 E244.15679 F7800
+G1 X-10.984 Y9.000 E245.03548 F3600
+G1 X-10.082 Y10.000 E245.03548 F7800
+G1 X10.082 Y10.000 E245.84201 F3600
+G1 X8.980 Y11.000 E245.84201 F7800
+G1 X-8.980 Y11.000 E246.56041 F3600
+G1 X-7.592 Y12.000 E246.56041 F7800
+G1 X7.592 Y12.000 E247.16778 F3600
+G1 X5.713 Y13.000 E247.16778 F7800
+G1 X-5.713 Y13.000 E247.62483 F3600
+G1 Z1.900 F7800
+G1 E246.62483 F2400
+G1 E247.62483 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E247.64483 F1800
+G1 X14.918 Y1.568 E247.66483
+G1 X14.815 Y2.347 E247.68483
+G1 X14.672 Y3.119 E247.70483
+G1 X14.489 Y3.882 E247.72483
+G1 X14.266 Y4.635 E247.74483
+G1 X14.004 Y5.376 E247.76483
+G1 X13.703 Y6.101 E247.78483
+G1 X13.365 Y6.810 E247.80483
+G1 X12.990 Y7.500 E247.82483
+G1 X12.580 Y8.170 E247.84483
+G1 X12.135 Y8.817 E247.86483
+G1 X11.657 Y9.440 E247.88483
+G1 X11.147 Y10.037 E247.90483
+G1 X10.607 Y10.607 E247.92483
+G1 X10.037 Y11.147 E247.94483
+G1 X9.440 Y11.657 E247.96483
+G1 X8.817 Y12.135 E247.98483
+G1 X8.170 Y12.580 E248.00483
+G1 X7.500 Y12.990 E248.02483
+G1 X6.810 Y13.365 E248.04483
+G1 X6.101 Y13.703 E248.06483
+G1 X5.376 Y14.004 E248.08483
+G1 X4.635 Y14.266 E248.10483
+G1 X3.882 Y14.489 E248.12483
+G1 X3.119 Y14.672 E248.14483
+G1 X2.347 Y14.815 E248.16483
+G1 X1.568 Y14.918 E248.18483
+G1 X0.785 Y14.979 E248.20483
+G1 X0.000 Y15.000 E248.22483
+G1 X-0.785 Y14.979 E248.24483
+G1 X-1.568 Y14.918 E248.26483
+G1 X-2.347 Y14.815 E248.28483
+G1 X-3.119 Y14.672 E248.30483
+G1 X-3.882 Y14.489 E248.32483
+G1 X-4.635 Y14.266 E248.34483
+G1 X-5.376 Y14.004 E248.36483
+G1 X-6.101 Y13.703 E248.38483
+G1 X-6.810 Y13.365 E248.40483
+G1 X-7.500 Y12.990 E248.42483
+G1 X-8.170 Y12.580 E248.44483
+G1 X-8.817 Y12.135 E248.46483
+G1 X-9.440 Y11.657 E248.48483
+G1 X-10.037 Y11.147 E248.50483
+G1 X-10.607 Y10.607 E248.52483
+G1 X-11.147 Y10.037 E248.54483
+G1 X-11.657 Y9.440 E248.56483
+G1 X-12.135 Y8.817 E248.58483
+G1 X-12.580 Y8.170 E248.60483
+G1 X-12.990 Y7.500 E248.62483
+G1 X-13.365 Y6.810 E248.64483
+G1 X-13.703 Y6.101 E248.66483
+G1 X-14.004 Y5.376 E248.68483
+G1 X-14.266 Y4.635 E248.70483
+G1 X-14.489 Y3.882 E248.72483
+G1 X-14.672 Y3.119 E248.74483
+G1 X-14.815 Y2.347 E248.76483
+G1 X-14.918 Y1.568 E248.78483
+G1 X-14.979 Y0.785 E248.80483
+G1 X-15.000 Y0.000 E248.82483
+G1 X-14.979 Y-0.785 E248.84483
+G1 X-14.918 Y-1.568 E248.86483
+G1 X-14.815 Y-2.347 E248.88483
+G1 X-14.672 Y-3.119 E248.90483
+G1 X-14.489 Y-3.882 E248.92483
+G1 X-14.266 Y-4.635 E248.94483
+G1 X-14.004 Y-5.376 E248.96483
+G1 X-13.703 Y-6.101 E248.98483
+G1 X-13.365 Y-6.810 E249.00483
+G1 X-12.990 Y-7.500 E249.02483
+G1 X-12.580 Y-8.170 E249.04483
+G1 X-12.135 Y-8.817 E249.06483
+G1 X-11.657 Y-9.440 E249.08483
+G1 X-11.147 Y-10.037 E249.10483
+G1 X-10.607 Y-10.607 E249.12483
+G1 X-10.037 Y-11.147 E249.14483
+G1 X-9.440 Y-11.657 E249.16483
+G1 X-8.817 Y-12.135 E249.18483
+G1 X-8.170 Y-12.580 E249.20483
+G1 X-7.500 Y-12.990 E249.22483
+G1 X-6.810 Y-13.365 E249.24483
+G1 X-6.101 Y-13.703 E249.26483
+G1 X-5.376 Y-14.004 E249.28483
+G1 X-4.635 Y-14.266 E249.30483
+G1 X-3.882 Y-14.489 E249.32483
+G1 X-3.119 Y-14.672 E249.34483
+G1 X-2.347 Y-14.815 E249.36483
+G1 X-1.568 Y-14.918 E249.38483
+G1 X-0.785 Y-14.979 E249.40483
+G1 X-0.000 Y-15.000 E249.42483
+G1 X0.785 Y-14.979 E249.44483
+G1 X1.568 Y-14.918 E249.46483
+G1 X2.347 Y-14.815 E249.48483
+G1 X3.119 Y-14.672 E249.50483
+G1 X3.882 Y-14.489 E249.52483
+G1 X4.635 Y-14.266 E249.54483
+G1 X5.376 Y-14.004 E249.56483
+G1 X6.101 Y-13.703 E249.58483
+G1 X6.810 Y-13.365 E249.60483
+G1 X7.500 Y-12.990 E249.62483
+G1 X8.170 Y-12.580 E249.64483
+G1 X8.817 Y-12.135 E249.66483
+G1 X9.440 Y-11.657 E249.68483
+G1 X10.037 Y-11.147 E249.70483
+G1 X10.607 Y-10.607 E249.72483
+G1 X11.147 Y-10.037 E249.74483
+G1 X11.657 Y-9.440 E249.76483
+G1 X12.135 Y-8.817 E249.78483
+G1 X12.580 Y-8.170 E249.80483
+G1 X12.990 Y-7.500 E249.82483
+G1 X13.365 Y-6.810 E249.84483
+G1 X13.703 Y-6.101 E249.86483
+G1 X14.004 Y-5.376 E249.88483
+G1 X14.266 Y-4.635 E249.90483
+G1 X14.489 Y-3.882 E249.92483
+G1 X14.672 Y-3.119 E249.94483
+G1 X14.815 Y-2.347 E249.96483
+G1 X14.918 Y-1.568 E249.98483
+G1 X14.979 Y-0.785 E250.00483
+G1 X15.000 Y-0.000 E250.02483
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E250.04483 F1800
+G1 X14.520 Y1.526 E250.06483
+G1 X14.420 Y2.284 E250.08483
+G1 X14.281 Y3.036 E250.10483
+G1 X14.103 Y3.779 E250.12483
+G1 X13.885 Y4.512 E250.14483
+G1 X13.630 Y5.232 E250.16483
+G1 X13.338 Y5.938 E250.18483
+G1 X13.009 Y6.628 E250.20483
+G1 X12.644 Y7.300 E250.22483
+G1 X12.245 Y7.952 E250.24483
+G1 X11.812 Y8.582 E250.26483
+G1 X11.346 Y9.188 E250.28483
+G1 X10.850 Y9.769 E250.30483
+G1 X10.324 Y10.324 E250.32483
+G1 X9.769 Y10.850 E250.34483
+G1 X9.188 Y11.346 E250.36483
+G1 X8.582 Y11.812 E250.38483
+G1 X7.952 Y12.245 E250.40483
+G1 X7.300 Y12.644 E250.42483
+G1 X6.628 Y13.009 E250.44483
+G1 X5.938 Y13.338 E250.46483
+G1 X5.232 Y13.630 E250.48483
+G1 X4.512 Y13.885 E250.50483
+G1 X3.779 Y14.103 E250.52483
+G1 X3.036 Y14.281 E250.54483
+G1 X2.284 Y14.420 E250.56483
+G1 X1.526 Y14.520 E250.58483
+G1 X0.764 Y14.580 E250.60483
+G1 X0.000 Y14.600 E250.62483
+G1 X-0.764 Y14.580 E250.64483
+G1 X-1.526 Y14.520 E250.66483
+G1 X-2.284 Y14.420 E250.68483
+G1 X-3.036 Y14.281 E250.70483
+G1 X-3.779 Y14.103 E250.72483
+G1 X-4.512 Y13.885 E250.74483
+G1 X-5.232 Y13.630 E250.76483
+G1 X-5.938 Y13.338 E250.78483
+G1 X-6.628 Y13.009 E250.80483
+G1 X-7.300 Y12.644 E250.82483
+G1 X-7.952 Y12.245 E250.84483
+G1 X-8.582 Y11.812 E250.86483
+G1 X-9.188 Y11.346 E250.88483
+G1 X-9.769 Y10.850 E250.90483
+G1 X-10.324 Y10.324 E250.92483
+G1 X-10.850 Y9.769 E250.94483
+G1 X-11.346 Y9.188 E250.96483
+G1 X-11.812 Y8.582 E250.98483
+G1 X-12.245 Y7.952 E251.00483
+G1 X-12.644 Y7.300 E251.02483
+G1 X-13.009 Y6.628 E251.04483
+G1 X-13.338 Y5.938 E251.06483
+G1 X-13.630 Y5.232 E251.08483
+G1 X-13.885 Y4.512 E251.10483
+G1 X-14.103 Y3.779 E251.12483
+G1 X-14.281 Y3.036 E251.14483
+G1 X-14.420 Y2.284 E251.16483
+G1 X-14.520 Y1.526 E251.18483
+G1 X-14.580 Y0.764 E251.20483
+G1 X-14.600 Y0.000 E251.22483
+G1 X-14.580 Y-0.764 E251.24483
+G1 X-14.520 Y-1.526 E251.26483
+G1 X-14.420 Y-2.284 E251.28483
+G1 X-14.281 Y-3.036 E251.30483
+G1 X-14.103 Y-3.779 E251.32483
+G1 X-13.885 Y-4.512 E251.34483
+G1 X-13.630 Y-5.232 E251.36483
+G1 X-13.338 Y-5.938 E251.38483
+G1 X-13.009 Y-6.628 E251.40483
+G1 X-12.644 Y-7.300 E251.42483
+G1 X-12.245 Y-7.952 E251.44483
+G1 X-11.812 Y-8.582 E251.46483
+G1 X-11.346 Y-9.188 E251.48483
+G1 X-10.850 Y-9.769 E251.50483
+G1 X-10.324 Y-10.324 E251.52483
+G1 X-9.769 Y-10.850 E251.54483
+G1 X-9.188 Y-11.346 E251.56483
+G1 X-8.582 Y-11.812 E251.58483
+G1 X-7.952 Y-12.245 E251.60483
+G1 X-7.300 Y-12.644 E251.62483
+G1 X-6.628 Y-13.009 E251.64483
+G1 X-5.938 Y-13.338 E251.66483
+G1 X-5.232 Y-13.630 E251.68483
+G1 X-4.512 Y-13.885 E251.70483
+G1 X-3.779 Y-14.103 E251.72483
+G1 X-3.036 Y-14.281 E251.74483
+G1 X-2.284 Y-14.420 E251.76483
+G1 X-1.526 Y-14.520 E251.78483
+G1 X-0.764 Y-14.580 E251.80483
+G1 X-0.000 Y-14.600 E251.82483
+G1 X0.764 Y-14.580 E251.84483
+G1 X1.526 Y-14.520 E251.86483
+G1 X2.284 Y-14.420 E251.88483
+G1 X3.036 Y-14.281 E251.90483
+G1 X3.779 Y-14.103 E251.92483
+G1 X4.512 Y-13.885 E251.94483
+G1 X5.232 Y-13.630 E251.96483
+G1 X5.938 Y-13.338 E251.98483
+G1 X6.628 Y-13.009 E252.00483
+G1 X7.300 Y-12.644 E252.02483
+G1 X7.952 Y-12.245 E252.04483
+G1 X8.582 Y-11.812 E252.06483
+G1 X9.188 Y-11.346 E252.08483
+G1 X9.769 Y-10.850 E252.10483
+G1 X10.324 Y-10.324 E252.12483
+G1 X10.850 Y-9.769 E252.14483
+G1 X11.346 Y-9.188 E252.16483
+G1 X11.812 Y-8.582 E252.18483
+G1 X12.245 Y-7.952 E252.20483
+G1 X12.644 Y-7.300 E252.22483
+G1 X13.009 Y-6.628 E252.24483
+G1 X13.338 Y-5.938 E252.26483
+G1 X13.630 Y-5.232 E252.28483
+G1 X13.885 Y-4.512 E252.30483
+G1 X14.103 Y-3.779 E252.32483
+G1 X14.281 Y-3.036 E252.34483
+G1 X14.420 Y-2.284 E252.36483
+G1 X14.520 Y-1.526 E252.38483
+G1 X14.580 Y-0.764 E252.40483
+G1 X14.600 Y-0.000 E252.42483
+G1 X5.713 Y-13.000 E252.42483 F7800
+G1 X-5.713 Y-13.000 E252.88188 F3600
+G1 X-7.592 Y-12.000 E252.88188 F7800
+G1 X7.592 Y-12.000 E253.48925 F3600
+G1 X8.980 Y-11.000 E253.48925 F7800
+G1 X-8.980 Y-11.000 E254.20765 F3600
+G1 X-10.082 Y-10.000 E254.20765 F7800
+G1 X10.082 Y-10.000 E255.01418 F3600
+G1 X10.984 Y-9.000 E255.01418 F7800
+G1 X-10.984 Y-9.000 E255.89287 F3600
+G1 X-11.732 Y-8.000 E255.89287 F7800
+G1 X11.732 Y-8.000 E256.83143 F3600
+G1 X12.355 Y-7.000 E256.83143 F7800
+G1 X-12.355 Y-7.000 E257.81981 F3600
+G1 X-12.870 Y-6.000 E257.81981 F7800
+G1 X12.870 Y-6.000 E258.84942 F3600
+G1 X13.291 Y-5.000 E258.84942 F7800
+G1 X-13.291 Y-5.000 E259.91267 F3600
+G1 X-13.625 Y-4.000 E259.91267 F7800
+G1 X13.625 Y-4.000 E261.00267 F3600
+G1 X13.879 Y-3.000 E261.00267 F7800
+G1 X-13.879 Y-3.000 E262.11302 F3600
+G1 X-14.058 Y-2.000 E262.11302 F7800
+G1 X14.058 Y-2.000 E263.23770 F3600
+G1 X14.165 Y-1.000 E263.23770 F7800
+G1 X-14.165 Y-1.000 E264.37088 F3600
+G1 X-14.200 Y0.000 E264.37088 F7800
+G1 X14.200 Y0.000 E265.50688 F3600
+G1 X14.165 Y1.000 E265.50688 F7800
+G1 X-14.165 Y1.000 E266.64006 F3600
+G1 X-14.058 Y2.000 E266.64006 F7800
+G1 X14.058 Y2.000 E267.76474 F3600
+G1 X13.879 Y3.000 E267.76474 F7800
+G1 X-13.879 Y3.000 E268.87509 F3600
+G1 X-13.625 Y4.000 E268.87509 F7800
+G1 X13.625 Y4.000 E269.96509 F3600
+G1 X13.291 Y5.000 E269.96509 F7800
+G1 X-13.291 Y5.000 E271.02834 F3600
+G1 X-12.870 Y6.000 E271.02834 F7800
+G1 X12.870 Y6.000 E272.05795 F3600
+G1 X12.355 Y7.000 E272.05795 F7800
+G1 X-12.355 Y7.000 E273.04633 F3600
+G1 X-11.732 Y8.000 E273.04633 F7800
+G1 X11.732 Y8.000 E273.98489 F3600
+G1 X10.984 Y9.000 E273.98489 F7800
+G1 X-10.984 Y9.000 E274.86358 F3600
+G1 X-10.082 Y10.000 E274.86358 F7800
+G1 X10.082 Y10.000 E275.67011 F3600
+G1 X8.980 Y11.000 E275.67011 F7800
+G1 X-8.980 Y11.000 E276.38851 F3600
+G1 X-7.592 Y12.000 E276.38851 F7800
+G1 X7.592 Y12.000 E276.99588 F3600
+G1 X5.713 Y13.000 E276.99588 F7800
+G1 X-5.713 Y13.000 E277.45293 F3600
+G1 Z2.100 F7800
+G1 E276.45293 F2400
+G1 E277.45293 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E277.47293 F1800
+G1 X14.918 Y1.568 E277.49293
+G1 X14.815 Y2.347 E277.51293
+G1 X14.672 Y3.119 E277.53293
+G1 X14.489 Y3.882 E277.55293
+G1 X14.266 Y4.635 E277.57293
+G1 X14.004 Y5.376 E277.59293
+G1 X13.703 Y6.101 E277.61293
+G1 X13.365 Y6.810 E277.63293
+G1 X12.990 Y7.500 E277.65293
+G1 X12.580 Y8.170 E277.67293
+G1 X12.135 Y8.817 E277.69293
+G1 X11.657 Y9.440 E277.71293
+G1 X11.147 Y10.037 E277.73293
+G1 X10.607 Y10.607 E277.75293
+G1 X10.037 Y11.147 E277.77293
+G1 X9.440 Y11.657 E277.79293
+G1 X8.817 Y12.135 E277.81293
+G1 X8.170 Y12.580 E277.83293
+G1 X7.500 Y12.990 E277.85293
+G1 X6.810 Y13.365 E277.87293
+G1 X6.101 Y13.703 E277.89293
+G1 X5.376 Y14.004 E277.91293
+G1 X4.635 Y14.266 E277.93293
+G1 X3.882 Y14.489 E277.95293
+G1 X3.119 Y14.672 E277.97293
+G1 X2.347 Y14.815 E277.99293
+G1 X1.568 Y14.918 E278.01293
+G1 X0.785 Y14.979 E278.03293
+G1 X0.000 Y15.000 E278.05293
+G1 X-0.785 Y14.979 E278.07293
+G1 X-1.568 Y14.918 E278.09293
+G1 X-2.347 Y14.815 E278.11293
+G1 X-3.119 Y14.672 E278.13293
+G1 X-3.882 Y14.489 E278.15293
+G1 X-4.635 Y14.266 E278.17293
+G1 X-5.376 Y14.004 E278.19293
+G1 X-6.101 Y13.703 E278.21293
+G1 X-6.810 Y13.365 E278.23293
+G1 X-7.500 Y12.990 E278.25293
+G1 X-8.170 Y12.580 E278.27293
+G1 X-8.817 Y12.135 E278.29293
+G1 X-9.440 Y11.657 E278.31293
+G1 X-10.037 Y11.147 E278.33293
+G1 X-10.607 Y10.607 E278.35293
+G1 X-11.147 Y10.037 E278.37293
+G1 X-11.657 Y9.440 E278.39293
+G1 X-12.135 Y8.817 E278.41293
+G1 X-12.580 Y8.170 E278.43293
+G1 X-12.990 Y7.500 E278.45293
+G1 X-13.365 Y6.810 E278.47293
+G1 X-13.703 Y6.101 E278.49293
+G1 X-14.004 Y5.376 E278.51293
+G1 X-14.266 Y4.635 E278.53293
+G1 X-14.489 Y3.882 E278.55293
+G1 X-14.672 Y3.119 E278.57293
+G1 X-14.815 Y2.347 E278.59293
+G1 X-14.918 Y1.568 E278.61293
+G1 X-14.979 Y0.785 E278.63293
+G1 X-15.000 Y0.000 E278.65293
+G1 X-14.979 Y-0.785 E278.67293
+G1 X-14.918 Y-1.568 E278.69293
+G1 X-14.815 Y-2.347 E278.71293
+G1 X-14.672 Y-3.119 E278.73293
+G1 X-14.489 Y-3.882 E278.75293
+G1 X-14.266 Y-4.635 E278.77293
+G1 X-14.004 Y-5.376 E278.79293
+G1 X-13.703 Y-6.101 E278.81293
+G1 X-13.365 Y-6.810 E278.83293
+G1 X-12.990 Y-7.500 E278.85293
+G1 X-12.580 Y-8.170 E278.87293
+G1 X-12.135 Y-8.817 E278.89293
+G1 X-11.657 Y-9.440 E278.91293
+G1 X-11.147 Y-10.037 E278.93293
+G1 X-10.607 Y-10.607 E278.95293
+G1 X-10.037 Y-11.147 E278.97293
+G1 X-9.440 Y-11.657 E278.99293
+G1 X-8.817 Y-12.135 E279.01293
+G1 X-8.170 Y-12.580 E279.03293
+G1 X-7.500 Y-12.990 E279.05293
+G1 X-6.810 Y-13.365 E279.07293
+G1 X-6.101 Y-13.703 E279.09293
+G1 X-5.376 Y-14.004 E279.11293
+G1 X-4.635 Y-14.266 E279.13293
+G1 X-3.882 Y-14.489 E279.15293
+G1 X-3.119 Y-14.672 E279.17293
+G1 X-2.347 Y-14.815 E279.19293
+G1 X-1.568 Y-14.918 E279.21293
+G1 X-0.785 Y-14.979 E279.23293
+G1 X-0.000 Y-15.000 E279.25293
+G1 X0.785 Y-14.979 E279.27293
+G1 X1.568 Y-14.918 E279.29293
+G1 X2.347 Y-14.815 E279.31293
+G1 X3.119 Y-14.672 E279.33293
+G1 X3.882 Y-14.489 E279.35293
+G1 X4.635 Y-14.266 E279.37293
+G1 X5.376 Y-14.004 E279.39293
+G1 X6.101 Y-13.703 E279.41293
+G1 X6.810 Y-13.365 E279.43293
+G1 X7.500 Y-12.990 E279.45293
+G1 X8.170 Y-12.580 E279.47293
+G1 X8.817 Y-12.135 E279.49293
+G1 X9.440 Y-11.657 E279.51293
+G1 X10.037 Y-11.147 E279.53293
+G1 X10.607 Y-10.607 E279.55293
+G1 X11.147 Y-10.037 E279.57293
+G1 X11.657 Y-9.440 E279.59293
+G1 X12.135 Y-8.817 E279.61293
+G1 X12.580 Y-8.170 E279.63293
+G1 X12.990 Y-7.500 E279.65293
+G1 X13.365 Y-6.810 E279.67293
+G1 X13.703 Y-6.101 E279.69293
+G1 X14.004 Y-5.376 E279.71293
+G1 X14.266 Y-4.635 E279.73293
+G1 X14.489 Y-3.882 E279.75293
+G1 X14.672 Y-3.119 E279.77293
+G1 X14.815 Y-2.347 E279.79293
+G1 X14.918 Y-1.568 E279.81293
+G1 X14.979 Y-0.785 E279.83293
+G1 X15.000 Y-0.000 E279.85293
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E279.87293 F1800
+G1 X14.520 Y1.526 E279.89293
+G1 X14.420 Y2.284 E279.91293
+G1 X14.281 Y3.036 E279.93293
+G1 X14.103 Y3.779 E279.95293
+G1 X13.885 Y4.512 E279.97293
+G1 X13.630 Y5.232 E279.99293
+G1 X13.338 Y5.938 E280.01293
+G1 X13.009 Y6.628 E280.03293
+G1 X12.644 Y7.300 E280.05293
+G1 X12.245 Y7.952 E280.07293
+G1 X11.812 Y8.582 E280.09293
+G1 X11.346 Y9.188 E280.11293
+G1 X10.850 Y9.769 E280.13293
+G1 X10.324 Y10.324 E280.15293
+G1 X9.769 Y10.850 E280.17293
+G1 X9.188 Y11.346 E280.19293
+G1 X8.582 Y11.812 E280.21293
+G1 X7.952 Y12.245 E280.23293
+G1 X7.300 Y12.644 E280.25293
+G1 X6.628 Y13.009 E280.27293
+G1 X5.938 Y13.338 E280.29293
+G1 X5.232 Y13.630 E280.31293
+G1 X4.512 Y13.885 E280.33293
+G1 X3.779 Y14.103 E280.35293
+G1 X3.036 Y14.281 E280.37293
+G1 X2.284 Y14.420 E280.39293
+G1 X1.526 Y14.520 E280.41293
+G1 X0.764 Y14.580 E280.43293
+G1 X0.000 Y14.600 E280.45293
+G1 X-0.764 Y14.580 E280.47293
+G1 X-1.526 Y14.520 E280.49293
+G1 X-2.284 Y14.420 E280.51293
+G1 X-3.036 Y14.281 E280.53293
+G1 X-3.779 Y14.103 E280.55293
+G1 X-4.512 Y13.885 E280.57293
+G1 X-5.232 Y13.630 E280.59293
+G1 X-5.938 Y13.338 E280.61293
+G1 X-6.628 Y13.009 E280.63293
+G1 X-7.300 Y12.644 E280.65293
+G1 X-7.952 Y12.245 E280.67293
+G1 X-8.582 Y11.812 E280.69293
+G1 X-9.188 Y11.346 E280.71293
+G1 X-9.769 Y10.850 E280.73293
+G1 X-10.324 Y10.324 E280.75293
+G1 X-10.850 Y9.769 E280.77293
+G1 X-11.346 Y9.188 E280.79293
+G1 X-11.812 Y8.582 E280.81293
+G1 X-12.245 Y7.952 E280.83293
+G1 X-12.644 Y7.300 E280.85293
+G1 X-13.009 Y6.628 E280.87293
+G1 X-13.338 Y5.938 E280.89293
+G1 X-13.630 Y5.232 E280.91293
+G1 X-13.885 Y4.512 E280.93293
+G1 X-14.103 Y3.779 E280.95293
+G1 X-14.281 Y3.036 E280.97293
+G1 X-14.420 Y2.284 E280.99293
+G1 X-14.520 Y1.526 E281.01293
+G1 X-14.580 Y0.764 E281.03293
+G1 X-14.600 Y0.000 E281.05293
+G1 X-14.580 Y-0.764 E281.07293
+G1 X-14.520 Y-1.526 E281.09293
+G1 X-14.420 Y-2.284 E281.11293
+G1 X-14.281 Y-3.036 E281.13293
+G1 X-14.103 Y-3.779 E281.15293
+G1 X-13.885 Y-4.512 E281.17293
+G1 X-13.630 Y-5.232 E281.19293
+G1 X-13.338 Y-5.938 E281.21293
+G1 X-13.009 Y-6.628 E281.23293
+G1 X-12.644 Y-7.300 E281.25293
+G1 X-12.245 Y-7.952 E281.27293
+G1 X-11.812 Y-8.582 E281.29293
+G1 X-11.346 Y-9.188 E281.31293
+G1 X-10.850 Y-9.769 E281.33293
+G1 X-10.324 Y-10.324 E281.35293
+G1 X-9.769 Y-10.850 E281.37293
+G1 X-9.188 Y-11.346 E281.39293
+G1 X-8.582 Y-11.812 E281.41293
+G1 X-7.952 Y-12.245 E281.43293
+G1 X-7.300 Y-12.644 E281.45293
+G1 X-6.628 Y-13.009 E281.47293
+G1 X-5.938 Y-13.338 E281.49293
+G1 X-5.232 Y-13.630 E281.51293
+G1 X-4.512 Y-13.885 E281.53293
+G1 X-3.779 Y-14.103 E281.55293
+G1 X-3.036 Y-14.281 E281.57293
+G1 X-2.284 Y-14.420 E281.59293
+G1 X-1.526 Y-14.520 E281.61293
+G1 X-0.764 Y-14.580 E281.63293
+G1 X-0.000 Y-14.600 E281.65293
+G1 X0.764 Y-14.580 E281.67293
+G1 X1.526 Y-14.520 E281.69293
+G1 X2.284 Y-14.420 E281.71293
+G1 X3.036 Y-14.281 E281.73293
+G1 X3.779 Y-14.103 E281.75293
+G1 X4.512 Y-13.885 E281.77293
+G1 X5.232 Y-13.630 E281.79293
+G1 X5.938 Y-13.338 E281.81293
+G1 X6.628 Y-13.009 E281.83293
+G1 X7.300 Y-12.644 E281.85293
+G1 X7.952 Y-12.245 E281.87293
+G1 X8.582 Y-11.812 E281.89293
+G1 X9.188 Y-11.346 E281.91293
+G1 X9.769 Y-10.850 E281.93293
+G1 X10.324 Y-10.324 E281.95293
+G1 X10.850 Y-9.769 E281.97293
+G1 X11.346 Y-9.188 E281.99293
+G1 X11.812 Y-8.582 E282.01293
+G1 X12.245 Y-7.952 E282.03293
+G1 X12.644 Y-7.300 E282.05293
+G1 X13.009 Y-6.628 E282.07293
+G1 X13.338 Y-5.938 E282.09293
+G1 X13.630 Y-5.232 E282.11293
+G1 X13.885 Y-4.512 E282.13293
+G1 X14.103 Y-3.779 E282.15293
+G1 X14.281 Y-3.036 E282.17293
+G1 X14.420 Y-2.284 E282.19293
+G1 X14.520 Y-1.526 E282.21293
+G1 X14.580 Y-0.764 E282.23293
+G1 X14.600 Y-0.000 E282.25293
+G1 X5.713 Y-13.000 E282.25293 F7800
+G1 X-5.713 Y-13.000 E282.70998 F3600
+G1 X-7.592 Y-12.000 E282.70998 F7800
+G1 X7.592 Y-12.000 E283.31735 F3600
+G1 X8.980 Y-11.000 E283.31735 F7800
+G1 X-8.980 Y-11.000 E284.03575 F3600
+G1 X-10.082 Y-10.000 E284.03575 F7800
+G1 X10.082 Y-10.000 E284.84228 F3600
+G1 X10.984 Y-9.000 E284.84228 F7800
+G1 X-10.984 Y-9.000 E285.72097 F3600
+G1 X-11.732 Y-8.000 E285.72097 F7800
+G1 X11.732 Y-8.000 E286.65953 F3600
+G1 X12.355 Y-7.000 E286.65953 F7800
+G1 X-12.355 Y-7.000 E287.64791 F3600
+G1 X-12.870 Y-6.000 E287.64791 F7800
+G1 X12.870 Y-6.000 E288.67752 F3600
+G1 X13.291 Y-5.000 E288.67752 F7800
+G1 X-13.291 Y-5.000 E289.74077 F3600
+G1 X-13.625 Y-4.000 E289.74077 F7800
+G1 X13.625 Y-4.000 E290.83077 F3600
+G1 X13.879 Y-3.000 E290.83077 F7800
+G1 X-13.879 Y-3.000 E291.94113 F3600
+G1 X-14.058 Y-2.000 E291.94113 F7800
+G1 X14.058 Y-2.000 E293.06580 F3600
+G1 X14.165 Y-1.000 E293.06580 F7800
+G1 X-14.165 Y-1.000 E294.19898 F3600
+G1 X-14.200 Y0.000 E294.19898 F7800
+G1 X14.200 Y0.000 E295.33498 F3600
+G1 X14.165 Y1.000 E295.33498 F7800
+G1 X-14.165 Y1.000 E296.46816 F3600
+G1 X-14.058 Y2.000 E296.46816 F7800
+G1 X14.058 Y2.000 E297.59284 F3600
+G1 X13.879 Y3.000 E297.59284 F7800
+G1 X-13.879 Y3.000 E298.70320 F3600
+G1 X-13.625 Y4.000 E298.70320 F7800
+G1 X13.625 Y4.000 E299.79320 F3600
+G1 X13.291 Y5.000 E299.79320 F7800
+G1 X-13.291 Y5.000 E300.85644 F3600
+G1 X-12.870 Y6.000 E300.85644 F7800
+G1 X12.870 Y6.000 E301.88605 F3600
+G1 X12.355 Y7.000 E301.88605 F7800
+G1 X-12.355 Y7.000 E302.87443 F3600
+G1 X-11.732 Y8.000 E302.87443 F7800
+G1 X11.732 Y8.000 E303.81299 F3600
+G1 X10.984 Y9.000 E303.81299 F7800
+G1 X-10.984 Y9.000 E304.69168 F3600
+G1 X-10.082 Y10.000 E304.69168 F7800
+G1 X10.082 Y10.000 E305.49822 F3600
+G1 X8.980 Y11.000 E305.49822 F7800
+G1 X-8.980 Y11.000 E306.21662 F3600
+G1 X-7.592 Y12.000 E306.21662 F7800
+G1 X7.592 Y12.000 E306.82398 F3600
+G1 X5.713 Y13.000 E306.82398 F7800
+G1 X-5.713 Y13.000 E307.28104 F3600
+G1 Z2.300 F7800
+G1 E306.28104 F2400
+G1 E307.28104 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E307.30104 F1800
+G1 X14.918 Y1.568 E307.32104
+G1 X14.815 Y2.347 E307.34104
+G1 X14.672 Y3.119 E307.36104
+G1 X14.489 Y3.882 E307.38104
+G1 X14.266 Y4.635 E307.40104
+G1 X14.004 Y5.376 E307.42104
+G1 X13.703 Y6.101 E307.44104
+G1 X13.365 Y6.810 E307.46104
+G1 X12.990 Y7.500 E307.48104
+G1 X12.580 Y8.170 E307.50104
+G1 X12.135 Y8.817 E307.52104
+G1 X11.657 Y9.440 E307.54104
+G1 X11.147 Y10.037 E307.56104
+G1 X10.607 Y10.607 E307.58104
+G1 X10.037 Y11.147 E307.60104
+G1 X9.440 Y11.657 E307.62104
+G1 X8.817 Y12.135 E307.64104
+G1 X8.170 Y12.580 E307.66104
+G1 X7.500 Y12.990 E307.68104
+G1 X6.810 Y13.365 E307.70104
+G1 X6.101 Y13.703 E307.72104
+G1 X5.376 Y14.004 E307.74104
+G1 X4.635 Y14.266 E307.76104
+G1 X3.882 Y14.489 E307.78104
+G1 X3.119 Y14.672 E307.80104
+G1 X2.347 Y14.815 E307.82104
+G1 X1.568 Y14.918 E307.84104
+G1 X0.785 Y14.979 E307.86104
+G1 X0.000 Y15.000 E307.88104
+G1 X-0.785 Y14.979 E307.90104
+G1 X-1.568 Y14.918 E307.92104
+G1 X-2.347 Y14.815 E307.94104
+G1 X-3.119 Y14.672 E307.96104
+G1 X-3.882 Y14.489 E307.98104
+G1 X-4.635 Y14.266 E308.00104
+G1 X-5.376 Y14.004 E308.02104
+G1 X-6.101 Y13.703 E308.04104
+G1 X-6.810 Y13.365 E308.06104
+G1 X-7.500 Y12.990 E308.08104
+G1 X-8.170 Y12.580 E308.10104
+G1 X-8.817 Y12.135 E308.12104
+G1 X-9.440 Y11.657 E308.14104
+G1 X-10.037 Y11.147 E308.16104
+G1 X-10.607 Y10.607 E308.18104
+G1 X-11.147 Y10.037 E308.20104
+G1 X-11.657 Y9.440 E308.22104
+G1 X-12.135 Y8.817 E308.24104
+G1 X-12.580 Y8.170 E308.26104
+G1 X-12.990 Y7.500 E308.28104
+G1 X-13.365 Y6.810 E308.30104
+G1 X-13.703 Y6.101 E308.32104
+G1 X-14.004 Y5.376 E308.34104
+G1 X-14.266 Y4.635 E308.36104
+G1 X-14.489 Y3.882 E308.38104
+G1 X-14.672 Y3.119 E308.40104
+G1 X-14.815 Y2.347 E308.42104
+G1 X-14.918 Y1.568 E308.44104
+G1 X-14.979 Y0.785 E308.46104
+G1 X-15.000 Y0.000 E308.48104
+G1 X-14.979 Y-0.785 E308.50104
+G1 X-14.918 Y-1.568 E308.52104
+G1 X-14.815 Y-2.347 E308.54104
+G1 X-14.672 Y-3.119 E308.56104
+G1 X-14.489 Y-3.882 E308.58104
+G1 X-14.266 Y-4.635 E308.60104
+G1 X-14.004 Y-5.376 E308.62104
+G1 X-13.703 Y-6.101 E308.64104
+G1 X-13.365 Y-6.810 E308.66104
+G1 X-12.990 Y-7.500 E308.68104
+G1 X-12.580 Y-8.170 E308.70104
+G1 X-12.135 Y-8.817 E308.72104
+G1 X-11.657 Y-9.440 E308.74104
+G1 X-11.147 Y-10.037 E308.76104
+G1 X-10.607 Y-10.607 E308.78104
+G1 X-10.037 Y-11.147 E308.80104
+G1 X-9.440 Y-11.657 E308.82104
+G1 X-8.817 Y-12.135 E308.84104
+G1 X-8.170 Y-12.580 E308.86104
+G1 X-7.500 Y-12.990 E308.88104
+G1 X-6.810 Y-13.365 E308.90104
+G1 X-6.101 Y-13.703 E308.92104
+G1 X-5.376 Y-14.004 E308.94104
+G1 X-4.635 Y-14.266 E308.96104
+G1 X-3.882 Y-14.489 E308.98104
+G1 X-3.119 Y-14.672 E309.00104
+G1 X-2.347 Y-14.815 E309.02104
+G1 X-1.568 Y-14.918 E309.04104
+G1 X-0.785 Y-14.979 E309.06104
+G1 X-0.000 Y-15.000 E309.08104
+G1 X0.785 Y-14.979 E309.10104
+G1 X1.568 Y-14.918 E309.12104
+G1 X2.347 Y-14.815 E309.14104
+G1 X3.119 Y-14.672 E309.16104
+G1 X3.882 Y-14.489 E309.18104
+G1 X4.635 Y-14.266 E309.20104
+G1 X5.376 Y-14.004 E309.22104
+G1 X6.101 Y-13.703 E309.24104
+G1 X6.810 Y-13.365 E309.26104
+G1 X7.500 Y-12.990 E309.28104
+G1 X8.170 Y-12.580 E309.30104
+G1 X8.817 Y-12.135 E309.32104
+G1 X9.440 Y-11.657 E309.34104
+G1 X10.037 Y-11.147 E309.36104
+G1 X10.607 Y-10.607 E309.38104
+G1 X11.147 Y-10.037 E309.40104
+G1 X11.657 Y-9.440 E309.42104
+G1 X12.135 Y-8.817 E309.44104
+G1 X12.580 Y-8.170 E309.46104
+G1 X12.990 Y-7.500 E309.48104
+G1 X13.365 Y-6.810 E309.50104
+G1 X13.703 Y-6.101 E309.52104
+G1 X14.004 Y-5.376 E309.54104
+G1 X14.266 Y-4.635 E309.56104
+G1 X14.489 Y-3.882 E309.58104
+G1 X14.672 Y-3.119 E309.60104
+G1 X14.815 Y-2.347 E309.62104
+G1 X14.918 Y-1.568 E309.64104
+G1 X14.979 Y-0.785 E309.66104
+G1 X15.000 Y-0.000 E309.68104
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E309.70104 F1800
+G1 X14.520 Y1.526 E309.72104
+G1 X14.420 Y2.284 E309.74104
+G1 X14.281 Y3.036 E309.76104
+G1 X14.103 Y3.779 E309.78104
+G1 X13.885 Y4.512 E309.80104
+G1 X13.630 Y5.232 E309.82104
+G1 X13.338 Y5.938 E309.84104
+G1 X13.009 Y6.628 E309.86104
+G1 X12.644 Y7.300 E309.88104
+G1 X12.245 Y7.952 E309.90104
+G1 X11.812 Y8.582 E309.92104
+G1 X11.346 Y9.188 E309.94104
+G1 X10.850 Y9.769 E309.96104
+G1 X10.324 Y10.324 E309.98104
+G1 X9.769 Y10.850 E310.00104
+G1 X9.188 Y11.346 E310.02104
+G1 X8.582 Y11.812 E310.04104
+G1 X7.952 Y12.245 E310.06104
+G1 X7.300 Y12.644 E310.08104
+G1 X6.628 Y13.009 E310.10104
+G1 X5.938 Y13.338 E310.12104
+G1 X5.232 Y13.630 E310.14104
+G1 X4.512 Y13.885 E310.16104
+G1 X3.779 Y14.103 E310.18104
+G1 X3.036 Y14.281 E310.20104
+G1 X2.284 Y14.420 E310.22104
+G1 X1.526 Y14.520 E310.24104
+G1 X0.764 Y14.580 E310.26104
+G1 X0.000 Y14.600 E310.28104
+G1 X-0.764 Y14.580 E310.30104
+G1 X-1.526 Y14.520 E310.32104
+G1 X-2.284 Y14.420 E310.34104
+G1 X-3.036 Y14.281 E310.36104
+G1 X-3.779 Y14.103 E310.38104
+G1 X-4.512 Y13.885 E310.40104
+G1 X-5.232 Y13.630 E310.42104
+G1 X-5.938 Y13.338 E310.44104
+G1 X-6.628 Y13.009 E310.46104
+G1 X-7.300 Y12.644 E310.48104
+G1 X-7.952 Y12.245 E310.50104
+G1 X-8.582 Y11.812 E310.52104
+G1 X-9.188 Y11.346 E310.54104
+G1 X-9.769 Y10.850 E310.56104
+G1 X-10.324 Y10.324 E310.58104
+G1 X-10.850 Y9.769 E310.60104
+G1 X-11.346 Y9.188 E310.62104
+G1 X-11.812 Y8.582 E310.64104
+G1 X-12.245 Y7.952 E310.66104
+G1 X-12.644 Y7.300 E310.68104
+G1 X-13.009 Y6.628 E310.70104
+G1 X-13.338 Y5.938 E310.72104
+G1 X-13.630 Y5.232 E310.74104
+G1 X-13.885 Y4.512 E310.76104
+G1 X-14.103 Y3.779 E310.78104
+G1 X-14.281 Y3.036 E310.80104
+G1 X-14.420 Y2.284 E310.82104
+G1 X-14.520 Y1.526 E310.84104
+G1 X-14.580 Y0.764 E310.86104
+G1 X-14.600 Y0.000 E310.88104
+G1 X-14.580 Y-0.764 E310.90104
+G1 X-14.520 Y-1.526 E310.92104
+G1 X-14.420 Y-2.284 E310.94104
+G1 X-14.281 Y-3.036 E310.96104
+G1 X-14.103 Y-3.779 E310.98104
+G1 X-13.885 Y-4.512 E311.00104
+G1 X-13.630 Y-5.232 E311.02104
+G1 X-13.338 Y-5.938 E311.04104
+G1 X-13.009 Y-6.628 E311.06104
+G1 X-12.644 Y-7.300 E311.08104
+G1 X-12.245 Y-7.952 E311.10104
+G1 X-11.812 Y-8.582 E311.12104
+G1 X-11.346 Y-9.188 E311.14104
+G1 X-10.850 Y-9.769 E311.16104
+G1 X-10.324 Y-10.324 E311.18104
+G1 X-9.769 Y-10.850 E311.20104
+G1 X-9.188 Y-11.346 E311.22104
+G1 X-8.582 Y-11.812 E311.24104
+G1 X-7.952 Y-12.245 E311.26104
+G1 X-7.300 Y-12.644 E311.28104
+G1 X-6.628 Y-13.009 E311.30104
+G1 X-5.938 Y-13.338 E311.32104
+G1 X-5.232 Y-13.630 E311.34104
+G1 X-4.512 Y-13.885 E311.36104
+G1 X-3.779 Y-14.103 E311.38104
+G1 X-3.036 Y-14.281 E311.40104
+G1 X-2.284 Y-14.420 E311.42104
+G1 X-1.526 Y-14.520 E311.44104
+G1 X-0.764 Y-14.580 E311.46104
+G1 X-0.000 Y-14.600 E311.48104
+G1 X0.764 Y-14.580 E311.50104
+G1 X1.526 Y-14.520 E311.52104
+G1 X2.284 Y-14.420 E311.54104
+G1 X3.036 Y-14.281 E311.56104
+G1 X3.779 Y-14.103 E311.58104
+G1 X4.512 Y-13.885 E311.60104
+G1 X5.232 Y-13.630 E311.62104
+G1 X5.938 Y-13.338 E311.64104
+G1 X6.628 Y-13.009 E311.66104
+G1 X7.300 Y-12.644 E311.68104
+G1 X7.952 Y-12.245 E311.70104
+G1 X8.582 Y-11.812 E311.72104
+G1 X9.188 Y-11.346 E311.74104
+G1 X9.769 Y-10.850 E311.76104
+G1 X10.324 Y-10.324 E311.78104
+G1 X10.850 Y-9.769 E311.80104
+G1 X11.346 Y-9.188 E311.82104
+G1 X11.812 Y-8.582 E311.84104
+G1 X12.245 Y-7.952 E311.86104
+G1 X12.644 Y-7.300 E311.88104
+G1 X13.009 Y-6.628 E311.90104
+G1 X13.338 Y-5.938 E311.92104
+G1 X13.630 Y-5.232 E311.94104
+G1 X13.885 Y-4.512 E311.96104
+G1 X14.103 Y-3.779 E311.98104
+G1 X14.281 Y-3.036 E312.00104
+G1 X14.420 Y-2.284 E312.02104
+G1 X14.520 Y-1.526 E312.04104
+G1 X14.580 Y-0.764 E312.06104
+G1 X14.600 Y-0.000 E312.08104
+G1 X5.713 Y-13.000 E312.08104 F7800
+G1 X-5.713 Y-13.000 E312.53809 F3600
+G1 X-7.592 Y-12.000 E312.53809 F7800
+G1 X7.592 Y-12.000 E313.14546 F3600
+G1 X8.980 Y-11.000 E313.14546 F7800
+G1 X-8.980 Y-11.000 E313.86385 F3600
+G1 X-10.082 Y-10.000 E313.86385 F7800
+G1 X10.082 Y-10.000 E314.67039 F3600
+G1 X10.984 Y-9.000 E314.67039 F7800
+G1 X-10.984 Y-9.000 E315.54908 F3600
+G1 X-11.732 Y-8.000 E315.54908 F7800
+G1 X11.732 Y-8.000 E316.48764 F3600
+G1 X12.355 Y-7.000 E316.48764 F7800
+G1 X-12.355 Y-7.000 E317.47602 F3600
+G1 X-12.870 Y-6.000 E317.47602 F7800
+G1 X12.870 Y-6.000 E318.50563 F3600
+G1 X13.291 Y-5.000 E318.50563 F7800
+G1 X-13.291 Y-5.000 E319.56888 F3600
+G1 X-13.625 Y-4.000 E319.56888 F7800
+G1 X13.625 Y-4.000 E320.65887 F3600
+G1 X13.879 Y-3.000 E320.65887 F7800
+G1 X-13.879 Y-3.000 E321.76923 F3600
+G1 X-14.058 Y-2.000 E321.76923 F7800
+G1 X14.058 Y-2.000 E322.89391 F3600
+G1 X14.165 Y-1.000 E322.89391 F7800
+G1 X-14.165 Y-1.000 E324.02709 F3600
+G1 X-14.200 Y0.000 E324.02709 F7800
+G1 X14.200 Y0.000 E325.16309 F3600
+G1 X14.165 Y1.000 E325.16309 F7800
+G1 X-14.165 Y1.000 E326.29627 F3600
+G1 X-14.058 Y2.000 E326.29627 F7800
+G1 X14.058 Y2.000 E327.42094 F3600
+G1 X13.879 Y3.000 E327.42094 F7800
+G1 X-13.879 Y3.000 E328.53130 F3600
+G1 X-13.625 Y4.000 E328.53130 F7800
+G1 X13.625 Y4.000 E329.62130 F3600
+G1 X13.291 Y5.000 E329.62130 F7800
+G1 X-13.291 Y5.000 E330.68455 F3600
+G1 X-12.870 Y6.000 E330.68455 F7800
+G1 X12.870 Y6.000 E331.71416 F3600
+G1 X12.355 Y7.000 E331.71416 F7800
+G1 X-12.355 Y7.000 E332.70254 F3600
+G1 X-11.732 Y8.000 E332.70254 F7800
+G1 X11.732 Y8.000 E333.64110 F3600
+G1 X10.984 Y9.000 E333.64110 F7800
+G1 X-10.984 Y9.000 E334.51979 F3600
+G1 X-10.082 Y10.000 E334.51979 F7800
+G1 X10.082 Y10.000 E335.32632 F3600
+G1 X8.980 Y11.000 E335.32632 F7800
+G1 X-8.980 Y11.000 E336.04472 F3600
+G1 X-7.592 Y12.000 E336.04472 F7800
+G1 X7.592 Y12.000 E336.65209 F3600
+G1 X5.713 Y13.000 E336.65209 F7800
+G1 X-5.713 Y13.000 E337.10914 F3600
+G1 Z2.500 F7800
+G1 E336.10914 F2400
+G1 E337.10914 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E337.12914 F1800
+G1 X14.918 Y1.568 E337.14914
+G1 X14.815 Y2.347 E337.16914
+G1 X14.672 Y3.119 E337.18914
+G1 X14.489 Y3.882 E337.20914
+G1 X14.266 Y4.635 E337.22914
+G1 X14.004 Y5.376 E337.24914
+G1 X13.703 Y6.101 E337.26914
+G1 X13.365 Y6.810 E337.28914
+G1 X12.990 Y7.500 E337.30914
+G1 X12.580 Y8.170 E337.32914
+G1 X12.135 Y8.817 E337.34914
+G1 X11.657 Y9.440 E337.36914
+G1 X11.147 Y10.037 E337.38914
+G1 X10.607 Y10.607 E337.40914
+G1 X10.037 Y11.147 E337.42914
+G1 X9.440 Y11.657 E337.44914
+G1 X8.817 Y12.135 E337.46914
+G1 X8.170 Y12.580 E337.48914
+G1 X7.500 Y12.990 E337.50914
+G1 X6.810 Y13.365 E337.52914
+G1 X6.101 Y13.703 E337.54914
+G1 X5.376 Y14.004 E337.56914
+G1 X4.635 Y14.266 E337.58914
+G1 X3.882 Y14.489 E337.60914
+G1 X3.119 Y14.672 E337.62914
+G1 X2.347 Y14.815 E337.64914
+G1 X1.568 Y14.918 E337.66914
+G1 X0.785 Y14.979 E337.68914
+G1 X0.000 Y15.000 E337.70914
+G1 X-0.785 Y14.979 E337.72914
+G1 X-1.568 Y14.918 E337.74914
+G1 X-2.347 Y14.815 E337.76914
+G1 X-3.119 Y14.672 E337.78914
+G1 X-3.882 Y14.489 E337.80914
+G1 X-4.635 Y14.266 E337.82914
+G1 X-5.376 Y14.004 E337.84914
+G1 X-6.101 Y13.703 E337.86914
+G1 X-6.810 Y13.365 E337.88914
+G1 X-7.500 Y12.990 E337.90914
+G1 X-8.170 Y12.580 E337.92914
+G1 X-8.817 Y12.135 E337.94914
+G1 X-9.440 Y11.657 E337.96914
+G1 X-10.037 Y11.147 E337.98914
+G1 X-10.607 Y10.607 E338.00914
+G1 X-11.147 Y10.037 E338.02914
+G1 X-11.657 Y9.440 E338.04914
+G1 X-12.135 Y8.817 E338.06914
+G1 X-12.580 Y8.170 E338.08914
+G1 X-12.990 Y7.500 E338.10914
+G1 X-13.365 Y6.810 E338.12914
+G1 X-13.703 Y6.101 E338.14914
+G1 X-14.004 Y5.376 E338.16914
+G1 X-14.266 Y4.635 E338.18914
+G1 X-14.489 Y3.882 E338.20914
+G1 X-14.672 Y3.119 E338.22914
+G1 X-14.815 Y2.347 E338.24914
+G1 X-14.918 Y1.568 E338.26914
+G1 X-14.979 Y0.785 E338.28914
+G1 X-15.000 Y0.000 E338.30914
+G1 X-14.979 Y-0.785 E338.32914
+G1 X-14.918 Y-1.568 E338.34914
+G1 X-14.815 Y-2.347 E338.36914
+G1 X-14.672 Y-3.119 E338.38914
+G1 X-14.489 Y-3.882 E338.40914
+G1 X-14.266 Y-4.635 E338.42914
+G1 X-14.004 Y-5.376 E338.44914
+G1 X-13.703 Y-6.101 E338.46914
+G1 X-13.365 Y-6.810 E338.48914
+G1 X-12.990 Y-7.500 E338.50914
+G1 X-12.580 Y-8.170 E338.52914
+G1 X-12.135 Y-8.817 E338.54914
+G1 X-11.657 Y-9.440 E338.56914
+G1 X-11.147 Y-10.037 E338.58914
+G1 X-10.607 Y-10.607 E338.60914
+G1 X-10.037 Y-11.147 E338.62914
+G1 X-9.440 Y-11.657 E338.64914
+G1 X-8.817 Y-12.135 E338.66914
+G1 X-8.170 Y-12.580 E338.68914
+G1 X-7.500 Y-12.990 E338.70914
+G1 X-6.810 Y-13.365 E338.72914
+G1 X-6.101 Y-13.703 E338.74914
+G1 X-5.376 Y-14.004 E338.76914
+G1 X-4.635 Y-14.266 E338.78914
+G1 X-3.882 Y-14.489 E338.80914
+G1 X-3.119 Y-14.672 E338.82914
+G1 X-2.347 Y-14.815 E338.84914
+G1 X-1.568 Y-14.918 E338.86914
+G1 X-0.785 Y-14.979 E338.88914
+G1 X-0.000 Y-15.000 E338.90914
+G1 X0.785 Y-14.979 E338.92914
+G1 X1.568 Y-14.918 E338.94914
+G1 X2.347 Y-14.815 E338.96914
+G1 X3.119 Y-14.672 E338.98914
+G1 X3.882 Y-14.489 E339.00914
+G1 X4.635 Y-14.266 E339.02914
+G1 X5.376 Y-14.004 E339.04914
+G1 X6.101 Y-13.703 E339.06914
+G1 X6.810 Y-13.365 E339.08914
+G1 X7.500 Y-12.990 E339.10914
+G1 X8.170 Y-12.580 E339.12914
+G1 X8.817 Y-12.135 E339.14914
+G1 X9.440 Y-11.657 E339.16914
+G1 X10.037 Y-11.147 E339.18914
+G1 X10.607 Y-10.607 E339.20914
+G1 X11.147 Y-10.037 E339.22914
+G1 X11.657 Y-9.440 E339.24914
+G1 X12.135 Y-8.817 E339.26914
+G1 X12.580 Y-8.170 E339.28914
+G1 X12.990 Y-7.500 E339.30914
+G1 X13.365 Y-6.810 E339.32914
+G1 X13.703 Y-6.101 E339.34914
+G1 X14.004 Y-5.376 E339.36914
+G1 X14.266 Y-4.635 E339.38914
+G1 X14.489 Y-3.882 E339.40914
+G1 X14.672 Y-3.119 E339.42914
+G1 X14.815 Y-2.347 E339.44914
+G1 X14.918 Y-1.568 E339.46914
+G1 X14.979 Y-0.785 E339.48914
+G1 X15.000 Y-0.000 E339.50914
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E339.52914 F1800
+G1 X14.520 Y1.526 E339.54914
+G1 X14.420 Y2.284 E339.56914
+G1 X14.281 Y3.036 E339.58914
+G1 X14.103 Y3.779 E339.60914
+G1 X13.885 Y4.512 E339.62914
+G1 X13.630 Y5.232 E339.64914
+G1 X13.338 Y5.938 E339.66914
+G1 X13.009 Y6.628 E339.68914
+G1 X12.644 Y7.300 E339.70914
+G1 X12.245 Y7.952 E339.72914
+G1 X11.812 Y8.582 E339.74914
+G1 X11.346 Y9.188 E339.76914
+G1 X10.850 Y9.769 E339.78914
+G1 X10.324 Y10.324 E339.80914
+G1 X9.769 Y10.850 E339.82914
+G1 X9.188 Y11.346 E339.84914
+G1 X8.582 Y11.812 E339.86914
+G1 X7.952 Y12.245 E339.88914
+G1 X7.300 Y12.644 E339.90914
+G1 X6.628 Y13.009 E339.92914
+G1 X5.938 Y13.338 E339.94914
+G1 X5.232 Y13.630 E339.96914
+G1 X4.512 Y13.885 E339.98914
+G1 X3.779 Y14.103 E340.00914
+G1 X3.036 Y14.281 E340.02914
+G1 X2.284 Y14.420 E340.04914
+G1 X1.526 Y14.520 E340.06914
+G1 X0.764 Y14.580 E340.08914
+G1 X0.000 Y14.600 E340.10914
+G1 X-0.764 Y14.580 E340.12914
+G1 X-1.526 Y14.520 E340.14914
+G1 X-2.284 Y14.420 E340.16914
+G1 X-3.036 Y14.281 E340.18914
+G1 X-3.779 Y14.103 E340.20914
+G1 X-4.512 Y13.885 E340.22914
+G1 X-5.232 Y13.630 E340.24914
+G1 X-5.938 Y13.338 E340.26914
+G1 X-6.628 Y13.009 E340.28914
+G1 X-7.300 Y12.644 E340.30914
+G1 X-7.952 Y12.245 E340.32914
+G1 X-8.582 Y11.812 E340.34914
+G1 X-9.188 Y11.346 E340.36914
+G1 X-9.769 Y10.850 E340.38914
+G1 X-10.324 Y10.324 E340.40914
+G1 X-10.850 Y9.769 E340.42914
+G1 X-11.346 Y9.188 E340.44914
+G1 X-11.812 Y8.582 E340.46914
+G1 X-12.245 Y7.952 E340.48914
+G1 X-12.644 Y7.300 E340.50914
+G1 X-13.009 Y6.628 E340.52914
+G1 X-13.338 Y5.938 E340.54914
+G1 X-13.630 Y5.232 E340.56914
+G1 X-13.885 Y4.512 E340.58914
+G1 X-14.103 Y3.779 E340.60914
+G1 X-14.281 Y3.036 E340.62914
+G1 X-14.420 Y2.284 E340.64914
+G1 X-14.520 Y1.526 E340.66914
+G1 X-14.580 Y0.764 E340.68914
+G1 X-14.600 Y0.000 E340.70914
+G1 X-14.580 Y-0.764 E340.72914
+G1 X-14.520 Y-1.526 E340.74914
+G1 X-14.420 Y-2.284 E340.76914
+G1 X-14.281 Y-3.036 E340.78914
+G1 X-14.103 Y-3.779 E340.80914
+G1 X-13.885 Y-4.512 E340.82914
+G1 X-13.630 Y-5.232 E340.84914
+G1 X-13.338 Y-5.938 E340.86914
+G1 X-13.009 Y-6.628 E340.88914
+G1 X-12.644 Y-7.300 E340.90914
+G1 X-12.245 Y-7.952 E340.92914
+G1 X-11.812 Y-8.582 E340.94914
+G1 X-11.346 Y-9.188 E340.96914
+G1 X-10.850 Y-9.769 E340.98914
+G1 X-10.324 Y-10.324 E341.00914
+G1 X-9.769 Y-10.850 E341.02914
+G1 X-9.188 Y-11.346 E341.04914
+G1 X-8.582 Y-11.812 E341.06914
+G1 X-7.952 Y-12.245 E341.08914
+G1 X-7.300 Y-12.644 E341.10914
+G1 X-6.628 Y-13.009 E341.12914
+G1 X-5.938 Y-13.338 E341.14914
+G1 X-5.232 Y-13.630 E341.16914
+G1 X-4.512 Y-13.885 E341.18914
+G1 X-3.779 Y-14.103 E341.20914
+G1 X-3.036 Y-14.281 E341.22914
+G1 X-2.284 Y-14.420 E341.24914
+G1 X-1.526 Y-14.520 E341.26914
+G1 X-0.764 Y-14.580 E341.28914
+G1 X-0.000 Y-14.600 E341.30914
+G1 X0.764 Y-14.580 E341.32914
+G1 X1.526 Y-14.520 E341.34914
+G1 X2.284 Y-14.420 E341.36914
+G1 X3.036 Y-14.281 E341.38914
+G1 X3.779 Y-14.103 E341.40914
+G1 X4.512 Y-13.885 E341.42914
+G1 X5.232 Y-13.630 E341.44914
+G1 X5.938 Y-13.338 E341.46914
+G1 X6.628 Y-13.009 E341.48914
+G1 X7.300 Y-12.644 E341.50914
+G1 X7.952 Y-12.245 E341.52914
+G1 X8.582 Y-11.812 E341.54914
+G1 X9.188 Y-11.346 E341.56914
+G1 X9.769 Y-10.850 E341.58914
+G1 X10.324 Y-10.324 E341.60914
+G1 X10.850 Y-9.769 E341.62914
+G1 X11.346 Y-9.188 E341.64914
+G1 X11.812 Y-8.582 E341.66914
+G1 X12.245 Y-7.952 E341.68914
+G1 X12.644 Y-7.300 E341.70914
+G1 X13.009 Y-6.628 E341.72914
+G1 X13.338 Y-5.938 E341.74914
+G1 X13.630 Y-5.232 E341.76914
+G1 X13.885 Y-4.512 E341.78914
+G1 X14.103 Y-3.779 E341.80914
+G1 X14.281 Y-3.036 E341.82914
+G1 X14.420 Y-2.284 E341.84914
+G1 X14.520 Y-1.526 E341.86914
+G1 X14.580 Y-0.764 E341.88914
+G1 X14.600 Y-0.000 E341.90914
+G1 X5.713 Y-13.000 E341.90914 F7800
+G1 X-5.713 Y-13.000 E342.36619 F3600
+G1 X-7.592 Y-12.000 E342.36619 F7800
+G1 X7.592 Y-12.000 E342.97356 F3600
+G1 X8.980 Y-11.000 E342.97356 F7800
+G1 X-8.980 Y-11.000 E343.69196 F3600
+G1 X-10.082 Y-10.000 E343.69196 F7800
+G1 X10.082 Y-10.000 E344.49849 F3600
+G1 X10.984 Y-9.000 E344.49849 F7800
+G1 X-10.984 Y-9.000 E345.37718 F3600
+G1 X-11.732 Y-8.000 E345.37718 F7800
+G1 X11.732 Y-8.000 E346.31574 F3600
+G1 X12.355 Y-7.000 E346.31574 F7800
+G1 X-12.355 Y-7.000 E347.30412 F3600
+G1 X-12.870 Y-6.000 E347.30412 F7800
+G1 X12.870 Y-6.000 E348.33373 F3600
+G1 X13.291 Y-5.000 E348.33373 F7800
+G1 X-13.291 Y-5.000 E349.39698 F3600
+G1 X-13.625 Y-4.000 E349.39698 F7800
+G1 X13.625 Y-4.000 E350.48698 F3600
+G1 X13.879 Y-3.000 E350.48698 F7800
+G1 X-13.879 Y-3.000 E351.59734 F3600
+G1 X-14.058 Y-2.000 E351.59734 F7800
+G1 X14.058 Y-2.000 E352.72201 F3600
+G1 X14.165 Y-1.000 E352.72201 F7800
+G1 X-14.165 Y-1.000 E353.85519 F3600
+G1 X-14.200 Y0.000 E353.85519 F7800
+G1 X14.200 Y0.000 E354.99119 F3600
+G1 X14.165 Y1.000 E354.99119 F7800
+G1 X-14.165 Y1.000 E356.12437 F3600
+G1 X-14.058 Y2.000 E356.12437 F7800
+G1 X14.058 Y2.000 E357.24905 F3600
+G1 X13.879 Y3.000 E357.24905 F7800
+G1 X-13.879 Y3.000 E358.35941 F3600
+G1 X-13.625 Y4.000 E358.35941 F7800
+G1 X13.625 Y4.000 E359.44940 F3600
+G1 X13.291 Y5.000 E359.44940 F7800
+G1 X-13.291 Y5.000 E360.51265 F3600
+G1 X-12.870 Y6.000 E360.51265 F7800
+G1 X12.870 Y6.000 E361.54226 F3600
+G1 X12.355 Y7.000 E361.54226 F7800
+G1 X-12.355 Y7.000 E362.53064 F3600
+G1 X-11.732 Y8.000 E362.53064 F7800
+G1 X11.732 Y8.000 E363.46920 F3600
+G1 X10.984 Y9.000 E363.46920 F7800
+G1 X-10.984 Y9.000 E364.34789 F3600
+G1 X-10.082 Y10.000 E364.34789 F7800
+G1 X10.082 Y10.000 E365.15443 F3600
+G1 X8.980 Y11.000 E365.15443 F7800
+G1 X-8.980 Y11.000 E365.87282 F3600
+G1 X-7.592 Y12.000 E365.87282 F7800
+G1 X7.592 Y12.000 E366.48019 F3600
+G1 X5.713 Y13.000 E366.48019 F7800
+G1 X-5.713 Y13.000 E366.93724 F3600
+G1 Z2.700 F7800
+G1 E365.93724 F2400
+G1 E366.93724 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E366.95724 F1800
+G1 X14.918 Y1.568 E366.97724
+G1 X14.815 Y2.347 E366.99724
+G1 X14.672 Y3.119 E367.01724
+G1 X14.489 Y3.882 E367.03724
+G1 X14.266 Y4.635 E367.05724
+G1 X14.004 Y5.376 E367.07724
+G1 X13.703 Y6.101 E367.09724
+G1 X13.365 Y6.810 E367.11724
+G1 X12.990 Y7.500 E367.13724
+G1 X12.580 Y8.170 E367.15724
+G1 X12.135 Y8.817 E367.17724
+G1 X11.657 Y9.440 E367.19724
+G1 X11.147 Y10.037 E367.21724
+G1 X10.607 Y10.607 E367.23724
+G1 X10.037 Y11.147 E367.25724
+G1 X9.440 Y11.657 E367.27724
+G1 X8.817 Y12.135 E367.29724
+G1 X8.170 Y12.580 E367.31724
+G1 X7.500 Y12.990 E367.33724
+G1 X6.810 Y13.365 E367.35724
+G1 X6.101 Y13.703 E367.37724
+G1 X5.376 Y14.004 E367.39724
+G1 X4.635 Y14.266 E367.41724
+G1 X3.882 Y14.489 E367.43724
+G1 X3.119 Y14.672 E367.45724
+G1 X2.347 Y14.815 E367.47724
+G1 X1.568 Y14.918 E367.49724
+G1 X0.785 Y14.979 E367.51724
+G1 X0.000 Y15.000 E367.53724
+G1 X-0.785 Y14.979 E367.55724
+G1 X-1.568 Y14.918 E367.57724
+G1 X-2.347 Y14.815 E367.59724
+G1 X-3.119 Y14.672 E367.61724
+G1 X-3.882 Y14.489 E367.63724
+G1 X-4.635 Y14.266 E367.65724
+G1 X-5.376 Y14.004 E367.67724
+G1 X-6.101 Y13.703 E367.69724
+G1 X-6.810 Y13.365 E367.71724
+G1 X-7.500 Y12.990 E367.73724
+G1 X-8.170 Y12.580 E367.75724
+G1 X-8.817 Y12.135 E367.77724
+G1 X-9.440 Y11.657 E367.79724
+G1 X-10.037 Y11.147 E367.81724
+G1 X-10.607 Y10.607 E367.83724
+G1 X-11.147 Y10.037 E367.85724
+G1 X-11.657 Y9.440 E367.87724
+G1 X-12.135 Y8.817 E367.89724
+G1 X-12.580 Y8.170 E367.91724
+G1 X-12.990 Y7.500 E367.93724
+G1 X-13.365 Y6.810 E367.95724
+G1 X-13.703 Y6.101 E367.97724
+G1 X-14.004 Y5.376 E367.99724
+G1 X-14.266 Y4.635 E368.01724
+G1 X-14.489 Y3.882 E368.03724
+G1 X-14.672 Y3.119 E368.05724
+G1 X-14.815 Y2.347 E368.07724
+G1 X-14.918 Y1.568 E368.09724
+G1 X-14.979 Y0.785 E368.11724
+G1 X-15.000 Y0.000 E368.13724
+G1 X-14.979 Y-0.785 E368.15724
+G1 X-14.918 Y-1.568 E368.17724
+G1 X-14.815 Y-2.347 E368.19724
+G1 X-14.672 Y-3.119 E368.21724
+G1 X-14.489 Y-3.882 E368.23724
+G1 X-14.266 Y-4.635 E368.25724
+G1 X-14.004 Y-5.376 E368.27724
+G1 X-13.703 Y-6.101 E368.29724
+G1 X-13.365 Y-6.810 E368.31724
+G1 X-12.990 Y-7.500 E368.33724
+G1 X-12.580 Y-8.170 E368.35724
+G1 X-12.135 Y-8.817 E368.37724
+G1 X-11.657 Y-9.440 E368.39724
+G1 X-11.147 Y-10.037 E368.41724
+G1 X-10.607 Y-10.607 E368.43724
+G1 X-10.037 Y-11.147 E368.45724
+G1 X-9.440 Y-11.657 E368.47724
+G1 X-8.817 Y-12.135 E368.49724
+G1 X-8.170 Y-12.580 E368.51724
+G1 X-7.500 Y-12.990 E368.53724
+G1 X-6.810 Y-13.365 E368.55724
+G1 X-6.101 Y-13.703 E368.57724
+G1 X-5.376 Y-14.004 E368.59724
+G1 X-4.635 Y-14.266 E368.61724
+G1 X-3.882 Y-14.489 E368.63724
+G1 X-3.119 Y-14.672 E368.65724
+G1 X-2.347 Y-14.815 E368.67724
+G1 X-1.568 Y-14.918 E368.69724
+G1 X-0.785 Y-14.979 E368.71724
+G1 X-0.000 Y-15.000 E368.73724
+G1 X0.785 Y-14.979 E368.75724
+G1 X1.568 Y-14.918 E368.77724
+G1 X2.347 Y-14.815 E368.79724
+G1 X3.119 Y-14.672 E368.81724
+G1 X3.882 Y-14.489 E368.83724
+G1 X4.635 Y-14.266 E368.85724
+G1 X5.376 Y-14.004 E368.87724
+G1 X6.101 Y-13.703 E368.89724
+G1 X6.810 Y-13.365 E368.91724
+G1 X7.500 Y-12.990 E368.93724
+G1 X8.170 Y-12.580 E368.95724
+G1 X8.817 Y-12.135 E368.97724
+G1 X9.440 Y-11.657 E368.99724
+G1 X10.037 Y-11.147 E369.01724
+G1 X10.607 Y-10.607 E369.03724
+G1 X11.147 Y-10.037 E369.05724
+G1 X11.657 Y-9.440 E369.07724
+G1 X12.135 Y-8.817 E369.09724
+G1 X12.580 Y-8.170 E369.11724
+G1 X12.990 Y-7.500 E369.13724
+G1 X13.365 Y-6.810 E369.15724
+G1 X13.703 Y-6.101 E369.17724
+G1 X14.004 Y-5.376 E369.19724
+G1 X14.266 Y-4.635 E369.21724
+G1 X14.489 Y-3.882 E369.23724
+G1 X14.672 Y-3.119 E369.25724
+G1 X14.815 Y-2.347 E369.27724
+G1 X14.918 Y-1.568 E369.29724
+G1 X14.979 Y-0.785 E369.31724
+G1 X15.000 Y-0.000 E369.33724
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E369.35724 F1800
+G1 X14.520 Y1.526 E369.37724
+G1 X14.420 Y2.284 E369.39724
+G1 X14.281 Y3.036 E369.41724
+G1 X14.103 Y3.779 E369.43724
+G1 X13.885 Y4.512 E369.45724
+G1 X13.630 Y5.232 E369.47724
+G1 X13.338 Y5.938 E369.49724
+G1 X13.009 Y6.628 E369.51724
+G1 X12.644 Y7.300 E369.53724
+G1 X12.245 Y7.952 E369.55724
+G1 X11.812 Y8.582 E369.57724
+G1 X11.346 Y9.188 E369.59724
+G1 X10.850 Y9.769 E369.61724
+G1 X10.324 Y10.324 E369.63724
+G1 X9.769 Y10.850 E369.65724
+G1 X9.188 Y11.346 E369.67724
+G1 X8.582 Y11.812 E369.69724
+G1 X7.952 Y12.245 E369.71724
+G1 X7.300 Y12.644 E369.73724
+G1 X6.628 Y13.009 E369.75724
+G1 X5.938 Y13.338 E369.77724
+G1 X5.232 Y13.630 E369.79724
+G1 X4.512 Y13.885 E369.81724
+G1 X3.779 Y14.103 E369.83724
+G1 X3.036 Y14.281 E369.85724
+G1 X2.284 Y14.420 E369.87724
+G1 X1.526 Y14.520 E369.89724
+G1 X0.764 Y14.580 E369.91724
+G1 X0.000 Y14.600 E369.93724
+G1 X-0.764 Y14.580 E369.95724
+G1 X-1.526 Y14.520 E369.97724
+G1 X-2.284 Y14.420 E369.99724
+G1 X-3.036 Y14.281 E370.01724
+G1 X-3.779 Y14.103 E370.03724
+G1 X-4.512 Y13.885 E370.05724
+G1 X-5.232 Y13.630 E370.07724
+G1 X-5.938 Y13.338 E370.09724
+G1 X-6.628 Y13.009 E370.11724
+G1 X-7.300 Y12.644 E370.13724
+G1 X-7.952 Y12.245 E370.15724
+G1 X-8.582 Y11.812 E370.17724
+G1 X-9.188 Y11.346 E370.19724
+G1 X-9.769 Y10.850 E370.21724
+G1 X-10.324 Y10.324 E370.23724
+G1 X-10.850 Y9.769 E370.25724
+G1 X-11.346 Y9.188 E370.27724
+G1 X-11.812 Y8.582 E370.29724
+G1 X-12.245 Y7.952 E370.31724
+G1 X-12.644 Y7.300 E370.33724
+G1 X-13.009 Y6.628 E370.35724
+G1 X-13.338 Y5.938 E370.37724
+G1 X-13.630 Y5.232 E370.39724
+G1 X-13.885 Y4.512 E370.41724
+G1 X-14.103 Y3.779 E370.43724
+G1 X-14.281 Y3.036 E370.45724
+G1 X-14.420 Y2.284 E370.47724
+G1 X-14.520 Y1.526 E370.49724
+G1 X-14.580 Y0.764 E370.51724
+G1 X-14.600 Y0.000 E370.53724
+G1 X-14.580 Y-0.764 E370.55724
+G1 X-14.520 Y-1.526 E370.57724
+G1 X-14.420 Y-2.284 E370.59724
+G1 X-14.281 Y-3.036 E370.61724
+G1 X-14.103 Y-3.779 E370.63724
+G1 X-13.885 Y-4.512 E370.65724
+G1 X-13.630 Y-5.232 E370.67724
+G1 X-13.338 Y-5.938 E370.69724
+G1 X-13.009 Y-6.628 E370.71724
+G1 X-12.644 Y-7.300 E370.73724
+G1 X-12.245 Y-7.952 E370.75724
+G1 X-11.812 Y-8.582 E370.77724
+G1 X-11.346 Y-9.188 E370.79724
+G1 X-10.850 Y-9.769 E370.81724
+G1 X-10.324 Y-10.324 E370.83724
+G1 X-9.769 Y-10.850 E370.85724
+G1 X-9.188 Y-11.346 E370.87724
+G1 X-8.582 Y-11.812 E370.89724
+G1 X-7.952 Y-12.245 E370.91724
+G1 X-7.300 Y-12.644 E370.93724
+G1 X-6.628 Y-13.009 E370.95724
+G1 X-5.938 Y-13.338 E370.97724
+G1 X-5.232 Y-13.630 E370.99724
+G1 X-4.512 Y-13.885 E371.01724
+G1 X-3.779 Y-14.103 E371.03724
+G1 X-3.036 Y-14.281 E371.05724
+G1 X-2.284 Y-14.420 E371.07724
+G1 X-1.526 Y-14.520 E371.09724
+G1 X-0.764 Y-14.580 E371.11724
+G1 X-0.000 Y-14.600 E371.13724
+G1 X0.764 Y-14.580 E371.15724
+G1 X1.526 Y-14.520 E371.17724
+G1 X2.284 Y-14.420 E371.19724
+G1 X3.036 Y-14.281 E371.21724
+G1 X3.779 Y-14.103 E371.23724
+G1 X4.512 Y-13.885 E371.25724
+G1 X5.232 Y-13.630 E371.27724
+G1 X5.938 Y-13.338 E371.29724
+G1 X6.628 Y-13.009 E371.31724
+G1 X7.300 Y-12.644 E371.33724
+G1 X7.952 Y-12.245 E371.35724
+G1 X8.582 Y-11.812 E371.37724
+G1 X9.188 Y-11.346 E371.39724
+G1 X9.769 Y-10.850 E371.41724
+G1 X10.324 Y-10.324 E371.43724
+G1 X10.850 Y-9.769 E371.45724
+G1 X11.346 Y-9.188 E371.47724
+G1 X11.812 Y-8.582 E371.49724
+G1 X12.245 Y-7.952 E371.51724
+G1 X12.644 Y-7.300 E371.53724
+G1 X13.009 Y-6.628 E371.55724
+G1 X13.338 Y-5.938 E371.57724
+G1 X13.630 Y-5.232 E371.59724
+G1 X13.885 Y-4.512 E371.61724
+G1 X14.103 Y-3.779 E371.63724
+G1 X14.281 Y-3.036 E371.65724
+G1 X14.420 Y-2.284 E371.67724
+G1 X14.520 Y-1.526 E371.69724
+G1 X14.580 Y-0.764 E371.71724
+G1 X14.600 Y-0.000 E371.73724
+G1 X5.713 Y-13.000 E371.73724 F7800
+G1 X-5.713 Y-13.000 E372.19429 F3600
+G1 X-7.592 Y-12.000 E372.19429 F7800
+G1 X7.592 Y-12.000 E372.80166 F3600
+G1 X8.980 Y-11.000 E372.80166 F7800
+G1 X-8.980 Y-11.000 E373.52006 F3600
+G1 X-10.082 Y-10.000 E373.52006 F7800
+G1 X10.082 Y-10.000 E374.32659 F3600
+G1 X10.984 Y-9.000 E374.32659 F7800
+G1 X-10.984 Y-9.000 E375.20528 F3600
+G1 X-11.732 Y-8.000 E375.20528 F7800
+G1 X11.732 Y-8.000 E376.14384 F3600
+G1 X12.355 Y-7.000 E376.14384 F7800
+G1 X-12.355 Y-7.000 E377.13222 F3600
+G1 X-12.870 Y-6.000 E377.13222 F7800
+G1 X12.870 Y-6.000 E378.16183 F3600
+G1 X13.291 Y-5.000 E378.16183 F7800
+G1 X-13.291 Y-5.000 E379.22508 F3600
+G1 X-13.625 Y-4.000 E379.22508 F7800
+G1 X13.625 Y-4.000 E380.31508 F3600
+G1 X13.879 Y-3.000 E380.31508 F7800
+G1 X-13.879 Y-3.000 E381.42544 F3600
+G1 X-14.058 Y-2.000 E381.42544 F7800
+G1 X14.058 Y-2.000 E382.55012 F3600
+G1 X14.165 Y-1.000 E382.55012 F7800
+G1 X-14.165 Y-1.000 E383.68329 F3600
+G1 X-14.200 Y0.000 E383.68329 F7800
+G1 X14.200 Y0.000 E384.81929 F3600
+G1 X14.165 Y1.000 E384.81929 F7800
+G1 X-14.165 Y1.000 E385.95247 F3600
+G1 X-14.058 Y2.000 E385.95247 F7800
+G1 X14.058 Y2.000 E387.07715 F3600
+G1 X13.879 Y3.000 E387.07715 F7800
+G1 X-13.879 Y3.000 E388.18751 F3600
+G1 X-13.625 Y4.000 E388.18751 F7800
+G1 X13.625 Y4.000 E389.27751 F3600
+G1 X13.291 Y5.000 E389.27751 F7800
+G1 X-13.291 Y5.000 E390.34075 F3600
+G1 X-12.870 Y6.000 E390.34075 F7800
+G1 X12.870 Y6.000 E391.37036 F3600
+G1 X12.355 Y7.000 E391.37036 F7800
+G1 X-12.355 Y7.000 E392.35874 F3600
+G1 X-11.732 Y8.000 E392.35874 F7800
+G1 X11.732 Y8.000 E393.29731 F3600
+G1 X10.984 Y9.000 E393.29731 F7800
+G1 X-10.984 Y9.000 E394.17600 F3600
+G1 X-10.082 Y10.000 E394.17600 F7800
+G1 X10.082 Y10.000 E394.98253 F3600
+G1 X8.980 Y11.000 E394.98253 F7800
+G1 X-8.980 Y11.000 E395.70093 F3600
+G1 X-7.592 Y12.000 E395.70093 F7800
+G1 X7.592 Y12.000 E396.30830 F3600
+G1 X5.713 Y13.000 E396.30830 F7800
+G1 X-5.713 Y13.000 E396.76535 F3600
+G1 Z2.900 F7800
+G1 E395.76535 F2400
+G1 E396.76535 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E396.78535 F1800
+G1 X14.918 Y1.568 E396.80535
+G1 X14.815 Y2.347 E396.82535
+G1 X14.672 Y3.119 E396.84535
+G1 X14.489 Y3.882 E396.86535
+G1 X14.266 Y4.635 E396.88535
+G1 X14.004 Y5.376 E396.90535
+G1 X13.703 Y6.101 E396.92535
+G1 X13.365 Y6.810 E396.94535
+G1 X12.990 Y7.500 E396.96535
+G1 X12.580 Y8.170 E396.98535
+G1 X12.135 Y8.817 E397.00535
+G1 X11.657 Y9.440 E397.02535
+G1 X11.147 Y10.037 E397.04535
+G1 X10.607 Y10.607 E397.06535
+G1 X10.037 Y11.147 E397.08535
+G1 X9.440 Y11.657 E397.10535
+G1 X8.817 Y12.135 E397.12535
+G1 X8.170 Y12.580 E397.14535
+G1 X7.500 Y12.990 E397.16535
+G1 X6.810 Y13.365 E397.18535
+G1 X6.101 Y13.703 E397.20535
+G1 X5.376 Y14.004 E397.22535
+G1 X4.635 Y14.266 E397.24535
+G1 X3.882 Y14.489 E397.26535
+G1 X3.119 Y14.672 E397.28535
+G1 X2.347 Y14.815 E397.30535
+G1 X1.568 Y14.918 E397.32535
+G1 X0.785 Y14.979 E397.34535
+G1 X0.000 Y15.000 E397.36535
+G1 X-0.785 Y14.979 E397.38535
+G1 X-1.568 Y14.918 E397.40535
+G1 X-2.347 Y14.815 E397.42535
+G1 X-3.119 Y14.672 E397.44535
+G1 X-3.882 Y14.489 E397.46535
+G1 X-4.635 Y14.266 E397.48535
+G1 X-5.376 Y14.004 E397.50535
+G1 X-6.101 Y13.703 E397.52535
+G1 X-6.810 Y13.365 E397.54535
+G1 X-7.500 Y12.990 E397.56535
+G1 X-8.170 Y12.580 E397.58535
+G1 X-8.817 Y12.135 E397.60535
+G1 X-9.440 Y11.657 E397.62535
+G1 X-10.037 Y11.147 E397.64535
+G1 X-10.607 Y10.607 E397.66535
+G1 X-11.147 Y10.037 E397.68535
+G1 X-11.657 Y9.440 E397.70535
+G1 X-12.135 Y8.817 E397.72535
+G1 X-12.580 Y8.170 E397.74535
+G1 X-12.990 Y7.500 E397.76535
+G1 X-13.365 Y6.810 E397.78535
+G1 X-13.703 Y6.101 E397.80535
+G1 X-14.004 Y5.376 E397.82535
+G1 X-14.266 Y4.635 E397.84535
+G1 X-14.489 Y3.882 E397.86535
+G1 X-14.672 Y3.119 E397.88535
+G1 X-14.815 Y2.347 E397.90535
+G1 X-14.918 Y1.568 E397.92535
+G1 X-14.979 Y0.785 E397.94535
+G1 X-15.000 Y0.000 E397.96535
+G1 X-14.979 Y-0.785 E397.98535
+G1 X-14.918 Y-1.568 E398.00535
+G1 X-14.815 Y-2.347 E398.02535
+G1 X-14.672 Y-3.119 E398.04535
+G1 X-14.489 Y-3.882 E398.06535
+G1 X-14.266 Y-4.635 E398.08535
+G1 X-14.004 Y-5.376 E398.10535
+G1 X-13.703 Y-6.101 E398.12535
+G1 X-13.365 Y-6.810 E398.14535
+G1 X-12.990 Y-7.500 E398.16535
+G1 X-12.580 Y-8.170 E398.18535
+G1 X-12.135 Y-8.817 E398.20535
+G1 X-11.657 Y-9.440 E398.22535
+G1 X-11.147 Y-10.037 E398.24535
+G1 X-10.607 Y-10.607 E398.26535
+G1 X-10.037 Y-11.147 E398.28535
+G1 X-9.440 Y-11.657 E398.30535
+G1 X-8.817 Y-12.135 E398.32535
+G1 X-8.170 Y-12.580 E398.34535
+G1 X-7.500 Y-12.990 E398.36535
+G1 X-6.810 Y-13.365 E398.38535
+G1 X-6.101 Y-13.703 E398.40535
+G1 X-5.376 Y-14.004 E398.42535
+G1 X-4.635 Y-14.266 E398.44535
+G1 X-3.882 Y-14.489 E398.46535
+G1 X-3.119 Y-14.672 E398.48535
+G1 X-2.347 Y-14.815 E398.50535
+G1 X-1.568 Y-14.918 E398.52535
+G1 X-0.785 Y-14.979 E398.54535
+G1 X-0.000 Y-15.000 E398.56535
+G1 X0.785 Y-14.979 E398.58535
+G1 X1.568 Y-14.918 E398.60535
+G1 X2.347 Y-14.815 E398.62535
+G1 X3.119 Y-14.672 E398.64535
+G1 X3.882 Y-14.489 E398.66535
+G1 X4.635 Y-14.266 E398.68535
+G1 X5.376 Y-14.004 E398.70535
+G1 X6.101 Y-13.703 E398.72535
+G1 X6.810 Y-13.365 E398.74535
+G1 X7.500 Y-12.990 E398.76535
+G1 X8.170 Y-12.580 E398.78535
+G1 X8.817 Y-12.135 E398.80535
+G1 X9.440 Y-11.657 E398.82535
+G1 X10.037 Y-11.147 E398.84535
+G1 X10.607 Y-10.607 E398.86535
+G1 X11.147 Y-10.037 E398.88535
+G1 X11.657 Y-9.440 E398.90535
+G1 X12.135 Y-8.817 E398.92535
+G1 X12.580 Y-8.170 E398.94535
+G1 X12.990 Y-7.500 E398.96535
+G1 X13.365 Y-6.810 E398.98535
+G1 X13.703 Y-6.101 E399.00535
+G1 X14.004 Y-5.376 E399.02535
+G1 X14.266 Y-4.635 E399.04535
+G1 X14.489 Y-3.882 E399.06535
+G1 X14.672 Y-3.119 E399.08535
+G1 X14.815 Y-2.347 E399.10535
+G1 X14.918 Y-1.568 E399.12535
+G1 X14.979 Y-0.785 E399.14535
+G1 X15.000 Y-0.000 E399.16535
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E399.18535 F1800
+G1 X14.520 Y1.526 E399.20535
+G1 X14.420 Y2.284 E399.22535
+G1 X14.281 Y3.036 E399.24535
+G1 X14.103 Y3.779 E399.26535
+G1 X13.885 Y4.512 E399.28535
+G1 X13.630 Y5.232 E399.30535
+G1 X13.338 Y5.938 E399.32535
+G1 X13.009 Y6.628 E399.34535
+G1 X12.644 Y7.300 E399.36535
+G1 X12.245 Y7.952 E399.38535
+G1 X11.812 Y8.582 E399.40535
+G1 X11.346 Y9.188 E399.42535
+G1 X10.850 Y9.769 E399.44535
+G1 X10.324 Y10.324 E399.46535
+G1 X9.769 Y10.850 E399.48535
+G1 X9.188 Y11.346 E399.50535
+G1 X8.582 Y11.812 E399.52535
+G1 X7.952 Y12.245 E399.54535
+G1 X7.300 Y12.644 E399.56535
+G1 X6.628 Y13.009 E399.58535
+G1 X5.938 Y13.338 E399.60535
+G1 X5.232 Y13.630 E399.62535
+G1 X4.512 Y13.885 E399.64535
+G1 X3.779 Y14.103 E399.66535
+G1 X3.036 Y14.281 E399.68535
+G1 X2.284 Y14.420 E399.70535
+G1 X1.526 Y14.520 E399.72535
+G1 X0.764 Y14.580 E399.74535
+G1 X0.000 Y14.600 E399.76535
+G1 X-0.764 Y14.580 E399.78535
+G1 X-1.526 Y14.520 E399.80535
+G1 X-2.284 Y14.420 E399.82535
+G1 X-3.036 Y14.281 E399.84535
+G1 X-3.779 Y14.103 E399.86535
+G1 X-4.512 Y13.885 E399.88535
+G1 X-5.232 Y13.630 E399.90535
+G1 X-5.938 Y13.338 E399.92535
+G1 X-6.628 Y13.009 E399.94535
+G1 X-7.300 Y12.644 E399.96535
+G1 X-7.952 Y12.245 E399.98535
+G1 X-8.582 Y11.812 E400.00535
+G1 X-9.188 Y11.346 E400.02535
+G1 X-9.769 Y10.850 E400.04535
+G1 X-10.324 Y10.324 E400.06535
+G1 X-10.850 Y9.769 E400.08535
+G1 X-11.346 Y9.188 E400.10535
+G1 X-11.812 Y8.582 E400.12535
+G1 X-12.245 Y7.952 E400.14535
+G1 X-12.644 Y7.300 E400.16535
+G1 X-13.009 Y6.628 E400.18535
+G1 X-13.338 Y5.938 E400.20535
+G1 X-13.630 Y5.232 E400.22535
+G1 X-13.885 Y4.512 E400.24535
+G1 X-14.103 Y3.779 E400.26535
+G1 X-14.281 Y3.036 E400.28535
+G1 X-14.420 Y2.284 E400.30535
+G1 X-14.520 Y1.526 E400.32535
+G1 X-14.580 Y0.764 E400.34535
+G1 X-14.600 Y0.000 E400.36535
+G1 X-14.580 Y-0.764 E400.38535
+G1 X-14.520 Y-1.526 E400.40535
+G1 X-14.420 Y-2.284 E400.42535
+G1 X-14.281 Y-3.036 E400.44535
+G1 X-14.103 Y-3.779 E400.46535
+G1 X-13.885 Y-4.512 E400.48535
+G1 X-13.630 Y-5.232 E400.50535
+G1 X-13.338 Y-5.938 E400.52535
+G1 X-13.009 Y-6.628 E400.54535
+G1 X-12.644 Y-7.300 E400.56535
+G1 X-12.245 Y-7.952 E400.58535
+G1 X-11.812 Y-8.582 E400.60535
+G1 X-11.346 Y-9.188 E400.62535
+G1 X-10.850 Y-9.769 E400.64535
+G1 X-10.324 Y-10.324 E400.66535
+G1 X-9.769 Y-10.850 E400.68535
+G1 X-9.188 Y-11.346 E400.70535
+G1 X-8.582 Y-11.812 E400.72535
+G1 X-7.952 Y-12.245 E400.74535
+G1 X-7.300 Y-12.644 E400.76535
+G1 X-6.628 Y-13.009 E400.78535
+G1 X-5.938 Y-13.338 E400.80535
+G1 X-5.232 Y-13.630 E400.82535
+G1 X-4.512 Y-13.885 E400.84535
+G1 X-3.779 Y-14.103 E400.86535
+G1 X-3.036 Y-14.281 E400.88535
+G1 X-2.284 Y-14.420 E400.90535
+G1 X-1.526 Y-14.520 E400.92535
+G1 X-0.764 Y-14.580 E400.94535
+G1 X-0.000 Y-14.600 E400.96535
+G1 X0.764 Y-14.580 E400.98535
+G1 X1.526 Y-14.520 E401.00535
+G1 X2.284 Y-14.420 E401.02535
+G1 X3.036 Y-14.281 E401.04535
+G1 X3.779 Y-14.103 E401.06535
+G1 X4.512 Y-13.885 E401.08535
+G1 X5.232 Y-13.630 E401.10535
+G1 X5.938 Y-13.338 E401.12535
+G1 X6.628 Y-13.009 E401.14535
+G1 X7.300 Y-12.644 E401.16535
+G1 X7.952 Y-12.245 E401.18535
+G1 X8.582 Y-11.812 E401.20535
+G1 X9.188 Y-11.346 E401.22535
+G1 X9.769 Y-10.850 E401.24535
+G1 X10.324 Y-10.324 E401.26535
+G1 X10.850 Y-9.769 E401.28535
+G1 X11.346 Y-9.188 E401.30535
+G1 X11.812 Y-8.582 E401.32535
+G1 X12.245 Y-7.952 E401.34535
+G1 X12.644 Y-7.300 E401.36535
+G1 X13.009 Y-6.628 E401.38535
+G1 X13.338 Y-5.938 E401.40535
+G1 X13.630 Y-5.232 E401.42535
+G1 X13.885 Y-4.512 E401.44535
+G1 X14.103 Y-3.779 E401.46535
+G1 X14.281 Y-3.036 E401.48535
+G1 X14.420 Y-2.284 E401.50535
+G1 X14.520 Y-1.526 E401.52535
+G1 X14.580 Y-0.764 E401.54535
+G1 X14.600 Y-0.000 E401.56535
+G1 X5.713 Y-13.000 E401.56535 F7800
+G1 X-5.713 Y-13.000 E402.02240 F3600
+G1 X-7.592 Y-12.000 E402.02240 F7800
+G1 X7.592 Y-12.000 E402.62977 F3600
+G1 X8.980 Y-11.000 E402.62977 F7800
+G1 X-8.980 Y-11.000 E403.34816 F3600
+G1 X-10.082 Y-10.000 E403.34816 F7800
+G1 X10.082 Y-10.000 E404.15470 F3600
+G1 X10.984 Y-9.000 E404.15470 F7800
+G1 X-10.984 Y-9.000 E405.03339 F3600
+G1 X-11.732 Y-8.000 E405.03339 F7800
+G1 X11.732 Y-8.000 E405.97195 F3600
+G1 X12.355 Y-7.000 E405.97195 F7800
+G1 X-12.355 Y-7.000 E406.96033 F3600
+G1 X-12.870 Y-6.000 E406.96033 F7800
+G1 X12.870 Y-6.000 E407.98994 F3600
+G1 X13.291 Y-5.000 E407.98994 F7800
+G1 X-13.291 Y-5.000 E409.05319 F3600
+G1 X-13.625 Y-4.000 E409.05319 F7800
+G1 X13.625 Y-4.000 E410.14318 F3600
+G1 X13.879 Y-3.000 E410.14318 F7800
+G1 X-13.879 Y-3.000 E411.25354 F3600
+G1 X-14.058 Y-2.000 E411.25354 F7800
+G1 X14.058 Y-2.000 E412.37822 F3600
+G1 X14.165 Y-1.000 E412.37822 F7800
+G1 X-14.165 Y-1.000 E413.51140 F3600
+G1 X-14.200 Y0.000 E413.51140 F7800
+G1 X14.200 Y0.000 E414.64740 F3600
+G1 X14.165 Y1.000 E414.64740 F7800
+G1 X-14.165 Y1.000 E415.78058 F3600
+G1 X-14.058 Y2.000 E415.78058 F7800
+G1 X14.058 Y2.000 E416.90525 F3600
+G1 X13.879 Y3.000 E416.90525 F7800
+G1 X-13.879 Y3.000 E418.01561 F3600
+G1 X-13.625 Y4.000 E418.01561 F7800
+G1 X13.625 Y4.000 E419.10561 F3600
+G1 X13.291 Y5.000 E419.10561 F7800
+G1 X-13.291 Y5.000 E420.16886 F3600
+G1 X-12.870 Y6.000 E420.16886 F7800
+G1 X12.870 Y6.000 E421.19847 F3600
+G1 X12.355 Y7.000 E421.19847 F7800
+G1 X-12.355 Y7.000 E422.18685 F3600
+G1 X-11.732 Y8.000 E422.18685 F7800
+G1 X11.732 Y8.000 E423.12541 F3600
+G1 X10.984 Y9.000 E423.12541 F7800
+G1 X-10.984 Y9.000 E424.00410 F3600
+G1 X-10.082 Y10.000 E424.00410 F7800
+G1 X10.082 Y10.000 E424.81063 F3600
+G1 X8.980 Y11.000 E424.81063 F7800
+G1 X-8.980 Y11.000 E425.52903 F3600
+G1 X-7.592 Y12.000 E425.52903 F7800
+G1 X7.592 Y12.000 E426.13640 F3600
+G1 X5.713 Y13.000 E426.13640 F7800
+G1 X-5.713 Y13.000 E426.59345 F3600
+G1 Z3.100 F7800
+G1 E425.59345 F2400
+G1 E426.59345 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E426.61345 F1800
+G1 X14.918 Y1.568 E426.63345
+G1 X14.815 Y2.347 E426.65345
+G1 X14.672 Y3.119 E426.67345
+G1 X14.489 Y3.882 E426.69345
+G1 X14.266 Y4.635 E426.71345
+G1 X14.004 Y5.376 E426.73345
+G1 X13.703 Y6.101 E426.75345
+G1 X13.365 Y6.810 E426.77345
+G1 X12.990 Y7.500 E426.79345
+G1 X12.580 Y8.170 E426.81345
+G1 X12.135 Y8.817 E426.83345
+G1 X11.657 Y9.440 E426.85345
+G1 X11.147 Y10.037 E426.87345
+G1 X10.607 Y10.607 E426.89345
+G1 X10.037 Y11.147 E426.91345
+G1 X9.440 Y11.657 E426.93345
+G1 X8.817 Y12.135 E426.95345
+G1 X8.170 Y12.580 E426.97345
+G1 X7.500 Y12.990 E426.99345
+G1 X6.810 Y13.365 E427.01345
+G1 X6.101 Y13.703 E427.03345
+G1 X5.376 Y14.004 E427.05345
+G1 X4.635 Y14.266 E427.07345
+G1 X3.882 Y14.489 E427.09345
+G1 X3.119 Y14.672 E427.11345
+G1 X2.347 Y14.815 E427.13345
+G1 X1.568 Y14.918 E427.15345
+G1 X0.785 Y14.979 E427.17345
+G1 X0.000 Y15.000 E427.19345
+G1 X-0.785 Y14.979 E427.21345
+G1 X-1.568 Y14.918 E427.23345
+G1 X-2.347 Y14.815 E427.25345
+G1 X-3.119 Y14.672 E427.27345
+G1 X-3.882 Y14.489 E427.29345
+G1 X-4.635 Y14.266 E427.31345
+G1 X-5.376 Y14.004 E427.33345
+G1 X-6.101 Y13.703 E427.35345
+G1 X-6.810 Y13.365 E427.37345
+G1 X-7.500 Y12.990 E427.39345
+G1 X-8.170 Y12.580 E427.41345
+G1 X-8.817 Y12.135 E427.43345
+G1 X-9.440 Y11.657 E427.45345
+G1 X-10.037 Y11.147 E427.47345
+G1 X-10.607 Y10.607 E427.49345
+G1 X-11.147 Y10.037 E427.51345
+G1 X-11.657 Y9.440 E427.53345
+G1 X-12.135 Y8.817 E427.55345
+G1 X-12.580 Y8.170 E427.57345
+G1 X-12.990 Y7.500 E427.59345
+G1 X-13.365 Y6.810 E427.61345
+G1 X-13.703 Y6.101 E427.63345
+G1 X-14.004 Y5.376 E427.65345
+G1 X-14.266 Y4.635 E427.67345
+G1 X-14.489 Y3.882 E427.69345
+G1 X-14.672 Y3.119 E427.71345
+G1 X-14.815 Y2.347 E427.73345
+G1 X-14.918 Y1.568 E427.75345
+G1 X-14.979 Y0.785 E427.77345
+G1 X-15.000 Y0.000 E427.79345
+G1 X-14.979 Y-0.785 E427.81345
+G1 X-14.918 Y-1.568 E427.83345
+G1 X-14.815 Y-2.347 E427.85345
+G1 X-14.672 Y-3.119 E427.87345
+G1 X-14.489 Y-3.882 E427.89345
+G1 X-14.266 Y-4.635 E427.91345
+G1 X-14.004 Y-5.376 E427.93345
+G1 X-13.703 Y-6.101 E427.95345
+G1 X-13.365 Y-6.810 E427.97345
+G1 X-12.990 Y-7.500 E427.99345
+G1 X-12.580 Y-8.170 E428.01345
+G1 X-12.135 Y-8.817 E428.03345
+G1 X-11.657 Y-9.440 E428.05345
+G1 X-11.147 Y-10.037 E428.07345
+G1 X-10.607 Y-10.607 E428.09345
+G1 X-10.037 Y-11.147 E428.11345
+G1 X-9.440 Y-11.657 E428.13345
+G1 X-8.817 Y-12.135 E428.15345
+G1 X-8.170 Y-12.580 E428.17345
+G1 X-7.500 Y-12.990 E428.19345
+G1 X-6.810 Y-13.365 E428.21345
+G1 X-6.101 Y-13.703 E428.23345
+G1 X-5.376 Y-14.004 E428.25345
+G1 X-4.635 Y-14.266 E428.27345
+G1 X-3.882 Y-14.489 E428.29345
+G1 X-3.119 Y-14.672 E428.31345
+G1 X-2.347 Y-14.815 E428.33345
+G1 X-1.568 Y-14.918 E428.35345
+G1 X-0.785 Y-14.979 E428.37345
+G1 X-0.000 Y-15.000 E428.39345
+G1 X0.785 Y-14.979 E428.41345
+G1 X1.568 Y-14.918 E428.43345
+G1 X2.347 Y-14.815 E428.45345
+G1 X3.119 Y-14.672 E428.47345
+G1 X3.882 Y-14.489 E428.49345
+G1 X4.635 Y-14.266 E428.51345
+G1 X5.376 Y-14.004 E428.53345
+G1 X6.101 Y-13.703 E428.55345
+G1 X6.810 Y-13.365 E428.57345
+G1 X7.500 Y-12.990 E428.59345
+G1 X8.170 Y-12.580 E428.61345
+G1 X8.817 Y-12.135 E428.63345
+G1 X9.440 Y-11.657 E428.65345
+G1 X10.037 Y-11.147 E428.67345
+G1 X10.607 Y-10.607 E428.69345
+G1 X11.147 Y-10.037 E428.71345
+G1 X11.657 Y-9.440 E428.73345
+G1 X12.135 Y-8.817 E428.75345
+G1 X12.580 Y-8.170 E428.77345
+G1 X12.990 Y-7.500 E428.79345
+G1 X13.365 Y-6.810 E428.81345
+G1 X13.703 Y-6.101 E428.83345
+G1 X14.004 Y-5.376 E428.85345
+G1 X14.266 Y-4.635 E428.87345
+G1 X14.489 Y-3.882 E428.89345
+G1 X14.672 Y-3.119 E428.91345
+G1 X14.815 Y-2.347 E428.93345
+G1 X14.918 Y-1.568 E428.95345
+G1 X14.979 Y-0.785 E428.97345
+G1 X15.000 Y-0.000 E428.99345
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E429.01345 F1800
+G1 X14.520 Y1.526 E429.03345
+G1 X14.420 Y2.284 E429.05345
+G1 X14.281 Y3.036 E429.07345
+G1 X14.103 Y3.779 E429.09345
+G1 X13.885 Y4.512 E429.11345
+G1 X13.630 Y5.232 E429.13345
+G1 X13.338 Y5.938 E429.15345
+G1 X13.009 Y6.628 E429.17345
+G1 X12.644 Y7.300 E429.19345
+G1 X12.245 Y7.952 E429.21345
+G1 X11.812 Y8.582 E429.23345
+G1 X11.346 Y9.188 E429.25345
+G1 X10.850 Y9.769 E429.27345
+G1 X10.324 Y10.324 E429.29345
+G1 X9.769 Y10.850 E429.31345
+G1 X9.188 Y11.346 E429.33345
+G1 X8.582 Y11.812 E429.35345
+G1 X7.952 Y12.245 E429.37345
+G1 X7.300 Y12.644 E429.39345
+G1 X6.628 Y13.009 E429.41345
+G1 X5.938 Y13.338 E429.43345
+G1 X5.232 Y13.630 E429.45345
+G1 X4.512 Y13.885 E429.47345
+G1 X3.779 Y14.103 E429.49345
+G1 X3.036 Y14.281 E429.51345
+G1 X2.284 Y14.420 E429.53345
+G1 X1.526 Y14.520 E429.55345
+G1 X0.764 Y14.580 E429.57345
+G1 X0.000 Y14.600 E429.59345
+G1 X-0.764 Y14.580 E429.61345
+G1 X-1.526 Y14.520 E429.63345
+G1 X-2.284 Y14.420 E429.65345
+G1 X-3.036 Y14.281 E429.67345
+G1 X-3.779 Y14.103 E429.69345
+G1 X-4.512 Y13.885 E429.71345
+G1 X-5.232 Y13.630 E429.73345
+G1 X-5.938 Y13.338 E429.75345
+G1 X-6.628 Y13.009 E429.77345
+G1 X-7.300 Y12.644 E429.79345
+G1 X-7.952 Y12.245 E429.81345
+G1 X-8.582 Y11.812 E429.83345
+G1 X-9.188 Y11.346 E429.85345
+G1 X-9.769 Y10.850 E429.87345
+G1 X-10.324 Y10.324 E429.89345
+G1 X-10.850 Y9.769 E429.91345
+G1 X-11.346 Y9.188 E429.93345
+G1 X-11.812 Y8.582 E429.95345
+G1 X-12.245 Y7.952 E429.97345
+G1 X-12.644 Y7.300 E429.99345
+G1 X-13.009 Y6.628 E430.01345
+G1 X-13.338 Y5.938 E430.03345
+G1 X-13.630 Y5.232 E430.05345
+G1 X-13.885 Y4.512 E430.07345
+G1 X-14.103 Y3.779 E430.09345
+G1 X-14.281 Y3.036 E430.11345
+G1 X-14.420 Y2.284 E430.13345
+G1 X-14.520 Y1.526 E430.15345
+G1 X-14.580 Y0.764 E430.17345
+G1 X-14.600 Y0.000 E430.19345
+G1 X-14.580 Y-0.764 E430.21345
+G1 X-14.520 Y-1.526 E430.23345
+G1 X-14.420 Y-2.284 E430.25345
+G1 X-14.281 Y-3.036 E430.27345
+G1 X-14.103 Y-3.779 E430.29345
+G1 X-13.885 Y-4.512 E430.31345
+G1 X-13.630 Y-5.232 E430.33345
+G1 X-13.338 Y-5.938 E430.35345
+G1 X-13.009 Y-6.628 E430.37345
+G1 X-12.644 Y-7.300 E430.39345
+G1 X-12.245 Y-7.952 E430.41345
+G1 X-11.812 Y-8.582 E430.43345
+G1 X-11.346 Y-9.188 E430.45345
+G1 X-10.850 Y-9.769 E430.47345
+G1 X-10.324 Y-10.324 E430.49345
+G1 X-9.769 Y-10.850 E430.51345
+G1 X-9.188 Y-11.346 E430.53345
+G1 X-8.582 Y-11.812 E430.55345
+G1 X-7.952 Y-12.245 E430.57345
+G1 X-7.300 Y-12.644 E430.59345
+G1 X-6.628 Y-13.009 E430.61345
+G1 X-5.938 Y-13.338 E430.63345
+G1 X-5.232 Y-13.630 E430.65345
+G1 X-4.512 Y-13.885 E430.67345
+G1 X-3.779 Y-14.103 E430.69345
+G1 X-3.036 Y-14.281 E430.71345
+G1 X-2.284 Y-14.420 E430.73345
+G1 X-1.526 Y-14.520 E430.75345
+G1 X-0.764 Y-14.580 E430.77345
+G1 X-0.000 Y-14.600 E430.79345
+G1 X0.764 Y-14.580 E430.81345
+G1 X1.526 Y-14.520 E430.83345
+G1 X2.284 Y-14.420 E430.85345
+G1 X3.036 Y-14.281 E430.87345
+G1 X3.779 Y-14.103 E430.89345
+G1 X4.512 Y-13.885 E430.91345
+G1 X5.232 Y-13.630 E430.93345
+G1 X5.938 Y-13.338 E430.95345
+G1 X6.628 Y-13.009 E430.97345
+G1 X7.300 Y-12.644 E430.99345
+G1 X7.952 Y-12.245 E431.01345
+G1 X8.582 Y-11.812 E431.03345
+G1 X9.188 Y-11.346 E431.05345
+G1 X9.769 Y-10.850 E431.07345
+G1 X10.324 Y-10.324 E431.09345
+G1 X10.850 Y-9.769 E431.11345
+G1 X11.346 Y-9.188 E431.13345
+G1 X11.812 Y-8.582 E431.15345
+G1 X12.245 Y-7.952 E431.17345
+G1 X12.644 Y-7.300 E431.19345
+G1 X13.009 Y-6.628 E431.21345
+G1 X13.338 Y-5.938 E431.23345
+G1 X13.630 Y-5.232 E431.25345
+G1 X13.885 Y-4.512 E431.27345
+G1 X14.103 Y-3.779 E431.29345
+G1 X14.281 Y-3.036 E431.31345
+G1 X14.420 Y-2.284 E431.33345
+G1 X14.520 Y-1.526 E431.35345
+G1 X14.580 Y-0.764 E431.37345
+G1 X14.600 Y-0.000 E431.39345
+G1 X5.713 Y-13.000 E431.39345 F7800
+G1 X-5.713 Y-13.000 E431.85050 F3600
+G1 X-7.592 Y-12.000 E431.85050 F7800
+G1 X7.592 Y-12.000 E432.45787 F3600
+G1 X8.980 Y-11.000 E432.45787 F7800
+G1 X-8.980 Y-11.000 E433.17627 F3600
+G1 X-10.082 Y-10.000 E433.17627 F7800
+G1 X10.082 Y-10.000 E433.98280 F3600
+G1 X10.984 Y-9.000 E433.98280 F7800
+G1 X-10.984 Y-9.000 E434.86149 F3600
+G1 X-11.732 Y-8.000 E434.86149 F7800
+G1 X11.732 Y-8.000 E435.80005 F3600
+G1 X12.355 Y-7.000 E435.80005 F7800
+G1 X-12.355 Y-7.000 E436.78843 F3600
+G1 X-12.870 Y-6.000 E436.78843 F7800
+G1 X12.870 Y-6.000 E437.81804 F3600
+G1 X13.291 Y-5.000 E437.81804 F7800
+G1 X-13.291 Y-5.000 E438.88129 F3600
+G1 X-13.625 Y-4.000 E438.88129 F7800
+G1 X13.625 Y-4.000 E439.97129 F3600
+G1 X13.879 Y-3.000 E439.97129 F7800
+G1 X-13.879 Y-3.000 E441.08165 F3600
+G1 X-14.058 Y-2.000 E441.08165 F7800
+G1 X14.058 Y-2.000 E442.20632 F3600
+G1 X14.165 Y-1.000 E442.20632 F7800
+G1 X-14.165 Y-1.000 E443.33950 F3600
+G1 X-14.200 Y0.000 E443.33950 F7800
+G1 X14.200 Y0.000 E444.47550 F3600
+G1 X14.165 Y1.000 E444.47550 F7800
+G1 X-14.165 Y1.000 E445.60868 F3600
+G1 X-14.058 Y2.000 E445.60868 F7800
+G1 X14.058 Y2.000 E446.73336 F3600
+G1 X13.879 Y3.000 E446.73336 F7800
+G1 X-13.879 Y3.000 E447.84372 F3600
+G1 X-13.625 Y4.000 E447.84372 F7800
+G1 X13.625 Y4.000 E448.93371 F3600
+G1 X13.291 Y5.000 E448.93371 F7800
+G1 X-13.291 Y5.000 E449.99696 F3600
+G1 X-12.870 Y6.000 E449.99696 F7800
+G1 X12.870 Y6.000 E451.02657 F3600
+G1 X12.355 Y7.000 E451.02657 F7800
+G1 X-12.355 Y7.000 E452.01495 F3600
+G1 X-11.732 Y8.000 E452.01495 F7800
+G1 X11.732 Y8.000 E452.95351 F3600
+G1 X10.984 Y9.000 E452.95351 F7800
+G1 X-10.984 Y9.000 E453.83220 F3600
+G1 X-10.082 Y10.000 E453.83220 F7800
+G1 X10.082 Y10.000 E454.63874 F3600
+G1 X8.980 Y11.000 E454.63874 F7800
+G1 X-8.980 Y11.000 E455.35713 F3600
+G1 X-7.592 Y12.000 E455.35713 F7800
+G1 X7.592 Y12.000 E455.96450 F3600
+G1 X5.713 Y13.000 E455.96450 F7800
+G1 X-5.713 Y13.000 E456.42155 F3600
+G1 Z3.300 F7800
+G1 E455.42155 F2400
+G1 E456.42155 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E456.44155 F1800
+G1 X14.918 Y1.568 E456.46155
+G1 X14.815 Y2.347 E456.48155
+G1 X14.672 Y3.119 E456.50155
+G1 X14.489 Y3.882 E456.52155
+G1 X14.266 Y4.635 E456.54155
+G1 X14.004 Y5.376 E456.56155
+G1 X13.703 Y6.101 E456.58155
+G1 X13.365 Y6.810 E456.60155
+G1 X12.990 Y7.500 E456.62155
+G1 X12.580 Y8.170 E456.64155
+G1 X12.135 Y8.817 E456.66155
+G1 X11.657 Y9.440 E456.68155
+G1 X11.147 Y10.037 E456.70155
+G1 X10.607 Y10.607 E456.72155
+G1 X10.037 Y11.147 E456.74155
+G1 X9.440 Y11.657 E456.76155
+G1 X8.817 Y12.135 E456.78155
+G1 X8.170 Y12.580 E456.80155
+G1 X7.500 Y12.990 E456.82155
+G1 X6.810 Y13.365 E456.84155
+G1 X6.101 Y13.703 E456.86155
+G1 X5.376 Y14.004 E456.88155
+G1 X4.635 Y14.266 E456.90155
+G1 X3.882 Y14.489 E456.92155
+G1 X3.119 Y14.672 E456.94155
+G1 X2.347 Y14.815 E456.96155
+G1 X1.568 Y14.918 E456.98155
+G1 X0.785 Y14.979 E457.00155
+G1 X0.000 Y15.000 E457.02155
+G1 X-0.785 Y14.979 E457.04155
+G1 X-1.568 Y14.918 E457.06155
+G1 X-2.347 Y14.815 E457.08155
+G1 X-3.119 Y14.672 E457.10155
+G1 X-3.882 Y14.489 E457.12155
+G1 X-4.635 Y14.266 E457.14155
+G1 X-5.376 Y14.004 E457.16155
+G1 X-6.101 Y13.703 E457.18155
+G1 X-6.810 Y13.365 E457.20155
+G1 X-7.500 Y12.990 E457.22155
+G1 X-8.170 Y12.580 E457.24155
+G1 X-8.817 Y12.135 E457.26155
+G1 X-9.440 Y11.657 E457.28155
+G1 X-10.037 Y11.147 E457.30155
+G1 X-10.607 Y10.607 E457.32155
+G1 X-11.147 Y10.037 E457.34155
+G1 X-11.657 Y9.440 E457.36155
+G1 X-12.135 Y8.817 E457.38155
+G1 X-12.580 Y8.170 E457.40155
+G1 X-12.990 Y7.500 E457.42155
+G1 X-13.365 Y6.810 E457.44155
+G1 X-13.703 Y6.101 E457.46155
+G1 X-14.004 Y5.376 E457.48155
+G1 X-14.266 Y4.635 E457.50155
+G1 X-14.489 Y3.882 E457.52155
+G1 X-14.672 Y3.119 E457.54155
+G1 X-14.815 Y2.347 E457.56155
+G1 X-14.918 Y1.568 E457.58155
+G1 X-14.979 Y0.785 E457.60155
+G1 X-15.000 Y0.000 E457.62155
+G1 X-14.979 Y-0.785 E457.64155
+G1 X-14.918 Y-1.568 E457.66155
+G1 X-14.815 Y-2.347 E457.68155
+G1 X-14.672 Y-3.119 E457.70155
+G1 X-14.489 Y-3.882 E457.72155
+G1 X-14.266 Y-4.635 E457.74155
+G1 X-14.004 Y-5.376 E457.76155
+G1 X-13.703 Y-6.101 E457.78155
+G1 X-13.365 Y-6.810 E457.80155
+G1 X-12.990 Y-7.500 E457.82155
+G1 X-12.580 Y-8.170 E457.84155
+G1 X-12.135 Y-8.817 E457.86155
+G1 X-11.657 Y-9.440 E457.88155
+G1 X-11.147 Y-10.037 E457.90155
+G1 X-10.607 Y-10.607 E457.92155
+G1 X-10.037 Y-11.147 E457.94155
+G1 X-9.440 Y-11.657 E457.96155
+G1 X-8.817 Y-12.135 E457.98155
+G1 X-8.170 Y-12.580 E458.00155
+G1 X-7.500 Y-12.990 E458.02155
+G1 X-6.810 Y-13.365 E458.04155
+G1 X-6.101 Y-13.703 E458.06155
+G1 X-5.376 Y-14.004 E458.08155
+G1 X-4.635 Y-14.266 E458.10155
+G1 X-3.882 Y-14.489 E458.12155
+G1 X-3.119 Y-14.672 E458.14155
+G1 X-2.347 Y-14.815 E458.16155
+G1 X-1.568 Y-14.918 E458.18155
+G1 X-0.785 Y-14.979 E458.20155
+G1 X-0.000 Y-15.000 E458.22155
+G1 X0.785 Y-14.979 E458.24155
+G1 X1.568 Y-14.918 E458.26155
+G1 X2.347 Y-14.815 E458.28155
+G1 X3.119 Y-14.672 E458.30155
+G1 X3.882 Y-14.489 E458.32155
+G1 X4.635 Y-14.266 E458.34155
+G1 X5.376 Y-14.004 E458.36155
+G1 X6.101 Y-13.703 E458.38155
+G1 X6.810 Y-13.365 E458.40155
+G1 X7.500 Y-12.990 E458.42155
+G1 X8.170 Y-12.580 E458.44155
+G1 X8.817 Y-12.135 E458.46155
+G1 X9.440 Y-11.657 E458.48155
+G1 X10.037 Y-11.147 E458.50155
+G1 X10.607 Y-10.607 E458.52155
+G1 X11.147 Y-10.037 E458.54155
+G1 X11.657 Y-9.440 E458.56155
+G1 X12.135 Y-8.817 E458.58155
+G1 X12.580 Y-8.170 E458.60155
+G1 X12.990 Y-7.500 E458.62155
+G1 X13.365 Y-6.810 E458.64155
+G1 X13.703 Y-6.101 E458.66155
+G1 X14.004 Y-5.376 E458.68155
+G1 X14.266 Y-4.635 E458.70155
+G1 X14.489 Y-3.882 E458.72155
+G1 X14.672 Y-3.119 E458.74155
+G1 X14.815 Y-2.347 E458.76155
+G1 X14.918 Y-1.568 E458.78155
+G1 X14.979 Y-0.785 E458.80155
+G1 X15.000 Y-0.000 E458.82155
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E458.84155 F1800
+G1 X14.520 Y1.526 E458.86155
+G1 X14.420 Y2.284 E458.88155
+G1 X14.281 Y3.036 E458.90155
+G1 X14.103 Y3.779 E458.92155
+G1 X13.885 Y4.512 E458.94155
+G1 X13.630 Y5.232 E458.96155
+G1 X13.338 Y5.938 E458.98155
+G1 X13.009 Y6.628 E459.00155
+G1 X12.644 Y7.300 E459.02155
+G1 X12.245 Y7.952 E459.04155
+G1 X11.812 Y8.582 E459.06155
+G1 X11.346 Y9.188 E459.08155
+G1 X10.850 Y9.769 E459.10155
+G1 X10.324 Y10.324 E459.12155
+G1 X9.769 Y10.850 E459.14155
+G1 X9.188 Y11.346 E459.16155
+G1 X8.582 Y11.812 E459.18155
+G1 X7.952 Y12.245 E459.20155
+G1 X7.300 Y12.644 E459.22155
+G1 X6.628 Y13.009 E459.24155
+G1 X5.938 Y13.338 E459.26155
+G1 X5.232 Y13.630 E459.28155
+G1 X4.512 Y13.885 E459.30155
+G1 X3.779 Y14.103 E459.32155
+G1 X3.036 Y14.281 E459.34155
+G1 X2.284 Y14.420 E459.36155
+G1 X1.526 Y14.520 E459.38155
+G1 X0.764 Y14.580 E459.40155
+G1 X0.000 Y14.600 E459.42155
+G1 X-0.764 Y14.580 E459.44155
+G1 X-1.526 Y14.520 E459.46155
+G1 X-2.284 Y14.420 E459.48155
+G1 X-3.036 Y14.281 E459.50155
+G1 X-3.779 Y14.103 E459.52155
+G1 X-4.512 Y13.885 E459.54155
+G1 X-5.232 Y13.630 E459.56155
+G1 X-5.938 Y13.338 E459.58155
+G1 X-6.628 Y13.009 E459.60155
+G1 X-7.300 Y12.644 E459.62155
+G1 X-7.952 Y12.245 E459.64155
+G1 X-8.582 Y11.812 E459.66155
+G1 X-9.188 Y11.346 E459.68155
+G1 X-9.769 Y10.850 E459.70155
+G1 X-10.324 Y10.324 E459.72155
+G1 X-10.850 Y9.769 E459.74155
+G1 X-11.346 Y9.188 E459.76155
+G1 X-11.812 Y8.582 E459.78155
+G1 X-12.245 Y7.952 E459.80155
+G1 X-12.644 Y7.300 E459.82155
+G1 X-13.009 Y6.628 E459.84155
+G1 X-13.338 Y5.938 E459.86155
+G1 X-13.630 Y5.232 E459.88155
+G1 X-13.885 Y4.512 E459.90155
+G1 X-14.103 Y3.779 E459.92155
+G1 X-14.281 Y3.036 E459.94155
+G1 X-14.420 Y2.284 E459.96155
+G1 X-14.520 Y1.526 E459.98155
+G1 X-14.580 Y0.764 E460.00155
+G1 X-14.600 Y0.000 E460.02155
+G1 X-14.580 Y-0.764 E460.04155
+G1 X-14.520 Y-1.526 E460.06155
+G1 X-14.420 Y-2.284 E460.08155
+G1 X-14.281 Y-3.036 E460.10155
+G1 X-14.103 Y-3.779 E460.12155
+G1 X-13.885 Y-4.512 E460.14155
+G1 X-13.630 Y-5.232 E460.16155
+G1 X-13.338 Y-5.938 E460.18155
+G1 X-13.009 Y-6.628 E460.20155
+G1 X-12.644 Y-7.300 E460.22155
+G1 X-12.245 Y-7.952 E460.24155
+G1 X-11.812 Y-8.582 E460.26155
+G1 X-11.346 Y-9.188 E460.28155
+G1 X-10.850 Y-9.769 E460.30155
+G1 X-10.324 Y-10.324 E460.32155
+G1 X-9.769 Y-10.850 E460.34155
+G1 X-9.188 Y-11.346 E460.36155
+G1 X-8.582 Y-11.812 E460.38155
+G1 X-7.952 Y-12.245 E460.40155
+G1 X-7.300 Y-12.644 E460.42155
+G1 X-6.628 Y-13.009 E460.44155
+G1 X-5.938 Y-13.338 E460.46155
+G1 X-5.232 Y-13.630 E460.48155
+G1 X-4.512 Y-13.885 E460.50155
+G1 X-3.779 Y-14.103 E460.52155
+G1 X-3.036 Y-14.281 E460.54155
+G1 X-2.284 Y-14.420 E460.56155
+G1 X-1.526 Y-14.520 E460.58155
+G1 X-0.764 Y-14.580 E460.60155
+G1 X-0.000 Y-14.600 E460.62155
+G1 X0.764 Y-14.580 E460.64155
+G1 X1.526 Y-14.520 E460.66155
+G1 X2.284 Y-14.420 E460.68155
+G1 X3.036 Y-14.281 E460.70155
+G1 X3.779 Y-14.103 E460.72155
+G1 X4.512 Y-13.885 E460.74155
+G1 X5.232 Y-13.630 E460.76155
+G1 X5.938 Y-13.338 E460.78155
+G1 X6.628 Y-13.009 E460.80155
+G1 X7.300 Y-12.644 E460.82155
+G1 X7.952 Y-12.245 E460.84155
+G1 X8.582 Y-11.812 E460.86155
+G1 X9.188 Y-11.346 E460.88155
+G1 X9.769 Y-10.850 E460.90155
+G1 X10.324 Y-10.324 E460.92155
+G1 X10.850 Y-9.769 E460.94155
+G1 X11.346 Y-9.188 E460.96155
+G1 X11.812 Y-8.582 E460.98155
+G1 X12.245 Y-7.952 E461.00155
+G1 X12.644 Y-7.300 E461.02155
+G1 X13.009 Y-6.628 E461.04155
+G1 X13.338 Y-5.938 E461.06155
+G1 X13.630 Y-5.232 E461.08155
+G1 X13.885 Y-4.512 E461.10155
+G1 X14.103 Y-3.779 E461.12155
+G1 X14.281 Y-3.036 E461.14155
+G1 X14.420 Y-2.284 E461.16155
+G1 X14.520 Y-1.526 E461.18155
+G1 X14.580 Y-0.764 E461.20155
+G1 X14.600 Y-0.000 E461.22155
+G1 X5.713 Y-13.000 E461.22155 F7800
+G1 X-5.713 Y-13.000 E461.67860 F3600
+G1 X-7.592 Y-12.000 E461.67860 F7800
+G1 X7.592 Y-12.000 E462.28597 F3600
+G1 X8.980 Y-11.000 E462.28597 F7800
+G1 X-8.980 Y-11.000 E463.00437 F3600
+G1 X-10.082 Y-10.000 E463.00437 F7800
+G1 X10.082 Y-10.000 E463.81090 F3600
+G1 X10.984 Y-9.000 E463.81090 F7800
+G1 X-10.984 Y-9.000 E464.68959 F3600
+G1 X-11.732 Y-8.000 E464.68959 F7800
+G1 X11.732 Y-8.000 E465.62816 F3600
+G1 X12.355 Y-7.000 E465.62816 F7800
+G1 X-12.355 Y-7.000 E466.61654 F3600
+G1 X-12.870 Y-6.000 E466.61654 F7800
+G1 X12.870 Y-6.000 E467.64615 F3600
+G1 X13.291 Y-5.000 E467.64615 F7800
+G1 X-13.291 Y-5.000 E468.70939 F3600
+G1 X-13.625 Y-4.000 E468.70939 F7800
+G1 X13.625 Y-4.000 E469.79939 F3600
+G1 X13.879 Y-3.000 E469.79939 F7800
+G1 X-13.879 Y-3.000 E470.90975 F3600
+G1 X-14.058 Y-2.000 E470.90975 F7800
+G1 X14.058 Y-2.000 E472.03443 F3600
+G1 X14.165 Y-1.000 E472.03443 F7800
+G1 X-14.165 Y-1.000 E473.16761 F3600
+G1 X-14.200 Y0.000 E473.16761 F7800
+G1 X14.200 Y0.000 E474.30361 F3600
+G1 X14.165 Y1.000 E474.30361 F7800
+G1 X-14.165 Y1.000 E475.43678 F3600
+G1 X-14.058 Y2.000 E475.43678 F7800
+G1 X14.058 Y2.000 E476.56146 F3600
+G1 X13.879 Y3.000 E476.56146 F7800
+G1 X-13.879 Y3.000 E477.67182 F3600
+G1 X-13.625 Y4.000 E477.67182 F7800
+G1 X13.625 Y4.000 E478.76182 F3600
+G1 X13.291 Y5.000 E478.76182 F7800
+G1 X-13.291 Y5.000 E479.82507 F3600
+G1 X-12.870 Y6.000 E479.82507 F7800
+G1 X12.870 Y6.000 E480.85468 F3600
+G1 X12.355 Y7.000 E480.85468 F7800
+G1 X-12.355 Y7.000 E481.84306 F3600
+G1 X-11.732 Y8.000 E481.84306 F7800
+G1 X11.732 Y8.000 E482.78162 F3600
+G1 X10.984 Y9.000 E482.78162 F7800
+G1 X-10.984 Y9.000 E483.66031 F3600
+G1 X-10.082 Y10.000 E483.66031 F7800
+G1 X10.082 Y10.000 E484.46684 F3600
+G1 X8.980 Y11.000 E484.46684 F7800
+G1 X-8.980 Y11.000 E485.18524 F3600
+G1 X-7.592 Y12.000 E485.18524 F7800
+G1 X7.592 Y12.000 E485.79261 F3600
+G1 X5.713 Y13.000 E485.79261 F7800
+G1 X-5.713 Y13.000 E486.24966 F3600
+G1 X20.000 Y-10.000 E486.54966 F3000
+G1 X24.000 Y-10.000 E486.84966
+G1 X20.000 Y-8.000 E487.14966 F3000
+G1 X24.000 Y-8.000 E487.44966
+G1 X20.000 Y-6.000 E487.74966 F3000
+G1 X24.000 Y-6.000 E488.04966
+G1 X20.000 Y-4.000 E488.34966 F3000
+G1 X24.000 Y-4.000 E488.64966
+G1 X20.000 Y-2.000 E488.94966 F3000
+G1 X24.000 Y-2.000 E489.24966
+G1 X20.000 Y0.000 E489.54966 F3000
+G1 X24.000 Y0.000 E489.84966
+G1 X20.000 Y2.000 E490.14966 F3000
+G1 X24.000 Y2.000 E490.44966
+G1 X20.000 Y4.000 E490.74966 F3000
+G1 X24.000 Y4.000 E491.04966
+G1 X20.000 Y6.000 E491.34966 F3000
+G1 X24.000 Y6.000 E491.64966
+G1 X20.000 Y8.000 E491.94966 F3000
+G1 X24.000 Y8.000 E492.24966
+G1 Z3.500 F7800
+G1 E491.24966 F2400
+G1 E492.24966 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E492.26966 F1800
+G1 X14.918 Y1.568 E492.28966
+G1 X14.815 Y2.347 E492.30966
+G1 X14.672 Y3.119 E492.32966
+G1 X14.489 Y3.882 E492.34966
+G1 X14.266 Y4.635 E492.36966
+G1 X14.004 Y5.376 E492.38966
+G1 X13.703 Y6.101 E492.40966
+G1 X13.365 Y6.810 E492.42966
+G1 X12.990 Y7.500 E492.44966
+G1 X12.580 Y8.170 E492.46966
+G1 X12.135 Y8.817 E492.48966
+G1 X11.657 Y9.440 E492.50966
+G1 X11.147 Y10.037 E492.52966
+G1 X10.607 Y10.607 E492.54966
+G1 X10.037 Y11.147 E492.56966
+G1 X9.440 Y11.657 E492.58966
+G1 X8.817 Y12.135 E492.60966
+G1 X8.170 Y12.580 E492.62966
+G1 X7.500 Y12.990 E492.64966
+G1 X6.810 Y13.365 E492.66966
+G1 X6.101 Y13.703 E492.68966
+G1 X5.376 Y14.004 E492.70966
+G1 X4.635 Y14.266 E492.72966
+G1 X3.882 Y14.489 E492.74966
+G1 X3.119 Y14.672 E492.76966
+G1 X2.347 Y14.815 E492.78966
+G1 X1.568 Y14.918 E492.80966
+G1 X0.785 Y14.979 E492.82966
+G1 X0.000 Y15.000 E492.84966
+G1 X-0.785 Y14.979 E492.86966
+G1 X-1.568 Y14.918 E492.88966
+G1 X-2.347 Y14.815 E492.90966
+G1 X-3.119 Y14.672 E492.92966
+G1 X-3.882 Y14.489 E492.94966
+G1 X-4.635 Y14.266 E492.96966
+G1 X-5.376 Y14.004 E492.98966
+G1 X-6.101 Y13.703 E493.00966
+G1 X-6.810 Y13.365 E493.02966
+G1 X-7.500 Y12.990 E493.04966
+G1 X-8.170 Y12.580 E493.06966
+G1 X-8.817 Y12.135 E493.08966
+G1 X-9.440 Y11.657 E493.10966
+G1 X-10.037 Y11.147 E493.12966
+G1 X-10.607 Y10.607 E493.14966
+G1 X-11.147 Y10.037 E493.16966
+G1 X-11.657 Y9.440 E493.18966
+G1 X-12.135 Y8.817 E493.20966
+G1 X-12.580 Y8.170 E493.22966
+G1 X-12.990 Y7.500 E493.24966
+G1 X-13.365 Y6.810 E493.26966
+G1 X-13.703 Y6.101 E493.28966
+G1 X-14.004 Y5.376 E493.30966
+G1 X-14.266 Y4.635 E493.32966
+G1 X-14.489 Y3.882 E493.34966
+G1 X-14.672 Y3.119 E493.36966
+G1 X-14.815 Y2.347 E493.38966
+G1 X-14.918 Y1.568 E493.40966
+G1 X-14.979 Y0.785 E493.42966
+G1 X-15.000 Y0.000 E493.44966
+G1 X-14.979 Y-0.785 E493.46966
+G1 X-14.918 Y-1.568 E493.48966
+G1 X-14.815 Y-2.347 E493.50966
+G1 X-14.672 Y-3.119 E493.52966
+G1 X-14.489 Y-3.882 E493.54966
+G1 X-14.266 Y-4.635 E493.56966
+G1 X-14.004 Y-5.376 E493.58966
+G1 X-13.703 Y-6.101 E493.60966
+G1 X-13.365 Y-6.810 E493.62966
+G1 X-12.990 Y-7.500 E493.64966
+G1 X-12.580 Y-8.170 E493.66966
+G1 X-12.135 Y-8.817 E493.68966
+G1 X-11.657 Y-9.440 E493.70966
+G1 X-11.147 Y-10.037 E493.72966
+G1 X-10.607 Y-10.607 E493.74966
+G1 X-10.037 Y-11.147 E493.76966
+G1 X-9.440 Y-11.657 E493.78966
+G1 X-8.817 Y-12.135 E493.80966
+G1 X-8.170 Y-12.580 E493.82966
+G1 X-7.500 Y-12.990 E493.84966
+G1 X-6.810 Y-13.365 E493.86966
+G1 X-6.101 Y-13.703 E493.88966
+G1 X-5.376 Y-14.004 E493.90966
+G1 X-4.635 Y-14.266 E493.92966
+G1 X-3.882 Y-14.489 E493.94966
+G1 X-3.119 Y-14.672 E493.96966
+G1 X-2.347 Y-14.815 E493.98966
+G1 X-1.568 Y-14.918 E494.00966
+G1 X-0.785 Y-14.979 E494.02966
+G1 X-0.000 Y-15.000 E494.04966
+G1 X0.785 Y-14.979 E494.06966
+G1 X1.568 Y-14.918 E494.08966
+G1 X2.347 Y-14.815 E494.10966
+G1 X3.119 Y-14.672 E494.12966
+G1 X3.882 Y-14.489 E494.14966
+G1 X4.635 Y-14.266 E494.16966
+G1 X5.376 Y-14.004 E494.18966
+G1 X6.101 Y-13.703 E494.20966
+G1 X6.810 Y-13.365 E494.22966
+G1 X7.500 Y-12.990 E494.24966
+G1 X8.170 Y-12.580 E494.26966
+G1 X8.817 Y-12.135 E494.28966
+G1 X9.440 Y-11.657 E494.30966
+G1 X10.037 Y-11.147 E494.32966
+G1 X10.607 Y-10.607 E494.34966
+G1 X11.147 Y-10.037 E494.36966
+G1 X11.657 Y-9.440 E494.38966
+G1 X12.135 Y-8.817 E494.40966
+G1 X12.580 Y-8.170 E494.42966
+G1 X12.990 Y-7.500 E494.44966
+G1 X13.365 Y-6.810 E494.46966
+G1 X13.703 Y-6.101 E494.48966
+G1 X14.004 Y-5.376 E494.50966
+G1 X14.266 Y-4.635 E494.52966
+G1 X14.489 Y-3.882 E494.54966
+G1 X14.672 Y-3.119 E494.56966
+G1 X14.815 Y-2.347 E494.58966
+G1 X14.918 Y-1.568 E494.60966
+G1 X14.979 Y-0.785 E494.62966
+G1 X15.000 Y-0.000 E494.64966
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E494.66966 F1800
+G1 X14.520 Y1.526 E494.68966
+G1 X14.420 Y2.284 E494.70966
+G1 X14.281 Y3.036 E494.72966
+G1 X14.103 Y3.779 E494.74966
+G1 X13.885 Y4.512 E494.76966
+G1 X13.630 Y5.232 E494.78966
+G1 X13.338 Y5.938 E494.80966
+G1 X13.009 Y6.628 E494.82966
+G1 X12.644 Y7.300 E494.84966
+G1 X12.245 Y7.952 E494.86966
+G1 X11.812 Y8.582 E494.88966
+G1 X11.346 Y9.188 E494.90966
+G1 X10.850 Y9.769 E494.92966
+G1 X10.324 Y10.324 E494.94966
+G1 X9.769 Y10.850 E494.96966
+G1 X9.188 Y11.346 E494.98966
+G1 X8.582 Y11.812 E495.00966
+G1 X7.952 Y12.245 E495.02966
+G1 X7.300 Y12.644 E495.04966
+G1 X6.628 Y13.009 E495.06966
+G1 X5.938 Y13.338 E495.08966
+G1 X5.232 Y13.630 E495.10966
+G1 X4.512 Y13.885 E495.12966
+G1 X3.779 Y14.103 E495.14966
+G1 X3.036 Y14.281 E495.16966
+G1 X2.284 Y14.420 E495.18966
+G1 X1.526 Y14.520 E495.20966
+G1 X0.764 Y14.580 E495.22966
+G1 X0.000 Y14.600 E495.24966
+G1 X-0.764 Y14.580 E495.26966
+G1 X-1.526 Y14.520 E495.28966
+G1 X-2.284 Y14.420 E495.30966
+G1 X-3.036 Y14.281 E495.32966
+G1 X-3.779 Y14.103 E495.34966
+G1 X-4.512 Y13.885 E495.36966
+G1 X-5.232 Y13.630 E495.38966
+G1 X-5.938 Y13.338 E495.40966
+G1 X-6.628 Y13.009 E495.42966
+G1 X-7.300 Y12.644 E495.44966
+G1 X-7.952 Y12.245 E495.46966
+G1 X-8.582 Y11.812 E495.48966
+G1 X-9.188 Y11.346 E495.50966
+G1 X-9.769 Y10.850 E495.52966
+G1 X-10.324 Y10.324 E495.54966
+G1 X-10.850 Y9.769 E495.56966
+G1 X-11.346 Y9.188 E495.58966
+G1 X-11.812 Y8.582 E495.60966
+G1 X-12.245 Y7.952 E495.62966
+G1 X-12.644 Y7.300 E495.64966
+G1 X-13.009 Y6.628 E495.66966
+G1 X-13.338 Y5.938 E495.68966
+G1 X-13.630 Y5.232 E495.70966
+G1 X-13.885 Y4.512 E495.72966
+G1 X-14.103 Y3.779 E495.74966
+G1 X-14.281 Y3.036 E495.76966
+G1 X-14.420 Y2.284 E495.78966
+G1 X-14.520 Y1.526 E495.80966
+G1 X-14.580 Y0.764 E495.82966
+G1 X-14.600 Y0.000 E495.84966
+G1 X-14.580 Y-0.764 E495.86966
+G1 X-14.520 Y-1.526 E495.88966
+G1 X-14.420 Y-2.284 E495.90966
+G1 X-14.281 Y-3.036 E495.92966
+G1 X-14.103 Y-3.779 E495.94966
+G1 X-13.885 Y-4.512 E495.96966
+G1 X-13.630 Y-5.232 E495.98966
+G1 X-13.338 Y-5.938 E496.00966
+G1 X-13.009 Y-6.628 E496.02966
+G1 X-12.644 Y-7.300 E496.04966
+G1 X-12.245 Y-7.952 E496.06966
+G1 X-11.812 Y-8.582 E496.08966
+G1 X-11.346 Y-9.188 E496.10966
+G1 X-10.850 Y-9.769 E496.12966
+G1 X-10.324 Y-10.324 E496.14966
+G1 X-9.769 Y-10.850 E496.16966
+G1 X-9.188 Y-11.346 E496.18966
+G1 X-8.582 Y-11.812 E496.20966
+G1 X-7.952 Y-12.245 E496.22966
+G1 X-7.300 Y-12.644 E496.24966
+G1 X-6.628 Y-13.009 E496.26966
+G1 X-5.938 Y-13.338 E496.28966
+G1 X-5.232 Y-13.630 E496.30966
+G1 X-4.512 Y-13.885 E496.32966
+G1 X-3.779 Y-14.103 E496.34966
+G1 X-3.036 Y-14.281 E496.36966
+G1 X-2.284 Y-14.420 E496.38966
+G1 X-1.526 Y-14.520 E496.40966
+G1 X-0.764 Y-14.580 E496.42966
+G1 X-0.000 Y-14.600 E496.44966
+G1 X0.764 Y-14.580 E496.46966
+G1 X1.526 Y-14.520 E496.48966
+G1 X2.284 Y-14.420 E496.50966
+G1 X3.036 Y-14.281 E496.52966
+G1 X3.779 Y-14.103 E496.54966
+G1 X4.512 Y-13.885 E496.56966
+G1 X5.232 Y-13.630 E496.58966
+G1 X5.938 Y-13.338 E496.60966
+G1 X6.628 Y-13.009 E496.62966
+G1 X7.300 Y-12.644 E496.64966
+G1 X7.952 Y-12.245 E496.66966
+G1 X8.582 Y-11.812 E496.68966
+G1 X9.188 Y-11.346 E496.70966
+G1 X9.769 Y-10.850 E496.72966
+G1 X10.324 Y-10.324 E496.74966
+G1 X10.850 Y-9.769 E496.76966
+G1 X11.346 Y-9.188 E496.78966
+G1 X11.812 Y-8.582 E496.80966
+G1 X12.245 Y-7.952 E496.82966
+G1 X12.644 Y-7.300 E496.84966
+G1 X13.009 Y-6.628 E496.86966
+G1 X13.338 Y-5.938 E496.88966
+G1 X13.630 Y-5.232 E496.90966
+G1 X13.885 Y-4.512 E496.92966
+G1 X14.103 Y-3.779 E496.94966
+G1 X14.281 Y-3.036 E496.96966
+G1 X14.420 Y-2.284 E496.98966
+G1 X14.520 Y-1.526 E497.00966
+G1 X14.580 Y-0.764 E497.02966
+G1 X14.600 Y-0.000 E497.04966
+G1 X5.713 Y-13.000 E497.04966 F7800
+G1 X-5.713 Y-13.000 E497.50671 F3600
+G1 X-7.592 Y-12.000 E497.50671 F7800
+G1 X7.592 Y-12.000 E498.11408 F3600
+G1 X8.980 Y-11.000 E498.11408 F7800
+G1 X-8.980 Y-11.000 E498.83247 F3600
+G1 X-10.082 Y-10.000 E498.83247 F7800
+G1 X10.082 Y-10.000 E499.63901 F3600
+G1 X10.984 Y-9.000 E499.63901 F7800
+G1 X-10.984 Y-9.000 E500.51770 F3600
+G1 X-11.732 Y-8.000 E500.51770 F7800
+G1 X11.732 Y-8.000 E501.45626 F3600
+G1 X12.355 Y-7.000 E501.45626 F7800
+G1 X-12.355 Y-7.000 E502.44464 F3600
+G1 X-12.870 Y-6.000 E502.44464 F7800
+G1 X12.870 Y-6.000 E503.47425 F3600
+G1 X13.291 Y-5.000 E503.47425 F7800
+G1 X-13.291 Y-5.000 E504.53750 F3600
+G1 X-13.625 Y-4.000 E504.53750 F7800
+G1 X13.625 Y-4.000 E505.62749 F3600
+G1 X13.879 Y-3.000 E505.62749 F7800
+G1 X-13.879 Y-3.000 E506.73785 F3600
+G1 X-14.058 Y-2.000 E506.73785 F7800
+G1 X14.058 Y-2.000 E507.86253 F3600
+G1 X14.165 Y-1.000 E507.86253 F7800
+G1 X-14.165 Y-1.000 E508.99571 F3600
+G1 X-14.200 Y0.000 E508.99571 F7800
+G1 X14.200 Y0.000 E510.13171 F3600
+G1 X14.165 Y1.000 E510.13171 F7800
+G1 X-14.165 Y1.000 E511.26489 F3600
+G1 X-14.058 Y2.000 E511.26489 F7800
+G1 X14.058 Y2.000 E512.38956 F3600
+G1 X13.879 Y3.000 E512.38956 F7800
+G1 X-13.879 Y3.000 E513.49992 F3600
+G1 X-13.625 Y4.000 E513.49992 F7800
+G1 X13.625 Y4.000 E514.58992 F3600
+G1 X13.291 Y5.000 E514.58992 F7800
+G1 X-13.291 Y5.000 E515.65317 F3600
+G1 X-12.870 Y6.000 E515.65317 F7800
+G1 X12.870 Y6.000 E516.68278 F3600
+G1 X12.355 Y7.000 E516.68278 F7800
+G1 X-12.355 Y7.000 E517.67116 F3600
+G1 X-11.732 Y8.000 E517.67116 F7800
+G1 X11.732 Y8.000 E518.60972 F3600
+G1 X10.984 Y9.000 E518.60972 F7800
+G1 X-10.984 Y9.000 E519.48841 F3600
+G1 X-10.082 Y10.000 E519.48841 F7800
+G1 X10.082 Y10.000 E520.29494 F3600
+G1 X8.980 Y11.000 E520.29494 F7800
+G1 X-8.980 Y11.000 E521.01334 F3600
+G1 X-7.592 Y12.000 E521.01334 F7800
+G1 X7.592 Y12.000 E521.62071 F3600
+G1 X5.713 Y13.000 E521.62071 F7800
+G1 X-5.713 Y13.000 E522.07776 F3600
+G1 Z3.700 F7800
+G1 E521.07776 F2400
+G1 E522.07776 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E522.09776 F1800
+G1 X14.918 Y1.568 E522.11776
+G1 X14.815 Y2.347 E522.13776
+G1 X14.672 Y3.119 E522.15776
+G1 X14.489 Y3.882 E522.17776
+G1 X14.266 Y4.635 E522.19776
+G1 X14.004 Y5.376 E522.21776
+G1 X13.703 Y6.101 E522.23776
+G1 X13.365 Y6.810 E522.25776
+G1 X12.990 Y7.500 E522.27776
+G1 X12.580 Y8.170 E522.29776
+G1 X12.135 Y8.817 E522.31776
+G1 X11.657 Y9.440 E522.33776
+G1 X11.147 Y10.037 E522.35776
+G1 X10.607 Y10.607 E522.37776
+G1 X10.037 Y11.147 E522.39776
+G1 X9.440 Y11.657 E522.41776
+G1 X8.817 Y12.135 E522.43776
+G1 X8.170 Y12.580 E522.45776
+G1 X7.500 Y12.990 E522.47776
+G1 X6.810 Y13.365 E522.49776
+G1 X6.101 Y13.703 E522.51776
+G1 X5.376 Y14.004 E522.53776
+G1 X4.635 Y14.266 E522.55776
+G1 X3.882 Y14.489 E522.57776
+G1 X3.119 Y14.672 E522.59776
+G1 X2.347 Y14.815 E522.61776
+G1 X1.568 Y14.918 E522.63776
+G1 X0.785 Y14.979 E522.65776
+G1 X0.000 Y15.000 E522.67776
+G1 X-0.785 Y14.979 E522.69776
+G1 X-1.568 Y14.918 E522.71776
+G1 X-2.347 Y14.815 E522.73776
+G1 X-3.119 Y14.672 E522.75776
+G1 X-3.882 Y14.489 E522.77776
+G1 X-4.635 Y14.266 E522.79776
+G1 X-5.376 Y14.004 E522.81776
+G1 X-6.101 Y13.703 E522.83776
+G1 X-6.810 Y13.365 E522.85776
+G1 X-7.500 Y12.990 E522.87776
+G1 X-8.170 Y12.580 E522.89776
+G1 X-8.817 Y12.135 E522.91776
+G1 X-9.440 Y11.657 E522.93776
+G1 X-10.037 Y11.147 E522.95776
+G1 X-10.607 Y10.607 E522.97776
+G1 X-11.147 Y10.037 E522.99776
+G1 X-11.657 Y9.440 E523.01776
+G1 X-12.135 Y8.817 E523.03776
+G1 X-12.580 Y8.170 E523.05776
+G1 X-12.990 Y7.500 E523.07776
+G1 X-13.365 Y6.810 E523.09776
+G1 X-13.703 Y6.101 E523.11776
+G1 X-14.004 Y5.376 E523.13776
+G1 X-14.266 Y4.635 E523.15776
+G1 X-14.489 Y3.882 E523.17776
+G1 X-14.672 Y3.119 E523.19776
+G1 X-14.815 Y2.347 E523.21776
+G1 X-14.918 Y1.568 E523.23776
+G1 X-14.979 Y0.785 E523.25776
+G1 X-15.000 Y0.000 E523.27776
+G1 X-14.979 Y-0.785 E523.29776
+G1 X-14.918 Y-1.568 E523.31776
+G1 X-14.815 Y-2.347 E523.33776
+G1 X-14.672 Y-3.119 E523.35776
+G1 X-14.489 Y-3.882 E523.37776
+G1 X-14.266 Y-4.635 E523.39776
+G1 X-14.004 Y-5.376 E523.41776
+G1 X-13.703 Y-6.101 E523.43776
+G1 X-13.365 Y-6.810 E523.45776
+G1 X-12.990 Y-7.500 E523.47776
+G1 X-12.580 Y-8.170 E523.49776
+G1 X-12.135 Y-8.817 E523.51776
+G1 X-11.657 Y-9.440 E523.53776
+G1 X-11.147 Y-10.037 E523.55776
+G1 X-10.607 Y-10.607 E523.57776
+G1 X-10.037 Y-11.147 E523.59776
+G1 X-9.440 Y-11.657 E523.61776
+G1 X-8.817 Y-12.135 E523.63776
+G1 X-8.170 Y-12.580 E523.65776
+G1 X-7.500 Y-12.990 E523.67776
+G1 X-6.810 Y-13.365 E523.69776
+G1 X-6.101 Y-13.703 E523.71776
+G1 X-5.376 Y-14.004 E523.73776
+G1 X-4.635 Y-14.266 E523.75776
+G1 X-3.882 Y-14.489 E523.77776
+G1 X-3.119 Y-14.672 E523.79776
+G1 X-2.347 Y-14.815 E523.81776
+G1 X-1.568 Y-14.918 E523.83776
+G1 X-0.785 Y-14.979 E523.85776
+G1 X-0.000 Y-15.000 E523.87776
+G1 X0.785 Y-14.979 E523.89776
+G1 X1.568 Y-14.918 E523.91776
+G1 X2.347 Y-14.815 E523.93776
+G1 X3.119 Y-14.672 E523.95776
+G1 X3.882 Y-14.489 E523.97776
+G1 X4.635 Y-14.266 E523.99776
+G1 X5.376 Y-14.004 E524.01776
+G1 X6.101 Y-13.703 E524.03776
+G1 X6.810 Y-13.365 E524.05776
+G1 X7.500 Y-12.990 E524.07776
+G1 X8.170 Y-12.580 E524.09776
+G1 X8.817 Y-12.135 E524.11776
+G1 X9.440 Y-11.657 E524.13776
+G1 X10.037 Y-11.147 E524.15776
+G1 X10.607 Y-10.607 E524.17776
+G1 X11.147 Y-10.037 E524.19776
+G1 X11.657 Y-9.440 E524.21776
+G1 X12.135 Y-8.817 E524.23776
+G1 X12.580 Y-8.170 E524.25776
+G1 X12.990 Y-7.500 E524.27776
+G1 X13.365 Y-6.810 E524.29776
+G1 X13.703 Y-6.101 E524.31776
+G1 X14.004 Y-5.376 E524.33776
+G1 X14.266 Y-4.635 E524.35776
+G1 X14.489 Y-3.882 E524.37776
+G1 X14.672 Y-3.119 E524.39776
+G1 X14.815 Y-2.347 E524.41776
+G1 X14.918 Y-1.568 E524.43776
+G1 X14.979 Y-0.785 E524.45776
+G1 X15.000 Y-0.000 E524.47776
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E524.49776 F1800
+G1 X14.520 Y1.526 E524.51776
+G1 X14.420 Y2.284 E524.53776
+G1 X14.281 Y3.036 E524.55776
+G1 X14.103 Y3.779 E524.57776
+G1 X13.885 Y4.512 E524.59776
+G1 X13.630 Y5.232 E524.61776
+G1 X13.338 Y5.938 E524.63776
+G1 X13.009 Y6.628 E524.65776
+G1 X12.644 Y7.300 E524.67776
+G1 X12.245 Y7.952 E524.69776
+G1 X11.812 Y8.582 E524.71776
+G1 X11.346 Y9.188 E524.73776
+G1 X10.850 Y9.769 E524.75776
+G1 X10.324 Y10.324 E524.77776
+G1 X9.769 Y10.850 E524.79776
+G1 X9.188 Y11.346 E524.81776
+G1 X8.582 Y11.812 E524.83776
+G1 X7.952 Y12.245 E524.85776
+G1 X7.300 Y12.644 E524.87776
+G1 X6.628 Y13.009 E524.89776
+G1 X5.938 Y13.338 E524.91776
+G1 X5.232 Y13.630 E524.93776
+G1 X4.512 Y13.885 E524.95776
+G1 X3.779 Y14.103 E524.97776
+G1 X3.036 Y14.281 E524.99776
+G1 X2.284 Y14.420 E525.01776
+G1 X1.526 Y14.520 E525.03776
+G1 X0.764 Y14.580 E525.05776
+G1 X0.000 Y14.600 E525.07776
+G1 X-0.764 Y14.580 E525.09776
+G1 X-1.526 Y14.520 E525.11776
+G1 X-2.284 Y14.420 E525.13776
+G1 X-3.036 Y14.281 E525.15776
+G1 X-3.779 Y14.103 E525.17776
+G1 X-4.512 Y13.885 E525.19776
+G1 X-5.232 Y13.630 E525.21776
+G1 X-5.938 Y13.338 E525.23776
+G1 X-6.628 Y13.009 E525.25776
+G1 X-7.300 Y12.644 E525.27776
+G1 X-7.952 Y12.245 E525.29776
+G1 X-8.582 Y11.812 E525.31776
+G1 X-9.188 Y11.346 E525.33776
+G1 X-9.769 Y10.850 E525.35776
+G1 X-10.324 Y10.324 E525.37776
+G1 X-10.850 Y9.769 E525.39776
+G1 X-11.346 Y9.188 E525.41776
+G1 X-11.812 Y8.582 E525.43776
+G1 X-12.245 Y7.952 E525.45776
+G1 X-12.644 Y7.300 E525.47776
+G1 X-13.009 Y6.628 E525.49776
+G1 X-13.338 Y5.938 E525.51776
+G1 X-13.630 Y5.232 E525.53776
+G1 X-13.885 Y4.512 E525.55776
+G1 X-14.103 Y3.779 E525.57776
+G1 X-14.281 Y3.036 E525.59776
+G1 X-14.420 Y2.284 E525.61776
+G1 X-14.520 Y1.526 E525.63776
+G1 X-14.580 Y0.764 E525.65776
+G1 X-14.600 Y0.000 E525.67776
+G1 X-14.580 Y-0.764 E525.69776
+G1 X-14.520 Y-1.526 E525.71776
+G1 X-14.420 Y-2.284 E525.73776
+G1 X-14.281 Y-3.036 E525.75776
+G1 X-14.103 Y-3.779 E525.77776
+G1 X-13.885 Y-4.512 E525.79776
+G1 X-13.630 Y-5.232 E525.81776
+G1 X-13.338 Y-5.938 E525.83776
+G1 X-13.009 Y-6.628 E525.85776
+G1 X-12.644 Y-7.300 E525.87776
+G1 X-12.245 Y-7.952 E525.89776
+G1 X-11.812 Y-8.582 E525.91776
+G1 X-11.346 Y-9.188 E525.93776
+G1 X-10.850 Y-9.769 E525.95776
+G1 X-10.324 Y-10.324 E525.97776
+G1 X-9.769 Y-10.850 E525.99776
+G1 X-9.188 Y-11.346 E526.01776
+G1 X-8.582 Y-11.812 E526.03776
+G1 X-7.952 Y-12.245 E526.05776
+G1 X-7.300 Y-12.644 E526.07776
+G1 X-6.628 Y-13.009 E526.09776
+G1 X-5.938 Y-13.338 E526.11776
+G1 X-5.232 Y-13.630 E526.13776
+G1 X-4.512 Y-13.885 E526.15776
+G1 X-3.779 Y-14.103 E526.17776
+G1 X-3.036 Y-14.281 E526.19776
+G1 X-2.284 Y-14.420 E526.21776
+G1 X-1.526 Y-14.520 E526.23776
+G1 X-0.764 Y-14.580 E526.25776
+G1 X-0.000 Y-14.600 E526.27776
+G1 X0.764 Y-14.580 E526.29776
+G1 X1.526 Y-14.520 E526.31776
+G1 X2.284 Y-14.420 E526.33776
+G1 X3.036 Y-14.281 E526.35776
+G1 X3.779 Y-14.103 E526.37776
+G1 X4.512 Y-13.885 E526.39776
+G1 X5.232 Y-13.630 E526.41776
+G1 X5.938 Y-13.338 E526.43776
+G1 X6.628 Y-13.009 E526.45776
+G1 X7.300 Y-12.644 E526.47776
+G1 X7.952 Y-12.245 E526.49776
+G1 X8.582 Y-11.812 E526.51776
+G1 X9.188 Y-11.346 E526.53776
+G1 X9.769 Y-10.850 E526.55776
+G1 X10.324 Y-10.324 E526.57776
+G1 X10.850 Y-9.769 E526.59776
+G1 X11.346 Y-9.188 E526.61776
+G1 X11.812 Y-8.582 E526.63776
+G1 X12.245 Y-7.952 E526.65776
+G1 X12.644 Y-7.300 E526.67776
+G1 X13.009 Y-6.628 E526.69776
+G1 X13.338 Y-5.938 E526.71776
+G1 X13.630 Y-5.232 E526.73776
+G1 X13.885 Y-4.512 E526.75776
+G1 X14.103 Y-3.779 E526.77776
+G1 X14.281 Y-3.036 E526.79776
+G1 X14.420 Y-2.284 E526.81776
+G1 X14.520 Y-1.526 E526.83776
+G1 X14.580 Y-0.764 E526.85776
+G1 X14.600 Y-0.000 E526.87776
+G1 X5.713 Y-13.000 E526.87776 F7800
+G1 X-5.713 Y-13.000 E527.33481 F3600
+G1 X-7.592 Y-12.000 E527.33481 F7800
+G1 X7.592 Y-12.000 E527.94218 F3600
+G1 X8.980 Y-11.000 E527.94218 F7800
+G1 X-8.980 Y-11.000 E528.66058 F3600
+G1 X-10.082 Y-10.000 E528.66058 F7800
+G1 X10.082 Y-10.000 E529.46711 F3600
+G1 X10.984 Y-9.000 E529.46711 F7800
+G1 X-10.984 Y-9.000 E530.34580 F3600
+G1 X-11.732 Y-8.000 E530.34580 F7800
+G1 X11.732 Y-8.000 E531.28436 F3600
+G1 X12.355 Y-7.000 E531.28436 F7800
+G1 X-12.355 Y-7.000 E532.27274 F3600
+G1 X-12.870 Y-6.000 E532.27274 F7800
+G1 X12.870 Y-6.000 E533.30235 F3600
+G1 X13.291 Y-5.000 E533.30235 F7800
+G1 X-13.291 Y-5.000 E534.36560 F3600
+G1 X-13.625 Y-4.000 E534.36560 F7800
+G1 X13.625 Y-4.000 E535.45560 F3600
+G1 X13.879 Y-3.000 E535.45560 F7800
+G1 X-13.879 Y-3.000 E536.56596 F3600
+G1 X-14.058 Y-2.000 E536.56596 F7800
+G1 X14.058 Y-2.000 E537.69063 F3600
+G1 X14.165 Y-1.000 E537.69063 F7800
+G1 X-14.165 Y-1.000 E538.82381 F3600
+G1 X-14.200 Y0.000 E538.82381 F7800
+G1 X14.200 Y0.000 E539.95981 F3600
+G1 X14.165 Y1.000 E539.95981 F7800
+G1 X-14.165 Y1.000 E541.09299 F3600
+G1 X-14.058 Y2.000 E541.09299 F7800
+G1 X14.058 Y2.000 E542.21767 F3600
+G1 X13.879 Y3.000 E542.21767 F7800
+G1 X-13.879 Y3.000 E543.32803 F3600
+G1 X-13.625 Y4.000 E543.32803 F7800
+G1 X13.625 Y4.000 E544.41802 F3600
+G1 X13.291 Y5.000 E544.41802 F7800
+G1 X-13.291 Y5.000 E545.48127 F3600
+G1 X-12.870 Y6.000 E545.48127 F7800
+G1 X12.870 Y6.000 E546.51088 F3600
+G1 X12.355 Y7.000 E546.51088 F7800
+G1 X-12.355 Y7.000 E547.49926 F3600
+G1 X-11.732 Y8.000 E547.49926 F7800
+G1 X11.732 Y8.000 E548.43782 F3600
+G1 X10.984 Y9.000 E548.43782 F7800
+G1 X-10.984 Y9.000 E549.31651 F3600
+G1 X-10.082 Y10.000 E549.31651 F7800
+G1 X10.082 Y10.000 E550.12305 F3600
+G1 X8.980 Y11.000 E550.12305 F7800
+G1 X-8.980 Y11.000 E550.84144 F3600
+G1 X-7.592 Y12.000 E550.84144 F7800
+G1 X7.592 Y12.000 E551.44881 F3600
+G1 X5.713 Y13.000 E551.44881 F7800
+G1 X-5.713 Y13.000 E551.90586 F3600
+G1 Z3.900 F7800
+G1 E550.90586 F2400
+G1 E551.90586 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E551.92586 F1800
+G1 X14.918 Y1.568 E551.94586
+G1 X14.815 Y2.347 E551.96586
+G1 X14.672 Y3.119 E551.98586
+G1 X14.489 Y3.882 E552.00586
+G1 X14.266 Y4.635 E552.02586
+G1 X14.004 Y5.376 E552.04586
+G1 X13.703 Y6.101 E552.06586
+G1 X13.365 Y6.810 E552.08586
+G1 X12.990 Y7.500 E552.10586
+G1 X12.580 Y8.170 E552.12586
+G1 X12.135 Y8.817 E552.14586
+G1 X11.657 Y9.440 E552.16586
+G1 X11.147 Y10.037 E552.18586
+G1 X10.607 Y10.607 E552.20586
+G1 X10.037 Y11.147 E552.22586
+G1 X9.440 Y11.657 E552.24586
+G1 X8.817 Y12.135 E552.26586
+G1 X8.170 Y12.580 E552.28586
+G1 X7.500 Y12.990 E552.30586
+G1 X6.810 Y13.365 E552.32586
+G1 X6.101 Y13.703 E552.34586
+G1 X5.376 Y14.004 E552.36586
+G1 X4.635 Y14.266 E552.38586
+G1 X3.882 Y14.489 E552.40586
+G1 X3.119 Y14.672 E552.42586
+G1 X2.347 Y14.815 E552.44586
+G1 X1.568 Y14.918 E552.46586
+G1 X0.785 Y14.979 E552.48586
+G1 X0.000 Y15.000 E552.50586
+G1 X-0.785 Y14.979 E552.52586
+G1 X-1.568 Y14.918 E552.54586
+G1 X-2.347 Y14.815 E552.56586
+G1 X-3.119 Y14.672 E552.58586
+G1 X-3.882 Y14.489 E552.60586
+G1 X-4.635 Y14.266 E552.62586
+G1 X-5.376 Y14.004 E552.64586
+G1 X-6.101 Y13.703 E552.66586
+G1 X-6.810 Y13.365 E552.68586
+G1 X-7.500 Y12.990 E552.70586
+G1 X-8.170 Y12.580 E552.72586
+G1 X-8.817 Y12.135 E552.74586
+G1 X-9.440 Y11.657 E552.76586
+G1 X-10.037 Y11.147 E552.78586
+G1 X-10.607 Y10.607 E552.80586
+G1 X-11.147 Y10.037 E552.82586
+G1 X-11.657 Y9.440 E552.84586
+G1 X-12.135 Y8.817 E552.86586
+G1 X-12.580 Y8.170 E552.88586
+G1 X-12.990 Y7.500 E552.90586
+G1 X-13.365 Y6.810 E552.92586
+G1 X-13.703 Y6.101 E552.94586
+G1 X-14.004 Y5.376 E552.96586
+G1 X-14.266 Y4.635 E552.98586
+G1 X-14.489 Y3.882 E553.00586
+G1 X-14.672 Y3.119 E553.02586
+G1 X-14.815 Y2.347 E553.04586
+G1 X-14.918 Y1.568 E553.06586
+G1 X-14.979 Y0.785 E553.08586
+G1 X-15.000 Y0.000 E553.10586
+G1 X-14.979 Y-0.785 E553.12586
+G1 X-14.918 Y-1.568 E553.14586
+G1 X-14.815 Y-2.347 E553.16586
+G1 X-14.672 Y-3.119 E553.18586
+G1 X-14.489 Y-3.882 E553.20586
+G1 X-14.266 Y-4.635 E553.22586
+G1 X-14.004 Y-5.376 E553.24586
+G1 X-13.703 Y-6.101 E553.26586
+G1 X-13.365 Y-6.810 E553.28586
+G1 X-12.990 Y-7.500 E553.30586
+G1 X-12.580 Y-8.170 E553.32586
+G1 X-12.135 Y-8.817 E553.34586
+G1 X-11.657 Y-9.440 E553.36586
+G1 X-11.147 Y-10.037 E553.38586
+G1 X-10.607 Y-10.607 E553.40586
+G1 X-10.037 Y-11.147 E553.42586
+G1 X-9.440 Y-11.657 E553.44586
+G1 X-8.817 Y-12.135 E553.46586
+G1 X-8.170 Y-12.580 E553.48586
+G1 X-7.500 Y-12.990 E553.50586
+G1 X-6.810 Y-13.365 E553.52586
+G1 X-6.101 Y-13.703 E553.54586
+G1 X-5.376 Y-14.004 E553.56586
+G1 X-4.635 Y-14.266 E553.58586
+G1 X-3.882 Y-14.489 E553.60586
+G1 X-3.119 Y-14.672 E553.62586
+G1 X-2.347 Y-14.815 E553.64586
+G1 X-1.568 Y-14.918 E553.66586
+G1 X-0.785 Y-14.979 E553.68586
+G1 X-0.000 Y-15.000 E553.70586
+G1 X0.785 Y-14.979 E553.72586
+G1 X1.568 Y-14.918 E553.74586
+G1 X2.347 Y-14.815 E553.76586
+G1 X3.119 Y-14.672 E553.78586
+G1 X3.882 Y-14.489 E553.80586
+G1 X4.635 Y-14.266 E553.82586
+G1 X5.376 Y-14.004 E553.84586
+G1 X6.101 Y-13.703 E553.86586
+G1 X6.810 Y-13.365 E553.88586
+G1 X7.500 Y-12.990 E553.90586
+G1 X8.170 Y-12.580 E553.92586
+G1 X8.817 Y-12.135 E553.94586
+G1 X9.440 Y-11.657 E553.96586
+G1 X10.037 Y-11.147 E553.98586
+G1 X10.607 Y-10.607 E554.00586
+G1 X11.147 Y-10.037 E554.02586
+G1 X11.657 Y-9.440 E554.04586
+G1 X12.135 Y-8.817 E554.06586
+G1 X12.580 Y-8.170 E554.08586
+G1 X12.990 Y-7.500 E554.10586
+G1 X13.365 Y-6.810 E554.12586
+G1 X13.703 Y-6.101 E554.14586
+G1 X14.004 Y-5.376 E554.16586
+G1 X14.266 Y-4.635 E554.18586
+G1 X14.489 Y-3.882 E554.20586
+G1 X14.672 Y-3.119 E554.22586
+G1 X14.815 Y-2.347 E554.24586
+G1 X14.918 Y-1.568 E554.26586
+G1 X14.979 Y-0.785 E554.28586
+G1 X15.000 Y-0.000 E554.30586
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E554.32586 F1800
+G1 X14.520 Y1.526 E554.34586
+G1 X14.420 Y2.284 E554.36586
+G1 X14.281 Y3.036 E554.38586
+G1 X14.103 Y3.779 E554.40586
+G1 X13.885 Y4.512 E554.42586
+G1 X13.630 Y5.232 E554.44586
+G1 X13.338 Y5.938 E554.46586
+G1 X13.009 Y6.628 E554.48586
+G1 X12.644 Y7.300 E554.50586
+G1 X12.245 Y7.952 E554.52586
+G1 X11.812 Y8.582 E554.54586
+G1 X11.346 Y9.188 E554.56586
+G1 X10.850 Y9.769 E554.58586
+G1 X10.324 Y10.324 E554.60586
+G1 X9.769 Y10.850 E554.62586
+G1 X9.188 Y11.346 E554.64586
+G1 X8.582 Y11.812 E554.66586
+G1 X7.952 Y12.245 E554.68586
+G1 X7.300 Y12.644 E554.70586
+G1 X6.628 Y13.009 E554.72586
+G1 X5.938 Y13.338 E554.74586
+G1 X5.232 Y13.630 E554.76586
+G1 X4.512 Y13.885 E554.78586
+G1 X3.779 Y14.103 E554.80586
+G1 X3.036 Y14.281 E554.82586
+G1 X2.284 Y14.420 E554.84586
+G1 X1.526 Y14.520 E554.86586
+G1 X0.764 Y14.580 E554.88586
+G1 X0.000 Y14.600 E554.90586
+G1 X-0.764 Y14.580 E554.92586
+G1 X-1.526 Y14.520 E554.94586
+G1 X-2.284 Y14.420 E554.96586
+G1 X-3.036 Y14.281 E554.98586
+G1 X-3.779 Y14.103 E555.00586
+G1 X-4.512 Y13.885 E555.02586
+G1 X-5.232 Y13.630 E555.04586
+G1 X-5.938 Y13.338 E555.06586
+G1 X-6.628 Y13.009 E555.08586
+G1 X-7.300 Y12.644 E555.10586
+G1 X-7.952 Y12.245 E555.12586
+G1 X-8.582 Y11.812 E555.14586
+G1 X-9.188 Y11.346 E555.16586
+G1 X-9.769 Y10.850 E555.18586
+G1 X-10.324 Y10.324 E555.20586
+G1 X-10.850 Y9.769 E555.22586
+G1 X-11.346 Y9.188 E555.24586
+G1 X-11.812 Y8.582 E555.26586
+G1 X-12.245 Y7.952 E555.28586
+G1 X-12.644 Y7.300 E555.30586
+G1 X-13.009 Y6.628 E555.32586
+G1 X-13.338 Y5.938 E555.34586
+G1 X-13.630 Y5.232 E555.36586
+G1 X-13.885 Y4.512 E555.38586
+G1 X-14.103 Y3.779 E555.40586
+G1 X-14.281 Y3.036 E555.42586
+G1 X-14.420 Y2.284 E555.44586
+G1 X-14.520 Y1.526 E555.46586
+G1 X-14.580 Y0.764 E555.48586
+G1 X-14.600 Y0.000 E555.50586
+G1 X-14.580 Y-0.764 E555.52586
+G1 X-14.520 Y-1.526 E555.54586
+G1 X-14.420 Y-2.284 E555.56586
+G1 X-14.281 Y-3.036 E555.58586
+G1 X-14.103 Y-3.779 E555.60586
+G1 X-13.885 Y-4.512 E555.62586
+G1 X-13.630 Y-5.232 E555.64586
+G1 X-13.338 Y-5.938 E555.66586
+G1 X-13.009 Y-6.628 E555.68586
+G1 X-12.644 Y-7.300 E555.70586
+G1 X-12.245 Y-7.952 E555.72586
+G1 X-11.812 Y-8.582 E555.74586
+G1 X-11.346 Y-9.188 E555.76586
+G1 X-10.850 Y-9.769 E555.78586
+G1 X-10.324 Y-10.324 E555.80586
+G1 X-9.769 Y-10.850 E555.82586
+G1 X-9.188 Y-11.346 E555.84586
+G1 X-8.582 Y-11.812 E555.86586
+G1 X-7.952 Y-12.245 E555.88586
+G1 X-7.300 Y-12.644 E555.90586
+G1 X-6.628 Y-13.009 E555.92586
+G1 X-5.938 Y-13.338 E555.94586
+G1 X-5.232 Y-13.630 E555.96586
+G1 X-4.512 Y-13.885 E555.98586
+G1 X-3.779 Y-14.103 E556.00586
+G1 X-3.036 Y-14.281 E556.02586
+G1 X-2.284 Y-14.420 E556.04586
+G1 X-1.526 Y-14.520 E556.06586
+G1 X-0.764 Y-14.580 E556.08586
+G1 X-0.000 Y-14.600 E556.10586
+G1 X0.764 Y-14.580 E556.12586
+G1 X1.526 Y-14.520 E556.14586
+G1 X2.284 Y-14.420 E556.16586
+G1 X3.036 Y-14.281 E556.18586
+G1 X3.779 Y-14.103 E556.20586
+G1 X4.512 Y-13.885 E556.22586
+G1 X5.232 Y-13.630 E556.24586
+G1 X5.938 Y-13.338 E556.26586
+G1 X6.628 Y-13.009 E556.28586
+G1 X7.300 Y-12.644 E556.30586
+G1 X7.952 Y-12.245 E556.32586
+G1 X8.582 Y-11.812 E556.34586
+G1 X9.188 Y-11.346 E556.36586
+G1 X9.769 Y-10.850 E556.38586
+G1 X10.324 Y-10.324 E556.40586
+G1 X10.850 Y-9.769 E556.42586
+G1 X11.346 Y-9.188 E556.44586
+G1 X11.812 Y-8.582 E556.46586
+G1 X12.245 Y-7.952 E556.48586
+G1 X12.644 Y-7.300 E556.50586
+G1 X13.009 Y-6.628 E556.52586
+G1 X13.338 Y-5.938 E556.54586
+G1 X13.630 Y-5.232 E556.56586
+G1 X13.885 Y-4.512 E556.58586
+G1 X14.103 Y-3.779 E556.60586
+G1 X14.281 Y-3.036 E556.62586
+G1 X14.420 Y-2.284 E556.64586
+G1 X14.520 Y-1.526 E556.66586
+G1 X14.580 Y-0.764 E556.68586
+G1 X14.600 Y-0.000 E556.70586
+G1 X5.713 Y-13.000 E556.70586 F7800
+G1 X-5.713 Y-13.000 E557.16292 F3600
+G1 X-7.592 Y-12.000 E557.16292 F7800
+G1 X7.592 Y-12.000 E557.77028 F3600
+G1 X8.980 Y-11.000 E557.77028 F7800
+G1 X-8.980 Y-11.000 E558.48868 F3600
+G1 X-10.082 Y-10.000 E558.48868 F7800
+G1 X10.082 Y-10.000 E559.29522 F3600
+G1 X10.984 Y-9.000 E559.29522 F7800
+G1 X-10.984 Y-9.000 E560.17391 F3600
+G1 X-11.732 Y-8.000 E560.17391 F7800
+G1 X11.732 Y-8.000 E561.11247 F3600
+G1 X12.355 Y-7.000 E561.11247 F7800
+G1 X-12.355 Y-7.000 E562.10085 F3600
+G1 X-12.870 Y-6.000 E562.10085 F7800
+G1 X12.870 Y-6.000 E563.13046 F3600
+G1 X13.291 Y-5.000 E563.13046 F7800
+G1 X-13.291 Y-5.000 E564.19370 F3600
+G1 X-13.625 Y-4.000 E564.19370 F7800
+G1 X13.625 Y-4.000 E565.28370 F3600
+G1 X13.879 Y-3.000 E565.28370 F7800
+G1 X-13.879 Y-3.000 E566.39406 F3600
+G1 X-14.058 Y-2.000 E566.39406 F7800
+G1 X14.058 Y-2.000 E567.51874 F3600
+G1 X14.165 Y-1.000 E567.51874 F7800
+G1 X-14.165 Y-1.000 E568.65192 F3600
+G1 X-14.200 Y0.000 E568.65192 F7800
+G1 X14.200 Y0.000 E569.78792 F3600
+G1 X14.165 Y1.000 E569.78792 F7800
+G1 X-14.165 Y1.000 E570.92110 F3600
+G1 X-14.058 Y2.000 E570.92110 F7800
+G1 X14.058 Y2.000 E572.04577 F3600
+G1 X13.879 Y3.000 E572.04577 F7800
+G1 X-13.879 Y3.000 E573.15613 F3600
+G1 X-13.625 Y4.000 E573.15613 F7800
+G1 X13.625 Y4.000 E574.24613 F3600
+G1 X13.291 Y5.000 E574.24613 F7800
+G1 X-13.291 Y5.000 E575.30938 F3600
+G1 X-12.870 Y6.000 E575.30938 F7800
+G1 X12.870 Y6.000 E576.33899 F3600
+G1 X12.355 Y7.000 E576.33899 F7800
+G1 X-12.355 Y7.000 E577.32737 F3600
+G1 X-11.732 Y8.000 E577.32737 F7800
+G1 X11.732 Y8.000 E578.26593 F3600
+G1 X10.984 Y9.000 E578.26593 F7800
+G1 X-10.984 Y9.000 E579.14462 F3600
+G1 X-10.082 Y10.000 E579.14462 F7800
+G1 X10.082 Y10.000 E579.95115 F3600
+G1 X8.980 Y11.000 E579.95115 F7800
+G1 X-8.980 Y11.000 E580.66955 F3600
+G1 X-7.592 Y12.000 E580.66955 F7800
+G1 X7.592 Y12.000 E581.27692 F3600
+G1 X5.713 Y13.000 E581.27692 F7800
+G1 X-5.713 Y13.000 E581.73397 F3600
+G1 Z4.100 F7800
+G1 E580.73397 F2400
+G1 E581.73397 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E581.75397 F1800
+G1 X14.918 Y1.568 E581.77397
+G1 X14.815 Y2.347 E581.79397
+G1 X14.672 Y3.119 E581.81397
+G1 X14.489 Y3.882 E581.83397
+G1 X14.266 Y4.635 E581.85397
+G1 X14.004 Y5.376 E581.87397
+G1 X13.703 Y6.101 E581.89397
+G1 X13.365 Y6.810 E581.91397
+G1 X12.990 Y7.500 E581.93397
+G1 X12.580 Y8.170 E581.95397
+G1 X12.135 Y8.817 E581.97397
+G1 X11.657 Y9.440 E581.99397
+G1 X11.147 Y10.037 E582.01397
+G1 X10.607 Y10.607 E582.03397
+G1 X10.037 Y11.147 E582.05397
+G1 X9.440 Y11.657 E582.07397
+G1 X8.817 Y12.135 E582.09397
+G1 X8.170 Y12.580 E582.11397
+G1 X7.500 Y12.990 E582.13397
+G1 X6.810 Y13.365 E582.15397
+G1 X6.101 Y13.703 E582.17397
+G1 X5.376 Y14.004 E582.19397
+G1 X4.635 Y14.266 E582.21397
+G1 X3.882 Y14.489 E582.23397
+G1 X3.119 Y14.672 E582.25397
+G1 X2.347 Y14.815 E582.27397
+G1 X1.568 Y14.918 E582.29397
+G1 X0.785 Y14.979 E582.31397
+G1 X0.000 Y15.000 E582.33397
+G1 X-0.785 Y14.979 E582.35397
+G1 X-1.568 Y14.918 E582.37397
+G1 X-2.347 Y14.815 E582.39397
+G1 X-3.119 Y14.672 E582.41397
+G1 X-3.882 Y14.489 E582.43397
+G1 X-4.635 Y14.266 E582.45397
+G1 X-5.376 Y14.004 E582.47397
+G1 X-6.101 Y13.703 E582.49397
+G1 X-6.810 Y13.365 E582.51397
+G1 X-7.500 Y12.990 E582.53397
+G1 X-8.170 Y12.580 E582.55397
+G1 X-8.817 Y12.135 E582.57397
+G1 X-9.440 Y11.657 E582.59397
+G1 X-10.037 Y11.147 E582.61397
+G1 X-10.607 Y10.607 E582.63397
+G1 X-11.147 Y10.037 E582.65397
+G1 X-11.657 Y9.440 E582.67397
+G1 X-12.135 Y8.817 E582.69397
+G1 X-12.580 Y8.170 E582.71397
+G1 X-12.990 Y7.500 E582.73397
+G1 X-13.365 Y6.810 E582.75397
+G1 X-13.703 Y6.101 E582.77397
+G1 X-14.004 Y5.376 E582.79397
+G1 X-14.266 Y4.635 E582.81397
+G1 X-14.489 Y3.882 E582.83397
+G1 X-14.672 Y3.119 E582.85397
+G1 X-14.815 Y2.347 E582.87397
+G1 X-14.918 Y1.568 E582.89397
+G1 X-14.979 Y0.785 E582.91397
+G1 X-15.000 Y0.000 E582.93397
+G1 X-14.979 Y-0.785 E582.95397
+G1 X-14.918 Y-1.568 E582.97397
+G1 X-14.815 Y-2.347 E582.99397
+G1 X-14.672 Y-3.119 E583.01397
+G1 X-14.489 Y-3.882 E583.03397
+G1 X-14.266 Y-4.635 E583.05397
+G1 X-14.004 Y-5.376 E583.07397
+G1 X-13.703 Y-6.101 E583.09397
+G1 X-13.365 Y-6.810 E583.11397
+G1 X-12.990 Y-7.500 E583.13397
+G1 X-12.580 Y-8.170 E583.15397
+G1 X-12.135 Y-8.817 E583.17397
+G1 X-11.657 Y-9.440 E583.19397
+G1 X-11.147 Y-10.037 E583.21397
+G1 X-10.607 Y-10.607 E583.23397
+G1 X-10.037 Y-11.147 E583.25397
+G1 X-9.440 Y-11.657 E583.27397
+G1 X-8.817 Y-12.135 E583.29397
+G1 X-8.170 Y-12.580 E583.31397
+G1 X-7.500 Y-12.990 E583.33397
+G1 X-6.810 Y-13.365 E583.35397
+G1 X-6.101 Y-13.703 E583.37397
+G1 X-5.376 Y-14.004 E583.39397
+G1 X-4.635 Y-14.266 E583.41397
+G1 X-3.882 Y-14.489 E583.43397
+G1 X-3.119 Y-14.672 E583.45397
+G1 X-2.347 Y-14.815 E583.47397
+G1 X-1.568 Y-14.918 E583.49397
+G1 X-0.785 Y-14.979 E583.51397
+G1 X-0.000 Y-15.000 E583.53397
+G1 X0.785 Y-14.979 E583.55397
+G1 X1.568 Y-14.918 E583.57397
+G1 X2.347 Y-14.815 E583.59397
+G1 X3.119 Y-14.672 E583.61397
+G1 X3.882 Y-14.489 E583.63397
+G1 X4.635 Y-14.266 E583.65397
+G1 X5.376 Y-14.004 E583.67397
+G1 X6.101 Y-13.703 E583.69397
+G1 X6.810 Y-13.365 E583.71397
+G1 X7.500 Y-12.990 E583.73397
+G1 X8.170 Y-12.580 E583.75397
+G1 X8.817 Y-12.135 E583.77397
+G1 X9.440 Y-11.657 E583.79397
+G1 X10.037 Y-11.147 E583.81397
+G1 X10.607 Y-10.607 E583.83397
+G1 X11.147 Y-10.037 E583.85397
+G1 X11.657 Y-9.440 E583.87397
+G1 X12.135 Y-8.817 E583.89397
+G1 X12.580 Y-8.170 E583.91397
+G1 X12.990 Y-7.500 E583.93397
+G1 X13.365 Y-6.810 E583.95397
+G1 X13.703 Y-6.101 E583.97397
+G1 X14.004 Y-5.376 E583.99397
+G1 X14.266 Y-4.635 E584.01397
+G1 X14.489 Y-3.882 E584.03397
+G1 X14.672 Y-3.119 E584.05397
+G1 X14.815 Y-2.347 E584.07397
+G1 X14.918 Y-1.568 E584.09397
+G1 X14.979 Y-0.785 E584.11397
+G1 X15.000 Y-0.000 E584.13397
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E584.15397 F1800
+G1 X14.520 Y1.526 E584.17397
+G1 X14.420 Y2.284 E584.19397
+G1 X14.281 Y3.036 E584.21397
+G1 X14.103 Y3.779 E584.23397
+G1 X13.885 Y4.512 E584.25397
+G1 X13.630 Y5.232 E584.27397
+G1 X13.338 Y5.938 E584.29397
+G1 X13.009 Y6.628 E584.31397
+G1 X12.644 Y7.300 E584.33397
+G1 X12.245 Y7.952 E584.35397
+G1 X11.812 Y8.582 E584.37397
+G1 X11.346 Y9.188 E584.39397
+G1 X10.850 Y9.769 E584.41397
+G1 X10.324 Y10.324 E584.43397
+G1 X9.769 Y10.850 E584.45397
+G1 X9.188 Y11.346 E584.47397
+G1 X8.582 Y11.812 E584.49397
+G1 X7.952 Y12.245 E584.51397
+G1 X7.300 Y12.644 E584.53397
+G1 X6.628 Y13.009 E584.55397
+G1 X5.938 Y13.338 E584.57397
+G1 X5.232 Y13.630 E584.59397
+G1 X4.512 Y13.885 E584.61397
+G1 X3.779 Y14.103 E584.63397
+G1 X3.036 Y14.281 E584.65397
+G1 X2.284 Y14.420 E584.67397
+G1 X1.526 Y14.520 E584.69397
+G1 X0.764 Y14.580 E584.71397
+G1 X0.000 Y14.600 E584.73397
+G1 X-0.764 Y14.580 E584.75397
+G1 X-1.526 Y14.520 E584.77397
+G1 X-2.284 Y14.420 E584.79397
+G1 X-3.036 Y14.281 E584.81397
+G1 X-3.779 Y14.103 E584.83397
+G1 X-4.512 Y13.885 E584.85397
+G1 X-5.232 Y13.630 E584.87397
+G1 X-5.938 Y13.338 E584.89397
+G1 X-6.628 Y13.009 E584.91397
+G1 X-7.300 Y12.644 E584.93397
+G1 X-7.952 Y12.245 E584.95397
+G1 X-8.582 Y11.812 E584.97397
+G1 X-9.188 Y11.346 E584.99397
+G1 X-9.769 Y10.850 E585.01397
+G1 X-10.324 Y10.324 E585.03397
+G1 X-10.850 Y9.769 E585.05397
+G1 X-11.346 Y9.188 E585.07397
+G1 X-11.812 Y8.582 E585.09397
+G1 X-12.245 Y7.952 E585.11397
+G1 X-12.644 Y7.300 E585.13397
+G1 X-13.009 Y6.628 E585.15397
+G1 X-13.338 Y5.938 E585.17397
+G1 X-13.630 Y5.232 E585.19397
+G1 X-13.885 Y4.512 E585.21397
+G1 X-14.103 Y3.779 E585.23397
+G1 X-14.281 Y3.036 E585.25397
+G1 X-14.420 Y2.284 E585.27397
+G1 X-14.520 Y1.526 E585.29397
+G1 X-14.580 Y0.764 E585.31397
+G1 X-14.600 Y0.000 E585.33397
+G1 X-14.580 Y-0.764 E585.35397
+G1 X-14.520 Y-1.526 E585.37397
+G1 X-14.420 Y-2.284 E585.39397
+G1 X-14.281 Y-3.036 E585.41397
+G1 X-14.103 Y-3.779 E585.43397
+G1 X-13.885 Y-4.512 E585.45397
+G1 X-13.630 Y-5.232 E585.47397
+G1 X-13.338 Y-5.938 E585.49397
+G1 X-13.009 Y-6.628 E585.51397
+G1 X-12.644 Y-7.300 E585.53397
+G1 X-12.245 Y-7.952 E585.55397
+G1 X-11.812 Y-8.582 E585.57397
+G1 X-11.346 Y-9.188 E585.59397
+G1 X-10.850 Y-9.769 E585.61397
+G1 X-10.324 Y-10.324 E585.63397
+G1 X-9.769 Y-10.850 E585.65397
+G1 X-9.188 Y-11.346 E585.67397
+G1 X-8.582 Y-11.812 E585.69397
+G1 X-7.952 Y-12.245 E585.71397
+G1 X-7.300 Y-12.644 E585.73397
+G1 X-6.628 Y-13.009 E585.75397
+G1 X-5.938 Y-13.338 E585.77397
+G1 X-5.232 Y-13.630 E585.79397
+G1 X-4.512 Y-13.885 E585.81397
+G1 X-3.779 Y-14.103 E585.83397
+G1 X-3.036 Y-14.281 E585.85397
+G1 X-2.284 Y-14.420 E585.87397
+G1 X-1.526 Y-14.520 E585.89397
+G1 X-0.764 Y-14.580 E585.91397
+G1 X-0.000 Y-14.600 E585.93397
+G1 X0.764 Y-14.580 E585.95397
+G1 X1.526 Y-14.520 E585.97397
+G1 X2.284 Y-14.420 E585.99397
+G1 X3.036 Y-14.281 E586.01397
+G1 X3.779 Y-14.103 E586.03397
+G1 X4.512 Y-13.885 E586.05397
+G1 X5.232 Y-13.630 E586.07397
+G1 X5.938 Y-13.338 E586.09397
+G1 X6.628 Y-13.009 E586.11397
+G1 X7.300 Y-12.644 E586.13397
+G1 X7.952 Y-12.245 E586.15397
+G1 X8.582 Y-11.812 E586.17397
+G1 X9.188 Y-11.346 E586.19397
+G1 X9.769 Y-10.850 E586.21397
+G1 X10.324 Y-10.324 E586.23397
+G1 X10.850 Y-9.769 E586.25397
+G1 X11.346 Y-9.188 E586.27397
+G1 X11.812 Y-8.582 E586.29397
+G1 X12.245 Y-7.952 E586.31397
+G1 X12.644 Y-7.300 E586.33397
+G1 X13.009 Y-6.628 E586.35397
+G1 X13.338 Y-5.938 E586.37397
+G1 X13.630 Y-5.232 E586.39397
+G1 X13.885 Y-4.512 E586.41397
+G1 X14.103 Y-3.779 E586.43397
+G1 X14.281 Y-3.036 E586.45397
+G1 X14.420 Y-2.284 E586.47397
+G1 X14.520 Y-1.526 E586.49397
+G1 X14.580 Y-0.764 E586.51397
+G1 X14.600 Y-0.000 E586.53397
+G1 X5.713 Y-13.000 E586.53397 F7800
+G1 X-5.713 Y-13.000 E586.99102 F3600
+G1 X-7.592 Y-12.000 E586.99102 F7800
+G1 X7.592 Y-12.000 E587.59839 F3600
+G1 X8.980 Y-11.000 E587.59839 F7800
+G1 X-8.980 Y-11.000 E588.31679 F3600
+G1 X-10.082 Y-10.000 E588.31679 F7800
+G1 X10.082 Y-10.000 E589.12332 F3600
+G1 X10.984 Y-9.000 E589.12332 F7800
+G1 X-10.984 Y-9.000 E590.00201 F3600
+G1 X-11.732 Y-8.000 E590.00201 F7800
+G1 X11.732 Y-8.000 E590.94057 F3600
+G1 X12.355 Y-7.000 E590.94057 F7800
+G1 X-12.355 Y-7.000 E591.92895 F3600
+G1 X-12.870 Y-6.000 E591.92895 F7800
+G1 X12.870 Y-6.000 E592.95856 F3600
+G1 X13.291 Y-5.000 E592.95856 F7800
+G1 X-13.291 Y-5.000 E594.02181 F3600
+G1 X-13.625 Y-4.000 E594.02181 F7800
+G1 X13.625 Y-4.000 E595.11181 F3600
+G1 X13.879 Y-3.000 E595.11181 F7800
+G1 X-13.879 Y-3.000 E596.22216 F3600
+G1 X-14.058 Y-2.000 E596.22216 F7800
+G1 X14.058 Y-2.000 E597.34684 F3600
+G1 X14.165 Y-1.000 E597.34684 F7800
+G1 X-14.165 Y-1.000 E598.48002 F3600
+G1 X-14.200 Y0.000 E598.48002 F7800
+G1 X14.200 Y0.000 E599.61602 F3600
+G1 X14.165 Y1.000 E599.61602 F7800
+G1 X-14.165 Y1.000 E600.74920 F3600
+G1 X-14.058 Y2.000 E600.74920 F7800
+G1 X14.058 Y2.000 E601.87388 F3600
+G1 X13.879 Y3.000 E601.87388 F7800
+G1 X-13.879 Y3.000 E602.98423 F3600
+G1 X-13.625 Y4.000 E602.98423 F7800
+G1 X13.625 Y4.000 E604.07423 F3600
+G1 X13.291 Y5.000 E604.07423 F7800
+G1 X-13.291 Y5.000 E605.13748 F3600
+G1 X-12.870 Y6.000 E605.13748 F7800
+G1 X12.870 Y6.000 E606.16709 F3600
+G1 X12.355 Y7.000 E606.16709 F7800
+G1 X-12.355 Y7.000 E607.15547 F3600
+G1 X-11.732 Y8.000 E607.15547 F7800
+G1 X11.732 Y8.000 E608.09403 F3600
+G1 X10.984 Y9.000 E608.09403 F7800
+G1 X-10.984 Y9.000 E608.97272 F3600
+G1 X-10.082 Y10.000 E608.97272 F7800
+G1 X10.082 Y10.000 E609.77925 F3600
+G1 X8.980 Y11.000 E609.77925 F7800
+G1 X-8.980 Y11.000 E610.49765 F3600
+G1 X-7.592 Y12.000 E610.49765 F7800
+G1 X7.592 Y12.000 E611.10502 F3600
+G1 X5.713 Y13.000 E611.10502 F7800
+G1 X-5.713 Y13.000 E611.56207 F3600
+G1 Z4.300 F7800
+G1 E610.56207 F2400
+G1 E611.56207 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E611.58207 F1800
+G1 X14.918 Y1.568 E611.60207
+G1 X14.815 Y2.347 E611.62207
+G1 X14.672 Y3.119 E611.64207
+G1 X14.489 Y3.882 E611.66207
+G1 X14.266 Y4.635 E611.68207
+G1 X14.004 Y5.376 E611.70207
+G1 X13.703 Y6.101 E611.72207
+G1 X13.365 Y6.810 E611.74207
+G1 X12.990 Y7.500 E611.76207
+G1 X12.580 Y8.170 E611.78207
+G1 X12.135 Y8.817 E611.80207
+G1 X11.657 Y9.440 E611.82207
+G1 X11.147 Y10.037 E611.84207
+G1 X10.607 Y10.607 E611.86207
+G1 X10.037 Y11.147 E611.88207
+G1 X9.440 Y11.657 E611.90207
+G1 X8.817 Y12.135 E611.92207
+G1 X8.170 Y12.580 E611.94207
+G1 X7.500 Y12.990 E611.96207
+G1 X6.810 Y13.365 E611.98207
+G1 X6.101 Y13.703 E612.00207
+G1 X5.376 Y14.004 E612.02207
+G1 X4.635 Y14.266 E612.04207
+G1 X3.882 Y14.489 E612.06207
+G1 X3.119 Y14.672 E612.08207
+G1 X2.347 Y14.815 E612.10207
+G1 X1.568 Y14.918 E612.12207
+G1 X0.785 Y14.979 E612.14207
+G1 X0.000 Y15.000 E612.16207
+G1 X-0.785 Y14.979 E612.18207
+G1 X-1.568 Y14.918 E612.20207
+G1 X-2.347 Y14.815 E612.22207
+G1 X-3.119 Y14.672 E612.24207
+G1 X-3.882 Y14.489 E612.26207
+G1 X-4.635 Y14.266 E612.28207
+G1 X-5.376 Y14.004 E612.30207
+G1 X-6.101 Y13.703 E612.32207
+G1 X-6.810 Y13.365 E612.34207
+G1 X-7.500 Y12.990 E612.36207
+G1 X-8.170 Y12.580 E612.38207
+G1 X-8.817 Y12.135 E612.40207
+G1 X-9.440 Y11.657 E612.42207
+G1 X-10.037 Y11.147 E612.44207
+G1 X-10.607 Y10.607 E612.46207
+G1 X-11.147 Y10.037 E612.48207
+G1 X-11.657 Y9.440 E612.50207
+G1 X-12.135 Y8.817 E612.52207
+G1 X-12.580 Y8.170 E612.54207
+G1 X-12.990 Y7.500 E612.56207
+G1 X-13.365 Y6.810 E612.58207
+G1 X-13.703 Y6.101 E612.60207
+G1 X-14.004 Y5.376 E612.62207
+G1 X-14.266 Y4.635 E612.64207
+G1 X-14.489 Y3.882 E612.66207
+G1 X-14.672 Y3.119 E612.68207
+G1 X-14.815 Y2.347 E612.70207
+G1 X-14.918 Y1.568 E612.72207
+G1 X-14.979 Y0.785 E612.74207
+G1 X-15.000 Y0.000 E612.76207
+G1 X-14.979 Y-0.785 E612.78207
+G1 X-14.918 Y-1.568 E612.80207
+G1 X-14.815 Y-2.347 E612.82207
+G1 X-14.672 Y-3.119 E612.84207
+G1 X-14.489 Y-3.882 E612.86207
+G1 X-14.266 Y-4.635 E612.88207
+G1 X-14.004 Y-5.376 E612.90207
+G1 X-13.703 Y-6.101 E612.92207
+G1 X-13.365 Y-6.810 E612.94207
+G1 X-12.990 Y-7.500 E612.96207
+G1 X-12.580 Y-8.170 E612.98207
+G1 X-12.135 Y-8.817 E613.00207
+G1 X-11.657 Y-9.440 E613.02207
+G1 X-11.147 Y-10.037 E613.04207
+G1 X-10.607 Y-10.607 E613.06207
+G1 X-10.037 Y-11.147 E613.08207
+G1 X-9.440 Y-11.657 E613.10207
+G1 X-8.817 Y-12.135 E613.12207
+G1 X-8.170 Y-12.580 E613.14207
+G1 X-7.500 Y-12.990 E613.16207
+G1 X-6.810 Y-13.365 E613.18207
+G1 X-6.101 Y-13.703 E613.20207
+G1 X-5.376 Y-14.004 E613.22207
+G1 X-4.635 Y-14.266 E613.24207
+G1 X-3.882 Y-14.489 E613.26207
+G1 X-3.119 Y-14.672 E613.28207
+G1 X-2.347 Y-14.815 E613.30207
+G1 X-1.568 Y-14.918 E613.32207
+G1 X-0.785 Y-14.979 E613.34207
+G1 X-0.000 Y-15.000 E613.36207
+G1 X0.785 Y-14.979 E613.38207
+G1 X1.568 Y-14.918 E613.40207
+G1 X2.347 Y-14.815 E613.42207
+G1 X3.119 Y-14.672 E613.44207
+G1 X3.882 Y-14.489 E613.46207
+G1 X4.635 Y-14.266 E613.48207
+G1 X5.376 Y-14.004 E613.50207
+G1 X6.101 Y-13.703 E613.52207
+G1 X6.810 Y-13.365 E613.54207
+G1 X7.500 Y-12.990 E613.56207
+G1 X8.170 Y-12.580 E613.58207
+G1 X8.817 Y-12.135 E613.60207
+G1 X9.440 Y-11.657 E613.62207
+G1 X10.037 Y-11.147 E613.64207
+G1 X10.607 Y-10.607 E613.66207
+G1 X11.147 Y-10.037 E613.68207
+G1 X11.657 Y-9.440 E613.70207
+G1 X12.135 Y-8.817 E613.72207
+G1 X12.580 Y-8.170 E613.74207
+G1 X12.990 Y-7.500 E613.76207
+G1 X13.365 Y-6.810 E613.78207
+G1 X13.703 Y-6.101 E613.80207
+G1 X14.004 Y-5.376 E613.82207
+G1 X14.266 Y-4.635 E613.84207
+G1 X14.489 Y-3.882 E613.86207
+G1 X14.672 Y-3.119 E613.88207
+G1 X14.815 Y-2.347 E613.90207
+G1 X14.918 Y-1.568 E613.92207
+G1 X14.979 Y-0.785 E613.94207
+G1 X15.000 Y-0.000 E613.96207
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E613.98207 F1800
+G1 X14.520 Y1.526 E614.00207
+G1 X14.420 Y2.284 E614.02207
+G1 X14.281 Y3.036 E614.04207
+G1 X14.103 Y3.779 E614.06207
+G1 X13.885 Y4.512 E614.08207
+G1 X13.630 Y5.232 E614.10207
+G1 X13.338 Y5.938 E614.12207
+G1 X13.009 Y6.628 E614.14207
+G1 X12.644 Y7.300 E614.16207
+G1 X12.245 Y7.952 E614.18207
+G1 X11.812 Y8.582 E614.20207
+G1 X11.346 Y9.188 E614.22207
+G1 X10.850 Y9.769 E614.24207
+G1 X10.324 Y10.324 E614.26207
+G1 X9.769 Y10.850 E614.28207
+G1 X9.188 Y11.346 E614.30207
+G1 X8.582 Y11.812 E614.32207
+G1 X7.952 Y12.245 E614.34207
+G1 X7.300 Y12.644 E614.36207
+G1 X6.628 Y13.009 E614.38207
+G1 X5.938 Y13.338 E614.40207
+G1 X5.232 Y13.630 E614.42207
+G1 X4.512 Y13.885 E614.44207
+G1 X3.779 Y14.103 E614.46207
+G1 X3.036 Y14.281 E614.48207
+G1 X2.284 Y14.420 E614.50207
+G1 X1.526 Y14.520 E614.52207
+G1 X0.764 Y14.580 E614.54207
+G1 X0.000 Y14.600 E614.56207
+G1 X-0.764 Y14.580 E614.58207
+G1 X-1.526 Y14.520 E614.60207
+G1 X-2.284 Y14.420 E614.62207
+G1 X-3.036 Y14.281 E614.64207
+G1 X-3.779 Y14.103 E614.66207
+G1 X-4.512 Y13.885 E614.68207
+G1 X-5.232 Y13.630 E614.70207
+G1 X-5.938 Y13.338 E614.72207
+G1 X-6.628 Y13.009 E614.74207
+G1 X-7.300 Y12.644 E614.76207
+G1 X-7.952 Y12.245 E614.78207
+G1 X-8.582 Y11.812 E614.80207
+G1 X-9.188 Y11.346 E614.82207
+G1 X-9.769 Y10.850 E614.84207
+G1 X-10.324 Y10.324 E614.86207
+G1 X-10.850 Y9.769 E614.88207
+G1 X-11.346 Y9.188 E614.90207
+G1 X-11.812 Y8.582 E614.92207
+G1 X-12.245 Y7.952 E614.94207
+G1 X-12.644 Y7.300 E614.96207
+G1 X-13.009 Y6.628 E614.98207
+G1 X-13.338 Y5.938 E615.00207
+G1 X-13.630 Y5.232 E615.02207
+G1 X-13.885 Y4.512 E615.04207
+G1 X-14.103 Y3.779 E615.06207
+G1 X-14.281 Y3.036 E615.08207
+G1 X-14.420 Y2.284 E615.10207
+G1 X-14.520 Y1.526 E615.12207
+G1 X-14.580 Y0.764 E615.14207
+G1 X-14.600 Y0.000 E615.16207
+G1 X-14.580 Y-0.764 E615.18207
+G1 X-14.520 Y-1.526 E615.20207
+G1 X-14.420 Y-2.284 E615.22207
+G1 X-14.281 Y-3.036 E615.24207
+G1 X-14.103 Y-3.779 E615.26207
+G1 X-13.885 Y-4.512 E615.28207
+G1 X-13.630 Y-5.232 E615.30207
+G1 X-13.338 Y-5.938 E615.32207
+G1 X-13.009 Y-6.628 E615.34207
+G1 X-12.644 Y-7.300 E615.36207
+G1 X-12.245 Y-7.952 E615.38207
+G1 X-11.812 Y-8.582 E615.40207
+G1 X-11.346 Y-9.188 E615.42207
+G1 X-10.850 Y-9.769 E615.44207
+G1 X-10.324 Y-10.324 E615.46207
+G1 X-9.769 Y-10.850 E615.48207
+G1 X-9.188 Y-11.346 E615.50207
+G1 X-8.582 Y-11.812 E615.52207
+G1 X-7.952 Y-12.245 E615.54207
+G1 X-7.300 Y-12.644 E615.56207
+G1 X-6.628 Y-13.009 E615.58207
+G1 X-5.938 Y-13.338 E615.60207
+G1 X-5.232 Y-13.630 E615.62207
+G1 X-4.512 Y-13.885 E615.64207
+G1 X-3.779 Y-14.103 E615.66207
+G1 X-3.036 Y-14.281 E615.68207
+G1 X-2.284 Y-14.420 E615.70207
+G1 X-1.526 Y-14.520 E615.72207
+G1 X-0.764 Y-14.580 E615.74207
+G1 X-0.000 Y-14.600 E615.76207
+G1 X0.764 Y-14.580 E615.78207
+G1 X1.526 Y-14.520 E615.80207
+G1 X2.284 Y-14.420 E615.82207
+G1 X3.036 Y-14.281 E615.84207
+G1 X3.779 Y-14.103 E615.86207
+G1 X4.512 Y-13.885 E615.88207
+G1 X5.232 Y-13.630 E615.90207
+G1 X5.938 Y-13.338 E615.92207
+G1 X6.628 Y-13.009 E615.94207
+G1 X7.300 Y-12.644 E615.96207
+G1 X7.952 Y-12.245 E615.98207
+G1 X8.582 Y-11.812 E616.00207
+G1 X9.188 Y-11.346 E616.02207
+G1 X9.769 Y-10.850 E616.04207
+G1 X10.324 Y-10.324 E616.06207
+G1 X10.850 Y-9.769 E616.08207
+G1 X11.346 Y-9.188 E616.10207
+G1 X11.812 Y-8.582 E616.12207
+G1 X12.245 Y-7.952 E616.14207
+G1 X12.644 Y-7.300 E616.16207
+G1 X13.009 Y-6.628 E616.18207
+G1 X13.338 Y-5.938 E616.20207
+G1 X13.630 Y-5.232 E616.22207
+G1 X13.885 Y-4.512 E616.24207
+G1 X14.103 Y-3.779 E616.26207
+G1 X14.281 Y-3.036 E616.28207
+G1 X14.420 Y-2.284 E616.30207
+G1 X14.520 Y-1.526 E616.32207
+G1 X14.580 Y-0.764 E616.34207
+G1 X14.600 Y-0.000 E616.36207
+G1 X5.713 Y-13.000 E616.36207 F7800
+G1 X-5.713 Y-13.000 E616.81912 F3600
+G1 X-7.592 Y-12.000 E616.81912 F7800
+G1 X7.592 Y-12.000 E617.42649 F3600
+G1 X8.980 Y-11.000 E617.42649 F7800
+G1 X-8.980 Y-11.000 E618.14489 F3600
+G1 X-10.082 Y-10.000 E618.14489 F7800
+G1 X10.082 Y-10.000 E618.95142 F3600
+G1 X10.984 Y-9.000 E618.95142 F7800
+G1 X-10.984 Y-9.000 E619.83011 F3600
+G1 X-11.732 Y-8.000 E619.83011 F7800
+G1 X11.732 Y-8.000 E620.76867 F3600
+G1 X12.355 Y-7.000 E620.76867 F7800
+G1 X-12.355 Y-7.000 E621.75705 F3600
+G1 X-12.870 Y-6.000 E621.75705 F7800
+G1 X12.870 Y-6.000 E622.78666 F3600
+G1 X13.291 Y-5.000 E622.78666 F7800
+G1 X-13.291 Y-5.000 E623.84991 F3600
+G1 X-13.625 Y-4.000 E623.84991 F7800
+G1 X13.625 Y-4.000 E624.93991 F3600
+G1 X13.879 Y-3.000 E624.93991 F7800
+G1 X-13.879 Y-3.000 E626.05027 F3600
+G1 X-14.058 Y-2.000 E626.05027 F7800
+G1 X14.058 Y-2.000 E627.17494 F3600
+G1 X14.165 Y-1.000 E627.17494 F7800
+G1 X-14.165 Y-1.000 E628.30812 F3600
+G1 X-14.200 Y0.000 E628.30812 F7800
+G1 X14.200 Y0.000 E629.44412 F3600
+G1 X14.165 Y1.000 E629.44412 F7800
+G1 X-14.165 Y1.000 E630.57730 F3600
+G1 X-14.058 Y2.000 E630.57730 F7800
+G1 X14.058 Y2.000 E631.70198 F3600
+G1 X13.879 Y3.000 E631.70198 F7800
+G1 X-13.879 Y3.000 E632.81234 F3600
+G1 X-13.625 Y4.000 E632.81234 F7800
+G1 X13.625 Y4.000 E633.90234 F3600
+G1 X13.291 Y5.000 E633.90234 F7800
+G1 X-13.291 Y5.000 E634.96558 F3600
+G1 X-12.870 Y6.000 E634.96558 F7800
+G1 X12.870 Y6.000 E635.99519 F3600
+G1 X12.355 Y7.000 E635.99519 F7800
+G1 X-12.355 Y7.000 E636.98357 F3600
+G1 X-11.732 Y8.000 E636.98357 F7800
+G1 X11.732 Y8.000 E637.92213 F3600
+G1 X10.984 Y9.000 E637.92213 F7800
+G1 X-10.984 Y9.000 E638.80082 F3600
+G1 X-10.082 Y10.000 E638.80082 F7800
+G1 X10.082 Y10.000 E639.60736 F3600
+G1 X8.980 Y11.000 E639.60736 F7800
+G1 X-8.980 Y11.000 E640.32576 F3600
+G1 X-7.592 Y12.000 E640.32576 F7800
+G1 X7.592 Y12.000 E640.93312 F3600
+G1 X5.713 Y13.000 E640.93312 F7800
+G1 X-5.713 Y13.000 E641.39018 F3600
+G1 Z4.500 F7800
+G1 E640.39018 F2400
+G1 E641.39018 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E641.41018 F1800
+G1 X14.918 Y1.568 E641.43018
+G1 X14.815 Y2.347 E641.45018
+G1 X14.672 Y3.119 E641.47018
+G1 X14.489 Y3.882 E641.49018
+G1 X14.266 Y4.635 E641.51018
+G1 X14.004 Y5.376 E641.53018
+G1 X13.703 Y6.101 E641.55018
+G1 X13.365 Y6.810 E641.57018
+G1 X12.990 Y7.500 E641.59018
+G1 X12.580 Y8.170 E641.61018
+G1 X12.135 Y8.817 E641.63018
+G1 X11.657 Y9.440 E641.65018
+G1 X11.147 Y10.037 E641.67018
+G1 X10.607 Y10.607 E641.69018
+G1 X10.037 Y11.147 E641.71018
+G1 X9.440 Y11.657 E641.73018
+G1 X8.817 Y12.135 E641.75018
+G1 X8.170 Y12.580 E641.77018
+G1 X7.500 Y12.990 E641.79018
+G1 X6.810 Y13.365 E641.81018
+G1 X6.101 Y13.703 E641.83018
+G1 X5.376 Y14.004 E641.85018
+G1 X4.635 Y14.266 E641.87018
+G1 X3.882 Y14.489 E641.89018
+G1 X3.119 Y14.672 E641.91018
+G1 X2.347 Y14.815 E641.93018
+G1 X1.568 Y14.918 E641.95018
+G1 X0.785 Y14.979 E641.97018
+G1 X0.000 Y15.000 E641.99018
+G1 X-0.785 Y14.979 E642.01018
+G1 X-1.568 Y14.918 E642.03018
+G1 X-2.347 Y14.815 E642.05018
+G1 X-3.119 Y14.672 E642.07018
+G1 X-3.882 Y14.489 E642.09018
+G1 X-4.635 Y14.266 E642.11018
+G1 X-5.376 Y14.004 E642.13018
+G1 X-6.101 Y13.703 E642.15018
+G1 X-6.810 Y13.365 E642.17018
+G1 X-7.500 Y12.990 E642.19018
+G1 X-8.170 Y12.580 E642.21018
+G1 X-8.817 Y12.135 E642.23018
+G1 X-9.440 Y11.657 E642.25018
+G1 X-10.037 Y11.147 E642.27018
+G1 X-10.607 Y10.607 E642.29018
+G1 X-11.147 Y10.037 E642.31018
+G1 X-11.657 Y9.440 E642.33018
+G1 X-12.135 Y8.817 E642.35018
+G1 X-12.580 Y8.170 E642.37018
+G1 X-12.990 Y7.500 E642.39018
+G1 X-13.365 Y6.810 E642.41018
+G1 X-13.703 Y6.101 E642.43018
+G1 X-14.004 Y5.376 E642.45018
+G1 X-14.266 Y4.635 E642.47018
+G1 X-14.489 Y3.882 E642.49018
+G1 X-14.672 Y3.119 E642.51018
+G1 X-14.815 Y2.347 E642.53018
+G1 X-14.918 Y1.568 E642.55018
+G1 X-14.979 Y0.785 E642.57018
+G1 X-15.000 Y0.000 E642.59018
+G1 X-14.979 Y-0.785 E642.61018
+G1 X-14.918 Y-1.568 E642.63018
+G1 X-14.815 Y-2.347 E642.65018
+G1 X-14.672 Y-3.119 E642.67018
+G1 X-14.489 Y-3.882 E642.69018
+G1 X-14.266 Y-4.635 E642.71018
+G1 X-14.004 Y-5.376 E642.73018
+G1 X-13.703 Y-6.101 E642.75018
+G1 X-13.365 Y-6.810 E642.77018
+G1 X-12.990 Y-7.500 E642.79018
+G1 X-12.580 Y-8.170 E642.81018
+G1 X-12.135 Y-8.817 E642.83018
+G1 X-11.657 Y-9.440 E642.85018
+G1 X-11.147 Y-10.037 E642.87018
+G1 X-10.607 Y-10.607 E642.89018
+G1 X-10.037 Y-11.147 E642.91018
+G1 X-9.440 Y-11.657 E642.93018
+G1 X-8.817 Y-12.135 E642.95018
+G1 X-8.170 Y-12.580 E642.97018
+G1 X-7.500 Y-12.990 E642.99018
+G1 X-6.810 Y-13.365 E643.01018
+G1 X-6.101 Y-13.703 E643.03018
+G1 X-5.376 Y-14.004 E643.05018
+G1 X-4.635 Y-14.266 E643.07018
+G1 X-3.882 Y-14.489 E643.09018
+G1 X-3.119 Y-14.672 E643.11018
+G1 X-2.347 Y-14.815 E643.13018
+G1 X-1.568 Y-14.918 E643.15018
+G1 X-0.785 Y-14.979 E643.17018
+G1 X-0.000 Y-15.000 E643.19018
+G1 X0.785 Y-14.979 E643.21018
+G1 X1.568 Y-14.918 E643.23018
+G1 X2.347 Y-14.815 E643.25018
+G1 X3.119 Y-14.672 E643.27018
+G1 X3.882 Y-14.489 E643.29018
+G1 X4.635 Y-14.266 E643.31018
+G1 X5.376 Y-14.004 E643.33018
+G1 X6.101 Y-13.703 E643.35018
+G1 X6.810 Y-13.365 E643.37018
+G1 X7.500 Y-12.990 E643.39018
+G1 X8.170 Y-12.580 E643.41018
+G1 X8.817 Y-12.135 E643.43018
+G1 X9.440 Y-11.657 E643.45018
+G1 X10.037 Y-11.147 E643.47018
+G1 X10.607 Y-10.607 E643.49018
+G1 X11.147 Y-10.037 E643.51018
+G1 X11.657 Y-9.440 E643.53018
+G1 X12.135 Y-8.817 E643.55018
+G1 X12.580 Y-8.170 E643.57018
+G1 X12.990 Y-7.500 E643.59018
+G1 X13.365 Y-6.810 E643.61018
+G1 X13.703 Y-6.101 E643.63018
+G1 X14.004 Y-5.376 E643.65018
+G1 X14.266 Y-4.635 E643.67018
+G1 X14.489 Y-3.882 E643.69018
+G1 X14.672 Y-3.119 E643.71018
+G1 X14.815 Y-2.347 E643.73018
+G1 X14.918 Y-1.568 E643.75018
+G1 X14.979 Y-0.785 E643.77018
+G1 X15.000 Y-0.000 E643.79018
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E643.81018 F1800
+G1 X14.520 Y1.526 E643.83018
+G1 X14.420 Y2.284 E643.85018
+G1 X14.281 Y3.036 E643.87018
+G1 X14.103 Y3.779 E643.89018
+G1 X13.885 Y4.512 E643.91018
+G1 X13.630 Y5.232 E643.93018
+G1 X13.338 Y5.938 E643.95018
+G1 X13.009 Y6.628 E643.97018
+G1 X12.644 Y7.300 E643.99018
+G1 X12.245 Y7.952 E644.01018
+G1 X11.812 Y8.582 E644.03018
+G1 X11.346 Y9.188 E644.05018
+G1 X10.850 Y9.769 E644.07018
+G1 X10.324 Y10.324 E644.09018
+G1 X9.769 Y10.850 E644.11018
+G1 X9.188 Y11.346 E644.13018
+G1 X8.582 Y11.812 E644.15018
+G1 X7.952 Y12.245 E644.17018
+G1 X7.300 Y12.644 E644.19018
+G1 X6.628 Y13.009 E644.21018
+G1 X5.938 Y13.338 E644.23018
+G1 X5.232 Y13.630 E644.25018
+G1 X4.512 Y13.885 E644.27018
+G1 X3.779 Y14.103 E644.29018
+G1 X3.036 Y14.281 E644.31018
+G1 X2.284 Y14.420 E644.33018
+G1 X1.526 Y14.520 E644.35018
+G1 X0.764 Y14.580 E644.37018
+G1 X0.000 Y14.600 E644.39018
+G1 X-0.764 Y14.580 E644.41018
+G1 X-1.526 Y14.520 E644.43018
+G1 X-2.284 Y14.420 E644.45018
+G1 X-3.036 Y14.281 E644.47018
+G1 X-3.779 Y14.103 E644.49018
+G1 X-4.512 Y13.885 E644.51018
+G1 X-5.232 Y13.630 E644.53018
+G1 X-5.938 Y13.338 E644.55018
+G1 X-6.628 Y13.009 E644.57018
+G1 X-7.300 Y12.644 E644.59018
+G1 X-7.952 Y12.245 E644.61018
+G1 X-8.582 Y11.812 E644.63018
+G1 X-9.188 Y11.346 E644.65018
+G1 X-9.769 Y10.850 E644.67018
+G1 X-10.324 Y10.324 E644.69018
+G1 X-10.850 Y9.769 E644.71018
+G1 X-11.346 Y9.188 E644.73018
+G1 X-11.812 Y8.582 E644.75018
+G1 X-12.245 Y7.952 E644.77018
+G1 X-12.644 Y7.300 E644.79018
+G1 X-13.009 Y6.628 E644.81018
+G1 X-13.338 Y5.938 E644.83018
+G1 X-13.630 Y5.232 E644.85018
+G1 X-13.885 Y4.512 E644.87018
+G1 X-14.103 Y3.779 E644.89018
+G1 X-14.281 Y3.036 E644.91018
+G1 X-14.420 Y2.284 E644.93018
+G1 X-14.520 Y1.526 E644.95018
+G1 X-14.580 Y0.764 E644.97018
+G1 X-14.600 Y0.000 E644.99018
+G1 X-14.580 Y-0.764 E645.01018
+G1 X-14.520 Y-1.526 E645.03018
+G1 X-14.420 Y-2.284 E645.05018
+G1 X-14.281 Y-3.036 E645.07018
+G1 X-14.103 Y-3.779 E645.09018
+G1 X-13.885 Y-4.512 E645.11018
+G1 X-13.630 Y-5.232 E645.13018
+G1 X-13.338 Y-5.938 E645.15018
+G1 X-13.009 Y-6.628 E645.17018
+G1 X-12.644 Y-7.300 E645.19018
+G1 X-12.245 Y-7.952 E645.21018
+G1 X-11.812 Y-8.582 E645.23018
+G1 X-11.346 Y-9.188 E645.25018
+G1 X-10.850 Y-9.769 E645.27018
+G1 X-10.324 Y-10.324 E645.29018
+G1 X-9.769 Y-10.850 E645.31018
+G1 X-9.188 Y-11.346 E645.33018
+G1 X-8.582 Y-11.812 E645.35018
+G1 X-7.952 Y-12.245 E645.37018
+G1 X-7.300 Y-12.644 E645.39018
+G1 X-6.628 Y-13.009 E645.41018
+G1 X-5.938 Y-13.338 E645.43018
+G1 X-5.232 Y-13.630 E645.45018
+G1 X-4.512 Y-13.885 E645.47018
+G1 X-3.779 Y-14.103 E645.49018
+G1 X-3.036 Y-14.281 E645.51018
+G1 X-2.284 Y-14.420 E645.53018
+G1 X-1.526 Y-14.520 E645.55018
+G1 X-0.764 Y-14.580 E645.57018
+G1 X-0.000 Y-14.600 E645.59018
+G1 X0.764 Y-14.580 E645.61018
+G1 X1.526 Y-14.520 E645.63018
+G1 X2.284 Y-14.420 E645.65018
+G1 X3.036 Y-14.281 E645.67018
+G1 X3.779 Y-14.103 E645.69018
+G1 X4.512 Y-13.885 E645.71018
+G1 X5.232 Y-13.630 E645.73018
+G1 X5.938 Y-13.338 E645.75018
+G1 X6.628 Y-13.009 E645.77018
+G1 X7.300 Y-12.644 E645.79018
+G1 X7.952 Y-12.245 E645.81018
+G1 X8.582 Y-11.812 E645.83018
+G1 X9.188 Y-11.346 E645.85018
+G1 X9.769 Y-10.850 E645.87018
+G1 X10.324 Y-10.324 E645.89018
+G1 X10.850 Y-9.769 E645.91018
+G1 X11.346 Y-9.188 E645.93018
+G1 X11.812 Y-8.582 E645.95018
+G1 X12.245 Y-7.952 E645.97018
+G1 X12.644 Y-7.300 E645.99018
+G1 X13.009 Y-6.628 E646.01018
+G1 X13.338 Y-5.938 E646.03018
+G1 X13.630 Y-5.232 E646.05018
+G1 X13.885 Y-4.512 E646.07018
+G1 X14.103 Y-3.779 E646.09018
+G1 X14.281 Y-3.036 E646.11018
+G1 X14.420 Y-2.284 E646.13018
+G1 X14.520 Y-1.526 E646.15018
+G1 X14.580 Y-0.764 E646.17018
+G1 X14.600 Y-0.000 E646.19018
+G1 X5.713 Y-13.000 E646.19018 F7800
+G1 X-5.713 Y-13.000 E646.64723 F3600
+G1 X-7.592 Y-12.000 E646.64723 F7800
+G1 X7.592 Y-12.000 E647.25459 F3600
+G1 X8.980 Y-11.000 E647.25459 F7800
+G1 X-8.980 Y-11.000 E647.97299 F3600
+G1 X-10.082 Y-10.000 E647.97299 F7800
+G1 X10.082 Y-10.000 E648.77953 F3600
+G1 X10.984 Y-9.000 E648.77953 F7800
+G1 X-10.984 Y-9.000 E649.65822 F3600
+G1 X-11.732 Y-8.000 E649.65822 F7800
+G1 X11.732 Y-8.000 E650.59678 F3600
+G1 X12.355 Y-7.000 E650.59678 F7800
+G1 X-12.355 Y-7.000 E651.58516 F3600
+G1 X-12.870 Y-6.000 E651.58516 F7800
+G1 X12.870 Y-6.000 E652.61477 F3600
+G1 X13.291 Y-5.000 E652.61477 F7800
+G1 X-13.291 Y-5.000 E653.67801 F3600
+G1 X-13.625 Y-4.000 E653.67801 F7800
+G1 X13.625 Y-4.000 E654.76801 F3600
+G1 X13.879 Y-3.000 E654.76801 F7800
+G1 X-13.879 Y-3.000 E655.87837 F3600
+G1 X-14.058 Y-2.000 E655.87837 F7800
+G1 X14.058 Y-2.000 E657.00305 F3600
+G1 X14.165 Y-1.000 E657.00305 F7800
+G1 X-14.165 Y-1.000 E658.13623 F3600
+G1 X-14.200 Y0.000 E658.13623 F7800
+G1 X14.200 Y0.000 E659.27223 F3600
+G1 X14.165 Y1.000 E659.27223 F7800
+G1 X-14.165 Y1.000 E660.40541 F3600
+G1 X-14.058 Y2.000 E660.40541 F7800
+G1 X14.058 Y2.000 E661.53008 F3600
+G1 X13.879 Y3.000 E661.53008 F7800
+G1 X-13.879 Y3.000 E662.64044 F3600
+G1 X-13.625 Y4.000 E662.64044 F7800
+G1 X13.625 Y4.000 E663.73044 F3600
+G1 X13.291 Y5.000 E663.73044 F7800
+G1 X-13.291 Y5.000 E664.79369 F3600
+G1 X-12.870 Y6.000 E664.79369 F7800
+G1 X12.870 Y6.000 E665.82330 F3600
+G1 X12.355 Y7.000 E665.82330 F7800
+G1 X-12.355 Y7.000 E666.81168 F3600
+G1 X-11.732 Y8.000 E666.81168 F7800
+G1 X11.732 Y8.000 E667.75024 F3600
+G1 X10.984 Y9.000 E667.75024 F7800
+G1 X-10.984 Y9.000 E668.62893 F3600
+G1 X-10.082 Y10.000 E668.62893 F7800
+G1 X10.082 Y10.000 E669.43546 F3600
+G1 X8.980 Y11.000 E669.43546 F7800
+G1 X-8.980 Y11.000 E670.15386 F3600
+G1 X-7.592 Y12.000 E670.15386 F7800
+G1 X7.592 Y12.000 E670.76123 F3600
+G1 X5.713 Y13.000 E670.76123 F7800
+G1 X-5.713 Y13.000 E671.21828 F3600
+G1 Z4.700 F7800
+G1 E670.21828 F2400
+G1 E671.21828 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E671.23828 F1800
+G1 X14.918 Y1.568 E671.25828
+G1 X14.815 Y2.347 E671.27828
+G1 X14.672 Y3.119 E671.29828
+G1 X14.489 Y3.882 E671.31828
+G1 X14.266 Y4.635 E671.33828
+G1 X14.004 Y5.376 E671.35828
+G1 X13.703 Y6.101 E671.37828
+G1 X13.365 Y6.810 E671.39828
+G1 X12.990 Y7.500 E671.41828
+G1 X12.580 Y8.170 E671.43828
+G1 X12.135 Y8.817 E671.45828
+G1 X11.657 Y9.440 E671.47828
+G1 X11.147 Y10.037 E671.49828
+G1 X10.607 Y10.607 E671.51828
+G1 X10.037 Y11.147 E671.53828
+G1 X9.440 Y11.657 E671.55828
+G1 X8.817 Y12.135 E671.57828
+G1 X8.170 Y12.580 E671.59828
+G1 X7.500 Y12.990 E671.61828
+G1 X6.810 Y13.365 E671.63828
+G1 X6.101 Y13.703 E671.65828
+G1 X5.376 Y14.004 E671.67828
+G1 X4.635 Y14.266 E671.69828
+G1 X3.882 Y14.489 E671.71828
+G1 X3.119 Y14.672 E671.73828
+G1 X2.347 Y14.815 E671.75828
+G1 X1.568 Y14.918 E671.77828
+G1 X0.785 Y14.979 E671.79828
+G1 X0.000 Y15.000 E671.81828
+G1 X-0.785 Y14.979 E671.83828
+G1 X-1.568 Y14.918 E671.85828
+G1 X-2.347 Y14.815 E671.87828
+G1 X-3.119 Y14.672 E671.89828
+G1 X-3.882 Y14.489 E671.91828
+G1 X-4.635 Y14.266 E671.93828
+G1 X-5.376 Y14.004 E671.95828
+G1 X-6.101 Y13.703 E671.97828
+G1 X-6.810 Y13.365 E671.99828
+G1 X-7.500 Y12.990 E672.01828
+G1 X-8.170 Y12.580 E672.03828
+G1 X-8.817 Y12.135 E672.05828
+G1 X-9.440 Y11.657 E672.07828
+G1 X-10.037 Y11.147 E672.09828
+G1 X-10.607 Y10.607 E672.11828
+G1 X-11.147 Y10.037 E672.13828
+G1 X-11.657 Y9.440 E672.15828
+G1 X-12.135 Y8.817 E672.17828
+G1 X-12.580 Y8.170 E672.19828
+G1 X-12.990 Y7.500 E672.21828
+G1 X-13.365 Y6.810 E672.23828
+G1 X-13.703 Y6.101 E672.25828
+G1 X-14.004 Y5.376 E672.27828
+G1 X-14.266 Y4.635 E672.29828
+G1 X-14.489 Y3.882 E672.31828
+G1 X-14.672 Y3.119 E672.33828
+G1 X-14.815 Y2.347 E672.35828
+G1 X-14.918 Y1.568 E672.37828
+G1 X-14.979 Y0.785 E672.39828
+G1 X-15.000 Y0.000 E672.41828
+G1 X-14.979 Y-0.785 E672.43828
+G1 X-14.918 Y-1.568 E672.45828
+G1 X-14.815 Y-2.347 E672.47828
+G1 X-14.672 Y-3.119 E672.49828
+G1 X-14.489 Y-3.882 E672.51828
+G1 X-14.266 Y-4.635 E672.53828
+G1 X-14.004 Y-5.376 E672.55828
+G1 X-13.703 Y-6.101 E672.57828
+G1 X-13.365 Y-6.810 E672.59828
+G1 X-12.990 Y-7.500 E672.61828
+G1 X-12.580 Y-8.170 E672.63828
+G1 X-12.135 Y-8.817 E672.65828
+G1 X-11.657 Y-9.440 E672.67828
+G1 X-11.147 Y-10.037 E672.69828
+G1 X-10.607 Y-10.607 E672.71828
+G1 X-10.037 Y-11.147 E672.73828
+G1 X-9.440 Y-11.657 E672.75828
+G1 X-8.817 Y-12.135 E672.77828
+G1 X-8.170 Y-12.580 E672.79828
+G1 X-7.500 Y-12.990 E672.81828
+G1 X-6.810 Y-13.365 E672.83828
+G1 X-6.101 Y-13.703 E672.85828
+G1 X-5.376 Y-14.004 E672.87828
+G1 X-4.635 Y-14.266 E672.89828
+G1 X-3.882 Y-14.489 E672.91828
+G1 X-3.119 Y-14.672 E672.93828
+G1 X-2.347 Y-14.815 E672.95828
+G1 X-1.568 Y-14.918 E672.97828
+G1 X-0.785 Y-14.979 E672.99828
+G1 X-0.000 Y-15.000 E673.01828
+G1 X0.785 Y-14.979 E673.03828
+G1 X1.568 Y-14.918 E673.05828
+G1 X2.347 Y-14.815 E673.07828
+G1 X3.119 Y-14.672 E673.09828
+G1 X3.882 Y-14.489 E673.11828
+G1 X4.635 Y-14.266 E673.13828
+G1 X5.376 Y-14.004 E673.15828
+G1 X6.101 Y-13.703 E673.17828
+G1 X6.810 Y-13.365 E673.19828
+G1 X7.500 Y-12.990 E673.21828
+G1 X8.170 Y-12.580 E673.23828
+G1 X8.817 Y-12.135 E673.25828
+G1 X9.440 Y-11.657 E673.27828
+G1 X10.037 Y-11.147 E673.29828
+G1 X10.607 Y-10.607 E673.31828
+G1 X11.147 Y-10.037 E673.33828
+G1 X11.657 Y-9.440 E673.35828
+G1 X12.135 Y-8.817 E673.37828
+G1 X12.580 Y-8.170 E673.39828
+G1 X12.990 Y-7.500 E673.41828
+G1 X13.365 Y-6.810 E673.43828
+G1 X13.703 Y-6.101 E673.45828
+G1 X14.004 Y-5.376 E673.47828
+G1 X14.266 Y-4.635 E673.49828
+G1 X14.489 Y-3.882 E673.51828
+G1 X14.672 Y-3.119 E673.53828
+G1 X14.815 Y-2.347 E673.55828
+G1 X14.918 Y-1.568 E673.57828
+G1 X14.979 Y-0.785 E673.59828
+G1 X15.000 Y-0.000 E673.61828
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E673.63828 F1800
+G1 X14.520 Y1.526 E673.65828
+G1 X14.420 Y2.284 E673.67828
+G1 X14.281 Y3.036 E673.69828
+G1 X14.103 Y3.779 E673.71828
+G1 X13.885 Y4.512 E673.73828
+G1 X13.630 Y5.232 E673.75828
+G1 X13.338 Y5.938 E673.77828
+G1 X13.009 Y6.628 E673.79828
+G1 X12.644 Y7.300 E673.81828
+G1 X12.245 Y7.952 E673.83828
+G1 X11.812 Y8.582 E673.85828
+G1 X11.346 Y9.188 E673.87828
+G1 X10.850 Y9.769 E673.89828
+G1 X10.324 Y10.324 E673.91828
+G1 X9.769 Y10.850 E673.93828
+G1 X9.188 Y11.346 E673.95828
+G1 X8.582 Y11.812 E673.97828
+G1 X7.952 Y12.245 E673.99828
+G1 X7.300 Y12.644 E674.01828
+G1 X6.628 Y13.009 E674.03828
+G1 X5.938 Y13.338 E674.05828
+G1 X5.232 Y13.630 E674.07828
+G1 X4.512 Y13.885 E674.09828
+G1 X3.779 Y14.103 E674.11828
+G1 X3.036 Y14.281 E674.13828
+G1 X2.284 Y14.420 E674.15828
+G1 X1.526 Y14.520 E674.17828
+G1 X0.764 Y14.580 E674.19828
+G1 X0.000 Y14.600 E674.21828
+G1 X-0.764 Y14.580 E674.23828
+G1 X-1.526 Y14.520 E674.25828
+G1 X-2.284 Y14.420 E674.27828
+G1 X-3.036 Y14.281 E674.29828
+G1 X-3.779 Y14.103 E674.31828
+G1 X-4.512 Y13.885 E674.33828
+G1 X-5.232 Y13.630 E674.35828
+G1 X-5.938 Y13.338 E674.37828
+G1 X-6.628 Y13.009 E674.39828
+G1 X-7.300 Y12.644 E674.41828
+G1 X-7.952 Y12.245 E674.43828
+G1 X-8.582 Y11.812 E674.45828
+G1 X-9.188 Y11.346 E674.47828
+G1 X-9.769 Y10.850 E674.49828
+G1 X-10.324 Y10.324 E674.51828
+G1 X-10.850 Y9.769 E674.53828
+G1 X-11.346 Y9.188 E674.55828
+G1 X-11.812 Y8.582 E674.57828
+G1 X-12.245 Y7.952 E674.59828
+G1 X-12.644 Y7.300 E674.61828
+G1 X-13.009 Y6.628 E674.63828
+G1 X-13.338 Y5.938 E674.65828
+G1 X-13.630 Y5.232 E674.67828
+G1 X-13.885 Y4.512 E674.69828
+G1 X-14.103 Y3.779 E674.71828
+G1 X-14.281 Y3.036 E674.73828
+G1 X-14.420 Y2.284 E674.75828
+G1 X-14.520 Y1.526 E674.77828
+G1 X-14.580 Y0.764 E674.79828
+G1 X-14.600 Y0.000 E674.81828
+G1 X-14.580 Y-0.764 E674.83828
+G1 X-14.520 Y-1.526 E674.85828
+G1 X-14.420 Y-2.284 E674.87828
+G1 X-14.281 Y-3.036 E674.89828
+G1 X-14.103 Y-3.779 E674.91828
+G1 X-13.885 Y-4.512 E674.93828
+G1 X-13.630 Y-5.232 E674.95828
+G1 X-13.338 Y-5.938 E674.97828
+G1 X-13.009 Y-6.628 E674.99828
+G1 X-12.644 Y-7.300 E675.01828
+G1 X-12.245 Y-7.952 E675.03828
+G1 X-11.812 Y-8.582 E675.05828
+G1 X-11.346 Y-9.188 E675.07828
+G1 X-10.850 Y-9.769 E675.09828
+G1 X-10.324 Y-10.324 E675.11828
+G1 X-9.769 Y-10.850 E675.13828
+G1 X-9.188 Y-11.346 E675.15828
+G1 X-8.582 Y-11.812 E675.17828
+G1 X-7.952 Y-12.245 E675.19828
+G1 X-7.300 Y-12.644 E675.21828
+G1 X-6.628 Y-13.009 E675.23828
+G1 X-5.938 Y-13.338 E675.25828
+G1 X-5.232 Y-13.630 E675.27828
+G1 X-4.512 Y-13.885 E675.29828
+G1 X-3.779 Y-14.103 E675.31828
+G1 X-3.036 Y-14.281 E675.33828
+G1 X-2.284 Y-14.420 E675.35828
+G1 X-1.526 Y-14.520 E675.37828
+G1 X-0.764 Y-14.580 E675.39828
+G1 X-0.000 Y-14.600 E675.41828
+G1 X0.764 Y-14.580 E675.43828
+G1 X1.526 Y-14.520 E675.45828
+G1 X2.284 Y-14.420 E675.47828
+G1 X3.036 Y-14.281 E675.49828
+G1 X3.779 Y-14.103 E675.51828
+G1 X4.512 Y-13.885 E675.53828
+G1 X5.232 Y-13.630 E675.55828
+G1 X5.938 Y-13.338 E675.57828
+G1 X6.628 Y-13.009 E675.59828
+G1 X7.300 Y-12.644 E675.61828
+G1 X7.952 Y-12.245 E675.63828
+G1 X8.582 Y-11.812 E675.65828
+G1 X9.188 Y-11.346 E675.67828
+G1 X9.769 Y-10.850 E675.69828
+G1 X10.324 Y-10.324 E675.71828
+G1 X10.850 Y-9.769 E675.73828
+G1 X11.346 Y-9.188 E675.75828
+G1 X11.812 Y-8.582 E675.77828
+G1 X12.245 Y-7.952 E675.79828
+G1 X12.644 Y-7.300 E675.81828
+G1 X13.009 Y-6.628 E675.83828
+G1 X13.338 Y-5.938 E675.85828
+G1 X13.630 Y-5.232 E675.87828
+G1 X13.885 Y-4.512 E675.89828
+G1 X14.103 Y-3.779 E675.91828
+G1 X14.281 Y-3.036 E675.93828
+G1 X14.420 Y-2.284 E675.95828
+G1 X14.520 Y-1.526 E675.97828
+G1 X14.580 Y-0.764 E675.99828
+G1 X14.600 Y-0.000 E676.01828
+G1 X5.713 Y-13.000 E676.01828 F7800
+G1 X-5.713 Y-13.000 E676.47533 F3600
+G1 X-7.592 Y-12.000 E676.47533 F7800
+G1 X7.592 Y-12.000 E677.08270 F3600
+G1 X8.980 Y-11.000 E677.08270 F7800
+G1 X-8.980 Y-11.000 E677.80110 F3600
+G1 X-10.082 Y-10.000 E677.80110 F7800
+G1 X10.082 Y-10.000 E678.60763 F3600
+G1 X10.984 Y-9.000 E678.60763 F7800
+G1 X-10.984 Y-9.000 E679.48632 F3600
+G1 X-11.732 Y-8.000 E679.48632 F7800
+G1 X11.732 Y-8.000 E680.42488 F3600
+G1 X12.355 Y-7.000 E680.42488 F7800
+G1 X-12.355 Y-7.000 E681.41326 F3600
+G1 X-12.870 Y-6.000 E681.41326 F7800
+G1 X12.870 Y-6.000 E682.44287 F3600
+G1 X13.291 Y-5.000 E682.44287 F7800
+G1 X-13.291 Y-5.000 E683.50612 F3600
+G1 X-13.625 Y-4.000 E683.50612 F7800
+G1 X13.625 Y-4.000 E684.59612 F3600
+G1 X13.879 Y-3.000 E684.59612 F7800
+G1 X-13.879 Y-3.000 E685.70647 F3600
+G1 X-14.058 Y-2.000 E685.70647 F7800
+G1 X14.058 Y-2.000 E686.83115 F3600
+G1 X14.165 Y-1.000 E686.83115 F7800
+G1 X-14.165 Y-1.000 E687.96433 F3600
+G1 X-14.200 Y0.000 E687.96433 F7800
+G1 X14.200 Y0.000 E689.10033 F3600
+G1 X14.165 Y1.000 E689.10033 F7800
+G1 X-14.165 Y1.000 E690.23351 F3600
+G1 X-14.058 Y2.000 E690.23351 F7800
+G1 X14.058 Y2.000 E691.35819 F3600
+G1 X13.879 Y3.000 E691.35819 F7800
+G1 X-13.879 Y3.000 E692.46854 F3600
+G1 X-13.625 Y4.000 E692.46854 F7800
+G1 X13.625 Y4.000 E693.55854 F3600
+G1 X13.291 Y5.000 E693.55854 F7800
+G1 X-13.291 Y5.000 E694.62179 F3600
+G1 X-12.870 Y6.000 E694.62179 F7800
+G1 X12.870 Y6.000 E695.65140 F3600
+G1 X12.355 Y7.000 E695.65140 F7800
+G1 X-12.355 Y7.000 E696.63978 F3600
+G1 X-11.732 Y8.000 E696.63978 F7800
+G1 X11.732 Y8.000 E697.57834 F3600
+G1 X10.984 Y9.000 E697.57834 F7800
+G1 X-10.984 Y9.000 E698.45703 F3600
+G1 X-10.082 Y10.000 E698.45703 F7800
+G1 X10.082 Y10.000 E699.26356 F3600
+G1 X8.980 Y11.000 E699.26356 F7800
+G1 X-8.980 Y11.000 E699.98196 F3600
+G1 X-7.592 Y12.000 E699.98196 F7800
+G1 X7.592 Y12.000 E700.58933 F3600
+G1 X5.713 Y13.000 E700.58933 F7800
+G1 X-5.713 Y13.000 E701.04638 F3600
+G1 Z4.900 F7800
+G1 E700.04638 F2400
+G1 E701.04638 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E701.06638 F1800
+G1 X14.918 Y1.568 E701.08638
+G1 X14.815 Y2.347 E701.10638
+G1 X14.672 Y3.119 E701.12638
+G1 X14.489 Y3.882 E701.14638
+G1 X14.266 Y4.635 E701.16638
+G1 X14.004 Y5.376 E701.18638
+G1 X13.703 Y6.101 E701.20638
+G1 X13.365 Y6.810 E701.22638
+G1 X12.990 Y7.500 E701.24638
+G1 X12.580 Y8.170 E701.26638
+G1 X12.135 Y8.817 E701.28638
+G1 X11.657 Y9.440 E701.30638
+G1 X11.147 Y10.037 E701.32638
+G1 X10.607 Y10.607 E701.34638
+G1 X10.037 Y11.147 E701.36638
+G1 X9.440 Y11.657 E701.38638
+G1 X8.817 Y12.135 E701.40638
+G1 X8.170 Y12.580 E701.42638
+G1 X7.500 Y12.990 E701.44638
+G1 X6.810 Y13.365 E701.46638
+G1 X6.101 Y13.703 E701.48638
+G1 X5.376 Y14.004 E701.50638
+G1 X4.635 Y14.266 E701.52638
+G1 X3.882 Y14.489 E701.54638
+G1 X3.119 Y14.672 E701.56638
+G1 X2.347 Y14.815 E701.58638
+G1 X1.568 Y14.918 E701.60638
+G1 X0.785 Y14.979 E701.62638
+G1 X0.000 Y15.000 E701.64638
+G1 X-0.785 Y14.979 E701.66638
+G1 X-1.568 Y14.918 E701.68638
+G1 X-2.347 Y14.815 E701.70638
+G1 X-3.119 Y14.672 E701.72638
+G1 X-3.882 Y14.489 E701.74638
+G1 X-4.635 Y14.266 E701.76638
+G1 X-5.376 Y14.004 E701.78638
+G1 X-6.101 Y13.703 E701.80638
+G1 X-6.810 Y13.365 E701.82638
+G1 X-7.500 Y12.990 E701.84638
+G1 X-8.170 Y12.580 E701.86638
+G1 X-8.817 Y12.135 E701.88638
+G1 X-9.440 Y11.657 E701.90638
+G1 X-10.037 Y11.147 E701.92638
+G1 X-10.607 Y10.607 E701.94638
+G1 X-11.147 Y10.037 E701.96638
+G1 X-11.657 Y9.440 E701.98638
+G1 X-12.135 Y8.817 E702.00638
+G1 X-12.580 Y8.170 E702.02638
+G1 X-12.990 Y7.500 E702.04638
+G1 X-13.365 Y6.810 E702.06638
+G1 X-13.703 Y6.101 E702.08638
+G1 X-14.004 Y5.376 E702.10638
+G1 X-14.266 Y4.635 E702.12638
+G1 X-14.489 Y3.882 E702.14638
+G1 X-14.672 Y3.119 E702.16638
+G1 X-14.815 Y2.347 E702.18638
+G1 X-14.918 Y1.568 E702.20638
+G1 X-14.979 Y0.785 E702.22638
+G1 X-15.000 Y0.000 E702.24638
+G1 X-14.979 Y-0.785 E702.26638
+G1 X-14.918 Y-1.568 E702.28638
+G1 X-14.815 Y-2.347 E702.30638
+G1 X-14.672 Y-3.119 E702.32638
+G1 X-14.489 Y-3.882 E702.34638
+G1 X-14.266 Y-4.635 E702.36638
+G1 X-14.004 Y-5.376 E702.38638
+G1 X-13.703 Y-6.101 E702.40638
+G1 X-13.365 Y-6.810 E702.42638
+G1 X-12.990 Y-7.500 E702.44638
+G1 X-12.580 Y-8.170 E702.46638
+G1 X-12.135 Y-8.817 E702.48638
+G1 X-11.657 Y-9.440 E702.50638
+G1 X-11.147 Y-10.037 E702.52638
+G1 X-10.607 Y-10.607 E702.54638
+G1 X-10.037 Y-11.147 E702.56638
+G1 X-9.440 Y-11.657 E702.58638
+G1 X-8.817 Y-12.135 E702.60638
+G1 X-8.170 Y-12.580 E702.62638
+G1 X-7.500 Y-12.990 E702.64638
+G1 X-6.810 Y-13.365 E702.66638
+G1 X-6.101 Y-13.703 E702.68638
+G1 X-5.376 Y-14.004 E702.70638
+G1 X-4.635 Y-14.266 E702.72638
+G1 X-3.882 Y-14.489 E702.74638
+G1 X-3.119 Y-14.672 E702.76638
+G1 X-2.347 Y-14.815 E702.78638
+G1 X-1.568 Y-14.918 E702.80638
+G1 X-0.785 Y-14.979 E702.82638
+G1 X-0.000 Y-15.000 E702.84638
+G1 X0.785 Y-14.979 E702.86638
+G1 X1.568 Y-14.918 E702.88638
+G1 X2.347 Y-14.815 E702.90638
+G1 X3.119 Y-14.672 E702.92638
+G1 X3.882 Y-14.489 E702.94638
+G1 X4.635 Y-14.266 E702.96638
+G1 X5.376 Y-14.004 E702.98638
+G1 X6.101 Y-13.703 E703.00638
+G1 X6.810 Y-13.365 E703.02638
+G1 X7.500 Y-12.990 E703.04638
+G1 X8.170 Y-12.580 E703.06638
+G1 X8.817 Y-12.135 E703.08638
+G1 X9.440 Y-11.657 E703.10638
+G1 X10.037 Y-11.147 E703.12638
+G1 X10.607 Y-10.607 E703.14638
+G1 X11.147 Y-10.037 E703.16638
+G1 X11.657 Y-9.440 E703.18638
+G1 X12.135 Y-8.817 E703.20638
+G1 X12.580 Y-8.170 E703.22638
+G1 X12.990 Y-7.500 E703.24638
+G1 X13.365 Y-6.810 E703.26638
+G1 X13.703 Y-6.101 E703.28638
+G1 X14.004 Y-5.376 E703.30638
+G1 X14.266 Y-4.635 E703.32638
+G1 X14.489 Y-3.882 E703.34638
+G1 X14.672 Y-3.119 E703.36638
+G1 X14.815 Y-2.347 E703.38638
+G1 X14.918 Y-1.568 E703.40638
+G1 X14.979 Y-0.785 E703.42638
+G1 X15.000 Y-0.000 E703.44638
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E703.46638 F1800
+G1 X14.520 Y1.526 E703.48638
+G1 X14.420 Y2.284 E703.50638
+G1 X14.281 Y3.036 E703.52638
+G1 X14.103 Y3.779 E703.54638
+G1 X13.885 Y4.512 E703.56638
+G1 X13.630 Y5.232 E703.58638
+G1 X13.338 Y5.938 E703.60638
+G1 X13.009 Y6.628 E703.62638
+G1 X12.644 Y7.300 E703.64638
+G1 X12.245 Y7.952 E703.66638
+G1 X11.812 Y8.582 E703.68638
+G1 X11.346 Y9.188 E703.70638
+G1 X10.850 Y9.769 E703.72638
+G1 X10.324 Y10.324 E703.74638
+G1 X9.769 Y10.850 E703.76638
+G1 X9.188 Y11.346 E703.78638
+G1 X8.582 Y11.812 E703.80638
+G1 X7.952 Y12.245 E703.82638
+G1 X7.300 Y12.644 E703.84638
+G1 X6.628 Y13.009 E703.86638
+G1 X5.938 Y13.338 E703.88638
+G1 X5.232 Y13.630 E703.90638
+G1 X4.512 Y13.885 E703.92638
+G1 X3.779 Y14.103 E703.94638
+G1 X3.036 Y14.281 E703.96638
+G1 X2.284 Y14.420 E703.98638
+G1 X1.526 Y14.520 E704.00638
+G1 X0.764 Y14.580 E704.02638
+G1 X0.000 Y14.600 E704.04638
+G1 X-0.764 Y14.580 E704.06638
+G1 X-1.526 Y14.520 E704.08638
+G1 X-2.284 Y14.420 E704.10638
+G1 X-3.036 Y14.281 E704.12638
+G1 X-3.779 Y14.103 E704.14638
+G1 X-4.512 Y13.885 E704.16638
+G1 X-5.232 Y13.630 E704.18638
+G1 X-5.938 Y13.338 E704.20638
+G1 X-6.628 Y13.009 E704.22638
+G1 X-7.300 Y12.644 E704.24638
+G1 X-7.952 Y12.245 E704.26638
+G1 X-8.582 Y11.812 E704.28638
+G1 X-9.188 Y11.346 E704.30638
+G1 X-9.769 Y10.850 E704.32638
+G1 X-10.324 Y10.324 E704.34638
+G1 X-10.850 Y9.769 E704.36638
+G1 X-11.346 Y9.188 E704.38638
+G1 X-11.812 Y8.582 E704.40638
+G1 X-12.245 Y7.952 E704.42638
+G1 X-12.644 Y7.300 E704.44638
+G1 X-13.009 Y6.628 E704.46638
+G1 X-13.338 Y5.938 E704.48638
+G1 X-13.630 Y5.232 E704.50638
+G1 X-13.885 Y4.512 E704.52638
+G1 X-14.103 Y3.779 E704.54638
+G1 X-14.281 Y3.036 E704.56638
+G1 X-14.420 Y2.284 E704.58638
+G1 X-14.520 Y1.526 E704.60638
+G1 X-14.580 Y0.764 E704.62638
+G1 X-14.600 Y0.000 E704.64638
+G1 X-14.580 Y-0.764 E704.66638
+G1 X-14.520 Y-1.526 E704.68638
+G1 X-14.420 Y-2.284 E704.70638
+G1 X-14.281 Y-3.036 E704.72638
+G1 X-14.103 Y-3.779 E704.74638
+G1 X-13.885 Y-4.512 E704.76638
+G1 X-13.630 Y-5.232 E704.78638
+G1 X-13.338 Y-5.938 E704.80638
+G1 X-13.009 Y-6.628 E704.82638
+G1 X-12.644 Y-7.300 E704.84638
+G1 X-12.245 Y-7.952 E704.86638
+G1 X-11.812 Y-8.582 E704.88638
+G1 X-11.346 Y-9.188 E704.90638
+G1 X-10.850 Y-9.769 E704.92638
+G1 X-10.324 Y-10.324 E704.94638
+G1 X-9.769 Y-10.850 E704.96638
+G1 X-9.188 Y-11.346 E704.98638
+G1 X-8.582 Y-11.812 E705.00638
+G1 X-7.952 Y-12.245 E705.02638
+G1 X-7.300 Y-12.644 E705.04638
+G1 X-6.628 Y-13.009 E705.06638
+G1 X-5.938 Y-13.338 E705.08638
+G1 X-5.232 Y-13.630 E705.10638
+G1 X-4.512 Y-13.885 E705.12638
+G1 X-3.779 Y-14.103 E705.14638
+G1 X-3.036 Y-14.281 E705.16638
+G1 X-2.284 Y-14.420 E705.18638
+G1 X-1.526 Y-14.520 E705.20638
+G1 X-0.764 Y-14.580 E705.22638
+G1 X-0.000 Y-14.600 E705.24638
+G1 X0.764 Y-14.580 E705.26638
+G1 X1.526 Y-14.520 E705.28638
+G1 X2.284 Y-14.420 E705.30638
+G1 X3.036 Y-14.281 E705.32638
+G1 X3.779 Y-14.103 E705.34638
+G1 X4.512 Y-13.885 E705.36638
+G1 X5.232 Y-13.630 E705.38638
+G1 X5.938 Y-13.338 E705.40638
+G1 X6.628 Y-13.009 E705.42638
+G1 X7.300 Y-12.644 E705.44638
+G1 X7.952 Y-12.245 E705.46638
+G1 X8.582 Y-11.812 E705.48638
+G1 X9.188 Y-11.346 E705.50638
+G1 X9.769 Y-10.850 E705.52638
+G1 X10.324 Y-10.324 E705.54638
+G1 X10.850 Y-9.769 E705.56638
+G1 X11.346 Y-9.188 E705.58638
+G1 X11.812 Y-8.582 E705.60638
+G1 X12.245 Y-7.952 E705.62638
+G1 X12.644 Y-7.300 E705.64638
+G1 X13.009 Y-6.628 E705.66638
+G1 X13.338 Y-5.938 E705.68638
+G1 X13.630 Y-5.232 E705.70638
+G1 X13.885 Y-4.512 E705.72638
+G1 X14.103 Y-3.779 E705.74638
+G1 X14.281 Y-3.036 E705.76638
+G1 X14.420 Y-2.284 E705.78638
+G1 X14.520 Y-1.526 E705.80638
+G1 X14.580 Y-0.764 E705.82638
+G1 X14.600 Y-0.000 E705.84638
+G1 X5.713 Y-13.000 E705.84638 F7800
+G1 X-5.713 Y-13.000 E706.30343 F3600
+G1 X-7.592 Y-12.000 E706.30343 F7800
+G1 X7.592 Y-12.000 E706.91080 F3600
+G1 X8.980 Y-11.000 E706.91080 F7800
+G1 X-8.980 Y-11.000 E707.62920 F3600
+G1 X-10.082 Y-10.000 E707.62920 F7800
+G1 X10.082 Y-10.000 E708.43573 F3600
+G1 X10.984 Y-9.000 E708.43573 F7800
+G1 X-10.984 Y-9.000 E709.31442 F3600
+G1 X-11.732 Y-8.000 E709.31442 F7800
+G1 X11.732 Y-8.000 E710.25298 F3600
+G1 X12.355 Y-7.000 E710.25298 F7800
+G1 X-12.355 Y-7.000 E711.24136 F3600
+G1 X-12.870 Y-6.000 E711.24136 F7800
+G1 X12.870 Y-6.000 E712.27097 F3600
+G1 X13.291 Y-5.000 E712.27097 F7800
+G1 X-13.291 Y-5.000 E713.33422 F3600
+G1 X-13.625 Y-4.000 E713.33422 F7800
+G1 X13.625 Y-4.000 E714.42422 F3600
+G1 X13.879 Y-3.000 E714.42422 F7800
+G1 X-13.879 Y-3.000 E715.53458 F3600
+G1 X-14.058 Y-2.000 E715.53458 F7800
+G1 X14.058 Y-2.000 E716.65925 F3600
+G1 X14.165 Y-1.000 E716.65925 F7800
+G1 X-14.165 Y-1.000 E717.79243 F3600
+G1 X-14.200 Y0.000 E717.79243 F7800
+G1 X14.200 Y0.000 E718.92843 F3600
+G1 X14.165 Y1.000 E718.92843 F7800
+G1 X-14.165 Y1.000 E720.06161 F3600
+G1 X-14.058 Y2.000 E720.06161 F7800
+G1 X14.058 Y2.000 E721.18629 F3600
+G1 X13.879 Y3.000 E721.18629 F7800
+G1 X-13.879 Y3.000 E722.29665 F3600
+G1 X-13.625 Y4.000 E722.29665 F7800
+G1 X13.625 Y4.000 E723.38665 F3600
+G1 X13.291 Y5.000 E723.38665 F7800
+G1 X-13.291 Y5.000 E724.44989 F3600
+G1 X-12.870 Y6.000 E724.44989 F7800
+G1 X12.870 Y6.000 E725.47950 F3600
+G1 X12.355 Y7.000 E725.47950 F7800
+G1 X-12.355 Y7.000 E726.46788 F3600
+G1 X-11.732 Y8.000 E726.46788 F7800
+G1 X11.732 Y8.000 E727.40644 F3600
+G1 X10.984 Y9.000 E727.40644 F7800
+G1 X-10.984 Y9.000 E728.28513 F3600
+G1 X-10.082 Y10.000 E728.28513 F7800
+G1 X10.082 Y10.000 E729.09167 F3600
+G1 X8.980 Y11.000 E729.09167 F7800
+G1 X-8.980 Y11.000 E729.81007 F3600
+G1 X-7.592 Y12.000 E729.81007 F7800
+G1 X7.592 Y12.000 E730.41743 F3600
+G1 X5.713 Y13.000 E730.41743 F7800
+G1 X-5.713 Y13.000 E730.87449 F3600
+G1 Z5.100 F7800
+G1 E729.87449 F2400
+G1 E730.87449 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E730.89449 F1800
+G1 X14.918 Y1.568 E730.91449
+G1 X14.815 Y2.347 E730.93449
+G1 X14.672 Y3.119 E730.95449
+G1 X14.489 Y3.882 E730.97449
+G1 X14.266 Y4.635 E730.99449
+G1 X14.004 Y5.376 E731.01449
+G1 X13.703 Y6.101 E731.03449
+G1 X13.365 Y6.810 E731.05449
+G1 X12.990 Y7.500 E731.07449
+G1 X12.580 Y8.170 E731.09449
+G1 X12.135 Y8.817 E731.11449
+G1 X11.657 Y9.440 E731.13449
+G1 X11.147 Y10.037 E731.15449
+G1 X10.607 Y10.607 E731.17449
+G1 X10.037 Y11.147 E731.19449
+G1 X9.440 Y11.657 E731.21449
+G1 X8.817 Y12.135 E731.23449
+G1 X8.170 Y12.580 E731.25449
+G1 X7.500 Y12.990 E731.27449
+G1 X6.810 Y13.365 E731.29449
+G1 X6.101 Y13.703 E731.31449
+G1 X5.376 Y14.004 E731.33449
+G1 X4.635 Y14.266 E731.35449
+G1 X3.882 Y14.489 E731.37449
+G1 X3.119 Y14.672 E731.39449
+G1 X2.347 Y14.815 E731.41449
+G1 X1.568 Y14.918 E731.43449
+G1 X0.785 Y14.979 E731.45449
+G1 X0.000 Y15.000 E731.47449
+G1 X-0.785 Y14.979 E731.49449
+G1 X-1.568 Y14.918 E731.51449
+G1 X-2.347 Y14.815 E731.53449
+G1 X-3.119 Y14.672 E731.55449
+G1 X-3.882 Y14.489 E731.57449
+G1 X-4.635 Y14.266 E731.59449
+G1 X-5.376 Y14.004 E731.61449
+G1 X-6.101 Y13.703 E731.63449
+G1 X-6.810 Y13.365 E731.65449
+G1 X-7.500 Y12.990 E731.67449
+G1 X-8.170 Y12.580 E731.69449
+G1 X-8.817 Y12.135 E731.71449
+G1 X-9.440 Y11.657 E731.73449
+G1 X-10.037 Y11.147 E731.75449
+G1 X-10.607 Y10.607 E731.77449
+G1 X-11.147 Y10.037 E731.79449
+G1 X-11.657 Y9.440 E731.81449
+G1 X-12.135 Y8.817 E731.83449
+G1 X-12.580 Y8.170 E731.85449
+G1 X-12.990 Y7.500 E731.87449
+G1 X-13.365 Y6.810 E731.89449
+G1 X-13.703 Y6.101 E731.91449
+G1 X-14.004 Y5.376 E731.93449
+G1 X-14.266 Y4.635 E731.95449
+G1 X-14.489 Y3.882 E731.97449
+G1 X-14.672 Y3.119 E731.99449
+G1 X-14.815 Y2.347 E732.01449
+G1 X-14.918 Y1.568 E732.03449
+G1 X-14.979 Y0.785 E732.05449
+G1 X-15.000 Y0.000 E732.07449
+G1 X-14.979 Y-0.785 E732.09449
+G1 X-14.918 Y-1.568 E732.11449
+G1 X-14.815 Y-2.347 E732.13449
+G1 X-14.672 Y-3.119 E732.15449
+G1 X-14.489 Y-3.882 E732.17449
+G1 X-14.266 Y-4.635 E732.19449
+G1 X-14.004 Y-5.376 E732.21449
+G1 X-13.703 Y-6.101 E732.23449
+G1 X-13.365 Y-6.810 E732.25449
+G1 X-12.990 Y-7.500 E732.27449
+G1 X-12.580 Y-8.170 E732.29449
+G1 X-12.135 Y-8.817 E732.31449
+G1 X-11.657 Y-9.440 E732.33449
+G1 X-11.147 Y-10.037 E732.35449
+G1 X-10.607 Y-10.607 E732.37449
+G1 X-10.037 Y-11.147 E732.39449
+G1 X-9.440 Y-11.657 E732.41449
+G1 X-8.817 Y-12.135 E732.43449
+G1 X-8.170 Y-12.580 E732.45449
+G1 X-7.500 Y-12.990 E732.47449
+G1 X-6.810 Y-13.365 E732.49449
+G1 X-6.101 Y-13.703 E732.51449
+G1 X-5.376 Y-14.004 E732.53449
+G1 X-4.635 Y-14.266 E732.55449
+G1 X-3.882 Y-14.489 E732.57449
+G1 X-3.119 Y-14.672 E732.59449
+G1 X-2.347 Y-14.815 E732.61449
+G1 X-1.568 Y-14.918 E732.63449
+G1 X-0.785 Y-14.979 E732.65449
+G1 X-0.000 Y-15.000 E732.67449
+G1 X0.785 Y-14.979 E732.69449
+G1 X1.568 Y-14.918 E732.71449
+G1 X2.347 Y-14.815 E732.73449
+G1 X3.119 Y-14.672 E732.75449
+G1 X3.882 Y-14.489 E732.77449
+G1 X4.635 Y-14.266 E732.79449
+G1 X5.376 Y-14.004 E732.81449
+G1 X6.101 Y-13.703 E732.83449
+G1 X6.810 Y-13.365 E732.85449
+G1 X7.500 Y-12.990 E732.87449
+G1 X8.170 Y-12.580 E732.89449
+G1 X8.817 Y-12.135 E732.91449
+G1 X9.440 Y-11.657 E732.93449
+G1 X10.037 Y-11.147 E732.95449
+G1 X10.607 Y-10.607 E732.97449
+G1 X11.147 Y-10.037 E732.99449
+G1 X11.657 Y-9.440 E733.01449
+G1 X12.135 Y-8.817 E733.03449
+G1 X12.580 Y-8.170 E733.05449
+G1 X12.990 Y-7.500 E733.07449
+G1 X13.365 Y-6.810 E733.09449
+G1 X13.703 Y-6.101 E733.11449
+G1 X14.004 Y-5.376 E733.13449
+G1 X14.266 Y-4.635 E733.15449
+G1 X14.489 Y-3.882 E733.17449
+G1 X14.672 Y-3.119 E733.19449
+G1 X14.815 Y-2.347 E733.21449
+G1 X14.918 Y-1.568 E733.23449
+G1 X14.979 Y-0.785 E733.25449
+G1 X15.000 Y-0.000 E733.27449
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E733.29449 F1800
+G1 X14.520 Y1.526 E733.31449
+G1 X14.420 Y2.284 E733.33449
+G1 X14.281 Y3.036 E733.35449
+G1 X14.103 Y3.779 E733.37449
+G1 X13.885 Y4.512 E733.39449
+G1 X13.630 Y5.232 E733.41449
+G1 X13.338 Y5.938 E733.43449
+G1 X13.009 Y6.628 E733.45449
+G1 X12.644 Y7.300 E733.47449
+G1 X12.245 Y7.952 E733.49449
+G1 X11.812 Y8.582 E733.51449
+G1 X11.346 Y9.188 E733.53449
+G1 X10.850 Y9.769 E733.55449
+G1 X10.324 Y10.324 E733.57449
+G1 X9.769 Y10.850 E733.59449
+G1 X9.188 Y11.346 E733.61449
+G1 X8.582 Y11.812 E733.63449
+G1 X7.952 Y12.245 E733.65449
+G1 X7.300 Y12.644 E733.67449
+G1 X6.628 Y13.009 E733.69449
+G1 X5.938 Y13.338 E733.71449
+G1 X5.232 Y13.630 E733.73449
+G1 X4.512 Y13.885 E733.75449
+G1 X3.779 Y14.103 E733.77449
+G1 X3.036 Y14.281 E733.79449
+G1 X2.284 Y14.420 E733.81449
+G1 X1.526 Y14.520 E733.83449
+G1 X0.764 Y14.580 E733.85449
+G1 X0.000 Y14.600 E733.87449
+G1 X-0.764 Y14.580 E733.89449
+G1 X-1.526 Y14.520 E733.91449
+G1 X-2.284 Y14.420 E733.93449
+G1 X-3.036 Y14.281 E733.95449
+G1 X-3.779 Y14.103 E733.97449
+G1 X-4.512 Y13.885 E733.99449
+G1 X-5.232 Y13.630 E734.01449
+G1 X-5.938 Y13.338 E734.03449
+G1 X-6.628 Y13.009 E734.05449
+G1 X-7.300 Y12.644 E734.07449
+G1 X-7.952 Y12.245 E734.09449
+G1 X-8.582 Y11.812 E734.11449
+G1 X-9.188 Y11.346 E734.13449
+G1 X-9.769 Y10.850 E734.15449
+G1 X-10.324 Y10.324 E734.17449
+G1 X-10.850 Y9.769 E734.19449
+G1 X-11.346 Y9.188 E734.21449
+G1 X-11.812 Y8.582 E734.23449
+G1 X-12.245 Y7.952 E734.25449
+G1 X-12.644 Y7.300 E734.27449
+G1 X-13.009 Y6.628 E734.29449
+G1 X-13.338 Y5.938 E734.31449
+G1 X-13.630 Y5.232 E734.33449
+G1 X-13.885 Y4.512 E734.35449
+G1 X-14.103 Y3.779 E734.37449
+G1 X-14.281 Y3.036 E734.39449
+G1 X-14.420 Y2.284 E734.41449
+G1 X-14.520 Y1.526 E734.43449
+G1 X-14.580 Y0.764 E734.45449
+G1 X-14.600 Y0.000 E734.47449
+G1 X-14.580 Y-0.764 E734.49449
+G1 X-14.520 Y-1.526 E734.51449
+G1 X-14.420 Y-2.284 E734.53449
+G1 X-14.281 Y-3.036 E734.55449
+G1 X-14.103 Y-3.779 E734.57449
+G1 X-13.885 Y-4.512 E734.59449
+G1 X-13.630 Y-5.232 E734.61449
+G1 X-13.338 Y-5.938 E734.63449
+G1 X-13.009 Y-6.628 E734.65449
+G1 X-12.644 Y-7.300 E734.67449
+G1 X-12.245 Y-7.952 E734.69449
+G1 X-11.812 Y-8.582 E734.71449
+G1 X-11.346 Y-9.188 E734.73449
+G1 X-10.850 Y-9.769 E734.75449
+G1 X-10.324 Y-10.324 E734.77449
+G1 X-9.769 Y-10.850 E734.79449
+G1 X-9.188 Y-11.346 E734.81449
+G1 X-8.582 Y-11.812 E734.83449
+G1 X-7.952 Y-12.245 E734.85449
+G1 X-7.300 Y-12.644 E734.87449
+G1 X-6.628 Y-13.009 E734.89449
+G1 X-5.938 Y-13.338 E734.91449
+G1 X-5.232 Y-13.630 E734.93449
+G1 X-4.512 Y-13.885 E734.95449
+G1 X-3.779 Y-14.103 E734.97449
+G1 X-3.036 Y-14.281 E734.99449
+G1 X-2.284 Y-14.420 E735.01449
+G1 X-1.526 Y-14.520 E735.03449
+G1 X-0.764 Y-14.580 E735.05449
+G1 X-0.000 Y-14.600 E735.07449
+G1 X0.764 Y-14.580 E735.09449
+G1 X1.526 Y-14.520 E735.11449
+G1 X2.284 Y-14.420 E735.13449
+G1 X3.036 Y-14.281 E735.15449
+G1 X3.779 Y-14.103 E735.17449
+G1 X4.512 Y-13.885 E735.19449
+G1 X5.232 Y-13.630 E735.21449
+G1 X5.938 Y-13.338 E735.23449
+G1 X6.628 Y-13.009 E735.25449
+G1 X7.300 Y-12.644 E735.27449
+G1 X7.952 Y-12.245 E735.29449
+G1 X8.582 Y-11.812 E735.31449
+G1 X9.188 Y-11.346 E735.33449
+G1 X9.769 Y-10.850 E735.35449
+G1 X10.324 Y-10.324 E735.37449
+G1 X10.850 Y-9.769 E735.39449
+G1 X11.346 Y-9.188 E735.41449
+G1 X11.812 Y-8.582 E735.43449
+G1 X12.245 Y-7.952 E735.45449
+G1 X12.644 Y-7.300 E735.47449
+G1 X13.009 Y-6.628 E735.49449
+G1 X13.338 Y-5.938 E735.51449
+G1 X13.630 Y-5.232 E735.53449
+G1 X13.885 Y-4.512 E735.55449
+G1 X14.103 Y-3.779 E735.57449
+G1 X14.281 Y-3.036 E735.59449
+G1 X14.420 Y-2.284 E735.61449
+G1 X14.520 Y-1.526 E735.63449
+G1 X14.580 Y-0.764 E735.65449
+G1 X14.600 Y-0.000 E735.67449
+G1 X5.713 Y-13.000 E735.67449 F7800
+G1 X-5.713 Y-13.000 E736.13154 F3600
+G1 X-7.592 Y-12.000 E736.13154 F7800
+G1 X7.592 Y-12.000 E736.73891 F3600
+G1 X8.980 Y-11.000 E736.73891 F7800
+G1 X-8.980 Y-11.000 E737.45730 F3600
+G1 X-10.082 Y-10.000 E737.45730 F7800
+G1 X10.082 Y-10.000 E738.26384 F3600
+G1 X10.984 Y-9.000 E738.26384 F7800
+G1 X-10.984 Y-9.000 E739.14253 F3600
+G1 X-11.732 Y-8.000 E739.14253 F7800
+G1 X11.732 Y-8.000 E740.08109 F3600
+G1 X12.355 Y-7.000 E740.08109 F7800
+G1 X-12.355 Y-7.000 E741.06947 F3600
+G1 X-12.870 Y-6.000 E741.06947 F7800
+G1 X12.870 Y-6.000 E742.09908 F3600
+G1 X13.291 Y-5.000 E742.09908 F7800
+G1 X-13.291 Y-5.000 E743.16233 F3600
+G1 X-13.625 Y-4.000 E743.16233 F7800
+G1 X13.625 Y-4.000 E744.25232 F3600
+G1 X13.879 Y-3.000 E744.25232 F7800
+G1 X-13.879 Y-3.000 E745.36268 F3600
+G1 X-14.058 Y-2.000 E745.36268 F7800
+G1 X14.058 Y-2.000 E746.48736 F3600
+G1 X14.165 Y-1.000 E746.48736 F7800
+G1 X-14.165 Y-1.000 E747.62054 F3600
+G1 X-14.200 Y0.000 E747.62054 F7800
+G1 X14.200 Y0.000 E748.75654 F3600
+G1 X14.165 Y1.000 E748.75654 F7800
+G1 X-14.165 Y1.000 E749.88972 F3600
+G1 X-14.058 Y2.000 E749.88972 F7800
+G1 X14.058 Y2.000 E751.01439 F3600
+G1 X13.879 Y3.000 E751.01439 F7800
+G1 X-13.879 Y3.000 E752.12475 F3600
+G1 X-13.625 Y4.000 E752.12475 F7800
+G1 X13.625 Y4.000 E753.21475 F3600
+G1 X13.291 Y5.000 E753.21475 F7800
+G1 X-13.291 Y5.000 E754.27800 F3600
+G1 X-12.870 Y6.000 E754.27800 F7800
+G1 X12.870 Y6.000 E755.30761 F3600
+G1 X12.355 Y7.000 E755.30761 F7800
+G1 X-12.355 Y7.000 E756.29599 F3600
+G1 X-11.732 Y8.000 E756.29599 F7800
+G1 X11.732 Y8.000 E757.23455 F3600
+G1 X10.984 Y9.000 E757.23455 F7800
+G1 X-10.984 Y9.000 E758.11324 F3600
+G1 X-10.082 Y10.000 E758.11324 F7800
+G1 X10.082 Y10.000 E758.91977 F3600
+G1 X8.980 Y11.000 E758.91977 F7800
+G1 X-8.980 Y11.000 E759.63817 F3600
+G1 X-7.592 Y12.000 E759.63817 F7800
+G1 X7.592 Y12.000 E760.24554 F3600
+G1 X5.713 Y13.000 E760.24554 F7800
+G1 X-5.713 Y13.000 E760.70259 F3600
+G1 Z5.300 F7800
+G1 E759.70259 F2400
+G1 E760.70259 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E760.72259 F1800
+G1 X14.918 Y1.568 E760.74259
+G1 X14.815 Y2.347 E760.76259
+G1 X14.672 Y3.119 E760.78259
+G1 X14.489 Y3.882 E760.80259
+G1 X14.266 Y4.635 E760.82259
+G1 X14.004 Y5.376 E760.84259
+G1 X13.703 Y6.101 E760.86259
+G1 X13.365 Y6.810 E760.88259
+G1 X12.990 Y7.500 E760.90259
+G1 X12.580 Y8.170 E760.92259
+G1 X12.135 Y8.817 E760.94259
+G1 X11.657 Y9.440 E760.96259
+G1 X11.147 Y10.037 E760.98259
+G1 X10.607 Y10.607 E761.00259
+G1 X10.037 Y11.147 E761.02259
+G1 X9.440 Y11.657 E761.04259
+G1 X8.817 Y12.135 E761.06259
+G1 X8.170 Y12.580 E761.08259
+G1 X7.500 Y12.990 E761.10259
+G1 X6.810 Y13.365 E761.12259
+G1 X6.101 Y13.703 E761.14259
+G1 X5.376 Y14.004 E761.16259
+G1 X4.635 Y14.266 E761.18259
+G1 X3.882 Y14.489 E761.20259
+G1 X3.119 Y14.672 E761.22259
+G1 X2.347 Y14.815 E761.24259
+G1 X1.568 Y14.918 E761.26259
+G1 X0.785 Y14.979 E761.28259
+G1 X0.000 Y15.000 E761.30259
+G1 X-0.785 Y14.979 E761.32259
+G1 X-1.568 Y14.918 E761.34259
+G1 X-2.347 Y14.815 E761.36259
+G1 X-3.119 Y14.672 E761.38259
+G1 X-3.882 Y14.489 E761.40259
+G1 X-4.635 Y14.266 E761.42259
+G1 X-5.376 Y14.004 E761.44259
+G1 X-6.101 Y13.703 E761.46259
+G1 X-6.810 Y13.365 E761.48259
+G1 X-7.500 Y12.990 E761.50259
+G1 X-8.170 Y12.580 E761.52259
+G1 X-8.817 Y12.135 E761.54259
+G1 X-9.440 Y11.657 E761.56259
+G1 X-10.037 Y11.147 E761.58259
+G1 X-10.607 Y10.607 E761.60259
+G1 X-11.147 Y10.037 E761.62259
+G1 X-11.657 Y9.440 E761.64259
+G1 X-12.135 Y8.817 E761.66259
+G1 X-12.580 Y8.170 E761.68259
+G1 X-12.990 Y7.500 E761.70259
+G1 X-13.365 Y6.810 E761.72259
+G1 X-13.703 Y6.101 E761.74259
+G1 X-14.004 Y5.376 E761.76259
+G1 X-14.266 Y4.635 E761.78259
+G1 X-14.489 Y3.882 E761.80259
+G1 X-14.672 Y3.119 E761.82259
+G1 X-14.815 Y2.347 E761.84259
+G1 X-14.918 Y1.568 E761.86259
+G1 X-14.979 Y0.785 E761.88259
+G1 X-15.000 Y0.000 E761.90259
+G1 X-14.979 Y-0.785 E761.92259
+G1 X-14.918 Y-1.568 E761.94259
+G1 X-14.815 Y-2.347 E761.96259
+G1 X-14.672 Y-3.119 E761.98259
+G1 X-14.489 Y-3.882 E762.00259
+G1 X-14.266 Y-4.635 E762.02259
+G1 X-14.004 Y-5.376 E762.04259
+G1 X-13.703 Y-6.101 E762.06259
+G1 X-13.365 Y-6.810 E762.08259
+G1 X-12.990 Y-7.500 E762.10259
+G1 X-12.580 Y-8.170 E762.12259
+G1 X-12.135 Y-8.817 E762.14259
+G1 X-11.657 Y-9.440 E762.16259
+G1 X-11.147 Y-10.037 E762.18259
+G1 X-10.607 Y-10.607 E762.20259
+G1 X-10.037 Y-11.147 E762.22259
+G1 X-9.440 Y-11.657 E762.24259
+G1 X-8.817 Y-12.135 E762.26259
+G1 X-8.170 Y-12.580 E762.28259
+G1 X-7.500 Y-12.990 E762.30259
+G1 X-6.810 Y-13.365 E762.32259
+G1 X-6.101 Y-13.703 E762.34259
+G1 X-5.376 Y-14.004 E762.36259
+G1 X-4.635 Y-14.266 E762.38259
+G1 X-3.882 Y-14.489 E762.40259
+G1 X-3.119 Y-14.672 E762.42259
+G1 X-2.347 Y-14.815 E762.44259
+G1 X-1.568 Y-14.918 E762.46259
+G1 X-0.785 Y-14.979 E762.48259
+G1 X-0.000 Y-15.000 E762.50259
+G1 X0.785 Y-14.979 E762.52259
+G1 X1.568 Y-14.918 E762.54259
+G1 X2.347 Y-14.815 E762.56259
+G1 X3.119 Y-14.672 E762.58259
+G1 X3.882 Y-14.489 E762.60259
+G1 X4.635 Y-14.266 E762.62259
+G1 X5.376 Y-14.004 E762.64259
+G1 X6.101 Y-13.703 E762.66259
+G1 X6.810 Y-13.365 E762.68259
+G1 X7.500 Y-12.990 E762.70259
+G1 X8.170 Y-12.580 E762.72259
+G1 X8.817 Y-12.135 E762.74259
+G1 X9.440 Y-11.657 E762.76259
+G1 X10.037 Y-11.147 E762.78259
+G1 X10.607 Y-10.607 E762.80259
+G1 X11.147 Y-10.037 E762.82259
+G1 X11.657 Y-9.440 E762.84259
+G1 X12.135 Y-8.817 E762.86259
+G1 X12.580 Y-8.170 E762.88259
+G1 X12.990 Y-7.500 E762.90259
+G1 X13.365 Y-6.810 E762.92259
+G1 X13.703 Y-6.101 E762.94259
+G1 X14.004 Y-5.376 E762.96259
+G1 X14.266 Y-4.635 E762.98259
+G1 X14.489 Y-3.882 E763.00259
+G1 X14.672 Y-3.119 E763.02259
+G1 X14.815 Y-2.347 E763.04259
+G1 X14.918 Y-1.568 E763.06259
+G1 X14.979 Y-0.785 E763.08259
+G1 X15.000 Y-0.000 E763.10259
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E763.12259 F1800
+G1 X14.520 Y1.526 E763.14259
+G1 X14.420 Y2.284 E763.16259
+G1 X14.281 Y3.036 E763.18259
+G1 X14.103 Y3.779 E763.20259
+G1 X13.885 Y4.512 E763.22259
+G1 X13.630 Y5.232 E763.24259
+G1 X13.338 Y5.938 E763.26259
+G1 X13.009 Y6.628 E763.28259
+G1 X12.644 Y7.300 E763.30259
+G1 X12.245 Y7.952 E763.32259
+G1 X11.812 Y8.582 E763.34259
+G1 X11.346 Y9.188 E763.36259
+G1 X10.850 Y9.769 E763.38259
+G1 X10.324 Y10.324 E763.40259
+G1 X9.769 Y10.850 E763.42259
+G1 X9.188 Y11.346 E763.44259
+G1 X8.582 Y11.812 E763.46259
+G1 X7.952 Y12.245 E763.48259
+G1 X7.300 Y12.644 E763.50259
+G1 X6.628 Y13.009 E763.52259
+G1 X5.938 Y13.338 E763.54259
+G1 X5.232 Y13.630 E763.56259
+G1 X4.512 Y13.885 E763.58259
+G1 X3.779 Y14.103 E763.60259
+G1 X3.036 Y14.281 E763.62259
+G1 X2.284 Y14.420 E763.64259
+G1 X1.526 Y14.520 E763.66259
+G1 X0.764 Y14.580 E763.68259
+G1 X0.000 Y14.600 E763.70259
+G1 X-0.764 Y14.580 E763.72259
+G1 X-1.526 Y14.520 E763.74259
+G1 X-2.284 Y14.420 E763.76259
+G1 X-3.036 Y14.281 E763.78259
+G1 X-3.779 Y14.103 E763.80259
+G1 X-4.512 Y13.885 E763.82259
+G1 X-5.232 Y13.630 E763.84259
+G1 X-5.938 Y13.338 E763.86259
+G1 X-6.628 Y13.009 E763.88259
+G1 X-7.300 Y12.644 E763.90259
+G1 X-7.952 Y12.245 E763.92259
+G1 X-8.582 Y11.812 E763.94259
+G1 X-9.188 Y11.346 E763.96259
+G1 X-9.769 Y10.850 E763.98259
+G1 X-10.324 Y10.324 E764.00259
+G1 X-10.850 Y9.769 E764.02259
+G1 X-11.346 Y9.188 E764.04259
+G1 X-11.812 Y8.582 E764.06259
+G1 X-12.245 Y7.952 E764.08259
+G1 X-12.644 Y7.300 E764.10259
+G1 X-13.009 Y6.628 E764.12259
+G1 X-13.338 Y5.938 E764.14259
+G1 X-13.630 Y5.232 E764.16259
+G1 X-13.885 Y4.512 E764.18259
+G1 X-14.103 Y3.779 E764.20259
+G1 X-14.281 Y3.036 E764.22259
+G1 X-14.420 Y2.284 E764.24259
+G1 X-14.520 Y1.526 E764.26259
+G1 X-14.580 Y0.764 E764.28259
+G1 X-14.600 Y0.000 E764.30259
+G1 X-14.580 Y-0.764 E764.32259
+G1 X-14.520 Y-1.526 E764.34259
+G1 X-14.420 Y-2.284 E764.36259
+G1 X-14.281 Y-3.036 E764.38259
+G1 X-14.103 Y-3.779 E764.40259
+G1 X-13.885 Y-4.512 E764.42259
+G1 X-13.630 Y-5.232 E764.44259
+G1 X-13.338 Y-5.938 E764.46259
+G1 X-13.009 Y-6.628 E764.48259
+G1 X-12.644 Y-7.300 E764.50259
+G1 X-12.245 Y-7.952 E764.52259
+G1 X-11.812 Y-8.582 E764.54259
+G1 X-11.346 Y-9.188 E764.56259
+G1 X-10.850 Y-9.769 E764.58259
+G1 X-10.324 Y-10.324 E764.60259
+G1 X-9.769 Y-10.850 E764.62259
+G1 X-9.188 Y-11.346 E764.64259
+G1 X-8.582 Y-11.812 E764.66259
+G1 X-7.952 Y-12.245 E764.68259
+G1 X-7.300 Y-12.644 E764.70259
+G1 X-6.628 Y-13.009 E764.72259
+G1 X-5.938 Y-13.338 E764.74259
+G1 X-5.232 Y-13.630 E764.76259
+G1 X-4.512 Y-13.885 E764.78259
+G1 X-3.779 Y-14.103 E764.80259
+G1 X-3.036 Y-14.281 E764.82259
+G1 X-2.284 Y-14.420 E764.84259
+G1 X-1.526 Y-14.520 E764.86259
+G1 X-0.764 Y-14.580 E764.88259
+G1 X-0.000 Y-14.600 E764.90259
+G1 X0.764 Y-14.580 E764.92259
+G1 X1.526 Y-14.520 E764.94259
+G1 X2.284 Y-14.420 E764.96259
+G1 X3.036 Y-14.281 E764.98259
+G1 X3.779 Y-14.103 E765.00259
+G1 X4.512 Y-13.885 E765.02259
+G1 X5.232 Y-13.630 E765.04259
+G1 X5.938 Y-13.338 E765.06259
+G1 X6.628 Y-13.009 E765.08259
+G1 X7.300 Y-12.644 E765.10259
+G1 X7.952 Y-12.245 E765.12259
+G1 X8.582 Y-11.812 E765.14259
+G1 X9.188 Y-11.346 E765.16259
+G1 X9.769 Y-10.850 E765.18259
+G1 X10.324 Y-10.324 E765.20259
+G1 X10.850 Y-9.769 E765.22259
+G1 X11.346 Y-9.188 E765.24259
+G1 X11.812 Y-8.582 E765.26259
+G1 X12.245 Y-7.952 E765.28259
+G1 X12.644 Y-7.300 E765.30259
+G1 X13.009 Y-6.628 E765.32259
+G1 X13.338 Y-5.938 E765.34259
+G1 X13.630 Y-5.232 E765.36259
+G1 X13.885 Y-4.512 E765.38259
+G1 X14.103 Y-3.779 E765.40259
+G1 X14.281 Y-3.036 E765.42259
+G1 X14.420 Y-2.284 E765.44259
+G1 X14.520 Y-1.526 E765.46259
+G1 X14.580 Y-0.764 E765.48259
+G1 X14.600 Y-0.000 E765.50259
+G1 X5.713 Y-13.000 E765.50259 F7800
+G1 X-5.713 Y-13.000 E765.95964 F3600
+G1 X-7.592 Y-12.000 E765.95964 F7800
+G1 X7.592 Y-12.000 E766.56701 F3600
+G1 X8.980 Y-11.000 E766.56701 F7800
+G1 X-8.980 Y-11.000 E767.28541 F3600
+G1 X-10.082 Y-10.000 E767.28541 F7800
+G1 X10.082 Y-10.000 E768.09194 F3600
+G1 X10.984 Y-9.000 E768.09194 F7800
+G1 X-10.984 Y-9.000 E768.97063 F3600
+G1 X-11.732 Y-8.000 E768.97063 F7800
+G1 X11.732 Y-8.000 E769.90919 F3600
+G1 X12.355 Y-7.000 E769.90919 F7800
+G1 X-12.355 Y-7.000 E770.89757 F3600
+G1 X-12.870 Y-6.000 E770.89757 F7800
+G1 X12.870 Y-6.000 E771.92718 F3600
+G1 X13.291 Y-5.000 E771.92718 F7800
+G1 X-13.291 Y-5.000 E772.99043 F3600
+G1 X-13.625 Y-4.000 E772.99043 F7800
+G1 X13.625 Y-4.000 E774.08043 F3600
+G1 X13.879 Y-3.000 E774.08043 F7800
+G1 X-13.879 Y-3.000 E775.19079 F3600
+G1 X-14.058 Y-2.000 E775.19079 F7800
+G1 X14.058 Y-2.000 E776.31546 F3600
+G1 X14.165 Y-1.000 E776.31546 F7800
+G1 X-14.165 Y-1.000 E777.44864 F3600
+G1 X-14.200 Y0.000 E777.44864 F7800
+G1 X14.200 Y0.000 E778.58464 F3600
+G1 X14.165 Y1.000 E778.58464 F7800
+G1 X-14.165 Y1.000 E779.71782 F3600
+G1 X-14.058 Y2.000 E779.71782 F7800
+G1 X14.058 Y2.000 E780.84250 F3600
+G1 X13.879 Y3.000 E780.84250 F7800
+G1 X-13.879 Y3.000 E781.95286 F3600
+G1 X-13.625 Y4.000 E781.95286 F7800
+G1 X13.625 Y4.000 E783.04285 F3600
+G1 X13.291 Y5.000 E783.04285 F7800
+G1 X-13.291 Y5.000 E784.10610 F3600
+G1 X-12.870 Y6.000 E784.10610 F7800
+G1 X12.870 Y6.000 E785.13571 F3600
+G1 X12.355 Y7.000 E785.13571 F7800
+G1 X-12.355 Y7.000 E786.12409 F3600
+G1 X-11.732 Y8.000 E786.12409 F7800
+G1 X11.732 Y8.000 E787.06265 F3600
+G1 X10.984 Y9.000 E787.06265 F7800
+G1 X-10.984 Y9.000 E787.94134 F3600
+G1 X-10.082 Y10.000 E787.94134 F7800
+G1 X10.082 Y10.000 E788.74788 F3600
+G1 X8.980 Y11.000 E788.74788 F7800
+G1 X-8.980 Y11.000 E789.46627 F3600
+G1 X-7.592 Y12.000 E789.46627 F7800
+G1 X7.592 Y12.000 E790.07364 F3600
+G1 X5.713 Y13.000 E790.07364 F7800
+G1 X-5.713 Y13.000 E790.53069 F3600
+G1 X20.000 Y-10.000 E790.83069 F3000
+G1 X24.000 Y-10.000 E791.13069
+G1 X20.000 Y-8.000 E791.43069 F3000
+G1 X24.000 Y-8.000 E791.73069
+G1 X20.000 Y-6.000 E792.03069 F3000
+G1 X24.000 Y-6.000 E792.33069
+G1 X20.000 Y-4.000 E792.63069 F3000
+G1 X24.000 Y-4.000 E792.93069
+G1 X20.000 Y-2.000 E793.23069 F3000
+G1 X24.000 Y-2.000 E793.53069
+G1 X20.000 Y0.000 E793.83069 F3000
+G1 X24.000 Y0.000 E794.13069
+G1 X20.000 Y2.000 E794.43069 F3000
+G1 X24.000 Y2.000 E794.73069
+G1 X20.000 Y4.000 E795.03069 F3000
+G1 X24.000 Y4.000 E795.33069
+G1 X20.000 Y6.000 E795.63069 F3000
+G1 X24.000 Y6.000 E795.93069
+G1 X20.000 Y8.000 E796.23069 F3000
+G1 X24.000 Y8.000 E796.53069
+G1 Z5.500 F7800
+G1 E795.53069 F2400
+G1 E796.53069 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E796.55069 F1800
+G1 X14.918 Y1.568 E796.57069
+G1 X14.815 Y2.347 E796.59069
+G1 X14.672 Y3.119 E796.61069
+G1 X14.489 Y3.882 E796.63069
+G1 X14.266 Y4.635 E796.65069
+G1 X14.004 Y5.376 E796.67069
+G1 X13.703 Y6.101 E796.69069
+G1 X13.365 Y6.810 E796.71069
+G1 X12.990 Y7.500 E796.73069
+G1 X12.580 Y8.170 E796.75069
+G1 X12.135 Y8.817 E796.77069
+G1 X11.657 Y9.440 E796.79069
+G1 X11.147 Y10.037 E796.81069
+G1 X10.607 Y10.607 E796.83069
+G1 X10.037 Y11.147 E796.85069
+G1 X9.440 Y11.657 E796.87069
+G1 X8.817 Y12.135 E796.89069
+G1 X8.170 Y12.580 E796.91069
+G1 X7.500 Y12.990 E796.93069
+G1 X6.810 Y13.365 E796.95069
+G1 X6.101 Y13.703 E796.97069
+G1 X5.376 Y14.004 E796.99069
+G1 X4.635 Y14.266 E797.01069
+G1 X3.882 Y14.489 E797.03069
+G1 X3.119 Y14.672 E797.05069
+G1 X2.347 Y14.815 E797.07069
+G1 X1.568 Y14.918 E797.09069
+G1 X0.785 Y14.979 E797.11069
+G1 X0.000 Y15.000 E797.13069
+G1 X-0.785 Y14.979 E797.15069
+G1 X-1.568 Y14.918 E797.17069
+G1 X-2.347 Y14.815 E797.19069
+G1 X-3.119 Y14.672 E797.21069
+G1 X-3.882 Y14.489 E797.23069
+G1 X-4.635 Y14.266 E797.25069
+G1 X-5.376 Y14.004 E797.27069
+G1 X-6.101 Y13.703 E797.29069
+G1 X-6.810 Y13.365 E797.31069
+G1 X-7.500 Y12.990 E797.33069
+G1 X-8.170 Y12.580 E797.35069
+G1 X-8.817 Y12.135 E797.37069
+G1 X-9.440 Y11.657 E797.39069
+G1 X-10.037 Y11.147 E797.41069
+G1 X-10.607 Y10.607 E797.43069
+G1 X-11.147 Y10.037 E797.45069
+G1 X-11.657 Y9.440 E797.47069
+G1 X-12.135 Y8.817 E797.49069
+G1 X-12.580 Y8.170 E797.51069
+G1 X-12.990 Y7.500 E797.53069
+G1 X-13.365 Y6.810 E797.55069
+G1 X-13.703 Y6.101 E797.57069
+G1 X-14.004 Y5.376 E797.59069
+G1 X-14.266 Y4.635 E797.61069
+G1 X-14.489 Y3.882 E797.63069
+G1 X-14.672 Y3.119 E797.65069
+G1 X-14.815 Y2.347 E797.67069
+G1 X-14.918 Y1.568 E797.69069
+G1 X-14.979 Y0.785 E797.71069
+G1 X-15.000 Y0.000 E797.73069
+G1 X-14.979 Y-0.785 E797.75069
+G1 X-14.918 Y-1.568 E797.77069
+G1 X-14.815 Y-2.347 E797.79069
+G1 X-14.672 Y-3.119 E797.81069
+G1 X-14.489 Y-3.882 E797.83069
+G1 X-14.266 Y-4.635 E797.85069
+G1 X-14.004 Y-5.376 E797.87069
+G1 X-13.703 Y-6.101 E797.89069
+G1 X-13.365 Y-6.810 E797.91069
+G1 X-12.990 Y-7.500 E797.93069
+G1 X-12.580 Y-8.170 E797.95069
+G1 X-12.135 Y-8.817 E797.97069
+G1 X-11.657 Y-9.440 E797.99069
+G1 X-11.147 Y-10.037 E798.01069
+G1 X-10.607 Y-10.607 E798.03069
+G1 X-10.037 Y-11.147 E798.05069
+G1 X-9.440 Y-11.657 E798.07069
+G1 X-8.817 Y-12.135 E798.09069
+G1 X-8.170 Y-12.580 E798.11069
+G1 X-7.500 Y-12.990 E798.13069
+G1 X-6.810 Y-13.365 E798.15069
+G1 X-6.101 Y-13.703 E798.17069
+G1 X-5.376 Y-14.004 E798.19069
+G1 X-4.635 Y-14.266 E798.21069
+G1 X-3.882 Y-14.489 E798.23069
+G1 X-3.119 Y-14.672 E798.25069
+G1 X-2.347 Y-14.815 E798.27069
+G1 X-1.568 Y-14.918 E798.29069
+G1 X-0.785 Y-14.979 E798.31069
+G1 X-0.000 Y-15.000 E798.33069
+G1 X0.785 Y-14.979 E798.35069
+G1 X1.568 Y-14.918 E798.37069
+G1 X2.347 Y-14.815 E798.39069
+G1 X3.119 Y-14.672 E798.41069
+G1 X3.882 Y-14.489 E798.43069
+G1 X4.635 Y-14.266 E798.45069
+G1 X5.376 Y-14.004 E798.47069
+G1 X6.101 Y-13.703 E798.49069
+G1 X6.810 Y-13.365 E798.51069
+G1 X7.500 Y-12.990 E798.53069
+G1 X8.170 Y-12.580 E798.55069
+G1 X8.817 Y-12.135 E798.57069
+G1 X9.440 Y-11.657 E798.59069
+G1 X10.037 Y-11.147 E798.61069
+G1 X10.607 Y-10.607 E798.63069
+G1 X11.147 Y-10.037 E798.65069
+G1 X11.657 Y-9.440 E798.67069
+G1 X12.135 Y-8.817 E798.69069
+G1 X12.580 Y-8.170 E798.71069
+G1 X12.990 Y-7.500 E798.73069
+G1 X13.365 Y-6.810 E798.75069
+G1 X13.703 Y-6.101 E798.77069
+G1 X14.004 Y-5.376 E798.79069
+G1 X14.266 Y-4.635 E798.81069
+G1 X14.489 Y-3.882 E798.83069
+G1 X14.672 Y-3.119 E798.85069
+G1 X14.815 Y-2.347 E798.87069
+G1 X14.918 Y-1.568 E798.89069
+G1 X14.979 Y-0.785 E798.91069
+G1 X15.000 Y-0.000 E798.93069
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E798.95069 F1800
+G1 X14.520 Y1.526 E798.97069
+G1 X14.420 Y2.284 E798.99069
+G1 X14.281 Y3.036 E799.01069
+G1 X14.103 Y3.779 E799.03069
+G1 X13.885 Y4.512 E799.05069
+G1 X13.630 Y5.232 E799.07069
+G1 X13.338 Y5.938 E799.09069
+G1 X13.009 Y6.628 E799.11069
+G1 X12.644 Y7.300 E799.13069
+G1 X12.245 Y7.952 E799.15069
+G1 X11.812 Y8.582 E799.17069
+G1 X11.346 Y9.188 E799.19069
+G1 X10.850 Y9.769 E799.21069
+G1 X10.324 Y10.324 E799.23069
+G1 X9.769 Y10.850 E799.25069
+G1 X9.188 Y11.346 E799.27069
+G1 X8.582 Y11.812 E799.29069
+G1 X7.952 Y12.245 E799.31069
+G1 X7.300 Y12.644 E799.33069
+G1 X6.628 Y13.009 E799.35069
+G1 X5.938 Y13.338 E799.37069
+G1 X5.232 Y13.630 E799.39069
+G1 X4.512 Y13.885 E799.41069
+G1 X3.779 Y14.103 E799.43069
+G1 X3.036 Y14.281 E799.45069
+G1 X2.284 Y14.420 E799.47069
+G1 X1.526 Y14.520 E799.49069
+G1 X0.764 Y14.580 E799.51069
+G1 X0.000 Y14.600 E799.53069
+G1 X-0.764 Y14.580 E799.55069
+G1 X-1.526 Y14.520 E799.57069
+G1 X-2.284 Y14.420 E799.59069
+G1 X-3.036 Y14.281 E799.61069
+G1 X-3.779 Y14.103 E799.63069
+G1 X-4.512 Y13.885 E799.65069
+G1 X-5.232 Y13.630 E799.67069
+G1 X-5.938 Y13.338 E799.69069
+G1 X-6.628 Y13.009 E799.71069
+G1 X-7.300 Y12.644 E799.73069
+G1 X-7.952 Y12.245 E799.75069
+G1 X-8.582 Y11.812 E799.77069
+G1 X-9.188 Y11.346 E799.79069
+G1 X-9.769 Y10.850 E799.81069
+G1 X-10.324 Y10.324 E799.83069
+G1 X-10.850 Y9.769 E799.85069
+G1 X-11.346 Y9.188 E799.87069
+G1 X-11.812 Y8.582 E799.89069
+G1 X-12.245 Y7.952 E799.91069
+G1 X-12.644 Y7.300 E799.93069
+G1 X-13.009 Y6.628 E799.95069
+G1 X-13.338 Y5.938 E799.97069
+G1 X-13.630 Y5.232 E799.99069
+G1 X-13.885 Y4.512 E800.01069
+G1 X-14.103 Y3.779 E800.03069
+G1 X-14.281 Y3.036 E800.05069
+G1 X-14.420 Y2.284 E800.07069
+G1 X-14.520 Y1.526 E800.09069
+G1 X-14.580 Y0.764 E800.11069
+G1 X-14.600 Y0.000 E800.13069
+G1 X-14.580 Y-0.764 E800.15069
+G1 X-14.520 Y-1.526 E800.17069
+G1 X-14.420 Y-2.284 E800.19069
+G1 X-14.281 Y-3.036 E800.21069
+G1 X-14.103 Y-3.779 E800.23069
+G1 X-13.885 Y-4.512 E800.25069
+G1 X-13.630 Y-5.232 E800.27069
+G1 X-13.338 Y-5.938 E800.29069
+G1 X-13.009 Y-6.628 E800.31069
+G1 X-12.644 Y-7.300 E800.33069
+G1 X-12.245 Y-7.952 E800.35069
+G1 X-11.812 Y-8.582 E800.37069
+G1 X-11.346 Y-9.188 E800.39069
+G1 X-10.850 Y-9.769 E800.41069
+G1 X-10.324 Y-10.324 E800.43069
+G1 X-9.769 Y-10.850 E800.45069
+G1 X-9.188 Y-11.346 E800.47069
+G1 X-8.582 Y-11.812 E800.49069
+G1 X-7.952 Y-12.245 E800.51069
+G1 X-7.300 Y-12.644 E800.53069
+G1 X-6.628 Y-13.009 E800.55069
+G1 X-5.938 Y-13.338 E800.57069
+G1 X-5.232 Y-13.630 E800.59069
+G1 X-4.512 Y-13.885 E800.61069
+G1 X-3.779 Y-14.103 E800.63069
+G1 X-3.036 Y-14.281 E800.65069
+G1 X-2.284 Y-14.420 E800.67069
+G1 X-1.526 Y-14.520 E800.69069
+G1 X-0.764 Y-14.580 E800.71069
+G1 X-0.000 Y-14.600 E800.73069
+G1 X0.764 Y-14.580 E800.75069
+G1 X1.526 Y-14.520 E800.77069
+G1 X2.284 Y-14.420 E800.79069
+G1 X3.036 Y-14.281 E800.81069
+G1 X3.779 Y-14.103 E800.83069
+G1 X4.512 Y-13.885 E800.85069
+G1 X5.232 Y-13.630 E800.87069
+G1 X5.938 Y-13.338 E800.89069
+G1 X6.628 Y-13.009 E800.91069
+G1 X7.300 Y-12.644 E800.93069
+G1 X7.952 Y-12.245 E800.95069
+G1 X8.582 Y-11.812 E800.97069
+G1 X9.188 Y-11.346 E800.99069
+G1 X9.769 Y-10.850 E801.01069
+G1 X10.324 Y-10.324 E801.03069
+G1 X10.850 Y-9.769 E801.05069
+G1 X11.346 Y-9.188 E801.07069
+G1 X11.812 Y-8.582 E801.09069
+G1 X12.245 Y-7.952 E801.11069
+G1 X12.644 Y-7.300 E801.13069
+G1 X13.009 Y-6.628 E801.15069
+G1 X13.338 Y-5.938 E801.17069
+G1 X13.630 Y-5.232 E801.19069
+G1 X13.885 Y-4.512 E801.21069
+G1 X14.103 Y-3.779 E801.23069
+G1 X14.281 Y-3.036 E801.25069
+G1 X14.420 Y-2.284 E801.27069
+G1 X14.520 Y-1.526 E801.29069
+G1 X14.580 Y-0.764 E801.31069
+G1 X14.600 Y-0.000 E801.33069
+G1 X5.713 Y-13.000 E801.33069 F7800
+G1 X-5.713 Y-13.000 E801.78774 F3600
+G1 X-7.592 Y-12.000 E801.78774 F7800
+G1 X7.592 Y-12.000 E802.39511 F3600
+G1 X8.980 Y-11.000 E802.39511 F7800
+G1 X-8.980 Y-11.000 E803.11351 F3600
+G1 X-10.082 Y-10.000 E803.11351 F7800
+G1 X10.082 Y-10.000 E803.92004 F3600
+G1 X10.984 Y-9.000 E803.92004 F7800
+G1 X-10.984 Y-9.000 E804.79873 F3600
+G1 X-11.732 Y-8.000 E804.79873 F7800
+G1 X11.732 Y-8.000 E805.73729 F3600
+G1 X12.355 Y-7.000 E805.73729 F7800
+G1 X-12.355 Y-7.000 E806.72567 F3600
+G1 X-12.870 Y-6.000 E806.72567 F7800
+G1 X12.870 Y-6.000 E807.75528 F3600
+G1 X13.291 Y-5.000 E807.75528 F7800
+G1 X-13.291 Y-5.000 E808.81853 F3600
+G1 X-13.625 Y-4.000 E808.81853 F7800
+G1 X13.625 Y-4.000 E809.90853 F3600
+G1 X13.879 Y-3.000 E809.90853 F7800
+G1 X-13.879 Y-3.000 E811.01889 F3600
+G1 X-14.058 Y-2.000 E811.01889 F7800
+G1 X14.058 Y-2.000 E812.14357 F3600
+G1 X14.165 Y-1.000 E812.14357 F7800
+G1 X-14.165 Y-1.000 E813.27674 F3600
+G1 X-14.200 Y0.000 E813.27674 F7800
+G1 X14.200 Y0.000 E814.41274 F3600
+G1 X14.165 Y1.000 E814.41274 F7800
+G1 X-14.165 Y1.000 E815.54592 F3600
+G1 X-14.058 Y2.000 E815.54592 F7800
+G1 X14.058 Y2.000 E816.67060 F3600
+G1 X13.879 Y3.000 E816.67060 F7800
+G1 X-13.879 Y3.000 E817.78096 F3600
+G1 X-13.625 Y4.000 E817.78096 F7800
+G1 X13.625 Y4.000 E818.87096 F3600
+G1 X13.291 Y5.000 E818.87096 F7800
+G1 X-13.291 Y5.000 E819.93420 F3600
+G1 X-12.870 Y6.000 E819.93420 F7800
+G1 X12.870 Y6.000 E820.96381 F3600
+G1 X12.355 Y7.000 E820.96381 F7800
+G1 X-12.355 Y7.000 E821.95219 F3600
+G1 X-11.732 Y8.000 E821.95219 F7800
+G1 X11.732 Y8.000 E822.89076 F3600
+G1 X10.984 Y9.000 E822.89076 F7800
+G1 X-10.984 Y9.000 E823.76945 F3600
+G1 X-10.082 Y10.000 E823.76945 F7800
+G1 X10.082 Y10.000 E824.57598 F3600
+G1 X8.980 Y11.000 E824.57598 F7800
+G1 X-8.980 Y11.000 E825.29438 F3600
+G1 X-7.592 Y12.000 E825.29438 F7800
+G1 X7.592 Y12.000 E825.90175 F3600
+G1 X5.713 Y13.000 E825.90175 F7800
+G1 X-5.713 Y13.000 E826.35880 F3600
+G1 Z5.700 F7800
+G1 E825.35880 F2400
+G1 E826.35880 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E826.37880 F1800
+G1 X14.918 Y1.568 E826.39880
+G1 X14.815 Y2.347 E826.41880
+G1 X14.672 Y3.119 E826.43880
+G1 X14.489 Y3.882 E826.45880
+G1 X14.266 Y4.635 E826.47880
+G1 X14.004 Y5.376 E826.49880
+G1 X13.703 Y6.101 E826.51880
+G1 X13.365 Y6.810 E826.53880
+G1 X12.990 Y7.500 E826.55880
+G1 X12.580 Y8.170 E826.57880
+G1 X12.135 Y8.817 E826.59880
+G1 X11.657 Y9.440 E826.61880
+G1 X11.147 Y10.037 E826.63880
+G1 X10.607 Y10.607 E826.65880
+G1 X10.037 Y11.147 E826.67880
+G1 X9.440 Y11.657 E826.69880
+G1 X8.817 Y12.135 E826.71880
+G1 X8.170 Y12.580 E826.73880
+G1 X7.500 Y12.990 E826.75880
+G1 X6.810 Y13.365 E826.77880
+G1 X6.101 Y13.703 E826.79880
+G1 X5.376 Y14.004 E826.81880
+G1 X4.635 Y14.266 E826.83880
+G1 X3.882 Y14.489 E826.85880
+G1 X3.119 Y14.672 E826.87880
+G1 X2.347 Y14.815 E826.89880
+G1 X1.568 Y14.918 E826.91880
+G1 X0.785 Y14.979 E826.93880
+G1 X0.000 Y15.000 E826.95880
+G1 X-0.785 Y14.979 E826.97880
+G1 X-1.568 Y14.918 E826.99880
+G1 X-2.347 Y14.815 E827.01880
+G1 X-3.119 Y14.672 E827.03880
+G1 X-3.882 Y14.489 E827.05880
+G1 X-4.635 Y14.266 E827.07880
+G1 X-5.376 Y14.004 E827.09880
+G1 X-6.101 Y13.703 E827.11880
+G1 X-6.810 Y13.365 E827.13880
+G1 X-7.500 Y12.990 E827.15880
+G1 X-8.170 Y12.580 E827.17880
+G1 X-8.817 Y12.135 E827.19880
+G1 X-9.440 Y11.657 E827.21880
+G1 X-10.037 Y11.147 E827.23880
+G1 X-10.607 Y10.607 E827.25880
+G1 X-11.147 Y10.037 E827.27880
+G1 X-11.657 Y9.440 E827.29880
+G1 X-12.135 Y8.817 E827.31880
+G1 X-12.580 Y8.170 E827.33880
+G1 X-12.990 Y7.500 E827.35880
+G1 X-13.365 Y6.810 E827.37880
+G1 X-13.703 Y6.101 E827.39880
+G1 X-14.004 Y5.376 E827.41880
+G1 X-14.266 Y4.635 E827.43880
+G1 X-14.489 Y3.882 E827.45880
+G1 X-14.672 Y3.119 E827.47880
+G1 X-14.815 Y2.347 E827.49880
+G1 X-14.918 Y1.568 E827.51880
+G1 X-14.979 Y0.785 E827.53880
+G1 X-15.000 Y0.000 E827.55880
+G1 X-14.979 Y-0.785 E827.57880
+G1 X-14.918 Y-1.568 E827.59880
+G1 X-14.815 Y-2.347 E827.61880
+G1 X-14.672 Y-3.119 E827.63880
+G1 X-14.489 Y-3.882 E827.65880
+G1 X-14.266 Y-4.635 E827.67880
+G1 X-14.004 Y-5.376 E827.69880
+G1 X-13.703 Y-6.101 E827.71880
+G1 X-13.365 Y-6.810 E827.73880
+G1 X-12.990 Y-7.500 E827.75880
+G1 X-12.580 Y-8.170 E827.77880
+G1 X-12.135 Y-8.817 E827.79880
+G1 X-11.657 Y-9.440 E827.81880
+G1 X-11.147 Y-10.037 E827.83880
+G1 X-10.607 Y-10.607 E827.85880
+G1 X-10.037 Y-11.147 E827.87880
+G1 X-9.440 Y-11.657 E827.89880
+G1 X-8.817 Y-12.135 E827.91880
+G1 X-8.170 Y-12.580 E827.93880
+G1 X-7.500 Y-12.990 E827.95880
+G1 X-6.810 Y-13.365 E827.97880
+G1 X-6.101 Y-13.703 E827.99880
+G1 X-5.376 Y-14.004 E828.01880
+G1 X-4.635 Y-14.266 E828.03880
+G1 X-3.882 Y-14.489 E828.05880
+G1 X-3.119 Y-14.672 E828.07880
+G1 X-2.347 Y-14.815 E828.09880
+G1 X-1.568 Y-14.918 E828.11880
+G1 X-0.785 Y-14.979 E828.13880
+G1 X-0.000 Y-15.000 E828.15880
+G1 X0.785 Y-14.979 E828.17880
+G1 X1.568 Y-14.918 E828.19880
+G1 X2.347 Y-14.815 E828.21880
+G1 X3.119 Y-14.672 E828.23880
+G1 X3.882 Y-14.489 E828.25880
+G1 X4.635 Y-14.266 E828.27880
+G1 X5.376 Y-14.004 E828.29880
+G1 X6.101 Y-13.703 E828.31880
+G1 X6.810 Y-13.365 E828.33880
+G1 X7.500 Y-12.990 E828.35880
+G1 X8.170 Y-12.580 E828.37880
+G1 X8.817 Y-12.135 E828.39880
+G1 X9.440 Y-11.657 E828.41880
+G1 X10.037 Y-11.147 E828.43880
+G1 X10.607 Y-10.607 E828.45880
+G1 X11.147 Y-10.037 E828.47880
+G1 X11.657 Y-9.440 E828.49880
+G1 X12.135 Y-8.817 E828.51880
+G1 X12.580 Y-8.170 E828.53880
+G1 X12.990 Y-7.500 E828.55880
+G1 X13.365 Y-6.810 E828.57880
+G1 X13.703 Y-6.101 E828.59880
+G1 X14.004 Y-5.376 E828.61880
+G1 X14.266 Y-4.635 E828.63880
+G1 X14.489 Y-3.882 E828.65880
+G1 X14.672 Y-3.119 E828.67880
+G1 X14.815 Y-2.347 E828.69880
+G1 X14.918 Y-1.568 E828.71880
+G1 X14.979 Y-0.785 E828.73880
+G1 X15.000 Y-0.000 E828.75880
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E828.77880 F1800
+G1 X14.520 Y1.526 E828.79880
+G1 X14.420 Y2.284 E828.81880
+G1 X14.281 Y3.036 E828.83880
+G1 X14.103 Y3.779 E828.85880
+G1 X13.885 Y4.512 E828.87880
+G1 X13.630 Y5.232 E828.89880
+G1 X13.338 Y5.938 E828.91880
+G1 X13.009 Y6.628 E828.93880
+G1 X12.644 Y7.300 E828.95880
+G1 X12.245 Y7.952 E828.97880
+G1 X11.812 Y8.582 E828.99880
+G1 X11.346 Y9.188 E829.01880
+G1 X10.850 Y9.769 E829.03880
+G1 X10.324 Y10.324 E829.05880
+G1 X9.769 Y10.850 E829.07880
+G1 X9.188 Y11.346 E829.09880
+G1 X8.582 Y11.812 E829.11880
+G1 X7.952 Y12.245 E829.13880
+G1 X7.300 Y12.644 E829.15880
+G1 X6.628 Y13.009 E829.17880
+G1 X5.938 Y13.338 E829.19880
+G1 X5.232 Y13.630 E829.21880
+G1 X4.512 Y13.885 E829.23880
+G1 X3.779 Y14.103 E829.25880
+G1 X3.036 Y14.281 E829.27880
+G1 X2.284 Y14.420 E829.29880
+G1 X1.526 Y14.520 E829.31880
+G1 X0.764 Y14.580 E829.33880
+G1 X0.000 Y14.600 E829.35880
+G1 X-0.764 Y14.580 E829.37880
+G1 X-1.526 Y14.520 E829.39880
+G1 X-2.284 Y14.420 E829.41880
+G1 X-3.036 Y14.281 E829.43880
+G1 X-3.779 Y14.103 E829.45880
+G1 X-4.512 Y13.885 E829.47880
+G1 X-5.232 Y13.630 E829.49880
+G1 X-5.938 Y13.338 E829.51880
+G1 X-6.628 Y13.009 E829.53880
+G1 X-7.300 Y12.644 E829.55880
+G1 X-7.952 Y12.245 E829.57880
+G1 X-8.582 Y11.812 E829.59880
+G1 X-9.188 Y11.346 E829.61880
+G1 X-9.769 Y10.850 E829.63880
+G1 X-10.324 Y10.324 E829.65880
+G1 X-10.850 Y9.769 E829.67880
+G1 X-11.346 Y9.188 E829.69880
+G1 X-11.812 Y8.582 E829.71880
+G1 X-12.245 Y7.952 E829.73880
+G1 X-12.644 Y7.300 E829.75880
+G1 X-13.009 Y6.628 E829.77880
+G1 X-13.338 Y5.938 E829.79880
+G1 X-13.630 Y5.232 E829.81880
+G1 X-13.885 Y4.512 E829.83880
+G1 X-14.103 Y3.779 E829.85880
+G1 X-14.281 Y3.036 E829.87880
+G1 X-14.420 Y2.284 E829.89880
+G1 X-14.520 Y1.526 E829.91880
+G1 X-14.580 Y0.764 E829.93880
+G1 X-14.600 Y0.000 E829.95880
+G1 X-14.580 Y-0.764 E829.97880
+G1 X-14.520 Y-1.526 E829.99880
+G1 X-14.420 Y-2.284 E830.01880
+G1 X-14.281 Y-3.036 E830.03880
+G1 X-14.103 Y-3.779 E830.05880
+G1 X-13.885 Y-4.512 E830.07880
+G1 X-13.630 Y-5.232 E830.09880
+G1 X-13.338 Y-5.938 E830.11880
+G1 X-13.009 Y-6.628 E830.13880
+G1 X-12.644 Y-7.300 E830.15880
+G1 X-12.245 Y-7.952 E830.17880
+G1 X-11.812 Y-8.582 E830.19880
+G1 X-11.346 Y-9.188 E830.21880
+G1 X-10.850 Y-9.769 E830.23880
+G1 X-10.324 Y-10.324 E830.25880
+G1 X-9.769 Y-10.850 E830.27880
+G1 X-9.188 Y-11.346 E830.29880
+G1 X-8.582 Y-11.812 E830.31880
+G1 X-7.952 Y-12.245 E830.33880
+G1 X-7.300 Y-12.644 E830.35880
+G1 X-6.628 Y-13.009 E830.37880
+G1 X-5.938 Y-13.338 E830.39880
+G1 X-5.232 Y-13.630 E830.41880
+G1 X-4.512 Y-13.885 E830.43880
+G1 X-3.779 Y-14.103 E830.45880
+G1 X-3.036 Y-14.281 E830.47880
+G1 X-2.284 Y-14.420 E830.49880
+G1 X-1.526 Y-14.520 E830.51880
+G1 X-0.764 Y-14.580 E830.53880
+G1 X-0.000 Y-14.600 E830.55880
+G1 X0.764 Y-14.580 E830.57880
+G1 X1.526 Y-14.520 E830.59880
+G1 X2.284 Y-14.420 E830.61880
+G1 X3.036 Y-14.281 E830.63880
+G1 X3.779 Y-14.103 E830.65880
+G1 X4.512 Y-13.885 E830.67880
+G1 X5.232 Y-13.630 E830.69880
+G1 X5.938 Y-13.338 E830.71880
+G1 X6.628 Y-13.009 E830.73880
+G1 X7.300 Y-12.644 E830.75880
+G1 X7.952 Y-12.245 E830.77880
+G1 X8.582 Y-11.812 E830.79880
+G1 X9.188 Y-11.346 E830.81880
+G1 X9.769 Y-10.850 E830.83880
+G1 X10.324 Y-10.324 E830.85880
+G1 X10.850 Y-9.769 E830.87880
+G1 X11.346 Y-9.188 E830.89880
+G1 X11.812 Y-8.582 E830.91880
+G1 X12.245 Y-7.952 E830.93880
+G1 X12.644 Y-7.300 E830.95880
+G1 X13.009 Y-6.628 E830.97880
+G1 X13.338 Y-5.938 E830.99880
+G1 X13.630 Y-5.232 E831.01880
+G1 X13.885 Y-4.512 E831.03880
+G1 X14.103 Y-3.779 E831.05880
+G1 X14.281 Y-3.036 E831.07880
+G1 X14.420 Y-2.284 E831.09880
+G1 X14.520 Y-1.526 E831.11880
+G1 X14.580 Y-0.764 E831.13880
+G1 X14.600 Y-0.000 E831.15880
+G1 X5.713 Y-13.000 E831.15880 F7800
+G1 X-5.713 Y-13.000 E831.61585 F3600
+G1 X-7.592 Y-12.000 E831.61585 F7800
+G1 X7.592 Y-12.000 E832.22322 F3600
+G1 X8.980 Y-11.000 E832.22322 F7800
+G1 X-8.980 Y-11.000 E832.94161 F3600
+G1 X-10.082 Y-10.000 E832.94161 F7800
+G1 X10.082 Y-10.000 E833.74815 F3600
+G1 X10.984 Y-9.000 E833.74815 F7800
+G1 X-10.984 Y-9.000 E834.62684 F3600
+G1 X-11.732 Y-8.000 E834.62684 F7800
+G1 X11.732 Y-8.000 E835.56540 F3600
+G1 X12.355 Y-7.000 E835.56540 F7800
+G1 X-12.355 Y-7.000 E836.55378 F3600
+G1 X-12.870 Y-6.000 E836.55378 F7800
+G1 X12.870 Y-6.000 E837.58339 F3600
+G1 X13.291 Y-5.000 E837.58339 F7800
+G1 X-13.291 Y-5.000 E838.64664 F3600
+G1 X-13.625 Y-4.000 E838.64664 F7800
+G1 X13.625 Y-4.000 E839.73663 F3600
+G1 X13.879 Y-3.000 E839.73663 F7800
+G1 X-13.879 Y-3.000 E840.84699 F3600
+G1 X-14.058 Y-2.000 E840.84699 F7800
+G1 X14.058 Y-2.000 E841.97167 F3600
+G1 X14.165 Y-1.000 E841.97167 F7800
+G1 X-14.165 Y-1.000 E843.10485 F3600
+G1 X-14.200 Y0.000 E843.10485 F7800
+G1 X14.200 Y0.000 E844.24085 F3600
+G1 X14.165 Y1.000 E844.24085 F7800
+G1 X-14.165 Y1.000 E845.37403 F3600
+G1 X-14.058 Y2.000 E845.37403 F7800
+G1 X14.058 Y2.000 E846.49870 F3600
+G1 X13.879 Y3.000 E846.49870 F7800
+G1 X-13.879 Y3.000 E847.60906 F3600
+G1 X-13.625 Y4.000 E847.60906 F7800
+G1 X13.625 Y4.000 E848.69906 F3600
+G1 X13.291 Y5.000 E848.69906 F7800
+G1 X-13.291 Y5.000 E849.76231 F3600
+G1 X-12.870 Y6.000 E849.76231 F7800
+G1 X12.870 Y6.000 E850.79192 F3600
+G1 X12.355 Y7.000 E850.79192 F7800
+G1 X-12.355 Y7.000 E851.78030 F3600
+G1 X-11.732 Y8.000 E851.78030 F7800
+G1 X11.732 Y8.000 E852.71886 F3600
+G1 X10.984 Y9.000 E852.71886 F7800
+G1 X-10.984 Y9.000 E853.59755 F3600
+G1 X-10.082 Y10.000 E853.59755 F7800
+G1 X10.082 Y10.000 E854.40408 F3600
+G1 X8.980 Y11.000 E854.40408 F7800
+G1 X-8.980 Y11.000 E855.12248 F3600
+G1 X-7.592 Y12.000 E855.12248 F7800
+G1 X7.592 Y12.000 E855.72985 F3600
+G1 X5.713 Y13.000 E855.72985 F7800
+G1 X-5.713 Y13.000 E856.18690 F3600
+G1 Z5.900 F7800
+G1 E855.18690 F2400
+G1 E856.18690 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E856.20690 F1800
+G1 X14.918 Y1.568 E856.22690
+G1 X14.815 Y2.347 E856.24690
+G1 X14.672 Y3.119 E856.26690
+G1 X14.489 Y3.882 E856.28690
+G1 X14.266 Y4.635 E856.30690
+G1 X14.004 Y5.376 E856.32690
+G1 X13.703 Y6.101 E856.34690
+G1 X13.365 Y6.810 E856.36690
+G1 X12.990 Y7.500 E856.38690
+G1 X12.580 Y8.170 E856.40690
+G1 X12.135 Y8.817 E856.42690
+G1 X11.657 Y9.440 E856.44690
+G1 X11.147 Y10.037 E856.46690
+G1 X10.607 Y10.607 E856.48690
+G1 X10.037 Y11.147 E856.50690
+G1 X9.440 Y11.657 E856.52690
+G1 X8.817 Y12.135 E856.54690
+G1 X8.170 Y12.580 E856.56690
+G1 X7.500 Y12.990 E856.58690
+G1 X6.810 Y13.365 E856.60690
+G1 X6.101 Y13.703 E856.62690
+G1 X5.376 Y14.004 E856.64690
+G1 X4.635 Y14.266 E856.66690
+G1 X3.882 Y14.489 E856.68690
+G1 X3.119 Y14.672 E856.70690
+G1 X2.347 Y14.815 E856.72690
+G1 X1.568 Y14.918 E856.74690
+G1 X0.785 Y14.979 E856.76690
+G1 X0.000 Y15.000 E856.78690
+G1 X-0.785 Y14.979 E856.80690
+G1 X-1.568 Y14.918 E856.82690
+G1 X-2.347 Y14.815 E856.84690
+G1 X-3.119 Y14.672 E856.86690
+G1 X-3.882 Y14.489 E856.88690
+G1 X-4.635 Y14.266 E856.90690
+G1 X-5.376 Y14.004 E856.92690
+G1 X-6.101 Y13.703 E856.94690
+G1 X-6.810 Y13.365 E856.96690
+G1 X-7.500 Y12.990 E856.98690
+G1 X-8.170 Y12.580 E857.00690
+G1 X-8.817 Y12.135 E857.02690
+G1 X-9.440 Y11.657 E857.04690
+G1 X-10.037 Y11.147 E857.06690
+G1 X-10.607 Y10.607 E857.08690
+G1 X-11.147 Y10.037 E857.10690
+G1 X-11.657 Y9.440 E857.12690
+G1 X-12.135 Y8.817 E857.14690
+G1 X-12.580 Y8.170 E857.16690
+G1 X-12.990 Y7.500 E857.18690
+G1 X-13.365 Y6.810 E857.20690
+G1 X-13.703 Y6.101 E857.22690
+G1 X-14.004 Y5.376 E857.24690
+G1 X-14.266 Y4.635 E857.26690
+G1 X-14.489 Y3.882 E857.28690
+G1 X-14.672 Y3.119 E857.30690
+G1 X-14.815 Y2.347 E857.32690
+G1 X-14.918 Y1.568 E857.34690
+G1 X-14.979 Y0.785 E857.36690
+G1 X-15.000 Y0.000 E857.38690
+G1 X-14.979 Y-0.785 E857.40690
+G1 X-14.918 Y-1.568 E857.42690
+G1 X-14.815 Y-2.347 E857.44690
+G1 X-14.672 Y-3.119 E857.46690
+G1 X-14.489 Y-3.882 E857.48690
+G1 X-14.266 Y-4.635 E857.50690
+G1 X-14.004 Y-5.376 E857.52690
+G1 X-13.703 Y-6.101 E857.54690
+G1 X-13.365 Y-6.810 E857.56690
+G1 X-12.990 Y-7.500 E857.58690
+G1 X-12.580 Y-8.170 E857.60690
+G1 X-12.135 Y-8.817 E857.62690
+G1 X-11.657 Y-9.440 E857.64690
+G1 X-11.147 Y-10.037 E857.66690
+G1 X-10.607 Y-10.607 E857.68690
+G1 X-10.037 Y-11.147 E857.70690
+G1 X-9.440 Y-11.657 E857.72690
+G1 X-8.817 Y-12.135 E857.74690
+G1 X-8.170 Y-12.580 E857.76690
+G1 X-7.500 Y-12.990 E857.78690
+G1 X-6.810 Y-13.365 E857.80690
+G1 X-6.101 Y-13.703 E857.82690
+G1 X-5.376 Y-14.004 E857.84690
+G1 X-4.635 Y-14.266 E857.86690
+G1 X-3.882 Y-14.489 E857.88690
+G1 X-3.119 Y-14.672 E857.90690
+G1 X-2.347 Y-14.815 E857.92690
+G1 X-1.568 Y-14.918 E857.94690
+G1 X-0.785 Y-14.979 E857.96690
+G1 X-0.000 Y-15.000 E857.98690
+G1 X0.785 Y-14.979 E858.00690
+G1 X1.568 Y-14.918 E858.02690
+G1 X2.347 Y-14.815 E858.04690
+G1 X3.119 Y-14.672 E858.06690
+G1 X3.882 Y-14.489 E858.08690
+G1 X4.635 Y-14.266 E858.10690
+G1 X5.376 Y-14.004 E858.12690
+G1 X6.101 Y-13.703 E858.14690
+G1 X6.810 Y-13.365 E858.16690
+G1 X7.500 Y-12.990 E858.18690
+G1 X8.170 Y-12.580 E858.20690
+G1 X8.817 Y-12.135 E858.22690
+G1 X9.440 Y-11.657 E858.24690
+G1 X10.037 Y-11.147 E858.26690
+G1 X10.607 Y-10.607 E858.28690
+G1 X11.147 Y-10.037 E858.30690
+G1 X11.657 Y-9.440 E858.32690
+G1 X12.135 Y-8.817 E858.34690
+G1 X12.580 Y-8.170 E858.36690
+G1 X12.990 Y-7.500 E858.38690
+G1 X13.365 Y-6.810 E858.40690
+G1 X13.703 Y-6.101 E858.42690
+G1 X14.004 Y-5.376 E858.44690
+G1 X14.266 Y-4.635 E858.46690
+G1 X14.489 Y-3.882 E858.48690
+G1 X14.672 Y-3.119 E858.50690
+G1 X14.815 Y-2.347 E858.52690
+G1 X14.918 Y-1.568 E858.54690
+G1 X14.979 Y-0.785 E858.56690
+G1 X15.000 Y-0.000 E858.58690
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E858.60690 F1800
+G1 X14.520 Y1.526 E858.62690
+G1 X14.420 Y2.284 E858.64690
+G1 X14.281 Y3.036 E858.66690
+G1 X14.103 Y3.779 E858.68690
+G1 X13.885 Y4.512 E858.70690
+G1 X13.630 Y5.232 E858.72690
+G1 X13.338 Y5.938 E858.74690
+G1 X13.009 Y6.628 E858.76690
+G1 X12.644 Y7.300 E858.78690
+G1 X12.245 Y7.952 E858.80690
+G1 X11.812 Y8.582 E858.82690
+G1 X11.346 Y9.188 E858.84690
+G1 X10.850 Y9.769 E858.86690
+G1 X10.324 Y10.324 E858.88690
+G1 X9.769 Y10.850 E858.90690
+G1 X9.188 Y11.346 E858.92690
+G1 X8.582 Y11.812 E858.94690
+G1 X7.952 Y12.245 E858.96690
+G1 X7.300 Y12.644 E858.98690
+G1 X6.628 Y13.009 E859.00690
+G1 X5.938 Y13.338 E859.02690
+G1 X5.232 Y13.630 E859.04690
+G1 X4.512 Y13.885 E859.06690
+G1 X3.779 Y14.103 E859.08690
+G1 X3.036 Y14.281 E859.10690
+G1 X2.284 Y14.420 E859.12690
+G1 X1.526 Y14.520 E859.14690
+G1 X0.764 Y14.580 E859.16690
+G1 X0.000 Y14.600 E859.18690
+G1 X-0.764 Y14.580 E859.20690
+G1 X-1.526 Y14.520 E859.22690
+G1 X-2.284 Y14.420 E859.24690
+G1 X-3.036 Y14.281 E859.26690
+G1 X-3.779 Y14.103 E859.28690
+G1 X-4.512 Y13.885 E859.30690
+G1 X-5.232 Y13.630 E859.32690
+G1 X-5.938 Y13.338 E859.34690
+G1 X-6.628 Y13.009 E859.36690
+G1 X-7.300 Y12.644 E859.38690
+G1 X-7.952 Y12.245 E859.40690
+G1 X-8.582 Y11.812 E859.42690
+G1 X-9.188 Y11.346 E859.44690
+G1 X-9.769 Y10.850 E859.46690
+G1 X-10.324 Y10.324 E859.48690
+G1 X-10.850 Y9.769 E859.50690
+G1 X-11.346 Y9.188 E859.52690
+G1 X-11.812 Y8.582 E859.54690
+G1 X-12.245 Y7.952 E859.56690
+G1 X-12.644 Y7.300 E859.58690
+G1 X-13.009 Y6.628 E859.60690
+G1 X-13.338 Y5.938 E859.62690
+G1 X-13.630 Y5.232 E859.64690
+G1 X-13.885 Y4.512 E859.66690
+G1 X-14.103 Y3.779 E859.68690
+G1 X-14.281 Y3.036 E859.70690
+G1 X-14.420 Y2.284 E859.72690
+G1 X-14.520 Y1.526 E859.74690
+G1 X-14.580 Y0.764 E859.76690
+G1 X-14.600 Y0.000 E859.78690
+G1 X-14.580 Y-0.764 E859.80690
+G1 X-14.520 Y-1.526 E859.82690
+G1 X-14.420 Y-2.284 E859.84690
+G1 X-14.281 Y-3.036 E859.86690
+G1 X-14.103 Y-3.779 E859.88690
+G1 X-13.885 Y-4.512 E859.90690
+G1 X-13.630 Y-5.232 E859.92690
+G1 X-13.338 Y-5.938 E859.94690
+G1 X-13.009 Y-6.628 E859.96690
+G1 X-12.644 Y-7.300 E859.98690
+G1 X-12.245 Y-7.952 E860.00690
+G1 X-11.812 Y-8.582 E860.02690
+G1 X-11.346 Y-9.188 E860.04690
+G1 X-10.850 Y-9.769 E860.06690
+G1 X-10.324 Y-10.324 E860.08690
+G1 X-9.769 Y-10.850 E860.10690
+G1 X-9.188 Y-11.346 E860.12690
+G1 X-8.582 Y-11.812 E860.14690
+G1 X-7.952 Y-12.245 E860.16690
+G1 X-7.300 Y-12.644 E860.18690
+G1 X-6.628 Y-13.009 E860.20690
+G1 X-5.938 Y-13.338 E860.22690
+G1 X-5.232 Y-13.630 E860.24690
+G1 X-4.512 Y-13.885 E860.26690
+G1 X-3.779 Y-14.103 E860.28690
+G1 X-3.036 Y-14.281 E860.30690
+G1 X-2.284 Y-14.420 E860.32690
+G1 X-1.526 Y-14.520 E860.34690
+G1 X-0.764 Y-14.580 E860.36690
+G1 X-0.000 Y-14.600 E860.38690
+G1 X0.764 Y-14.580 E860.40690
+G1 X1.526 Y-14.520 E860.42690
+G1 X2.284 Y-14.420 E860.44690
+G1 X3.036 Y-14.281 E860.46690
+G1 X3.779 Y-14.103 E860.48690
+G1 X4.512 Y-13.885 E860.50690
+G1 X5.232 Y-13.630 E860.52690
+G1 X5.938 Y-13.338 E860.54690
+G1 X6.628 Y-13.009 E860.56690
+G1 X7.300 Y-12.644 E860.58690
+G1 X7.952 Y-12.245 E860.60690
+G1 X8.582 Y-11.812 E860.62690
+G1 X9.188 Y-11.346 E860.64690
+G1 X9.769 Y-10.850 E860.66690
+G1 X10.324 Y-10.324 E860.68690
+G1 X10.850 Y-9.769 E860.70690
+G1 X11.346 Y-9.188 E860.72690
+G1 X11.812 Y-8.582 E860.74690
+G1 X12.245 Y-7.952 E860.76690
+G1 X12.644 Y-7.300 E860.78690
+G1 X13.009 Y-6.628 E860.80690
+G1 X13.338 Y-5.938 E860.82690
+G1 X13.630 Y-5.232 E860.84690
+G1 X13.885 Y-4.512 E860.86690
+G1 X14.103 Y-3.779 E860.88690
+G1 X14.281 Y-3.036 E860.90690
+G1 X14.420 Y-2.284 E860.92690
+G1 X14.520 Y-1.526 E860.94690
+G1 X14.580 Y-0.764 E860.96690
+G1 X14.600 Y-0.000 E860.98690
+G1 X5.713 Y-13.000 E860.98690 F7800
+G1 X-5.713 Y-13.000 E861.44395 F3600
+G1 X-7.592 Y-12.000 E861.44395 F7800
+G1 X7.592 Y-12.000 E862.05132 F3600
+G1 X8.980 Y-11.000 E862.05132 F7800
+G1 X-8.980 Y-11.000 E862.76972 F3600
+G1 X-10.082 Y-10.000 E862.76972 F7800
+G1 X10.082 Y-10.000 E863.57625 F3600
+G1 X10.984 Y-9.000 E863.57625 F7800
+G1 X-10.984 Y-9.000 E864.45494 F3600
+G1 X-11.732 Y-8.000 E864.45494 F7800
+G1 X11.732 Y-8.000 E865.39350 F3600
+G1 X12.355 Y-7.000 E865.39350 F7800
+G1 X-12.355 Y-7.000 E866.38188 F3600
+G1 X-12.870 Y-6.000 E866.38188 F7800
+G1 X12.870 Y-6.000 E867.41149 F3600
+G1 X13.291 Y-5.000 E867.41149 F7800
+G1 X-13.291 Y-5.000 E868.47474 F3600
+G1 X-13.625 Y-4.000 E868.47474 F7800
+G1 X13.625 Y-4.000 E869.56474 F3600
+G1 X13.879 Y-3.000 E869.56474 F7800
+G1 X-13.879 Y-3.000 E870.67510 F3600
+G1 X-14.058 Y-2.000 E870.67510 F7800
+G1 X14.058 Y-2.000 E871.79977 F3600
+G1 X14.165 Y-1.000 E871.79977 F7800
+G1 X-14.165 Y-1.000 E872.93295 F3600
+G1 X-14.200 Y0.000 E872.93295 F7800
+G1 X14.200 Y0.000 E874.06895 F3600
+G1 X14.165 Y1.000 E874.06895 F7800
+G1 X-14.165 Y1.000 E875.20213 F3600
+G1 X-14.058 Y2.000 E875.20213 F7800
+G1 X14.058 Y2.000 E876.32681 F3600
+G1 X13.879 Y3.000 E876.32681 F7800
+G1 X-13.879 Y3.000 E877.43717 F3600
+G1 X-13.625 Y4.000 E877.43717 F7800
+G1 X13.625 Y4.000 E878.52716 F3600
+G1 X13.291 Y5.000 E878.52716 F7800
+G1 X-13.291 Y5.000 E879.59041 F3600
+G1 X-12.870 Y6.000 E879.59041 F7800
+G1 X12.870 Y6.000 E880.62002 F3600
+G1 X12.355 Y7.000 E880.62002 F7800
+G1 X-12.355 Y7.000 E881.60840 F3600
+G1 X-11.732 Y8.000 E881.60840 F7800
+G1 X11.732 Y8.000 E882.54696 F3600
+G1 X10.984 Y9.000 E882.54696 F7800
+G1 X-10.984 Y9.000 E883.42565 F3600
+G1 X-10.082 Y10.000 E883.42565 F7800
+G1 X10.082 Y10.000 E884.23219 F3600
+G1 X8.980 Y11.000 E884.23219 F7800
+G1 X-8.980 Y11.000 E884.95058 F3600
+G1 X-7.592 Y12.000 E884.95058 F7800
+G1 X7.592 Y12.000 E885.55795 F3600
+G1 X5.713 Y13.000 E885.55795 F7800
+G1 X-5.713 Y13.000 E886.01500 F3600
+G1 Z6.100 F7800
+G1 E885.01500 F2400
+G1 E886.01500 F2400
+G0 X15.000 Y0 F7800
+G1 X14.979 Y0.785 E886.03500 F1800
+G1 X14.918 Y1.568 E886.05500
+G1 X14.815 Y2.347 E886.07500
+G1 X14.672 Y3.119 E886.09500
+G1 X14.489 Y3.882 E886.11500
+G1 X14.266 Y4.635 E886.13500
+G1 X14.004 Y5.376 E886.15500
+G1 X13.703 Y6.101 E886.17500
+G1 X13.365 Y6.810 E886.19500
+G1 X12.990 Y7.500 E886.21500
+G1 X12.580 Y8.170 E886.23500
+G1 X12.135 Y8.817 E886.25500
+G1 X11.657 Y9.440 E886.27500
+G1 X11.147 Y10.037 E886.29500
+G1 X10.607 Y10.607 E886.31500
+G1 X10.037 Y11.147 E886.33500
+G1 X9.440 Y11.657 E886.35500
+G1 X8.817 Y12.135 E886.37500
+G1 X8.170 Y12.580 E886.39500
+G1 X7.500 Y12.990 E886.41500
+G1 X6.810 Y13.365 E886.43500
+G1 X6.101 Y13.703 E886.45500
+G1 X5.376 Y14.004 E886.47500
+G1 X4.635 Y14.266 E886.49500
+G1 X3.882 Y14.489 E886.51500
+G1 X3.119 Y14.672 E886.53500
+G1 X2.347 Y14.815 E886.55500
+G1 X1.568 Y14.918 E886.57500
+G1 X0.785 Y14.979 E886.59500
+G1 X0.000 Y15.000 E886.61500
+G1 X-0.785 Y14.979 E886.63500
+G1 X-1.568 Y14.918 E886.65500
+G1 X-2.347 Y14.815 E886.67500
+G1 X-3.119 Y14.672 E886.69500
+G1 X-3.882 Y14.489 E886.71500
+G1 X-4.635 Y14.266 E886.73500
+G1 X-5.376 Y14.004 E886.75500
+G1 X-6.101 Y13.703 E886.77500
+G1 X-6.810 Y13.365 E886.79500
+G1 X-7.500 Y12.990 E886.81500
+G1 X-8.170 Y12.580 E886.83500
+G1 X-8.817 Y12.135 E886.85500
+G1 X-9.440 Y11.657 E886.87500
+G1 X-10.037 Y11.147 E886.89500
+G1 X-10.607 Y10.607 E886.91500
+G1 X-11.147 Y10.037 E886.93500
+G1 X-11.657 Y9.440 E886.95500
+G1 X-12.135 Y8.817 E886.97500
+G1 X-12.580 Y8.170 E886.99500
+G1 X-12.990 Y7.500 E887.01500
+G1 X-13.365 Y6.810 E887.03500
+G1 X-13.703 Y6.101 E887.05500
+G1 X-14.004 Y5.376 E887.07500
+G1 X-14.266 Y4.635 E887.09500
+G1 X-14.489 Y3.882 E887.11500
+G1 X-14.672 Y3.119 E887.13500
+G1 X-14.815 Y2.347 E887.15500
+G1 X-14.918 Y1.568 E887.17500
+G1 X-14.979 Y0.785 E887.19500
+G1 X-15.000 Y0.000 E887.21500
+G1 X-14.979 Y-0.785 E887.23500
+G1 X-14.918 Y-1.568 E887.25500
+G1 X-14.815 Y-2.347 E887.27500
+G1 X-14.672 Y-3.119 E887.29500
+G1 X-14.489 Y-3.882 E887.31500
+G1 X-14.266 Y-4.635 E887.33500
+G1 X-14.004 Y-5.376 E887.35500
+G1 X-13.703 Y-6.101 E887.37500
+G1 X-13.365 Y-6.810 E887.39500
+G1 X-12.990 Y-7.500 E887.41500
+G1 X-12.580 Y-8.170 E887.43500
+G1 X-12.135 Y-8.817 E887.45500
+G1 X-11.657 Y-9.440 E887.47500
+G1 X-11.147 Y-10.037 E887.49500
+G1 X-10.607 Y-10.607 E887.51500
+G1 X-10.037 Y-11.147 E887.53500
+G1 X-9.440 Y-11.657 E887.55500
+G1 X-8.817 Y-12.135 E887.57500
+G1 X-8.170 Y-12.580 E887.59500
+G1 X-7.500 Y-12.990 E887.61500
+G1 X-6.810 Y-13.365 E887.63500
+G1 X-6.101 Y-13.703 E887.65500
+G1 X-5.376 Y-14.004 E887.67500
+G1 X-4.635 Y-14.266 E887.69500
+G1 X-3.882 Y-14.489 E887.71500
+G1 X-3.119 Y-14.672 E887.73500
+G1 X-2.347 Y-14.815 E887.75500
+G1 X-1.568 Y-14.918 E887.77500
+G1 X-0.785 Y-14.979 E887.79500
+G1 X-0.000 Y-15.000 E887.81500
+G1 X0.785 Y-14.979 E887.83500
+G1 X1.568 Y-14.918 E887.85500
+G1 X2.347 Y-14.815 E887.87500
+G1 X3.119 Y-14.672 E887.89500
+G1 X3.882 Y-14.489 E887.91500
+G1 X4.635 Y-14.266 E887.93500
+G1 X5.376 Y-14.004 E887.95500
+G1 X6.101 Y-13.703 E887.97500
+G1 X6.810 Y-13.365 E887.99500
+G1 X7.500 Y-12.990 E888.01500
+G1 X8.170 Y-12.580 E888.03500
+G1 X8.817 Y-12.135 E888.05500
+G1 X9.440 Y-11.657 E888.07500
+G1 X10.037 Y-11.147 E888.09500
+G1 X10.607 Y-10.607 E888.11500
+G1 X11.147 Y-10.037 E888.13500
+G1 X11.657 Y-9.440 E888.15500
+G1 X12.135 Y-8.817 E888.17500
+G1 X12.580 Y-8.170 E888.19500
+G1 X12.990 Y-7.500 E888.21500
+G1 X13.365 Y-6.810 E888.23500
+G1 X13.703 Y-6.101 E888.25500
+G1 X14.004 Y-5.376 E888.27500
+G1 X14.266 Y-4.635 E888.29500
+G1 X14.489 Y-3.882 E888.31500
+G1 X14.672 Y-3.119 E888.33500
+G1 X14.815 Y-2.347 E888.35500
+G1 X14.918 Y-1.568 E888.37500
+G1 X14.979 Y-0.785 E888.39500
+G1 X15.000 Y-0.000 E888.41500
+G0 X14.600 Y0 F7800
+G1 X14.580 Y0.764 E888.43500 F1800
+G1 X14.520 Y1.526 E888.45500
+G1 X14.420 Y2.284 E888.47500
+G1 X14.281 Y3.036 E888.49500
+G1 X14.103 Y3.779 E888.51500
+G1 X13.885 Y4.512 E888.53500
+G1 X13.630 Y5.232 E888.55500
+G1 X13.338 Y5.938 E888.57500
+G1 X13.009 Y6.628 E888.59500
+G1 X12.644 Y7.300 E888.61500
+G1 X12.245 Y7.952 E888.63500
+G1 X11.812 Y8.582 E888.65500
+G1 X11.346 Y9.188 E888.67500
+G1 X10.850 Y9.769 E888.69500
+G1 X10.324 Y10.324 E888.71500
+G1 X9.769 Y10.850 E888.73500
+G1 X9.188 Y11.346 E888.75500
+G1 X8.582 Y11.812 E888.77500
+G1 X7.952 Y12.245 E888.79500
+G1 X7.300 Y12.644 E888.81500
+G1 X6.628 Y13.009 E888.83500
+G1 X5.938 Y13.338 E888.85500
+G1 X5.232 Y13.630 E888.87500
+G1 X4.512 Y13.885 E888.89500
+G1 X3.779 Y14.103 E888.91500
+G1 X3.036 Y14.281 E888.93500
+G1 X2.284 Y14.420 E888.95500
+G1 X1.526 Y14.520 E888.97500
+G1 X0.764 Y14.580 E888.99500
+G1 X0.000 Y14.600 E889.01500
+G1 X-0.764 Y14.580 E889.03500
+G1 X-1.526 Y14.520 E889.05500
+G1 X-2.284 Y14.420 E889.07500
+G1 X-3.036 Y14.281 E889.09500
+G1 X-3.779 Y14.103 E889.11500
+G1 X-4.512 Y13.885 E889.13500
+G1 X-5.232 Y13.630 E889.15500
+G1 X-5.938 Y13.338 E889.17500
+G1 X-6.628 Y13.009 E889.19500
+G1 X-7.300 Y12.644 E889.21500
+G1 X-7.952 Y12.245 E889.23500
+G1 X-8.582 Y11.812 E889.25500
+G1 X-9.188 Y11.346 E889.27500
+G1 X-9.769 Y10.850 E889.29500
+G1 X-10.324 Y10.324 E889.31500
+G1 X-10.850 Y9.769 E889.33500
+G1 X-11.346 Y9.188 E889.35500
+G1 X-11.812 Y8.582 E889.37500
+G1 X-12.245 Y7.952 E889.39500
+G1 X-12.644 Y7.300 E889.41500
+G1 X-13.009 Y6.628 E889.43500
+G1 X-13.338 Y5.938 E889.45500
+G1 X-13.630 Y5.232 E889.47500
+G1 X-13.885 Y4.512 E889.49500
+G1 X-14.103 Y3.779 E889.51500
+G1 X-14.281 Y3.036 E889.53500
+G1 X-14.420 Y2.284 E889.55500
+G1 X-14.520 Y1.526 E889.57500
+G1 X-14.580 Y0.764 E889.59500
+G1 X-14.600 Y0.000 E889.61500
+G1 X-14.580 Y-0.764 E889.63500
+G1 X-14.520 Y-1.526 E889.65500
+G1 X-14.420 Y-2.284 E889.67500
+G1 X-14.281 Y-3.036 E889.69500
+G1 X-14.103 Y-3.779 E889.71500
+G1 X-13.885 Y-4.512 E889.73500
+G1 X-13.630 Y-5.232 E889.75500
+G1 X-13.338 Y-5.938 E889.77500
+G1 X-13.009 Y-6.628 E889.79500
+G1 X-12.644 Y-7.300 E889.81500
+G1 X-12.245 Y-7.952 E889.83500
+G1 X-11.812 Y-8.582 E889.85500
+G1 X-11.346 Y-9.188 E889.87500
+G1 X-10.850 Y-9.769 E889.89500
+G1 X-10.324 Y-10.324 E889.91500
+G1 X-9.769 Y-10.850 E889.93500
+G1 X-9.188 Y-11.346 E889.95500
+G1 X-8.582 Y-11.812 E889.97500
+G1 X-7.952 Y-12.245 E889.99500
+G1 X-7.300 Y-12.644 E890.01500
+G1 X-6.628 Y-13.009 E890.03500
+G1 X-5.938 Y-13.338 E890.05500
+G1 X-5.232 Y-13.630 E890.07500
+G1 X-4.512 Y-13.885 E890.09500
+G1 X-3.779 Y-14.103 E890.11500
+G1 X-3.036 Y-14.281 E890.13500
+G1 X-2.284 Y-14.420 E890.15500
+G1 X-1.526 Y-14.520 E890.17500
+G1 X-0.764 Y-14.580 E890.19500
+G1 X-0.000 Y-14.600 E890.21500
+G1 X0.764 Y-14.580 E890.23500
+G1 X1.526 Y-14.520 E890.25500
+G1 X2.284 Y-14.420 E890.27500
+G1 X3.036 Y-14.281 E890.29500
+G1 X3.779 Y-14.103 E890.31500
+G1 X4.512 Y-13.885 E890.33500
+G1 X5.232 Y-13.630 E890.35500
+G1 X5.938 Y-13.338 E890.37500
+G1 X6.628 Y-13.009 E890.39500
+G1 X7.300 Y-12.644 E890.41500
+G1 X7.952 Y-12.245 E890.43500
+G1 X8.582 Y-11.812 E890.45500
+G1 X9.188 Y-11.346 E890.47500
+G1 X9.769 Y-10.850 E890.49500
+G1 X10.324 Y-10.324 E890.51500
+G1 X10.850 Y-9.769 E890.53500
+G1 X11.346 Y-9.188 E890.55500
+G1 X11.812 Y-8.582 E890.57500
+G1 X12.245 Y-7.952 E890.59500
+G1 X12.644 Y-7.300 E890.61500
+G1 X13.009 Y-6.628 E890.63500
+G1 X13.338 Y-5.938 E890.65500
+G1 X13.630 Y-5.232 E890.67500
+G1 X13.885 Y-4.512 E890.69500
+G1 X14.103 Y-3.779 E890.71500
+G1 X14.281 Y-3.036 E890.73500
+G1 X14.420 Y-2.284 E890.75500
+G1 X14.520 Y-1.526 E890.77500
+G1 X14.580 Y-0.764 E890.79500
+G1 X14.600 Y-0.000 E890.81500
+G1 X5.713 Y-13.000 E890.81500 F7800
+G1 X-5.713 Y-13.000 E891.27206 F3600
+G1 X-7.592 Y-12.000 E891.27206 F7800
+G1 X7.592 Y-12.000 E891.87942 F3600
+G1 X8.980 Y-11.000 E891.87942 F7800
+G1 X-8.980 Y-11.000 E892.59782 F3600
+G1 X-10.082 Y-10.000 E892.59782 F7800
+G1 X10.082 Y-10.000 E893.40435 F3600
+G1 X10.984 Y-9.000 E893.40435 F7800
+G1 X-10.984 Y-9.000 E894.28304 F3600
+G1 X-11.732 Y-8.000 E894.28304 F7800
+G1 X11.732 Y-8.000 E895.22161 F3600
+G1 X12.355 Y-7.000 E895.22161 F7800
+G1 X-12.355 Y-7.000 E896.20999 F3600
+G1 X-12.870 Y-6.000 E896.20999 F7800
+G1 X12.870 Y-6.000 E897.23960 F3600
+G1 X13.291 Y-5.000 E897.23960 F7800
+G1 X-13.291 Y-5.000 E898.30284 F3600
+G1 X-13.625 Y-4.000 E898.30284 F7800
+G1 X13.625 Y-4.000 E899.39284 F3600
+G1 X13.879 Y-3.000 E899.39284 F7800
+G1 X-13.879 Y-3.000 E900.50320 F3600
+G1 X-14.058 Y-2.000 E900.50320 F7800
+G1 X14.058 Y-2.000 E901.62788 F3600
+G1 X14.165 Y-1.000 E901.62788 F7800
+G1 X-14.165 Y-1.000 E902.76106 F3600
+G1 X-14.200 Y0.000 E902.76106 F7800
+G1 X14.200 Y0.000 E903.89706 F3600
+G1 X14.165 Y1.000 E903.89706 F7800
+G1 X-14.165 Y1.000 E905.03023 F3600
+G1 X-14.058 Y2.000 E905.03023 F7800
+G1 X14.058 Y2.000 E906.15491 F3600
+G1 X13.879 Y3.000 E906.15491 F7800
+G1 X-13.879 Y3.000 E907.26527 F3600
+G1 X-13.625 Y4.000 E907.26527 F7800
+G1 X13.625 Y4.000 E908.35527 F3600
+G1 X13.291 Y5.000 E908.35527 F7800
+G1 X-13.291 Y5.000 E909.41852 F3600
+G1 X-12.870 Y6.000 E909.41852 F7800
+G1 X12.870 Y6.000 E910.44813 F3600
+G1 X12.355 Y7.000 E910.44813 F7800
+G1 X-12.355 Y7.000 E911.43651 F3600
+G1 X-11.732 Y8.000 E911.43651 F7800
+G1 X11.732 Y8.000 E912.37507 F3600
+G1 X10.984 Y9.000 E912.37507 F7800
+G1 X-10.984 Y9.000 E913.25376 F3600
+G1 X-10.082 Y10.000 E913.25376 F7800
+G1 X10.082 Y10.000 E914.06029 F3600
+G1 X8.980 Y11.000 E914.06029 F7800
+G1 X-8.980 Y11.000 E914.77869 F3600
+G1 X-7.592 Y12.000 E914.77869 F7800
+G1 X7.592 Y12.000 E915.38606 F3600
+G1 X5.713 Y13.000 E915.38606 F7800
+G1 X-5.713 Y13.000 E915.84311 F3600
+M104 S0 ; turn off temperature
+G28 X0  ; home X axis
+M84     ; disable motors
@@ -0,0 +1,3614 @@
+; prism test
+M190 S60
+M104 S210
+G28
+G1 Z5 F5000
+M109 S210
+G21
+G90
+M83
+G92 E0
+G1 Z0.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z0.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z0.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z0.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z1.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z1.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z1.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z1.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z1.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z2.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z2.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z2.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z2.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z2.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z3.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z3.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z3.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z3.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z3.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z4.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z4.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z4.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z4.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z4.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z5.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z5.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z5.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z5.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z5.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z6.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z6.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z6.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z6.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z6.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z7.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z7.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z7.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z7.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z7.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z8.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z8.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z8.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z8.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z8.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z9.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z9.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z9.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z9.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z9.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z10.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z10.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z10.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z10.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z10.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z11.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z11.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z11.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z11.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z11.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z12.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z12.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z12.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z12.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z12.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z13.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z13.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z13.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z13.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z13.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z14.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z14.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z14.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z14.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z14.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z15.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z15.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z15.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z15.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z15.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z16.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z16.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z16.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z16.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z16.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z17.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z17.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z17.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z17.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z17.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z18.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z18.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z18.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z18.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z18.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z19.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z19.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z19.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z19.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z19.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z20.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z20.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z20.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z20.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z20.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z21.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z21.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z21.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z21.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z21.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z22.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z22.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z22.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z22.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z22.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z23.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z23.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z23.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z23.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z23.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z24.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z24.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z24.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z24.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z24.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z25.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z25.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z25.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z25.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z25.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z26.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z26.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z26.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z26.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z26.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z27.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z27.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z27.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z27.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z27.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z28.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z28.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z28.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z28.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z28.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z29.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z29.300 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z29.500 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z29.700 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z29.900 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+G1 Z30.100 F7800
+G1 X-10 Y-10 F7800
+G1 X10 Y-10 E0.66500 F1800
+G1 X10 Y10 E0.66500 F1800
+G1 X-10 Y10 E0.66500 F1800
+G1 X-10 Y-10 E0.66500 F1800
+G1 X-8 Y-9 F7800
+G1 X-8 Y9 E0.59900 F2400
+G1 X-6 Y-9 F7800
+G1 X-6 Y9 E0.59900 F2400
+G1 X-4 Y-9 F7800
+G1 X-4 Y9 E0.59900 F2400
+G1 X-2 Y-9 F7800
+G1 X-2 Y9 E0.59900 F2400
+G1 X0 Y-9 F7800
+G1 X0 Y9 E0.59900 F2400
+G1 X2 Y-9 F7800
+G1 X2 Y9 E0.59900 F2400
+G1 X4 Y-9 F7800
+G1 X4 Y9 E0.59900 F2400
+G1 X6 Y-9 F7800
+G1 X6 Y9 E0.59900 F2400
+G1 X8 Y-9 F7800
+G1 X8 Y9 E0.59900 F2400
+M104 S0
+M140 S0
+G28 X0
+M84
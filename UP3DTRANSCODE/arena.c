@@ -0,0 +1,51 @@
+/*
+  arena.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "arena.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN 64 //cache line, keeps batch arrays aligned for vector loads
+
+bool arena_init(arena_t* arena, size_t size)
+{
+  arena->size = (size+ARENA_ALIGN-1) & ~(size_t)(ARENA_ALIGN-1);
+  arena->used = 0;
+  arena->base = malloc( arena->size+ARENA_ALIGN );
+  return (NULL != arena->base);
+}
+
+void* arena_alloc(arena_t* arena, size_t size)
+{
+  uintptr_t start = ((uintptr_t)arena->base+arena->used+ARENA_ALIGN-1) & ~(uintptr_t)(ARENA_ALIGN-1);
+  size_t used = (start-(uintptr_t)arena->base)+size;
+  if( !arena->base || (used>arena->size+ARENA_ALIGN) )
+    return NULL;
+
+  arena->used = used;
+  memset( (void*)start, 0, size );
+  return (void*)start;
+}
+
+void arena_free(arena_t* arena)
+{
+  free( arena->base );
+  arena->base = NULL;
+  arena->size = arena->used = 0;
+}
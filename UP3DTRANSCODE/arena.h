@@ -0,0 +1,38 @@
+/*
+  arena.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef arena_h
+#define arena_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Per job memory: one allocation up front, everything of the job is taken from it
+// and released together when the job is done
+typedef struct {
+  uint8_t* base;
+  size_t   size;
+  size_t   used;
+} arena_t;
+
+bool  arena_init(arena_t* arena, size_t size);
+void* arena_alloc(arena_t* arena, size_t size); // zeroed and aligned, NULL if arena is exhausted
+void  arena_free(arena_t* arena);
+
+#endif //arena_h
@@ -0,0 +1,247 @@
+/*
+  fanout.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fanout.h"
+#include "transcoder.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+// The parser does not depend on the machine, its writer calls are recorded into chunks of commands.
+// Every target thread replays all chunks into its own writer, the last one done with a chunk frees it.
+// The number of chunks in flight is limited, a fast parser waits for the slowest target.
+
+#define FANOUT_CHUNK_CMDS 4096
+#define FANOUT_MAX_CHUNKS 32
+
+typedef struct fanout_chunk {
+  struct fanout_chunk* next;
+  uint32_t             count;
+  uint32_t             readers; // targets still to replay this chunk
+  umcwriter_cmd_t      cmds[FANOUT_CHUNK_CMDS];
+} fanout_chunk_t;
+
+typedef struct {
+  pthread_mutex_t  lock;
+  pthread_cond_t   cond;
+  fanout_chunk_t*  first;      // first published chunk
+  fanout_chunk_t*  last;       // last published chunk
+  fanout_chunk_t*  fill;       // chunk the parser records to
+  uint32_t         in_flight;
+  uint32_t         readers;
+  bool             done;       // no more chunks
+  bool             failed;     // g-code error or out of memory, targets are not finished
+} fanout_t;
+
+typedef struct {
+  fanout_t*        fo;
+  fanout_target_t* target;
+  pthread_t        thread;
+} fanout_worker_t;
+
+static void _fanout_publish(fanout_t* fo)
+{
+  fanout_chunk_t* c = fo->fill;
+  fo->fill = NULL;
+  if( !c || !c->count )
+  {
+    free( c );
+    return;
+  }
+  c->readers = fo->readers;
+
+  pthread_mutex_lock( &fo->lock );
+  while( fo->in_flight >= FANOUT_MAX_CHUNKS )
+    pthread_cond_wait( &fo->cond, &fo->lock );
+  if( fo->last )
+    fo->last->next = c;
+  else
+    fo->first = c;
+  fo->last = c;
+  fo->in_flight++;
+  pthread_cond_broadcast( &fo->cond );
+  pthread_mutex_unlock( &fo->lock );
+}
+
+static void _fanout_record(void* user, const umcwriter_cmd_t* cmd)
+{
+  fanout_t* fo = user;
+  if( !fo->fill && !(fo->fill = calloc(1, sizeof(fanout_chunk_t))) )
+  {
+    fo->failed = true;
+    return;
+  }
+  fo->fill->cmds[fo->fill->count++] = *cmd;
+  if( FANOUT_CHUNK_CMDS == fo->fill->count )
+    _fanout_publish( fo );
+}
+
+static void _fanout_end(fanout_t* fo, bool failed)
+{
+  _fanout_publish( fo );
+  pthread_mutex_lock( &fo->lock );
+  fo->done = true;
+  fo->failed |= failed;
+  pthread_cond_broadcast( &fo->cond );
+  pthread_mutex_unlock( &fo->lock );
+}
+
+//called locked
+static void _fanout_release(fanout_t* fo, fanout_chunk_t* c)
+{
+  if( --c->readers )
+    return;
+  if( fo->first == c ) //chunks are released in order
+    fo->first = c->next;
+  if( fo->last == c )
+    fo->last = NULL;
+  free( c );
+  fo->in_flight--;
+  pthread_cond_broadcast( &fo->cond );
+}
+
+static void* _fanout_worker(void* arg)
+{
+  fanout_worker_t* w = arg;
+  fanout_t* fo = w->fo;
+  transcoder_t* tc = w->target->tc;
+
+  fanout_chunk_t *c = NULL, *next;
+  bool started = false;
+  for(;;)
+  {
+    pthread_mutex_lock( &fo->lock );
+    while( !(next = started ? c->next : fo->first) && !fo->done )
+      pthread_cond_wait( &fo->cond, &fo->lock );
+    if( c )
+      _fanout_release( fo, c );
+    pthread_mutex_unlock( &fo->lock );
+
+    if( !next )
+      break;
+    started = true;
+
+    uint32_t i;
+    for( i=0; i<next->count; i++ )
+      umcwriter_replay( tc, &next->cmds[i] );
+    c = next;
+  }
+
+  if( fo->failed )
+    umcwriter_abort( tc ); //output stays as it is, like the serial transcode leaves it
+  else
+    umcwriter_finish( tc );
+  return NULL;
+}
+
+int fanout_transcode(FILE* fgcode, bool preheat, fanout_target_t* targets, uint32_t count)
+{
+  if( !count || (count>FANOUT_MAX_TARGETS) )
+    return -2;
+
+  uint32_t t;
+  for( t=0; t<count; t++ )
+    if( !arena_init(&targets[t].arena, TRANSCODER_ARENA_SIZE) || !(targets[t].tc = transcoder_create(&targets[t].arena, targets[t].settings)) )
+      return -2;
+
+  arena_t arena;
+  transcoder_t* parser;
+  if( !arena_init(&arena, TRANSCODER_ARENA_SIZE) || !(parser = transcoder_create(&arena, targets[0].settings)) )
+  {
+    arena_free( &arena );
+    return -2;
+  }
+
+  for( t=0; t<count; t++ )
+    if( !umcwriter_init( targets[t].tc, targets[t].fname_umc, targets[t].heightZ, targets[t].machine_type ) )
+    {
+      targets[t].open_failed = true;
+      while( t-- )
+        umcwriter_abort( targets[t].tc );
+      arena_free( &arena );
+      return -1;
+    }
+
+  fanout_t fo = { .readers = count };
+  pthread_mutex_init( &fo.lock, NULL );
+  pthread_cond_init( &fo.cond, NULL );
+
+  fanout_worker_t workers[FANOUT_MAX_TARGETS];
+  uint32_t started;
+  for( started=0; started<count; started++ )
+  {
+    workers[started].fo = &fo;
+    workers[started].target = &targets[started];
+    if( pthread_create( &workers[started].thread, NULL, _fanout_worker, &workers[started] ) )
+      break;
+  }
+
+  int ret = 1;
+  if( started<count )
+    ret = -2;
+  else
+  {
+    umcwriter_init_record( parser, _fanout_record, &fo );
+    gcp_reset( parser );
+
+    char line[1024];
+    if( preheat )
+    {
+      while( fgets(line,sizeof(line),fgcode) && gcp_preheat_scan(parser, line) );
+      rewind( fgcode );
+      gcp_preheat_start( parser );
+    }
+
+    while( fgets(line,sizeof(line),fgcode) && !fo.failed )
+      if( !gcp_process_line(parser, line) )
+      {
+        ret = 0;
+        break;
+      }
+    if( fo.failed && ret )
+      ret = -2;
+  }
+
+  _fanout_end( &fo, ret!=1 );
+  for( t=0; t<started; t++ )
+    pthread_join( workers[t].thread, NULL );
+  for( ; t<count; t++ )
+    umcwriter_abort( targets[t].tc );
+
+  //chunks of targets which never started
+  while( fo.first )
+  {
+    fanout_chunk_t* c = fo.first;
+    fo.first = c->next;
+    free( c );
+  }
+
+  //parser results for every target
+  gcp_state_t state;
+  gcp_get_state( parser, &state );
+  for( t=0; t<count; t++ )
+    gcp_set_state( targets[t].tc, &state );
+
+  pthread_cond_destroy( &fo.cond );
+  pthread_mutex_destroy( &fo.lock );
+  arena_free( &arena );
+  return ret;
+}
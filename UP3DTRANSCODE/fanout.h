@@ -0,0 +1,47 @@
+/*
+  fanout.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef fanout_h
+#define fanout_h
+
+#include "transcoder.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FANOUT_MAX_TARGETS 16
+
+// One output of a fan-out transcode
+typedef struct {
+  const settings_t* settings;
+  char              machine_type;
+  double            heightZ;
+  const char*       fname_umc;
+  arena_t           arena;     // owns tc, arena_free() when done with the results (also after errors)
+  transcoder_t*     tc;        // after the transcode: print time and parser results (layer, height)
+  bool              open_failed;
+} fanout_target_t;
+
+// Transcode fgcode for all targets in one pass: the g-code is parsed once, the writer commands are
+// handed to one thread per target with its own planner, stepper and writer. Targets must be zeroed
+// except for the inputs. Returns 1: done (umcwriter_finish() was already called for every target),
+// 0: g-code error, -1: output could not be written (open_failed is set), -2: out of memory
+int fanout_transcode(FILE* fgcode, bool preheat, fanout_target_t* targets, uint32_t count);
+
+#endif //fanout_h
@@ -18,6 +18,7 @@
 
 #include "gcodeparser.h"
 #include "umcwriter.h"
+#include "transcoder.h"
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -25,57 +26,198 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-static unsigned int gcp_line_number;
-static unsigned int gcp_file_line_number;
+#define gcp_error(e,s) { if(!tc->gcp.quiet) printf("GCP ERROR at line %d: %s\n>>%s\n",tc->gcp.file_line_number,e,s); }
+
+//feature names used by slic3r/prusaslicer and cura in ;TYPE: comments
+static const struct {
+  const char* name;
+  feature_t   feature;
+} gcp_feature_names[] = {
+  { "External perimeter",         FEATURE_OUTER_WALL },
+  { "Overhang perimeter",         FEATURE_OUTER_WALL },
+  { "WALL-OUTER",                 FEATURE_OUTER_WALL },
+  { "Perimeter",                  FEATURE_INNER_WALL },
+  { "Gap fill",                   FEATURE_INNER_WALL },
+  { "WALL-INNER",                 FEATURE_INNER_WALL },
+  { "Solid infill",               FEATURE_SKIN },
+  { "Top solid infill",           FEATURE_SKIN },
+  { "Bridge infill",              FEATURE_SKIN },
+  { "SKIN",                       FEATURE_SKIN },
+  { "Internal infill",            FEATURE_INFILL },
+  { "FILL",                       FEATURE_INFILL },
+  { "Support material",           FEATURE_SUPPORT },
+  { "Support material interface", FEATURE_SUPPORT },
+  { "SUPPORT",                    FEATURE_SUPPORT },
+  { "SUPPORT-INTERFACE",          FEATURE_SUPPORT },
+  { "Skirt",                      FEATURE_SKIRT },
+  { "Skirt/Brim",                 FEATURE_SKIRT },
+  { "SKIRT",                      FEATURE_SKIRT },
+};
+
+static void gcp_process_comment(transcoder_t* tc, const char* comment)
+{
+  while( ' '==*comment )
+    comment++;
 
-static bool gcp_use_absoulte;
-static bool gcp_use_extruder_absoulte;
-static double gcp_X,gcp_Y,gcp_Z,gcp_E,gcp_F;
+  if( strncmp(comment,"TYPE:",5) )
+    return;
+  comment += 5;
 
-static double gcp_Z_max_used;
-static unsigned int gcp_layer;
+  size_t len = strcspn(comment,"\r\n");
+  while( len && (' '==comment[len-1]) )
+    len--;
 
-#define gcp_error(e,s) { printf("GCP ERROR at line %d: %s\n>>%s\n",gcp_file_line_number,e,s); }
+  feature_t feature = FEATURE_DEFAULT;
+  size_t i;
+  for( i=0; i<sizeof(gcp_feature_names)/sizeof(gcp_feature_names[0]); i++ )
+    if( (strlen(gcp_feature_names[i].name)==len) && !strncmp(gcp_feature_names[i].name,comment,len) )
+    {
+      feature = gcp_feature_names[i].feature;
+      break;
+    }
 
-void gcp_reset()
+  umcwriter_set_feature(tc, feature);
+}
+
+void gcp_reset(transcoder_t* tc)
 {
-  gcp_line_number = 0;
-  gcp_file_line_number = 0;
+  tc->gcp.line_number = 0;
+  tc->gcp.file_line_number = 0;
 
-  gcp_use_absoulte = true;
-  gcp_use_extruder_absoulte = true;
+  tc->gcp.use_absolute = true;
+  tc->gcp.use_extruder_absolute = true;
   
-  gcp_X = gcp_Y = gcp_Z = gcp_E = 0;
-  gcp_F = 100;
+  tc->gcp.X = tc->gcp.Y = tc->gcp.Z = tc->gcp.E = 0;
+  tc->gcp.F = 100;
+
+  tc->gcp.Z_max_used = 0;
+  tc->gcp.layer = 0;
 
-  gcp_Z_max_used = 0;
-  gcp_layer = 0;
+  tc->gcp.preheat_bed = 0;
+  tc->gcp.preheat_nozzle = 0;
 }
 
-bool gcp_process_line(const char* gcodeline)
+// strtod() for the plain decimal numbers of g-code: up to 15 digits with up to 22 decimals are
+// exact as double, one division by the exact power of ten rounds like strtod() does. Anything
+// else (exponent, hex, inf/nan, white space, more digits) is left to strtod().
+static const double gcp_pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+static double gcp_strtod(const char* str, char** end)
+{
+  const char* p = str;
+  bool neg = false;
+  if( ('-'==*p) || ('+'==*p) )
+    neg = ('-'==*p++);
+
+  uint64_t mant = 0;
+  int digits = 0, decimals = 0;
+  bool any = false;
+  for( ; (*p>='0') && (*p<='9'); p++, any=true )
+    if( mant || ('0'!=*p) )
+      mant = mant*10 + (*p-'0'), digits++;
+  if( '.'==*p )
+    for( p++; (*p>='0') && (*p<='9'); p++, any=true )
+    {
+      mant = mant*10 + (*p-'0');
+      if( mant )
+        digits++;
+      decimals++;
+    }
+
+  if( !any || (digits>15) || (decimals>22) || ('e'==*p) || ('E'==*p) || ('x'==*p) || ('X'==*p) )
+    return strtod( str, end );
+
+  if( end )
+    *end = (char*)p;
+  double v = decimals ? (double)mant/gcp_pow10[decimals] : (double)mant;
+  return neg ? -v : v;
+}
+
+//find parameter word in a raw line (ends at comment or checksum)
+static bool gcp_find_word(const char* line, char word, double* value)
+{
+  for( ; *line && (';'!=*line) && ('*'!=*line); line++ )
+    if( (' '==*line) && (word==line[1]) )
+    {
+      *value = gcp_strtod( line+2, NULL );
+      return true;
+    }
+  return false;
+}
+
+bool gcp_preheat_scan(transcoder_t* tc, const char* gcodeline)
+{
+  const char* line = gcodeline;
+  double code, val;
+
+  if( 'N'==*line )
+  {
+    if( !(line = strchr(line,' ')) )
+      return true; //empty line
+    line++;
+  }
+
+  if( 'G'==*line )
+  {
+    code = gcp_strtod( line+1, NULL );
+    if( ((0==code) || (1==code)) && gcp_find_word(line,'E',&val) )
+      return false; //first extruding move ends the start sequence
+  }
+
+  if( 'M'==*line )
+  {
+    code = gcp_strtod( line+1, NULL );
+    if( !gcp_find_word(line,'S',&val) && !gcp_find_word(line,'R',&val) )
+      return true;
+
+    if( ((104==code) || (109==code)) && !tc->gcp.preheat_nozzle )
+      tc->gcp.preheat_nozzle = val;
+
+    if( ((140==code) || (190==code)) && !tc->gcp.preheat_bed )
+      tc->gcp.preheat_bed = val;
+  }
+
+  return true;
+}
+
+void gcp_preheat_start(transcoder_t* tc)
+{
+  //bed is the slowest heater, switch it on first
+  if( tc->gcp.preheat_bed>0 )
+    umcwriter_set_bed_temp(tc, tc->gcp.preheat_bed,false);
+  if( tc->gcp.preheat_nozzle>0 )
+    umcwriter_set_extruder_temp(tc, tc->gcp.preheat_nozzle,false);
+}
+
+bool gcp_process_line(transcoder_t* tc, const char* gcodeline)
 {
   if( !gcodeline )
     return false;
 
   char _line[256];
-  strncpy( _line, gcodeline, sizeof(_line) );
+  size_t len = strlen( gcodeline );
+  if( len >= sizeof(_line) )
+    len = sizeof(_line)-1;
+  memcpy( _line, gcodeline, len );
+  _line[len] = 0;
   char *line = _line;
   char *tok;
 
-  gcp_file_line_number++;
+  tc->gcp.file_line_number++;
   
   if( (0==*line) || ('\n'==*line) || ('\r'==*line) )
     return true; //empty line
 
   if( 'N'==*line )
   {
-    double lineno = strtod( line+1, NULL);
-    if( gcp_line_number+1 != lineno )
+    double lineno = gcp_strtod( line+1, NULL);
+    if( tc->gcp.line_number+1 != lineno )
     {
       gcp_error("Invalid line number sequence",gcodeline);
       return false;
     }
-    gcp_line_number = lineno;
+    tc->gcp.line_number = lineno;
 
     tok = strchr(line,' '); //jump over line number
     if( !tok )
@@ -85,7 +227,7 @@ bool gcp_process_line(const char* gcodeline)
 
   if( (tok = strchr(line,'*')) )
   {
-    double checksum = strtod( tok+1, NULL);
+    double checksum = gcp_strtod( tok+1, NULL);
     uint8_t csx=0;
     for( tok--; tok!=line; tok-- )
       csx^=*tok;
@@ -99,6 +241,8 @@ bool gcp_process_line(const char* gcodeline)
 
   if( (tok = strchr(line,';')) )
   {
+    gcp_process_comment(tc, tok+1);
+
     if( tok == line )
       return true; //complete line is a comment
 
@@ -115,44 +259,44 @@ bool gcp_process_line(const char* gcodeline)
       break;
 
     char* ref=NULL;
-    if('X'==*tok){xp=true;xv=strtod(tok+1,&ref);xb=(ref!=NULL);}
-    if('Y'==*tok){yp=true;yv=strtod(tok+1,&ref);yb=(ref!=NULL);}
-    if('Z'==*tok){zp=true;zv=strtod(tok+1,&ref);zb=(ref!=NULL);}
-    if('E'==*tok){ep=true;ev=strtod(tok+1,&ref);eb=(ref!=NULL);}
-    if('F'==*tok){fp=true;fv=strtod(tok+1,&ref);fb=(ref!=NULL);}
-    if('T'==*tok){tp=true;tv=strtod(tok+1,&ref);tb=(ref!=NULL);}
-    if('S'==*tok){sp=true;sv=strtod(tok+1,&ref);sb=(ref!=NULL);}
-    if('P'==*tok){pp=true;pv=strtod(tok+1,&ref);pb=(ref!=NULL);}
-    if('R'==*tok){rp=true;rv=strtod(tok+1,&ref);rb=(ref!=NULL);}
+    if('X'==*tok){xp=true;xv=gcp_strtod(tok+1,&ref);xb=(ref!=NULL);}
+    if('Y'==*tok){yp=true;yv=gcp_strtod(tok+1,&ref);yb=(ref!=NULL);}
+    if('Z'==*tok){zp=true;zv=gcp_strtod(tok+1,&ref);zb=(ref!=NULL);}
+    if('E'==*tok){ep=true;ev=gcp_strtod(tok+1,&ref);eb=(ref!=NULL);}
+    if('F'==*tok){fp=true;fv=gcp_strtod(tok+1,&ref);fb=(ref!=NULL);}
+    if('T'==*tok){tp=true;tv=gcp_strtod(tok+1,&ref);tb=(ref!=NULL);}
+    if('S'==*tok){sp=true;sv=gcp_strtod(tok+1,&ref);sb=(ref!=NULL);}
+    if('P'==*tok){pp=true;pv=gcp_strtod(tok+1,&ref);pb=(ref!=NULL);}
+    if('R'==*tok){rp=true;rv=gcp_strtod(tok+1,&ref);rb=(ref!=NULL);}
   }
   
   if( 'G'==*line )
   {
     char* ref = NULL;
-    double code = strtod( line+1, &ref ); if(!ref) code=-1;
+    double code = gcp_strtod( line+1, &ref ); if(!ref) code=-1;
     switch( (int)code )
     {
       case 0:
       case 1: //move
        {
-        if(fb) gcp_F=fv;
-        if(eb) gcp_E=(gcp_use_absoulte||gcp_use_extruder_absoulte)?ev:gcp_E+ev;
-        if(xb) gcp_X=(gcp_use_absoulte)?xv:gcp_X+xv;
-        if(yb) gcp_Y=(gcp_use_absoulte)?yv:gcp_Y+yv;
-        if(zb) gcp_Z=(gcp_use_absoulte)?zv:gcp_Z+zv;
+        if(fb) tc->gcp.F=fv;
+        if(eb) tc->gcp.E=(tc->gcp.use_absolute||tc->gcp.use_extruder_absolute)?ev:tc->gcp.E+ev;
+        if(xb) tc->gcp.X=(tc->gcp.use_absolute)?xv:tc->gcp.X+xv;
+        if(yb) tc->gcp.Y=(tc->gcp.use_absolute)?yv:tc->gcp.Y+yv;
+        if(zb) tc->gcp.Z=(tc->gcp.use_absolute)?zv:tc->gcp.Z+zv;
         if(zb)
         {
-          umcwriter_move_direct(gcp_X,gcp_Y,gcp_Z,gcp_E,gcp_F);
+          umcwriter_move_direct(tc, tc->gcp.X,tc->gcp.Y,tc->gcp.Z,tc->gcp.E,tc->gcp.F);
 
-          if( gcp_Z > gcp_Z_max_used )
+          if( tc->gcp.Z > tc->gcp.Z_max_used )
           {
-            gcp_Z_max_used = gcp_Z;
-            gcp_layer++;
+            tc->gcp.Z_max_used = tc->gcp.Z;
+            tc->gcp.layer++;
           }
-          umcwriter_set_report_data( gcp_layer, gcp_Z );
+          umcwriter_set_report_data(tc, tc->gcp.layer, tc->gcp.Z );
         }
         else
-          umcwriter_planner_add(gcp_X,gcp_Y,gcp_E,gcp_F);
+          umcwriter_planner_add(tc, tc->gcp.X,tc->gcp.Y,tc->gcp.E,tc->gcp.F);
        }
        break;
 
@@ -167,7 +311,7 @@ bool gcp_process_line(const char* gcodeline)
           if(sb) msec=sv*1000;
           if(pb) msec=pv;
           if(msec)
-            umcwriter_pause(msec);
+            umcwriter_pause(tc, msec);
         }
         break;
 
@@ -177,31 +321,31 @@ bool gcp_process_line(const char* gcodeline)
       case 28: //home
         {
           if(!xp && !yp && !zp) {xp=true;yp=true;zp=true;} //if no parameter given home all axis
-          if(xp){ gcp_X=0; }
-          if(yp){ gcp_Y=0; }
-          if(zp){ gcp_Z=0; }
-          umcwriter_virtual_home(xp?100*60:0,yp?100*60:0,zp?50*60:0);
+          if(xp){ tc->gcp.X=0; }
+          if(yp){ tc->gcp.Y=0; }
+          if(zp){ tc->gcp.Z=0; }
+          umcwriter_virtual_home(tc, xp?100*60:0,yp?100*60:0,zp?50*60:0);
         }
         break;
 
       case 90: //set absolute positioning
-        gcp_use_absoulte = true;
+        tc->gcp.use_absolute = true;
         break;
 
       case 91: //set relative positioning
-        gcp_use_absoulte = false;
+        tc->gcp.use_absolute = false;
         break;
 
       case 92: //set position
         {
-          if(xb) gcp_X=xv;
-          if(yb) gcp_Y=yv;
-          if(zb) gcp_Z=zv;
-          if(eb) gcp_E=ev;
+          if(xb) tc->gcp.X=xv;
+          if(yb) tc->gcp.Y=yv;
+          if(zb) tc->gcp.Z=zv;
+          if(eb) tc->gcp.E=ev;
           if( xb || yb )
-            umcwriter_planner_set_position(gcp_X,gcp_Y,gcp_E);
+            umcwriter_planner_set_position(tc, tc->gcp.X,tc->gcp.Y,tc->gcp.E);
           else if(eb)
-            umcwriter_planner_set_a_position(gcp_E);
+            umcwriter_planner_set_a_position(tc, tc->gcp.E);
             
         }
         break;
@@ -215,21 +359,21 @@ bool gcp_process_line(const char* gcodeline)
   if( 'M'==*line )
   {
     char* ref=NULL;
-    double code = strtod( line+1, &ref ); if(!ref) code=-1;
+    double code = gcp_strtod( line+1, &ref ); if(!ref) code=-1;
     switch( (int)code )
     {
       case 82: //set extruder absolute mode - default
-        gcp_use_extruder_absoulte = true;
+        tc->gcp.use_extruder_absolute = true;
         break;
       case 83: //set extruder relative mode
-        gcp_use_extruder_absoulte = false;
+        tc->gcp.use_extruder_absolute = false;
         break;
 
       case 84: //disable motors
         break;
 
       case 104://set extruder target temp
-        if( sb ) umcwriter_set_extruder_temp(sv,false);
+        if( sb ) umcwriter_set_extruder_temp(tc, sv,false);
         break;
 
       case 106: //fan
@@ -242,21 +386,21 @@ bool gcp_process_line(const char* gcodeline)
         break;
 
       case 109: //set extrduder target temp and wait
-        if( sb ) umcwriter_set_extruder_temp(sv,true);
-        if( rb ) umcwriter_set_extruder_temp(rv,true);
+        if( sb ) umcwriter_set_extruder_temp(tc, sv,true);
+        if( rb ) umcwriter_set_extruder_temp(tc, rv,true);
         break;
 
       case 140: //set bed target temp
-        if( sb ) umcwriter_set_bed_temp(sv,false);
+        if( sb ) umcwriter_set_bed_temp(tc, sv,false);
         break;
 
       case 190: //set bed target temp and wait
-        if( sb ) umcwriter_set_bed_temp(sv,true);
-        if( rb ) umcwriter_set_bed_temp(rv,true);
+        if( sb ) umcwriter_set_bed_temp(tc, sv,true);
+        if( rb ) umcwriter_set_bed_temp(tc, rv,true);
         break;
 
       case 300: //play beep sound
-        if( pb ) umcwriter_beep(pv);
+        if( pb ) umcwriter_beep(tc, pv);
         break;
 
       default:
@@ -268,7 +412,7 @@ bool gcp_process_line(const char* gcodeline)
   if( 'T'==*line )
   {
     //double code = strtod( line+1, NULL);
-    umcwriter_planner_sync();
+    umcwriter_planner_sync(tc);
     //ignore any T (tool change) commands
   }
   else
@@ -280,12 +424,39 @@ bool gcp_process_line(const char* gcodeline)
   return true;
 }
 
-int gcp_get_layer()
+void gcp_set_quiet(transcoder_t* tc, bool quiet)
+{
+  tc->gcp.quiet = quiet;
+}
+
+void gcp_get_state(transcoder_t* tc, gcp_state_t* state)
+{
+  state->line_number = tc->gcp.line_number;
+  state->file_line_number = tc->gcp.file_line_number;
+  state->use_absolute = tc->gcp.use_absolute;
+  state->use_extruder_absolute = tc->gcp.use_extruder_absolute;
+  state->X = tc->gcp.X; state->Y = tc->gcp.Y; state->Z = tc->gcp.Z; state->E = tc->gcp.E; state->F = tc->gcp.F;
+  state->Z_max_used = tc->gcp.Z_max_used;
+  state->layer = tc->gcp.layer;
+}
+
+void gcp_set_state(transcoder_t* tc, const gcp_state_t* state)
+{
+  tc->gcp.line_number = state->line_number;
+  tc->gcp.file_line_number = state->file_line_number;
+  tc->gcp.use_absolute = state->use_absolute;
+  tc->gcp.use_extruder_absolute = state->use_extruder_absolute;
+  tc->gcp.X = state->X; tc->gcp.Y = state->Y; tc->gcp.Z = state->Z; tc->gcp.E = state->E; tc->gcp.F = state->F;
+  tc->gcp.Z_max_used = state->Z_max_used;
+  tc->gcp.layer = state->layer;
+}
+
+int gcp_get_layer(transcoder_t* tc)
 {
-  return gcp_layer;
+  return tc->gcp.layer;
 }
 
-double gcp_get_height()
+double gcp_get_height(transcoder_t* tc)
 {
-  return gcp_Z_max_used;
+  return tc->gcp.Z_max_used;
 }
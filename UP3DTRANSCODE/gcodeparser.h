@@ -19,12 +19,47 @@
 #ifndef gcodeparser_h
 #define gcodeparser_h
 
+#include "up3dconf.h"
+
 #include <stdint.h>
 #include <stdbool.h>
 
-void   gcp_reset();
-bool   gcp_process_line(const char* gcodeline);
-int    gcp_get_layer();
-double gcp_get_height();
+// Parser state of one transcoder
+typedef struct {
+  unsigned int line_number;
+  unsigned int file_line_number;
+  bool         use_absolute;
+  bool         use_extruder_absolute;
+  double       X,Y,Z,E,F;
+  double       Z_max_used;
+  unsigned int layer;
+  double       preheat_bed;
+  double       preheat_nozzle;
+  bool         quiet;
+} gcp_ctx_t;
+
+// Parser state carried from one line to the next
+typedef struct {
+  unsigned int line_number;
+  unsigned int file_line_number;
+  bool         use_absolute;
+  bool         use_extruder_absolute;
+  double       X,Y,Z,E,F;
+  double       Z_max_used;
+  unsigned int layer;
+} gcp_state_t;
+
+void   gcp_reset(transcoder_t* tc);
+bool   gcp_process_line(transcoder_t* tc, const char* gcodeline);
+int    gcp_get_layer(transcoder_t* tc);
+double gcp_get_height(transcoder_t* tc);
+void   gcp_get_state(transcoder_t* tc, gcp_state_t* state);
+void   gcp_set_state(transcoder_t* tc, const gcp_state_t* state);
+void   gcp_set_quiet(transcoder_t* tc, bool quiet); // no error messages
+
+// Preheat hoisting: scan the start sequence line by line until false is returned,
+// then switch on all heaters found there at once so they can heat up concurrently
+bool   gcp_preheat_scan(transcoder_t* tc, const char* gcodeline);
+void   gcp_preheat_start(transcoder_t* tc);
 
 #endif //gcodeparser_h
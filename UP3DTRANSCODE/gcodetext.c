@@ -0,0 +1,91 @@
+/*
+  gcodetext.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gcodetext.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+bool gcodetext_read(gcodetext_t* gt, FILE* fgcode)
+{
+  gt->lines = NULL;
+  gt->line_count = 0;
+
+  size_t size = 0, alloc = 1<<20;
+  gt->text = malloc(alloc);
+  for(;;)
+  {
+    if( !gt->text )
+      return false;
+    size += fread( gt->text+size, 1, alloc-size, fgcode );
+    if( size<alloc )
+      break;
+    alloc *= 2;
+    char* text = realloc( gt->text, alloc );
+    if( !text )
+      free( gt->text );
+    gt->text = text;
+  }
+
+  uint32_t count = 0, alloc_lines = 1<<16;
+  gt->lines = malloc( alloc_lines*sizeof(uint32_t) );
+  size_t pos = 0;
+  while( gt->lines && (pos<size) )
+  {
+    if( count+1 >= alloc_lines )
+    {
+      alloc_lines *= 2;
+      uint32_t* lines = realloc( gt->lines, alloc_lines*sizeof(uint32_t) );
+      if( !lines )
+        free( gt->lines );
+      gt->lines = lines;
+      if( !gt->lines )
+        break;
+    }
+    gt->lines[count++] = pos;
+    size_t end = pos + GCODETEXT_LINE_LEN-1;
+    if( end>size )
+      end = size;
+    char* nl = memchr( gt->text+pos, '\n', end-pos );
+    pos = nl ? (size_t)(nl-gt->text)+1 : end;
+  }
+  if( !gt->lines )
+    return false;
+  gt->lines[count] = size;
+  gt->line_count = count;
+  return true;
+}
+
+void gcodetext_free(gcodetext_t* gt)
+{
+  free( gt->text );
+  free( gt->lines );
+  gt->text = NULL;
+  gt->lines = NULL;
+  gt->line_count = 0;
+}
+
+void gcodetext_get_line(const gcodetext_t* gt, uint32_t index, char* line)
+{
+  size_t len = gt->lines[index+1]-gt->lines[index];
+  memcpy( line, gt->text+gt->lines[index], len );
+  line[len] = 0;
+}
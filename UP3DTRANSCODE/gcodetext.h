@@ -0,0 +1,41 @@
+/*
+  gcodetext.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef gcodetext_h
+#define gcodetext_h
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GCODETEXT_LINE_LEN 1024 //same line splitting as fgets() of the serial transcode
+
+// Complete g-code file in memory with random access to its lines
+typedef struct {
+  char*     text;
+  uint32_t* lines; //line start offsets, lines[line_count] is end of text
+  uint32_t  line_count;
+} gcodetext_t;
+
+bool gcodetext_read(gcodetext_t* gt, FILE* fgcode);
+void gcodetext_free(gcodetext_t* gt);
+
+// line needs GCODETEXT_LINE_LEN chars
+void gcodetext_get_line(const gcodetext_t* gt, uint32_t index, char* line);
+
+#endif //gcodetext_h
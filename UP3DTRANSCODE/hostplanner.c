@@ -28,6 +28,7 @@
 
 #include "hostplanner.h"
 #include "hoststepper.h"
+#include "transcoder.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -36,26 +37,9 @@
 
 #define get_direction_pin_mask(a) (1<<a)
 
-#define SOME_LARGE_VALUE 1.0E+38 // Used by rapids and acceleration maximization calculations. Just needs
+#define SOME_LARGE_VALUE REAL(1.0E+38) // Used by rapids and acceleration maximization calculations. Just needs
                                  // to be larger than any feasible (mm/min)^2 or mm/sec^2 value.
 
-static plan_block_t block_buffer[BLOCK_BUFFER_SIZE];  // A ring buffer for motion instructions
-static uint32_t block_buffer_tail;     // Index of the block to process now
-static uint32_t block_buffer_head;     // Index of the next block to be pushed
-static uint32_t next_buffer_head;      // Index of the next buffer head
-static uint32_t block_buffer_planned;  // Index of the optimally planned block
-
-// Define planner variables
-typedef struct {
-  int32_t position[N_AXIS];          // The planner position of the tool in absolute steps. Kept separate
-                                     // from g-code position for movements requiring multiple line motions,
-                                     // i.e. arcs, canned cycles, and backlash compensation.
-  double previous_unit_vec[N_AXIS];   // Unit vector of previous path line segment
-  double previous_nominal_speed_sqr;  // Nominal speed of previous path line segment
-} planner_t;
-static planner_t pl;
-
-
 // Returns the index of the next block in the ring buffer. Also called by stepper segment buffer.
 uint32_t plan_next_block_index(uint32_t block_index) 
 {
@@ -139,36 +123,36 @@ static uint32_t plan_prev_block_index(uint32_t block_index)
   ARM versions should have enough memory and speed for look-ahead blocks numbering up to a hundred or more.
 
 */
-static void planner_recalculate() 
+static void planner_recalculate(transcoder_t* tc) 
 {   
   // Initialize block index to the last block in the planner buffer.
-  uint32_t block_index = plan_prev_block_index(block_buffer_head);
+  uint32_t block_index = plan_prev_block_index(tc->plan.block_buffer_head);
         
   // Bail. Can't do anything with one only one plan-able block.
-  if (block_index == block_buffer_planned) { return; }
+  if (block_index == tc->plan.block_buffer_planned) { return; }
       
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
   // NOTE: Forward pass will later refine and correct the reverse pass to create an optimal plan.
-  double entry_speed_sqr;
+  real_t entry_speed_sqr;
   plan_block_t *next;
-  plan_block_t *current = &block_buffer[block_index];
+  plan_block_t *current = &tc->plan.block_buffer[block_index];
 
   // Calculate maximum entry speed for last block in buffer, where the exit speed is always zero.
   current->entry_speed_sqr = min( current->max_entry_speed_sqr, 2*current->acceleration*current->millimeters);
   
   block_index = plan_prev_block_index(block_index);
-  if (block_index == block_buffer_planned) { // Only two plannable blocks in buffer. Reverse pass complete.
+  if (block_index == tc->plan.block_buffer_planned) { // Only two plannable blocks in buffer. Reverse pass complete.
     // Check if the first block is the tail. If so, notify stepper to update its current parameters.
-    if (block_index == block_buffer_tail) { st_update_plan_block_parameters(); }
+    if (block_index == tc->plan.block_buffer_tail) { st_update_plan_block_parameters(tc); }
   } else { // Three or more plan-able blocks
-    while (block_index != block_buffer_planned) { 
+    while (block_index != tc->plan.block_buffer_planned) { 
       next = current;
-      current = &block_buffer[block_index];
+      current = &tc->plan.block_buffer[block_index];
       block_index = plan_prev_block_index(block_index);
 
       // Check if next block is the tail block(=planned block). If so, update current stepper parameters.
-      if (block_index == block_buffer_tail) { st_update_plan_block_parameters(); } 
+      if (block_index == tc->plan.block_buffer_tail) { st_update_plan_block_parameters(tc); } 
 
       // Compute maximum entry speed decelerating over the current block from its exit speed.
       if (current->entry_speed_sqr != current->max_entry_speed_sqr) {
@@ -184,11 +168,11 @@ static void planner_recalculate()
 
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
-  next = &block_buffer[block_buffer_planned]; // Begin at buffer planned pointer
-  block_index = plan_next_block_index(block_buffer_planned); 
-  while (block_index != block_buffer_head) {
+  next = &tc->plan.block_buffer[tc->plan.block_buffer_planned]; // Begin at buffer planned pointer
+  block_index = plan_next_block_index(tc->plan.block_buffer_planned); 
+  while (block_index != tc->plan.block_buffer_head) {
     current = next;
-    next = &block_buffer[block_index];
+    next = &tc->plan.block_buffer[block_index];
     
     // Any acceleration detected in the forward pass automatically moves the optimal planned
     // pointer forward, since everything before this is all optimal. In other words, nothing
@@ -198,7 +182,7 @@ static void planner_recalculate()
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (entry_speed_sqr < next->entry_speed_sqr) {
         next->entry_speed_sqr = entry_speed_sqr; // Always <= max_entry_speed_sqr. Backward pass sets this.
-        block_buffer_planned = block_index; // Set optimal plan pointer.
+        tc->plan.block_buffer_planned = block_index; // Set optimal plan pointer.
       }
     }
     
@@ -206,52 +190,53 @@ static void planner_recalculate()
     // point in the buffer. When the plan is bracketed by either the beginning of the
     // buffer and a maximum entry speed or two maximum entry speeds, every block in between
     // cannot logically be further improved. Hence, we don't have to recompute them anymore.
-    if (next->entry_speed_sqr == next->max_entry_speed_sqr) { block_buffer_planned = block_index; }
+    if (next->entry_speed_sqr == next->max_entry_speed_sqr) { tc->plan.block_buffer_planned = block_index; }
     block_index = plan_next_block_index( block_index );
   } 
 }
 
 
-void plan_reset() 
+void plan_reset(transcoder_t* tc) 
 {
-  memset(&pl, 0, sizeof(planner_t)); // Clear planner struct
-  block_buffer_tail = 0;
-  block_buffer_head = 0; // Empty = tail
-  next_buffer_head = 1; // plan_next_block_index(block_buffer_head)
-  block_buffer_planned = 0; // = block_buffer_tail;
+  memset(&tc->plan.pl, 0, sizeof(planner_t)); // Clear planner struct
+  plan_set_feature(tc, FEATURE_DEFAULT);
+  tc->plan.block_buffer_tail = 0;
+  tc->plan.block_buffer_head = 0; // Empty = tail
+  tc->plan.next_buffer_head = 1; // plan_next_block_index(block_buffer_head)
+  tc->plan.block_buffer_planned = 0; // = block_buffer_tail;
 }
 
 
-void plan_discard_current_block() 
+void plan_discard_current_block(transcoder_t* tc) 
 {
-  if (block_buffer_head != block_buffer_tail) { // Discard non-empty buffer.
-    uint32_t block_index = plan_next_block_index( block_buffer_tail );
+  if (tc->plan.block_buffer_head != tc->plan.block_buffer_tail) { // Discard non-empty buffer.
+    uint32_t block_index = plan_next_block_index( tc->plan.block_buffer_tail );
     // Push block_buffer_planned pointer, if encountered.
-    if (block_buffer_tail == block_buffer_planned) { block_buffer_planned = block_index; }
-    block_buffer_tail = block_index;
+    if (tc->plan.block_buffer_tail == tc->plan.block_buffer_planned) { tc->plan.block_buffer_planned = block_index; }
+    tc->plan.block_buffer_tail = block_index;
   }
 }
 
 
-plan_block_t *plan_get_current_block() 
+plan_block_t *plan_get_current_block(transcoder_t* tc) 
 {
-  if (block_buffer_head == block_buffer_tail) { return(NULL); } // Buffer empty  
-  return(&block_buffer[block_buffer_tail]);
+  if (tc->plan.block_buffer_head == tc->plan.block_buffer_tail) { return(NULL); } // Buffer empty  
+  return(&tc->plan.block_buffer[tc->plan.block_buffer_tail]);
 }
 
 
-double plan_get_exec_block_exit_speed()
+real_t plan_get_exec_block_exit_speed(transcoder_t* tc)
 {
-  uint32_t block_index = plan_next_block_index(block_buffer_tail);
-  if (block_index == block_buffer_head) { return( 0.0 ); }
-  return( sqrt( block_buffer[block_index].entry_speed_sqr ) ); 
+  uint32_t block_index = plan_next_block_index(tc->plan.block_buffer_tail);
+  if (block_index == tc->plan.block_buffer_head) { return( REAL(0.0) ); }
+  return( real_sqrt( tc->plan.block_buffer[block_index].entry_speed_sqr ) ); 
 }
 
 
 // Returns the availability status of the block ring buffer. True, if full.
-bool plan_check_full_buffer()
+bool plan_check_full_buffer(transcoder_t* tc)
 {
-  if (block_buffer_tail == next_buffer_head) { return(true); }
+  if (tc->plan.block_buffer_tail == tc->plan.next_buffer_head) { return(true); }
   return(false);
 }
 
@@ -266,10 +251,10 @@ bool plan_check_full_buffer()
    is used in three ways: as a normal feed rate if invert_feed_rate is false, as inverse time if
    invert_feed_rate is true, or as seek/rapids rate if the feed_rate value is negative (and
    invert_feed_rate always false). */
-void plan_buffer_line(double *target, double feed_rate, bool invert_feed_rate) 
+void plan_buffer_line(transcoder_t* tc, double *target, real_t feed_rate, bool invert_feed_rate) 
 {
   // Prepare and initialize new block
-  plan_block_t *block = &block_buffer[block_buffer_head];
+  plan_block_t *block = &tc->plan.block_buffer[tc->plan.block_buffer_head];
   block->step_event_count = 0;
   block->millimeters = 0;
   block->direction_bits = 0;
@@ -279,17 +264,17 @@ void plan_buffer_line(double *target, double feed_rate, bool invert_feed_rate)
   // TODO: After this for-loop, we don't touch the stepper algorithm data. Might be a good idea
   // to try to keep these types of things completely separate from the planner for portability.
   int32_t target_steps[N_AXIS];
-  double unit_vec[N_AXIS], delta_mm;
+  real_t unit_vec[N_AXIS], delta_mm;
   uint32_t idx;
 
   for (idx=0; idx<N_AXIS; idx++) {
     // Calculate target position in absolute steps, number of steps for each axis, and determine max step events.
     // Also, compute individual axes distance for move and prep unit vector calculations.
     // NOTE: Computes true distance from converted step values.
-    target_steps[idx] = round(target[idx]*settings.steps_per_mm[idx]);
-    block->steps[idx] = abs(target_steps[idx]-pl.position[idx]);
+    target_steps[idx] = round(target[idx]*tc->settings.steps_per_mm[idx]);
+    block->steps[idx] = abs(target_steps[idx]-tc->plan.pl.position[idx]);
     block->step_event_count = max(block->step_event_count, block->steps[idx]);
-    delta_mm = (target_steps[idx] - pl.position[idx])/settings.steps_per_mm[idx];
+    delta_mm = (target_steps[idx] - tc->plan.pl.position[idx])/tc->settings.steps_per_mm[idx];
     unit_vec[idx] = delta_mm; // Store unit vector numerator. Denominator computed later.
         
     // Set direction bits. Bit enabled always means direction is negative.
@@ -298,7 +283,7 @@ void plan_buffer_line(double *target, double feed_rate, bool invert_feed_rate)
     // Incrementally compute total move distance by Euclidean norm. First add square of each term.
     block->millimeters += delta_mm*delta_mm;
   }
-  block->millimeters = sqrt(block->millimeters); // Complete millimeters calculation with sqrt()
+  block->millimeters = real_sqrt(block->millimeters); // Complete millimeters calculation with sqrt()
   // Bail if this is a zero-length block. Highly unlikely to occur.
   if (block->step_event_count == 0) { return; } 
   
@@ -312,32 +297,32 @@ void plan_buffer_line(double *target, double feed_rate, bool invert_feed_rate)
   // down such that no individual axes maximum values are exceeded with respect to the line direction. 
   // NOTE: This calculation assumes all axes are orthogonal (Cartesian) and works with ABC-axes,
   // if they are also orthogonal/independent. Operates on the absolute value of the unit vector.
-  double inverse_unit_vec_value;
-  double inverse_millimeters = 1.0/block->millimeters;  // Inverse millimeters to remove multiple double divides
-  double junction_cos_theta = 0;
+  real_t inverse_unit_vec_value;
+  real_t inverse_millimeters = REAL(1.0)/block->millimeters;  // Inverse millimeters to remove multiple double divides
+  real_t junction_cos_theta = 0;
   for (idx=0; idx<N_AXIS; idx++) {
     if (unit_vec[idx] != 0) {  // Avoid divide by zero.
       unit_vec[idx] *= inverse_millimeters;  // Complete unit vector calculation
-      inverse_unit_vec_value = fabs(1.0/unit_vec[idx]); // Inverse to remove multiple double divides.
+      inverse_unit_vec_value = real_fabs(REAL(1.0)/unit_vec[idx]); // Inverse to remove multiple double divides.
 
       // Check and limit feed rate against max individual axis velocities and accelerations
-      feed_rate = min(feed_rate,settings.max_rate[idx]*inverse_unit_vec_value);
-      block->acceleration = min(block->acceleration,settings.acceleration[idx]*inverse_unit_vec_value);
+      feed_rate = min(feed_rate,(real_t)tc->settings.max_rate[idx]*inverse_unit_vec_value);
+      block->acceleration = min(block->acceleration,tc->plan.pl.acceleration[idx]*inverse_unit_vec_value);
 
       if( A_AXIS != idx )
       {
         // Incrementally compute cosine of angle between previous and current path. Cos(theta) of the junction
         // between the current move and the previous move is simply the dot product of the two unit vectors,
         // where prev_unit_vec is negative. Used later to compute maximum junction speed.
-        junction_cos_theta -= pl.previous_unit_vec[idx] * unit_vec[idx];
+        junction_cos_theta -= tc->plan.pl.previous_unit_vec[idx] * unit_vec[idx];
       }
     }
     
-    block->factor[idx] = unit_vec[idx] * settings.steps_per_mm[idx];
+    block->factor[idx] = unit_vec[idx] * (real_t)tc->settings.steps_per_mm[idx];
   }
   
   // TODO: Need to check this method handling zero junction speeds when starting from rest.
-  if (block_buffer_head == block_buffer_tail) {
+  if (tc->plan.block_buffer_head == tc->plan.block_buffer_tail) {
   
     // Initialize block entry speed as zero. Assume it will be starting from rest. Planner will correct this later.
     block->entry_speed_sqr = 0.0;
@@ -368,17 +353,17 @@ void plan_buffer_line(double *target, double feed_rate, bool invert_feed_rate)
        change the overall maximum entry speed conditions of all blocks.
     */
     // NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
-    if (junction_cos_theta > 0.999999) {
+    if (junction_cos_theta > REAL(0.999999)) {
       //  For a 0 degree acute junction, just set minimum junction speed. 
       block->max_junction_speed_sqr = MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED;
     } else {
-      junction_cos_theta = max(junction_cos_theta,-0.999999); // Check for numerical round-off to avoid divide by zero.
-      double sin_theta_d2 = sqrt(0.5*(1.0-junction_cos_theta)); // Trig half angle identity. Always positive.
+      junction_cos_theta = max(junction_cos_theta,-REAL(0.999999)); // Check for numerical round-off to avoid divide by zero.
+      real_t sin_theta_d2 = real_sqrt(REAL(0.5)*(REAL(1.0)-junction_cos_theta)); // Trig half angle identity. Always positive.
 
       // TODO: Technically, the acceleration used in calculation needs to be limited by the minimum of the
       // two junctions. However, this shouldn't be a significant problem except in extreme circumstances.
       block->max_junction_speed_sqr = max( MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED,
-                                   (block->acceleration * settings.junction_deviation * sin_theta_d2)/(1.0-sin_theta_d2) );
+                                   (block->acceleration * tc->plan.pl.junction_deviation * sin_theta_d2)/(REAL(1.0)-sin_theta_d2) );
 
     }
   }
@@ -388,63 +373,223 @@ void plan_buffer_line(double *target, double feed_rate, bool invert_feed_rate)
   
   // Compute the junction maximum entry based on the minimum of the junction speed and neighboring nominal speeds.
   block->max_entry_speed_sqr = min(block->max_junction_speed_sqr, 
-                                   min(block->nominal_speed_sqr,pl.previous_nominal_speed_sqr));
+                                   min(block->nominal_speed_sqr,tc->plan.pl.previous_nominal_speed_sqr));
   
   // Update previous path unit_vector and nominal speed (squared)
-  memcpy(pl.previous_unit_vec, unit_vec, sizeof(unit_vec)); // pl.previous_unit_vec[] = unit_vec[]
-  pl.previous_nominal_speed_sqr = block->nominal_speed_sqr;
+  memcpy(tc->plan.pl.previous_unit_vec, unit_vec, sizeof(unit_vec)); // pl.previous_unit_vec[] = unit_vec[]
+  tc->plan.pl.previous_nominal_speed_sqr = block->nominal_speed_sqr;
     
   // Update planner position
-  memcpy(pl.position, target_steps, sizeof(target_steps)); // pl.position[] = target_steps[]
+  memcpy(tc->plan.pl.position, target_steps, sizeof(target_steps)); // pl.position[] = target_steps[]
 
   // New block is all set. Update buffer head and next buffer head indices.
-  block_buffer_head = next_buffer_head;  
-  next_buffer_head = plan_next_block_index(block_buffer_head);
+  tc->plan.block_buffer_head = tc->plan.next_buffer_head;  
+  tc->plan.next_buffer_head = plan_next_block_index(tc->plan.block_buffer_head);
   
   // Finish up by recalculating the plan with the new block.
-  planner_recalculate();
+  planner_recalculate(tc);
+}
+
+//-->MS
+/* Batched line input. Everything plan_buffer_line() computes from the line itself (step targets,
+   distance, unit vector, axis limited feed rate and acceleration, junction angle) does not depend on
+   the planner buffer. plan_batch_prepare() computes this for a whole batch in structure-of-arrays
+   form with one loop per quantity, which the compiler vectorizes. plan_batch_commit() then only
+   does the sequential part per line: linking to the buffer state and planner_recalculate().
+   Every step uses the same expressions in the same order as plan_buffer_line(), results match
+   it bit by bit.
+   The machine constants are read once per axis outside the loops. Variants with the constants of
+   each machine profile folded in were measured no faster: the division by steps_per_mm is the same
+   divide either way unless reciprocal math is allowed, and then -Ofast hoists 1/steps_per_mm already. */
+
+void plan_batch_prepare(transcoder_t* tc, const plan_line_t * restrict lines, uint32_t count)
+{
+  plan_batch_t * restrict plb = &tc->plan.plb;
+  uint32_t idx, i;
+
+  plb->count = count;
+  plb->next = 0;
+
+  for (i=0; i<count; i++) {
+    plb->millimeters[i] = 0;
+    plb->step_event_count[i] = 0;
+    plb->direction_bits[i] = 0;
+    plb->acceleration[i] = SOME_LARGE_VALUE;
+    plb->feed_rate[i] = lines[i].feed_rate;
+  }
+
+  for (idx=0; idx<N_AXIS; idx++) {
+    int32_t *target_steps = plb->target_steps[idx];
+    int32_t *steps = plb->steps[idx];
+    real_t *delta_mm = plb->unit_vec[idx];
+    double steps_per_mm = tc->settings.steps_per_mm[idx];
+
+    for (i=0; i<count; i++)
+      target_steps[i] = round(lines[i].target[idx]*steps_per_mm);
+
+    // Lines start where the previous one ended. Zero-length lines end where they start.
+    steps[0] = target_steps[0]-tc->plan.pl.position[idx];
+    for (i=1; i<count; i++)
+      steps[i] = target_steps[i]-target_steps[i-1];
+
+    for (i=0; i<count; i++) {
+      delta_mm[i] = steps[i]/steps_per_mm;
+      steps[i] = abs(steps[i]);
+      plb->step_event_count[i] = max(plb->step_event_count[i], (uint32_t)steps[i]);
+      plb->direction_bits[i] |= (delta_mm[i] < 0) ? get_direction_pin_mask(idx) : 0;
+      plb->millimeters[i] += delta_mm[i]*delta_mm[i];
+    }
+  }
+
+  for (i=0; i<count; i++) {
+    plb->millimeters[i] = real_sqrt(plb->millimeters[i]);
+    if (plb->feed_rate[i] < 0) { plb->feed_rate[i] = SOME_LARGE_VALUE; }
+    if (plb->feed_rate[i] < MINIMUM_FEED_RATE) { plb->feed_rate[i] = MINIMUM_FEED_RATE; }
+  }
+
+  for (idx=0; idx<N_AXIS; idx++) {
+    real_t *unit_vec = plb->unit_vec[idx];
+    real_t *factor = plb->factor[idx];
+    real_t steps_per_mm = tc->settings.steps_per_mm[idx];
+    real_t max_rate = tc->settings.max_rate[idx];
+    real_t acceleration = tc->plan.pl.acceleration[idx];
+
+    // stores are unconditional, the compiler has to prove them safe otherwise
+    for (i=0; i<count; i++) {
+      real_t uv = unit_vec[i], fr = plb->feed_rate[i], ac = plb->acceleration[i];
+      if (uv != 0) {
+        uv *= REAL(1.0)/plb->millimeters[i];
+        real_t inverse_unit_vec_value = real_fabs(REAL(1.0)/uv);
+        fr = min(fr,max_rate*inverse_unit_vec_value);
+        ac = min(ac,acceleration*inverse_unit_vec_value);
+      }
+      unit_vec[i] = uv;
+      plb->feed_rate[i] = fr;
+      plb->acceleration[i] = ac;
+      factor[i] = uv * steps_per_mm;
+    }
+  }
+
+  // Unit vector of the previous line for the junction angle. Zero-length lines are skipped
+  // and do not replace it, exactly as in plan_buffer_line().
+  for (idx=0; idx<N_AXIS; idx++) {
+    real_t prev = tc->plan.pl.previous_unit_vec[idx];
+    for (i=0; i<count; i++) {
+      plb->prev_unit_vec[idx][i] = prev;
+      if (plb->step_event_count[i]) { prev = plb->unit_vec[idx][i]; }
+    }
+  }
+
+  real_t junction_deviation = tc->plan.pl.junction_deviation;
+  for (i=0; i<count; i++) {
+    real_t junction_cos_theta = 0;
+    for (idx=0; idx<N_AXIS; idx++) {
+      if ((A_AXIS != idx) && (plb->unit_vec[idx][i] != 0)) {
+        junction_cos_theta -= plb->prev_unit_vec[idx][i] * plb->unit_vec[idx][i];
+      }
+    }
+
+    if (junction_cos_theta > REAL(0.999999)) {
+      plb->max_junction_speed_sqr[i] = MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED;
+    } else {
+      junction_cos_theta = max(junction_cos_theta,-REAL(0.999999));
+      real_t sin_theta_d2 = real_sqrt(REAL(0.5)*(REAL(1.0)-junction_cos_theta));
+      plb->max_junction_speed_sqr[i] = max( MINIMUM_JUNCTION_SPEED*MINIMUM_JUNCTION_SPEED,
+                                 (plb->acceleration[i] * junction_deviation * sin_theta_d2)/(REAL(1.0)-sin_theta_d2) );
+    }
+  }
 }
 
+void plan_batch_commit(transcoder_t* tc)
+{
+  plan_batch_t *plb = &tc->plan.plb;
+  uint32_t idx, i = plb->next++;
+
+  if (plb->step_event_count[i] == 0) { return; } // Zero-length block, see plan_buffer_line()
+
+  plan_block_t *block = &tc->plan.block_buffer[tc->plan.block_buffer_head];
+  block->step_event_count = plb->step_event_count[i];
+  block->millimeters = plb->millimeters[i];
+  block->direction_bits = plb->direction_bits[i];
+  block->acceleration = plb->acceleration[i];
+  for (idx=0; idx<N_AXIS; idx++) {
+    block->steps[idx] = plb->steps[idx][i];
+    block->factor[idx] = plb->factor[idx][i];
+    tc->plan.pl.previous_unit_vec[idx] = plb->unit_vec[idx][i];
+    tc->plan.pl.position[idx] = plb->target_steps[idx][i];
+  }
+
+  if (tc->plan.block_buffer_head == tc->plan.block_buffer_tail) {
+    block->entry_speed_sqr = 0.0;
+    block->max_junction_speed_sqr = 0.0; // Starting from rest. Enforce start from zero velocity.
+  } else {
+    block->max_junction_speed_sqr = plb->max_junction_speed_sqr[i];
+  }
+
+  block->nominal_speed_sqr = plb->feed_rate[i]*plb->feed_rate[i];
+  block->max_entry_speed_sqr = min(block->max_junction_speed_sqr, 
+                                   min(block->nominal_speed_sqr,tc->plan.pl.previous_nominal_speed_sqr));
+  tc->plan.pl.previous_nominal_speed_sqr = block->nominal_speed_sqr;
+
+  tc->plan.block_buffer_head = tc->plan.next_buffer_head;  
+  tc->plan.next_buffer_head = plan_next_block_index(tc->plan.block_buffer_head);
+  
+  planner_recalculate(tc);
+}
+//<--MS
+
 // Returns the number of active blocks are in the planner buffer.
-uint32_t plan_get_block_buffer_count()
+uint32_t plan_get_block_buffer_count(transcoder_t* tc)
 {
-  if (block_buffer_head >= block_buffer_tail) { return(block_buffer_head-block_buffer_tail); }
-  return(BLOCK_BUFFER_SIZE - (block_buffer_tail-block_buffer_head));
+  if (tc->plan.block_buffer_head >= tc->plan.block_buffer_tail) { return(tc->plan.block_buffer_head-tc->plan.block_buffer_tail); }
+  return(BLOCK_BUFFER_SIZE - (tc->plan.block_buffer_tail-tc->plan.block_buffer_head));
 }
 
 
 // Re-initialize buffer plan with a partially completed block, assumed to exist at the buffer tail.
 // Called after a steppers have come to a complete stop for a feed hold and the cycle is stopped.
-void plan_cycle_reinitialize()
+void plan_cycle_reinitialize(transcoder_t* tc)
 {
   // Re-plan from a complete stop. Reset planner entry speeds and buffer planned pointer.
-  st_update_plan_block_parameters();
-  block_buffer_planned = block_buffer_tail;
-  planner_recalculate();  
+  st_update_plan_block_parameters(tc);
+  tc->plan.block_buffer_planned = tc->plan.block_buffer_tail;
+  planner_recalculate(tc);  
 }
 
 //-->MS
-void plan_set_position(double *pos)
+void plan_set_position(transcoder_t* tc, double *pos)
 {
   uint32_t idx;
   for (idx=0; idx<N_AXIS; idx++)
   {
-    pl.position[idx] = round(pos[idx]*settings.steps_per_mm[idx]);
-    pl.previous_unit_vec[idx] = 0;
+    tc->plan.pl.position[idx] = round(pos[idx]*tc->settings.steps_per_mm[idx]);
+    tc->plan.pl.previous_unit_vec[idx] = 0;
   }
-  pl.previous_nominal_speed_sqr = 0;
+  tc->plan.pl.previous_nominal_speed_sqr = 0;
 }
 
-void plan_set_e_position(double epos)
+void plan_set_e_position(transcoder_t* tc, double epos)
 {
-  pl.position[A_AXIS] = round(epos*settings.steps_per_mm[A_AXIS]);
-  pl.previous_unit_vec[A_AXIS] = 0;
+  tc->plan.pl.position[A_AXIS] = round(epos*tc->settings.steps_per_mm[A_AXIS]);
+  tc->plan.pl.previous_unit_vec[A_AXIS] = 0;
+}
+
+void plan_set_feature(transcoder_t* tc, feature_t feature)
+{
+  uint32_t idx;
+  for (idx=0; idx<N_AXIS; idx++)
+  {
+    double acceleration = tc->settings.acceleration[idx]*feature_profiles[feature].acceleration_scale;
+    tc->plan.pl.acceleration[idx] = min( acceleration, tc->settings.max_acceleration[idx] );
+  }
+  double junction_deviation = tc->settings.junction_deviation*feature_profiles[feature].junction_deviation_scale;
+  tc->plan.pl.junction_deviation = min( junction_deviation, tc->settings.max_junction_deviation );
 }
 
-void plan_get_position(double *pos)
+void plan_get_position(transcoder_t* tc, double *pos)
 {
   uint32_t idx;
   for (idx=0; idx<N_AXIS; idx++)
-    pos[idx] = pl.position[idx]/settings.steps_per_mm[idx];
+    pos[idx] = tc->plan.pl.position[idx]/tc->settings.steps_per_mm[idx];
 }
 //<--MS
@@ -49,58 +49,122 @@ typedef struct {
   uint32_t step_event_count; // The maximum step axis count and number of steps required to complete this block. 
 
   // Fields used by the motion planner to manage acceleration
-  double entry_speed_sqr;         // The current planned entry speed at block junction in (mm/min)^2
-  double max_entry_speed_sqr;     // Maximum allowable entry speed based on the minimum of junction limit and 
+  real_t entry_speed_sqr;         // The current planned entry speed at block junction in (mm/min)^2
+  real_t max_entry_speed_sqr;     // Maximum allowable entry speed based on the minimum of junction limit and 
                                  //   neighboring nominal speeds with overrides in (mm/min)^2
-  double max_junction_speed_sqr;  // Junction entry speed limit based on direction vectors in (mm/min)^2
-  double nominal_speed_sqr;       // Axis-limit adjusted nominal speed for this block in (mm/min)^2
-  double acceleration;            // Axis-limit adjusted line acceleration in (mm/min^2)
-  double millimeters;             // The remaining distance for this block to be executed in (mm)
+  real_t max_junction_speed_sqr;  // Junction entry speed limit based on direction vectors in (mm/min)^2
+  real_t nominal_speed_sqr;       // Axis-limit adjusted nominal speed for this block in (mm/min)^2
+  real_t acceleration;            // Axis-limit adjusted line acceleration in (mm/min^2)
+  real_t millimeters;             // The remaining distance for this block to be executed in (mm)
   // uint8_t max_override;       // Maximum override value based on axis speed limits
 
  // int32_t line_number;
 
 //-->MS
-  double factor[N_AXIS];
+  real_t factor[N_AXIS];
 //<--MS
 
 } plan_block_t;
 
-      
+
+// Define planner variables
+typedef struct {
+  int32_t position[N_AXIS];          // The planner position of the tool in absolute steps. Kept separate
+                                     // from g-code position for movements requiring multiple line motions,
+                                     // i.e. arcs, canned cycles, and backlash compensation.
+  real_t previous_unit_vec[N_AXIS];   // Unit vector of previous path line segment
+  real_t previous_nominal_speed_sqr;  // Nominal speed of previous path line segment
+//-->MS
+  real_t acceleration[N_AXIS];        // Axis accelerations of the active feature profile
+  real_t junction_deviation;          // Junction deviation of the active feature profile
+//<--MS
+} planner_t;
+
+//-->MS
+// Number of lines handled by one plan_batch_prepare() call
+#ifndef PLAN_BATCH_SIZE
+  #define PLAN_BATCH_SIZE 64
+#endif
+
+// Lines prepared by plan_batch_prepare() in structure-of-arrays form
+typedef struct {
+  uint32_t count;
+  uint32_t next;
+  int32_t  target_steps[N_AXIS][PLAN_BATCH_SIZE];
+  int32_t  steps[N_AXIS][PLAN_BATCH_SIZE];
+  real_t   unit_vec[N_AXIS][PLAN_BATCH_SIZE];
+  real_t   prev_unit_vec[N_AXIS][PLAN_BATCH_SIZE];
+  real_t   factor[N_AXIS][PLAN_BATCH_SIZE];
+  real_t   millimeters[PLAN_BATCH_SIZE];
+  real_t   feed_rate[PLAN_BATCH_SIZE];
+  real_t   acceleration[PLAN_BATCH_SIZE];
+  real_t   max_junction_speed_sqr[PLAN_BATCH_SIZE];
+  uint32_t step_event_count[PLAN_BATCH_SIZE];
+  uint8_t  direction_bits[PLAN_BATCH_SIZE];
+} plan_batch_t;
+
+// Planner state of one transcoder
+typedef struct {
+  plan_block_t block_buffer[BLOCK_BUFFER_SIZE];  // A ring buffer for motion instructions
+  uint32_t block_buffer_tail;     // Index of the block to process now
+  uint32_t block_buffer_head;     // Index of the next block to be pushed
+  uint32_t next_buffer_head;      // Index of the next buffer head
+  uint32_t block_buffer_planned;  // Index of the optimally planned block
+  planner_t pl;
+  plan_batch_t plb;
+} plan_ctx_t;
+//<--MS
+
 // Initialize and reset the motion plan subsystem
-void plan_reset();
+void plan_reset(transcoder_t* tc);
 
 // Add a new linear movement to the buffer. target[N_AXIS] is the signed, absolute target position 
 // in millimeters. Feed rate specifies the speed of the motion. If feed rate is inverted, the feed
 // rate is taken to mean "frequency" and would complete the operation in 1/feed_rate minutes.
-void plan_buffer_line(double *target, double feed_rate, bool invert_feed_rate);
+void plan_buffer_line(transcoder_t* tc, double *target, real_t feed_rate, bool invert_feed_rate);
+
+//-->MS
+typedef struct {
+  double target[N_AXIS]; // signed, absolute target position in millimeters
+  double feed_rate;      // normal feed rate or negative for rapids (no inverse time)
+} plan_line_t;
+
+// Batched plan_buffer_line(). Prepare computes the line data of count lines in one go, starting
+// at the current planner position. Commit appends the next prepared line to the buffer, with the
+// same preconditions and result as plan_buffer_line(). Planner position and feature may not be
+// changed until all prepared lines are committed.
+void plan_batch_prepare(transcoder_t* tc, const plan_line_t *lines, uint32_t count);
+void plan_batch_commit(transcoder_t* tc);
+//<--MS
 
 // Called when the current block is no longer needed. Discards the block and makes the memory
 // availible for new blocks.
-void plan_discard_current_block();
+void plan_discard_current_block(transcoder_t* tc);
 
 // Gets the current block. Returns NULL if buffer empty
-plan_block_t *plan_get_current_block();
+plan_block_t *plan_get_current_block(transcoder_t* tc);
 
 // Called periodically by step segment buffer. Mostly used internally by planner.
 uint32_t plan_next_block_index(uint32_t block_index);
 
 // Called by step segment buffer when computing executing block velocity profile.
-double plan_get_exec_block_exit_speed();
+real_t plan_get_exec_block_exit_speed(transcoder_t* tc);
 
 // Reinitialize plan with a partially completed block
-void plan_cycle_reinitialize();
+void plan_cycle_reinitialize(transcoder_t* tc);
 
 // Returns the number of active blocks are in the planner buffer.
-uint32_t plan_get_block_buffer_count();
+uint32_t plan_get_block_buffer_count(transcoder_t* tc);
 
 // Returns the status of the block ring buffer. True, if buffer is full.
-bool plan_check_full_buffer();
+bool plan_check_full_buffer(transcoder_t* tc);
 
 //-->MS
-void plan_set_position(double *pos);
-void plan_set_e_position(double epos);
-void plan_get_position(double *pos);
+void plan_set_position(transcoder_t* tc, double *pos);
+void plan_set_e_position(transcoder_t* tc, double epos);
+void plan_get_position(transcoder_t* tc, double *pos);
+// Select the acceleration and junction deviation overrides used for all following lines
+void plan_set_feature(transcoder_t* tc, feature_t feature);
 //<--MS
 
 #endif //hostplanner_h
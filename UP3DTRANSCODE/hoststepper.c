@@ -27,6 +27,7 @@
 
 #include "hoststepper.h"
 #include "hostplanner.h"
+#include "transcoder.h"
 
 #include "up3dconf.h"
 
@@ -37,29 +38,6 @@
 #include <stdlib.h>
 
 #define get_direction_pin_mask(a) (1<<a)
-static segment_up3d_t segment_buffer[SEGMENT_BUFFER_SIZE];
-
-// Step segment ring buffer indices
-static volatile uint32_t segment_buffer_tail;
-static uint32_t segment_buffer_head;
-static uint32_t segment_next_head;
-
-// Pointers for the step segment being prepped from the planner buffer. Accessed only by the
-// main program. Pointers may be planning segments or planner blocks ahead of what being executed.
-static plan_block_t *pl_block;     // Pointer to the planner block being prepped
-
-// Segment preparation data struct. Contains all the necessary information to compute new segments
-// based on the current executing planner block.
-typedef struct {
-  uint32_t st_block_index;  // Index of stepper common data block being prepped
-  double current_speed;    // Current speed at the end of the segment buffer (mm/min)
-  double maximum_speed;    // Maximum speed of executing block. Not always nominal speed. (mm/min)
-  double exit_speed;       // Exit speed of executing block (mm/min)
-  double accelerate_until; // Acceleration ramp end measured from end of block (mm)
-  double decelerate_after; // Deceleration ramp start measured from end of block (mm)
-} st_prep_t;
-static st_prep_t prep;
-
 
 /*    BLOCK VELOCITY PROFILE DEFINITION 
           __________________________
@@ -99,74 +77,50 @@ static st_prep_t prep;
   are shown and defined in the above illustration.
 */
 
-static int64_t g_ex,g_ey,g_ea;
-
-bool st_get_next_segment_up3d(segment_up3d_t** ppseg)
+//encode a segment as MoveL block, see UP3D_PROG_BLK_MoveL() (all fields set, no clearing needed)
+static uint32_t _st_encode_up3d_seg(const segment_up3d_t* pseg, UP3D_BLK* pblk, int64_t* pticks)
 {
-  //auto prepare new segment(s) if segment buffer empty
-  if (segment_buffer_head == segment_buffer_tail)
-    st_prep_buffer();
-
-  //exit if no segments found
-  if (segment_buffer_head == segment_buffer_tail)
-    return false;
-
-  *ppseg = &segment_buffer[segment_buffer_tail];
-
-  // Segment is complete. Advance segment indexing.
-  if ( ++segment_buffer_tail == SEGMENT_BUFFER_SIZE) { segment_buffer_tail = 0; }
+  if( !pseg->p1 )
+    return 0;
 
-  return true;
-}
+  *pticks += (int64_t)pseg->p2*pseg->p1;
 
-void _st_store_up3d_seg(segment_up3d_t* pseg)
-{
-  if( pseg->p1 )
-  {
-    memcpy( &segment_buffer[segment_buffer_head], pseg, sizeof(segment_up3d_t) );
-    // increment segment buffer indices
-    segment_buffer_head = segment_next_head;
-    if ( ++segment_next_head == SEGMENT_BUFFER_SIZE ) { segment_next_head = 0; }
-  }
+  pblk->pcmd=UP3DPCMD_MoveL;
+  pblk->pdat1.s.s1=pseg->p1; pblk->pdat1.s.s2=pseg->p2;
+  pblk->pdat2.s.s1=pseg->p3; pblk->pdat2.s.s2=pseg->p4; pblk->pdat3.s.s1=pseg->p5;
+  pblk->pdat3.s.s2=pseg->p6; pblk->pdat4.s.s1=pseg->p7; pblk->pdat4.s.s2=pseg->p8;
+  return 1;
 }
 
-void _st_subtract_plsteps(segment_up3d_t* pseg)
+void _st_subtract_plsteps(transcoder_t* tc, segment_up3d_t* pseg)
 {
   if( pseg->p1 )
   {
-    int32_t p1 = pseg->p1;
-    int32_t p3 = pseg->p3;
-    int32_t p4 = pseg->p4;
-    int32_t p5 = pseg->p5;
-    int32_t p6 = pseg->p6;
-    int32_t p7 = pseg->p7;
-    int32_t p8 = pseg->p8;
-    
     //calculate xsteps generated like mcu in printer (THERE IS A BAD *FLOOR* ROUNDING INSIDE!)
-    int64_t sx = floor( (float)(p3*p1+p6*(p1-1)*p1/2) / 512.0 );
-    int64_t sy = floor( (float)(p4*p1+p7*(p1-1)*p1/2) / 512.0 );
-    int64_t sa = floor( (float)(p5*p1+p8*(p1-1)*p1/2) / 512.0 );
+    int64_t sx = UP3D_PROG_MoveL_Steps( pseg->p1, pseg->p3, pseg->p6 );
+    int64_t sy = UP3D_PROG_MoveL_Steps( pseg->p1, pseg->p4, pseg->p7 );
+    int64_t sa = UP3D_PROG_MoveL_Steps( pseg->p1, pseg->p5, pseg->p8 );
     
-    pl_block->steps[0] -= llabs(sx);
-    pl_block->steps[1] -= llabs(sy);
-    pl_block->steps[2] -= llabs(sa);
+    tc->st.pl_block->steps[0] -= llabs(sx);
+    tc->st.pl_block->steps[1] -= llabs(sy);
+    tc->st.pl_block->steps[2] -= llabs(sa);
   }
 }
 
-void _st_create_up3d_seg_a(segment_up3d_t* pseg, double t, double v_entry, double v_exit)
+void _st_create_up3d_seg_a(transcoder_t* tc, segment_up3d_t* pseg, real_t t, real_t v_entry, real_t v_exit)
 {
   pseg->p1 = 0;
 
   
   //s linear speed
-  int64_t s_x = g_ex*512 + (int64_t)(v_entry*t*pl_block->factor[X_AXIS])*512;
-  int64_t s_y = g_ey*512 + (int64_t)(v_entry*t*pl_block->factor[Y_AXIS])*512;
-  int64_t s_a = g_ea*512 + (int64_t)(v_entry*t*pl_block->factor[A_AXIS])*512;
+  int64_t s_x = tc->st.g_ex*512 + (int64_t)(v_entry*t*tc->st.pl_block->factor[X_AXIS])*512;
+  int64_t s_y = tc->st.g_ey*512 + (int64_t)(v_entry*t*tc->st.pl_block->factor[Y_AXIS])*512;
+  int64_t s_a = tc->st.g_ea*512 + (int64_t)(v_entry*t*tc->st.pl_block->factor[A_AXIS])*512;
   
   //s acceleration
-  int64_t sa_x = (int64_t)((v_exit-v_entry)*t*pl_block->factor[X_AXIS])*512;
-  int64_t sa_y = (int64_t)((v_exit-v_entry)*t*pl_block->factor[Y_AXIS])*512;
-  int64_t sa_a = (int64_t)((v_exit-v_entry)*t*pl_block->factor[A_AXIS])*512;
+  int64_t sa_x = (int64_t)((v_exit-v_entry)*t*tc->st.pl_block->factor[X_AXIS])*512;
+  int64_t sa_y = (int64_t)((v_exit-v_entry)*t*tc->st.pl_block->factor[Y_AXIS])*512;
+  int64_t sa_a = (int64_t)((v_exit-v_entry)*t*tc->st.pl_block->factor[A_AXIS])*512;
   
   //==> tmax = 65535*65535 / 50000000 = 85.8 sec. per segment
   int64_t p1 = 1+(int64_t)(t*F_CPU)/65535;
@@ -199,21 +153,21 @@ void _st_create_up3d_seg_a(segment_up3d_t* pseg, double t, double v_entry, doubl
   }
 }
 
-void _st_create_up3d_seg_c(segment_up3d_t* pseg, double v)
+void _st_create_up3d_seg_c(transcoder_t* tc, segment_up3d_t* pseg, real_t v)
 {
   pseg->p1 = 0;
 
   //calc xsteps
-  int64_t s_x = g_ex*512 + pl_block->steps[0]*512*((pl_block->direction_bits&get_direction_pin_mask(0))?-1:1);
-  int64_t s_y = g_ey*512 + pl_block->steps[1]*512*((pl_block->direction_bits&get_direction_pin_mask(1))?-1:1);
-  int64_t s_a = g_ea*512 + pl_block->steps[2]*512*((pl_block->direction_bits&get_direction_pin_mask(2))?-1:1);
+  int64_t s_x = tc->st.g_ex*512 + tc->st.pl_block->steps[0]*512*((tc->st.pl_block->direction_bits&get_direction_pin_mask(0))?-1:1);
+  int64_t s_y = tc->st.g_ey*512 + tc->st.pl_block->steps[1]*512*((tc->st.pl_block->direction_bits&get_direction_pin_mask(1))?-1:1);
+  int64_t s_a = tc->st.g_ea*512 + tc->st.pl_block->steps[2]*512*((tc->st.pl_block->direction_bits&get_direction_pin_mask(2))?-1:1);
   
   //calc time based on corrected xsteps
-  double tx = fabs(s_x / (512*settings.steps_per_mm[0]) / v);
-  double ty = fabs(s_y / (512*settings.steps_per_mm[1]) / v);
-  double ta = fabs(s_a / (512*settings.steps_per_mm[2]) / v);
+  real_t tx = real_fabs(s_x / (512*(real_t)tc->settings.steps_per_mm[0]) / v);
+  real_t ty = real_fabs(s_y / (512*(real_t)tc->settings.steps_per_mm[1]) / v);
+  real_t ta = real_fabs(s_a / (512*(real_t)tc->settings.steps_per_mm[2]) / v);
   
-  double t = max(max(tx,ty),ta);
+  real_t t = max(max(tx,ty),ta);
  
   //==> tmax = 65535*65535 / 50000000 = 85.8 sec. per segment
   int64_t p1 = 1+(int64_t)(t*F_CPU)/65535;
@@ -221,9 +175,9 @@ void _st_create_up3d_seg_c(segment_up3d_t* pseg, double v)
   {
     int64_t p2 = (int64_t)(t*F_CPU/p1);
     
-    int64_t p3 = (int64_t)(s_x/p1); if(pl_block->steps[0]<0) p3=0; //take care not to insert REVERSE steps
-    int64_t p4 = (int64_t)(s_y/p1); if(pl_block->steps[1]<0) p4=0; //take care not to insert REVERSE steps
-    int64_t p5 = (int64_t)(s_a/p1); if(pl_block->steps[2]<0) p5=0; //take care not to insert REVERSE steps
+    int64_t p3 = (int64_t)(s_x/p1); if(tc->st.pl_block->steps[0]<0) p3=0; //take care not to insert REVERSE steps
+    int64_t p4 = (int64_t)(s_y/p1); if(tc->st.pl_block->steps[1]<0) p4=0; //take care not to insert REVERSE steps
+    int64_t p5 = (int64_t)(s_a/p1); if(tc->st.pl_block->steps[2]<0) p5=0; //take care not to insert REVERSE steps
     
     //test format limits
     if( (p3<-32767) || (p3>32767) || (p4<-32767) || (p4>32767) || (p5<-32767) || (p5>32767) )
@@ -239,14 +193,14 @@ void _st_create_up3d_seg_c(segment_up3d_t* pseg, double v)
       p1 = 0;
 
     //calculate xsteps generated like mcu in printer (THERE IS A BAD *FLOOR* ROUNDING INSIDE!)
-    int64_t sx = floor( (float)(p3*p1) / 512.0 );
-    int64_t sy = floor( (float)(p4*p1) / 512.0 );
-    int64_t sa = floor( (float)(p5*p1) / 512.0 );
+    int64_t sx = UP3D_PROG_MoveL_Steps( p1, p3, 0 );
+    int64_t sy = UP3D_PROG_MoveL_Steps( p1, p4, 0 );
+    int64_t sa = UP3D_PROG_MoveL_Steps( p1, p5, 0 );
     
     //track global error
-    g_ex = (s_x/512 - sx);
-    g_ey = (s_y/512 - sy);
-    g_ea = (s_a/512 - sa);
+    tc->st.g_ex = (s_x/512 - sx);
+    tc->st.g_ey = (s_y/512 - sy);
+    tc->st.g_ea = (s_a/512 - sa);
     
     //always leave
     break;
@@ -254,132 +208,158 @@ void _st_create_up3d_seg_c(segment_up3d_t* pseg, double v)
 }
 
 // Reset and clear stepper subsystem variables
-void st_reset()
+void st_reset(transcoder_t* tc)
 {
   // Initialize stepper algorithm variables.
-  memset(&prep, 0, sizeof(st_prep_t));
-  pl_block = NULL;  // Planner block pointer used by segment buffer
-  segment_buffer_tail = 0;
-  segment_buffer_head = 0; // empty = tail
-  segment_next_head = 1;
-  g_ex = g_ey = g_ea = 0;
+  memset(&tc->st.prep, 0, sizeof(st_prep_t));
+  tc->st.pl_block = NULL;  // Planner block pointer used by segment buffer
+  tc->st.g_ex = tc->st.g_ey = tc->st.g_ea = 0;
 }
 
 // Called by planner_recalculate() when the executing block is updated by the new plan.
-void st_update_plan_block_parameters()
+void st_update_plan_block_parameters(transcoder_t* tc)
 { 
-  if (pl_block != NULL) { // Ignore if at start of a new block.
-    pl_block->entry_speed_sqr = prep.current_speed*prep.current_speed; // Update entry speed.
-    pl_block = NULL; // Flag st_prep_segment() to load new velocity profile.
+  if (tc->st.pl_block != NULL) { // Ignore if at start of a new block.
+    tc->st.pl_block->entry_speed_sqr = tc->st.prep.current_speed*tc->st.prep.current_speed; // Update entry speed.
+    tc->st.pl_block = NULL; // Flag st_prep_segment() to load new velocity profile.
   }
 }
 
-void st_prep_buffer()
+// Loads the velocity profile of the current planner block (pl_block) into prep.
+static void _st_prep_block_profile(transcoder_t* tc)
 {
-  if (segment_buffer_tail != segment_next_head) // Check if we need to fill the buffer.
+  // Check if the segment buffer completed the last planner block. If so, load the Bresenham
+  // data for the block. If not, we are still mid-block and the velocity profile was updated. 
+  // Increment stepper common data index to store new planner block data.
+  if ( ++tc->st.prep.st_block_index == (SEGMENT_BUFFER_SIZE-1) ) { tc->st.prep.st_block_index = 0; }
+  
+  // Initialize segment buffer data for generating the segments.
+  tc->st.prep.current_speed = real_sqrt(tc->st.pl_block->entry_speed_sqr);
+
+  //---------------------------------------------------------------------------------------
+  // Compute the velocity profile of a new planner block based on its entry and exit speeds
+  real_t inv_2_accel = REAL(0.5)/tc->st.pl_block->acceleration;
+
+  // Compute or recompute velocity profile parameters of the prepped planner block.
+  tc->st.prep.accelerate_until = tc->st.pl_block->millimeters;
+  tc->st.prep.exit_speed = plan_get_exec_block_exit_speed(tc);   
+  real_t exit_speed_sqr = tc->st.prep.exit_speed*tc->st.prep.exit_speed;
+  real_t intersect_distance = REAL(0.5)*(tc->st.pl_block->millimeters+inv_2_accel*(tc->st.pl_block->entry_speed_sqr-exit_speed_sqr));
+  if (intersect_distance > REAL(0.0))
   {
-    // Determine if we need to load a new planner block or if the block has been replanned. 
-    if (pl_block == NULL)
+    if (intersect_distance < tc->st.pl_block->millimeters) // Either trapezoid or triangle types
     {
-      if( !(pl_block = plan_get_current_block()) ) // Query planner for a queued block
-        return; // No planner blocks. Exit.
-                      
-      // Check if the segment buffer completed the last planner block. If so, load the Bresenham
-      // data for the block. If not, we are still mid-block and the velocity profile was updated. 
-      // Increment stepper common data index to store new planner block data.
-      if ( ++prep.st_block_index == (SEGMENT_BUFFER_SIZE-1) ) { prep.st_block_index = 0; }
-      
-      // Initialize segment buffer data for generating the segments.
-      prep.current_speed = sqrt(pl_block->entry_speed_sqr);
-
-      //---------------------------------------------------------------------------------------
-      // Compute the velocity profile of a new planner block based on its entry and exit speeds
-      double inv_2_accel = 0.5/pl_block->acceleration;
-
-      // Compute or recompute velocity profile parameters of the prepped planner block.
-      prep.accelerate_until = pl_block->millimeters;
-      prep.exit_speed = plan_get_exec_block_exit_speed();   
-      double exit_speed_sqr = prep.exit_speed*prep.exit_speed;
-      double intersect_distance = 0.5*(pl_block->millimeters+inv_2_accel*(pl_block->entry_speed_sqr-exit_speed_sqr));
-      if (intersect_distance > 0.0)
+      // NOTE: For acceleration-cruise and cruise-only types, following calculation will be 0.0.
+      tc->st.prep.decelerate_after = inv_2_accel*(tc->st.pl_block->nominal_speed_sqr-exit_speed_sqr);
+      if (tc->st.prep.decelerate_after < intersect_distance) // Trapezoid type
       {
-        if (intersect_distance < pl_block->millimeters) // Either trapezoid or triangle types
+        tc->st.prep.maximum_speed = real_sqrt(tc->st.pl_block->nominal_speed_sqr);
+        if (tc->st.pl_block->entry_speed_sqr == tc->st.pl_block->nominal_speed_sqr)
         {
-          // NOTE: For acceleration-cruise and cruise-only types, following calculation will be 0.0.
-          prep.decelerate_after = inv_2_accel*(pl_block->nominal_speed_sqr-exit_speed_sqr);
-          if (prep.decelerate_after < intersect_distance) // Trapezoid type
-          {
-            prep.maximum_speed = sqrt(pl_block->nominal_speed_sqr);
-            if (pl_block->entry_speed_sqr == pl_block->nominal_speed_sqr)
-            {
-              // Cruise-deceleration or cruise-only type.
-            }
-            else
-            {
-              // Full-trapezoid or acceleration-cruise types
-              prep.accelerate_until -= inv_2_accel*(pl_block->nominal_speed_sqr-pl_block->entry_speed_sqr); 
-            }
-          }
-          else
-          {
-            // Triangle type
-            prep.accelerate_until = intersect_distance;
-            prep.decelerate_after = intersect_distance;
-            prep.maximum_speed = sqrt(2.0*pl_block->acceleration*intersect_distance+exit_speed_sqr);
-          }          
+          // Cruise-deceleration or cruise-only type.
         }
         else
         {
-          // Deceleration-only type
-          prep.decelerate_after = pl_block->millimeters;
-          prep.maximum_speed = prep.current_speed;
+          // Full-trapezoid or acceleration-cruise types
+          tc->st.prep.accelerate_until -= inv_2_accel*(tc->st.pl_block->nominal_speed_sqr-tc->st.pl_block->entry_speed_sqr); 
         }
       }
       else
       {
-        // Acceleration-only type
-        prep.accelerate_until = 0.0;
-        prep.decelerate_after = 0.0;
-        prep.maximum_speed = prep.exit_speed;
-      }
+        // Triangle type
+        tc->st.prep.accelerate_until = intersect_distance;
+        tc->st.prep.decelerate_after = intersect_distance;
+        tc->st.prep.maximum_speed = real_sqrt(REAL(2.0)*tc->st.pl_block->acceleration*intersect_distance+exit_speed_sqr);
+      }          
     }
-    
-    if( pl_block->millimeters-prep.accelerate_until )
+    else
     {
-      //calc A
-      segment_up3d_t a_seg;
-      // Acceleration-cruise, acceleration-deceleration ramp junction, or end of block.
-      double time_var = 2.0*(pl_block->millimeters-prep.accelerate_until)/(prep.current_speed+prep.maximum_speed);
-      _st_create_up3d_seg_a( &a_seg, time_var, prep.current_speed, prep.maximum_speed);
-      //subtract A block distance
-      _st_subtract_plsteps( &a_seg );
-      //emit A block
-      _st_store_up3d_seg( &a_seg );
+      // Deceleration-only type
+      tc->st.prep.decelerate_after = tc->st.pl_block->millimeters;
+      tc->st.prep.maximum_speed = tc->st.prep.current_speed;
     }
+  }
+  else
+  {
+    // Acceleration-only type
+    tc->st.prep.accelerate_until = 0.0;
+    tc->st.prep.decelerate_after = 0.0;
+    tc->st.prep.maximum_speed = tc->st.prep.exit_speed;
+  }
+}
 
-    segment_up3d_t d_seg = {0};
-    if( prep.decelerate_after )
-    {
-      //calc D
-      double time_var = 2.0*(prep.decelerate_after)/(prep.maximum_speed+prep.exit_speed);
-      _st_create_up3d_seg_a( &d_seg, time_var, prep.maximum_speed, prep.exit_speed);
-      //subtract D block distance
-      _st_subtract_plsteps( &d_seg );
-    }
+bool st_next_block_up3d(transcoder_t* tc, UP3D_BLK* pblks, uint32_t* pcount, int64_t* pticks)
+{
+  if( !(tc->st.pl_block = plan_get_current_block(tc)) ) // Query planner for a queued block
+    return false; // No planner blocks. Exit.
 
-    if( pl_block->steps[0] || pl_block->steps[1] || pl_block->steps[2] )
-    {
-      //calc C
-      segment_up3d_t c_seg;
-      _st_create_up3d_seg_c( &c_seg, prep.maximum_speed );
-      //emit C
-      _st_store_up3d_seg( &c_seg );
-    }
-    
-    //emit D block
-    _st_store_up3d_seg( &d_seg );
+  _st_prep_block_profile(tc);
+
+  uint32_t count = 0;
+  if( tc->st.pl_block->millimeters-tc->st.prep.accelerate_until )
+  {
+    //calc A
+    segment_up3d_t a_seg;
+    // Acceleration-cruise, acceleration-deceleration ramp junction, or end of block.
+    real_t time_var = REAL(2.0)*(tc->st.pl_block->millimeters-tc->st.prep.accelerate_until)/(tc->st.prep.current_speed+tc->st.prep.maximum_speed);
+    _st_create_up3d_seg_a(tc, &a_seg, time_var, tc->st.prep.current_speed, tc->st.prep.maximum_speed);
+    //subtract A block distance
+    _st_subtract_plsteps(tc, &a_seg );
+    //emit A block
+    count += _st_encode_up3d_seg(&a_seg, pblks+count, pticks);
+  }
+
+  segment_up3d_t d_seg = {0};
+  if( tc->st.prep.decelerate_after )
+  {
+    //calc D
+    real_t time_var = REAL(2.0)*(tc->st.prep.decelerate_after)/(tc->st.prep.maximum_speed+tc->st.prep.exit_speed);
+    _st_create_up3d_seg_a(tc, &d_seg, time_var, tc->st.prep.maximum_speed, tc->st.prep.exit_speed);
+    //subtract D block distance
+    _st_subtract_plsteps(tc, &d_seg );
+  }
+
+  if( tc->st.pl_block->steps[0] || tc->st.pl_block->steps[1] || tc->st.pl_block->steps[2] )
+  {
+    //calc C
+    segment_up3d_t c_seg;
+    _st_create_up3d_seg_c(tc, &c_seg, tc->st.prep.maximum_speed );
+    //emit C
+    count += _st_encode_up3d_seg(&c_seg, pblks+count, pticks);
+  }
 
-    pl_block = NULL; // Set pointer to indicate check and load next planner block.
-    plan_discard_current_block();
+  //emit D block
+  count += _st_encode_up3d_seg(&d_seg, pblks+count, pticks);
+
+  tc->st.pl_block = NULL; // Set pointer to indicate check and load next planner block.
+  plan_discard_current_block(tc);
+
+  *pcount = count;
+  return true;
+}
+
+bool st_get_next_block_time(transcoder_t* tc, double* ptime)
+{
+  if( !(tc->st.pl_block = plan_get_current_block(tc)) ) // Query planner for a queued block
+    return false;
+
+  _st_prep_block_profile(tc);
+
+  real_t t = 0;
+  if( tc->st.pl_block->millimeters-tc->st.prep.accelerate_until ) // acceleration ramp
+    t += REAL(2.0)*(tc->st.pl_block->millimeters-tc->st.prep.accelerate_until)/(tc->st.prep.current_speed+tc->st.prep.maximum_speed);
+  if( tc->st.prep.accelerate_until-tc->st.prep.decelerate_after > 0 ) // cruise, timed by the longest axis like _st_create_up3d_seg_c
+  {
+    real_t axis_max = max(max(real_fabs(tc->st.pl_block->factor[0]/(real_t)tc->settings.steps_per_mm[0]),
+                              real_fabs(tc->st.pl_block->factor[1]/(real_t)tc->settings.steps_per_mm[1])),
+                              real_fabs(tc->st.pl_block->factor[2]/(real_t)tc->settings.steps_per_mm[2]));
+    t += (tc->st.prep.accelerate_until-tc->st.prep.decelerate_after)*axis_max/tc->st.prep.maximum_speed;
   }
+  if( tc->st.prep.decelerate_after ) // deceleration ramp
+    t += REAL(2.0)*(tc->st.prep.decelerate_after)/(tc->st.prep.maximum_speed+tc->st.prep.exit_speed);
+  *ptime = t;
+
+  tc->st.pl_block = NULL;
+  plan_discard_current_block(tc);
+  return true;
 }
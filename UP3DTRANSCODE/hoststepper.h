@@ -30,13 +30,16 @@
 
 #define SEGMENT_BUFFER_SIZE 16
 
+#define ST_BLOCK_SEGMENTS 3 // acceleration, cruise, deceleration
+
+#include "up3dconf.h"
+#include "hostplanner.h"
+#include "up3ddata.h"
 #include <stdint.h>
 #include <stdbool.h>
 
-// Primary stepper segment ring buffer. Contains small, short line segments for the stepper 
-// algorithm to execute, which are "checked-out" incrementally from the first block in the
-// planner buffer. Once "checked-out", the steps in the segments buffer cannot be modified by 
-// the planner, where the remaining planner block steps still can.
+// Stepper segment, the parameters of one MoveL block (acceleration, cruise or deceleration part
+// of a planner block)
 typedef struct {
   uint16_t p1;
   uint16_t p2;
@@ -51,18 +54,43 @@ typedef struct {
   
 } segment_up3d_t;
 
+// Segment preparation data struct. Contains all the necessary information to compute new segments
+// based on the current executing planner block.
+typedef struct {
+  uint32_t st_block_index;  // Index of stepper common data block being prepped
+  real_t current_speed;    // Current speed at the end of the segment buffer (mm/min)
+  real_t maximum_speed;    // Maximum speed of executing block. Not always nominal speed. (mm/min)
+  real_t exit_speed;       // Exit speed of executing block (mm/min)
+  real_t accelerate_until; // Acceleration ramp end measured from end of block (mm)
+  real_t decelerate_after; // Deceleration ramp start measured from end of block (mm)
+} st_prep_t;
+
+// Stepper state of one transcoder
+typedef struct {
+  // Pointers for the step segment being prepped from the planner buffer. Accessed only by the
+  // main program. Pointers may be planning segments or planner blocks ahead of what being executed.
+  plan_block_t *pl_block;     // Pointer to the planner block being prepped
+
+  st_prep_t prep;
+
+  int64_t g_ex,g_ey,g_ea;     // Step rounding error carried to the next segment
+} st_ctx_t;
+
 
 //MS-->
-bool st_get_next_segment_up3d(segment_up3d_t** ppseg);
+// Takes the next planner block and encodes its segments into pblks as MoveL blocks (up to
+// ST_BLOCK_SEGMENTS), their duration is added to pticks. Returns false if the planner is empty.
+bool st_next_block_up3d(transcoder_t* tc, UP3D_BLK* pblks, uint32_t* pcount, int64_t* pticks);
+
+// Estimate only: returns the execution time of the next planner block derived from its
+// velocity profile and discards the block without generating any segments.
+bool st_get_next_block_time(transcoder_t* tc, double* ptime);
 //<--
 
 // Reset the stepper subsystem variables       
-void st_reset();
-             
-// Reloads step segment buffer. Called continuously by realtime execution system.
-void st_prep_buffer();
+void st_reset(transcoder_t* tc);
 
 // Called by planner_recalculate() when the executing block is updated by the new plan.
-void st_update_plan_block_parameters();
+void st_update_plan_block_parameters(transcoder_t* tc);
 
 #endif //hoststepper_h
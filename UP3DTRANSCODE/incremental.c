@@ -0,0 +1,477 @@
+/*
+  incremental.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "incremental.h"
+#include "transcoder.h"
+#include "gcodetext.h"
+#include "umccache.h"
+#include "umcindex.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// A chunk is the g-code of one layer. It starts at the direct move changing the layer, which syncs the
+// planner first, so its output only depends on its lines and the state at its start. A chunk of the
+// previous run can be copied when lines and start state are the same and the line after it syncs the
+// planner as well (or there is none), otherwise moves at its end would have been planned differently.
+// Like the layer split, layer changes while a cold nozzle is heating up do not start a chunk.
+
+typedef struct {
+  gcp_state_t       gcp;
+  umcwriter_state_t umc;
+  uint64_t          block;  // output block index
+  int64_t           ticks;  // print time
+} incremental_point_t;
+
+typedef struct {
+  uint32_t            first_line;
+  uint32_t            line_count;
+  uint64_t            first_hash; // hash of the first line, to find candidates quickly
+  uint64_t            text_hash;  // hash of all lines
+  incremental_point_t start;
+  incremental_point_t end;
+  uint32_t            report_start;
+  uint32_t            report_count;
+} incremental_chunk_t;
+
+typedef struct {
+  char     magic[4];     // "UPCK"
+  uint32_t version;      // TRANSCODER_VERSION
+  uint64_t job;          // umccache_job_hash() of the output
+  uint64_t blocks;       // size and modification time of the output, checkpoints of other files are useless
+  int64_t  mtime;
+  uint32_t chunk_count;
+  uint32_t report_count; // elapsed ticks of the time reports of each chunk, relative to its start
+} incremental_header_t;
+
+// chunk of the previous run in the sorted lookup
+typedef struct {
+  uint64_t first_hash;
+  uint32_t index;
+} incremental_key_t;
+
+typedef struct {
+  transcoder_t*        tc;
+  gcodetext_t          gt;
+  // previous run
+  FILE*                old_umc;
+  incremental_chunk_t* old;
+  uint32_t             old_count;
+  int64_t*             old_reports;
+  uint32_t             old_report_count;
+  incremental_key_t*   old_sorted;   // chunks sorted by first_hash
+  // this run
+  incremental_chunk_t* chunks;
+  uint32_t             chunk_count;
+  uint32_t             chunk_alloc;
+} incremental_t;
+
+static uint64_t _incremental_hash(incremental_t* inc, uint32_t first, uint32_t count)
+{
+  return umccache_text_hash( inc->gt.text+inc->gt.lines[first], inc->gt.lines[first+count]-inc->gt.lines[first] );
+}
+
+//line starts with a direct move, see gcp_process_line()
+static bool _incremental_is_sync_line(const char* line)
+{
+  char buf[256]; //parser only looks at this much
+  strncpy( buf, line, sizeof(buf) );
+  buf[sizeof(buf)-1] = 0;
+  buf[strcspn(buf,";*")] = 0;
+
+  char* tok = buf;
+  if( 'N'==*tok )
+  {
+    if( !(tok = strchr(tok,' ')) )
+      return false;
+    tok++;
+  }
+  if( 'G'!=*tok )
+    return false;
+  int code = (int)strtod( tok+1, NULL );
+  if( (0!=code) && (1!=code) )
+    return false;
+
+  while( (tok = strchr(tok,' ')) )
+    if( 'Z'==*(++tok) )
+      return true;
+  return false;
+}
+
+static bool _incremental_gcp_equal(const gcp_state_t* a, const gcp_state_t* b)
+{
+  //file_line_number only counts lines for messages, it changes with edits before
+  return (a->line_number == b->line_number) &&
+         (a->use_absolute == b->use_absolute) && (a->use_extruder_absolute == b->use_extruder_absolute) &&
+         (a->X == b->X) && (a->Y == b->Y) && (a->Z == b->Z) && (a->E == b->E) && (a->F == b->F) &&
+         (a->Z_max_used == b->Z_max_used) && (a->layer == b->layer);
+}
+
+static bool _incremental_umc_equal(const umcwriter_state_t* a, const umcwriter_state_t* b)
+{
+  return (a->Z == b->Z) && (a->bed_temp == b->bed_temp) && (a->nozzle_temp == b->nozzle_temp) &&
+         (a->nozzle_heat_start == b->nozzle_heat_start) && (a->feature == b->feature) &&
+         (a->position[0] == b->position[0]) && (a->position[1] == b->position[1]) && (a->position[2] == b->position[2]);
+}
+
+static void _incremental_capture(transcoder_t* tc, incremental_point_t* p)
+{
+  umcwriter_planner_sync(tc);
+  memset( p, 0, sizeof(incremental_point_t) );
+  gcp_get_state( tc, &p->gcp );
+  umcwriter_get_state( tc, &p->umc );
+  p->block = umcwriter_get_block_index(tc);
+  p->ticks = umcwriter_get_print_ticks(tc);
+}
+
+static int _incremental_sort_cmp(const void* a, const void* b)
+{
+  const incremental_key_t* ka = a;
+  const incremental_key_t* kb = b;
+  if( ka->first_hash != kb->first_hash )
+    return (ka->first_hash>kb->first_hash) - (ka->first_hash<kb->first_hash);
+  return (ka->index>kb->index) - (ka->index<kb->index);
+}
+
+static void _incremental_drop_old(incremental_t* inc)
+{
+  if( inc->old_umc )
+    fclose( inc->old_umc );
+  free( inc->old );
+  free( inc->old_reports );
+  free( inc->old_sorted );
+  inc->old_umc = NULL;
+  inc->old = NULL;
+  inc->old_reports = NULL;
+  inc->old_sorted = NULL;
+  inc->old_count = inc->old_report_count = 0;
+}
+
+static void _incremental_load(incremental_t* inc, const char* fname_ckp, const char* fname_umc, uint64_t job)
+{
+  FILE* f = fopen( fname_ckp, "rb" );
+  if( !f )
+    return;
+
+  incremental_header_t header;
+  bool ok = (1 == fread( &header, sizeof(header), 1, f )) && !memcmp( header.magic, "UPCK", 4 ) &&
+            (TRANSCODER_VERSION == header.version) && (job == header.job) && header.chunk_count;
+  if( ok )
+  {
+    inc->old_count = header.chunk_count;
+    inc->old_report_count = header.report_count;
+    ok = (inc->old = malloc( header.chunk_count*sizeof(incremental_chunk_t) )) &&
+         (inc->old_reports = malloc( (header.report_count+1)*sizeof(int64_t) )) &&
+         (inc->old_sorted = malloc( header.chunk_count*sizeof(incremental_key_t) )) &&
+         (header.chunk_count == fread( inc->old, sizeof(incremental_chunk_t), header.chunk_count, f )) &&
+         (header.report_count == fread( inc->old_reports, sizeof(int64_t), header.report_count, f ));
+  }
+  fclose( f );
+
+  struct stat st;
+  ok = ok && !stat( fname_umc, &st ) && ((uint64_t)st.st_size == header.blocks*sizeof(UP3D_BLK)) &&
+       ((int64_t)st.st_mtime == header.mtime) && (inc->old_umc = fopen( fname_umc, "rb" ));
+
+  uint32_t c;
+  for( c=0; ok && (c<inc->old_count); c++ )
+  {
+    const incremental_chunk_t* chunk = &inc->old[c];
+    ok = (chunk->start.block <= chunk->end.block) && (chunk->end.block <= header.blocks) &&
+         (chunk->report_start <= header.report_count) && (chunk->report_count <= header.report_count-chunk->report_start);
+    inc->old_sorted[c].first_hash = chunk->first_hash;
+    inc->old_sorted[c].index = c;
+  }
+
+  if( !ok )
+  {
+    _incremental_drop_old( inc );
+    return;
+  }
+
+  qsort( inc->old_sorted, inc->old_count, sizeof(incremental_key_t), _incremental_sort_cmp );
+}
+
+//chunk of the previous run giving the output for the lines starting at first with state at
+static const incremental_chunk_t* _incremental_find(incremental_t* inc, uint32_t first, const incremental_point_t* at)
+{
+  if( !inc->old_count )
+    return NULL;
+
+  uint64_t hash = _incremental_hash( inc, first, 1 );
+  uint32_t lo = 0, hi = inc->old_count;
+  while( lo<hi )
+  {
+    uint32_t mid = (lo+hi)/2;
+    if( inc->old_sorted[mid].first_hash < hash )
+      lo = mid+1;
+    else
+      hi = mid;
+  }
+
+  char line[GCODETEXT_LINE_LEN];
+  for( ; (lo<inc->old_count) && (inc->old_sorted[lo].first_hash == hash); lo++ )
+  {
+    const incremental_chunk_t* c = &inc->old[inc->old_sorted[lo].index];
+    uint32_t next = first + c->line_count;
+    if( (next > inc->gt.line_count) || !_incremental_gcp_equal( &c->start.gcp, &at->gcp ) ||
+        !_incremental_umc_equal( &c->start.umc, &at->umc ) || (c->text_hash != _incremental_hash( inc, first, c->line_count )) )
+      continue;
+
+    if( next < inc->gt.line_count )
+    {
+      gcodetext_get_line( &inc->gt, next, line );
+      if( !_incremental_is_sync_line( line ) )
+        continue;
+    }
+    return c;
+  }
+  return NULL;
+}
+
+static incremental_chunk_t* _incremental_add(incremental_t* inc)
+{
+  if( inc->chunk_count == inc->chunk_alloc )
+  {
+    uint32_t alloc = inc->chunk_alloc ? inc->chunk_alloc*2 : 256;
+    incremental_chunk_t* chunks = realloc( inc->chunks, alloc*sizeof(incremental_chunk_t) );
+    if( !chunks )
+      return NULL;
+    inc->chunks = chunks;
+    inc->chunk_alloc = alloc;
+  }
+  return &inc->chunks[inc->chunk_count++];
+}
+
+static void _incremental_close(incremental_t* inc, incremental_chunk_t* cur, uint32_t next, const incremental_point_t* at)
+{
+  cur->line_count = next - cur->first_line;
+  cur->first_hash = _incremental_hash( inc, cur->first_line, 1 );
+  cur->text_hash = _incremental_hash( inc, cur->first_line, cur->line_count );
+  cur->end = *at;
+
+  incremental_chunk_t* c = _incremental_add( inc );
+  if( c )
+    *c = *cur;
+}
+
+static bool _incremental_splice(incremental_t* inc, const incremental_chunk_t* old, uint32_t first, const incremental_point_t* at)
+{
+  if( fseek( inc->old_umc, (long)(old->start.block*sizeof(UP3D_BLK)), SEEK_SET ) ||
+      !umcwriter_splice( inc->tc, inc->old_umc, old->end.block-old->start.block, inc->old_reports+old->report_start,
+                         old->report_count, old->end.ticks-old->start.ticks ) )
+    return false;
+
+  incremental_chunk_t* c = _incremental_add( inc );
+  if( c )
+  {
+    *c = *old;
+    c->first_line = first;
+    c->start.block = at->block;
+    c->start.ticks = at->ticks;
+    c->start.gcp.file_line_number = at->gcp.file_line_number;
+    c->end.block = at->block + (old->end.block-old->start.block);
+    c->end.ticks = at->ticks + (old->end.ticks-old->start.ticks);
+    c->end.gcp.file_line_number = at->gcp.file_line_number + old->line_count;
+  }
+
+  gcp_state_t gcp = old->end.gcp;
+  gcp.file_line_number = at->gcp.file_line_number + old->line_count;
+  gcp_set_state( inc->tc, &gcp );
+  umcwriter_set_state( inc->tc, &old->end.umc );
+  return true;
+}
+
+static void _incremental_save(incremental_t* inc, const char* fname_ckp, const char* fname_umc, uint64_t job)
+{
+  uint32_t report_count, r = 0, out = 0, c;
+  const umcwriter_report_t* reports = umcwriter_get_reports( inc->tc, &report_count );
+  int64_t* ticks = malloc( (report_count+1)*sizeof(int64_t) );
+  if( !ticks )
+    return;
+
+  for( c=0; c<inc->chunk_count; c++ )
+  {
+    incremental_chunk_t* chunk = &inc->chunks[c];
+    while( (r<report_count) && (reports[r].index < chunk->start.block) )
+      r++;
+    chunk->report_start = out;
+    for( ; (r<report_count) && (reports[r].index < chunk->end.block); r++ )
+      ticks[out++] = reports[r].ticks - chunk->start.ticks;
+    chunk->report_count = out - chunk->report_start;
+  }
+
+  incremental_header_t header = { .magic = "UPCK", .version = TRANSCODER_VERSION, .job = job,
+                                  .chunk_count = inc->chunk_count, .report_count = out };
+  struct stat st;
+  FILE* f = NULL;
+  if( !stat( fname_umc, &st ) )
+  {
+    header.blocks = (uint64_t)st.st_size/sizeof(UP3D_BLK);
+    header.mtime = (int64_t)st.st_mtime;
+    f = fopen( fname_ckp, "wb" );
+  }
+  if( f )
+  {
+    bool ok = (1 == fwrite( &header, sizeof(header), 1, f )) &&
+         (inc->chunk_count == fwrite( inc->chunks, sizeof(incremental_chunk_t), inc->chunk_count, f )) &&
+         (out == fwrite( ticks, sizeof(int64_t), out, f ));
+    if( fclose( f ) || !ok )
+      remove( fname_ckp );
+  }
+  free( ticks );
+}
+
+//returns -3 when the previous output could not be read, nothing is kept then
+static int _incremental_run(incremental_t* inc, const char* fname_temp, double heightZ, char machine_type, bool preheat)
+{
+  transcoder_t* tc = inc->tc;
+  inc->chunk_count = 0;
+
+  if( !umcwriter_init( tc, fname_temp, heightZ, machine_type ) )
+    return -1;
+  umcwriter_track_reports( tc );
+
+  gcp_reset( tc );
+  uint32_t i;
+  char line[GCODETEXT_LINE_LEN];
+  if( preheat )
+  {
+    for( i=0; i<inc->gt.line_count; i++ )
+    {
+      gcodetext_get_line( &inc->gt, i, line );
+      if( !gcp_preheat_scan(tc, line) )
+        break;
+    }
+    gcp_preheat_start( tc );
+  }
+
+  incremental_chunk_t cur;
+  incremental_point_t at;
+  bool open = false;
+  for( i=0; i<inc->gt.line_count; )
+  {
+    gcodetext_get_line( &inc->gt, i, line );
+    bool sync_line = _incremental_is_sync_line( line );
+    if( !open || sync_line )
+    {
+      _incremental_capture( tc, &at );
+      const incremental_chunk_t* old = _incremental_find( inc, i, &at );
+      if( old )
+      {
+        if( open )
+          _incremental_close( inc, &cur, i, &at );
+        open = false;
+        if( !_incremental_splice( inc, old, i, &at ) )
+          return -3;
+        i += old->line_count;
+        continue;
+      }
+      if( !open )
+      {
+        memset( &cur, 0, sizeof(cur) );
+        cur.first_line = i;
+        cur.start = at;
+        open = true;
+      }
+    }
+
+    int layer = gcp_get_layer(tc);
+    if( !gcp_process_line(tc, line) )
+      return 0;
+
+    if( sync_line && (cur.first_line<i) && (gcp_get_layer(tc)!=layer) && (at.umc.nozzle_heat_start<0) )
+    {
+      _incremental_close( inc, &cur, i, &at );
+      memset( &cur, 0, sizeof(cur) );
+      cur.first_line = i;
+      cur.start = at;
+    }
+    i++;
+  }
+
+  _incremental_capture( tc, &at );
+  if( open )
+    _incremental_close( inc, &cur, i, &at );
+  return 1;
+}
+
+int incremental_transcode(transcoder_t* tc, FILE* fgcode, const char* fname_umc, double heightZ, char machine_type, bool preheat)
+{
+  incremental_t inc;
+  memset( &inc, 0, sizeof(inc) );
+  inc.tc = tc;
+
+  if( !gcodetext_read( &inc.gt, fgcode ) )
+  {
+    gcodetext_free( &inc.gt );
+    rewind( fgcode );
+    return transcoder_run( tc, fgcode, fname_umc, heightZ, machine_type, preheat );
+  }
+
+  char fname_ckp[1040], fname_temp[1040], fname_ckp_temp[1040];
+  snprintf( fname_ckp, sizeof(fname_ckp), "%s.ckp", fname_umc );
+  snprintf( fname_temp, sizeof(fname_temp), "%s.tmp", fname_umc );
+  snprintf( fname_ckp_temp, sizeof(fname_ckp_temp), "%s.ckp.tmp", fname_umc );
+
+  uint64_t job = umccache_job_hash( &tc->settings, heightZ, machine_type, preheat );
+  _incremental_load( &inc, fname_ckp, fname_umc, job );
+
+  int ret = _incremental_run( &inc, fname_temp, heightZ, machine_type, preheat );
+  if( -3 == ret )
+  {
+    umcwriter_abort( tc );
+    _incremental_drop_old( &inc );
+    ret = _incremental_run( &inc, fname_temp, heightZ, machine_type, preheat );
+  }
+  _incremental_drop_old( &inc );
+
+  if( 1 == ret )
+  {
+    umcwriter_finish( tc );
+    _incremental_save( &inc, fname_ckp_temp, fname_temp, job );
+
+    char fname_idx[1050], fname_idx_temp[1050];
+    umcindex_name( fname_idx, sizeof(fname_idx), fname_umc );
+    umcindex_name( fname_idx_temp, sizeof(fname_idx_temp), fname_temp );
+
+    remove( fname_ckp ); //windows does not replace files
+    remove( fname_umc );
+    remove( fname_idx );
+    if( rename( fname_temp, fname_umc ) )
+      ret = -1;
+    else
+    {
+      rename( fname_ckp_temp, fname_ckp );
+      rename( fname_idx_temp, fname_idx );
+    }
+  }
+  else
+  {
+    umcwriter_abort( tc );
+    remove( fname_temp );
+  }
+
+  umcwriter_abort( tc ); //tracked reports
+  free( inc.chunks );
+  gcodetext_free( &inc.gt );
+  return ret;
+}
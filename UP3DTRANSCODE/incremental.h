@@ -0,0 +1,35 @@
+/*
+  incremental.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef incremental_h
+#define incremental_h
+
+#include "transcoder.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Update an output after edits of the g-code: fname_umc.ckp keeps a checkpoint of parser and writer
+// state plus a hash of the input for every layer of fname_umc. Layers with the same input and start state
+// as before are copied from the previous output, only changed layers are transcoded again. The output is
+// identical to a full transcode. On g-code errors the previous output is left unchanged.
+// Returns like transcoder_run(), umcwriter_finish() was already called on 1.
+int incremental_transcode(transcoder_t* tc, FILE* fgcode, const char* fname_umc, double heightZ, char machine_type, bool preheat);
+
+#endif //incremental_h
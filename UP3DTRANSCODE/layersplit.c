@@ -0,0 +1,243 @@
+/*
+  layersplit.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "layersplit.h"
+#include "transcoder.h"
+#include "gcodetext.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+// Every layer change is a direct move which syncs the planner, so a chunk starting there only
+// depends on the carried parser and writer state. It is taken in a quick scan (no planning),
+// layer changes while a cold nozzle is heating up are skipped since the wait time depends on it.
+
+#define LAYERSPLIT_MAX_JOBS 64
+
+struct layersplit;
+
+typedef struct {
+  struct layersplit* job;
+  uint32_t           index;
+  uint32_t           line;  //first line of chunk
+  gcp_state_t        gcp;   //carried state at chunk start
+  umcwriter_state_t  umc;
+  pthread_t          thread;
+  bool               started;
+  bool               ok;    //result of the worker
+  int64_t            ticks;
+  gcp_state_t        gcp_end;
+} layersplit_chunk_t;
+
+typedef struct layersplit {
+  const settings_t*  settings;
+  const char*        fname_umc;
+  double             heightZ;
+  char               machine_type;
+  bool               preheat;
+  gcodetext_t        gt;
+  layersplit_chunk_t chunks[LAYERSPLIT_MAX_JOBS];
+  uint32_t           chunk_count;
+} layersplit_t;
+
+static void _layersplit_start(layersplit_t* ls, transcoder_t* tc)
+{
+  gcp_reset(tc);
+
+  if( ls->preheat )
+  {
+    uint32_t i;
+    char line[GCODETEXT_LINE_LEN];
+    for( i=0; i<ls->gt.line_count; i++ )
+    {
+      gcodetext_get_line( &ls->gt, i, line );
+      if( !gcp_preheat_scan(tc, line) )
+        break;
+    }
+    gcp_preheat_start(tc);
+  }
+}
+
+//choose chunk starts at layer changes, spread evenly over the lines
+static void _layersplit_scan(layersplit_t* ls, uint32_t jobs)
+{
+  ls->chunk_count = 1;
+  ls->chunks[0].line = 0;
+
+  arena_t arena;
+  transcoder_t* tc;
+  if( !arena_init(&arena, TRANSCODER_ARENA_SIZE) || !(tc = transcoder_create(&arena, ls->settings)) )
+  {
+    arena_free( &arena );
+    return; //serial transcode
+  }
+
+  umcwriter_init( tc, NULL, ls->heightZ, ls->machine_type );
+  umcwriter_set_mute( tc, true );
+  gcp_set_quiet( tc, true );
+  _layersplit_start( ls, tc );
+
+  uint32_t i;
+  char line[GCODETEXT_LINE_LEN];
+  for( i=0; (i<ls->gt.line_count) && (ls->chunk_count<jobs); i++ )
+  {
+    layersplit_chunk_t *c = &ls->chunks[ls->chunk_count];
+    bool candidate = ((uint64_t)i*jobs >= (uint64_t)ls->gt.line_count*ls->chunk_count);
+    int layer = gcp_get_layer(tc);
+    if( candidate )
+    {
+      gcp_get_state( tc, &c->gcp );
+      umcwriter_get_state( tc, &c->umc );
+    }
+
+    gcodetext_get_line( &ls->gt, i, line );
+    if( !gcp_process_line(tc, line) )
+      break; //no chunks after an error, the chunk containing it reports it
+
+    if( candidate && (gcp_get_layer(tc)!=layer) && (c->umc.nozzle_heat_start<0) )
+    {
+      c->line = i;
+      ls->chunk_count++;
+    }
+  }
+
+  arena_free( &arena );
+}
+
+static bool _layersplit_process_chunk(layersplit_t* ls, transcoder_t* tc, uint32_t chunk)
+{
+  uint32_t i, end = (chunk+1<ls->chunk_count) ? ls->chunks[chunk+1].line : ls->gt.line_count;
+  char line[GCODETEXT_LINE_LEN];
+  for( i=ls->chunks[chunk].line; i<end; i++ )
+  {
+    gcodetext_get_line( &ls->gt, i, line );
+    if( !gcp_process_line(tc, line) )
+      return false;
+  }
+  return true;
+}
+
+static void _layersplit_chunk_name(layersplit_t* ls, char* name, size_t size, uint32_t chunk)
+{
+  snprintf( name, size, "%s.part%u", ls->fname_umc, chunk );
+}
+
+static void* _layersplit_worker(void* arg)
+{
+  layersplit_chunk_t *c = arg;
+  layersplit_t *ls = c->job;
+
+  char name[1024];
+  _layersplit_chunk_name( ls, name, sizeof(name), c->index );
+
+  arena_t arena;
+  transcoder_t* tc;
+  if( !arena_init(&arena, TRANSCODER_ARENA_SIZE) || !(tc = transcoder_create(&arena, ls->settings)) )
+    printf("ERROR: Out of memory\n");
+  else if( !umcwriter_open( tc, name, ls->heightZ, ls->machine_type ) )
+    printf("ERROR: Could not open %s for writing\n\n", name);
+  else
+  {
+    umcwriter_set_state( tc, &c->umc );
+    gcp_set_state( tc, &c->gcp );
+
+    c->ok = _layersplit_process_chunk( ls, tc, c->index );
+    if( c->ok )
+      umcwriter_close( tc );
+    else
+      umcwriter_abort( tc ); //output stays as it is, like the serial transcode leaves it
+    c->ticks = umcwriter_get_print_ticks( tc );
+    gcp_get_state( tc, &c->gcp_end );
+  }
+
+  arena_free( &arena );
+  return NULL;
+}
+
+int layersplit_transcode(transcoder_t* tc, FILE* fgcode, const char* fname_umc, double heightZ, char machine_type, bool preheat, uint32_t jobs)
+{
+  if( jobs>LAYERSPLIT_MAX_JOBS )
+    jobs = LAYERSPLIT_MAX_JOBS;
+
+  layersplit_t* ls = calloc( 1, sizeof(layersplit_t) );
+  if( !ls )
+    return -1;
+  ls->settings = &tc->settings;
+  ls->fname_umc = fname_umc;
+  ls->heightZ = heightZ;
+  ls->machine_type = machine_type;
+  ls->preheat = preheat;
+
+  int ret = 1;
+  if( !gcodetext_read(&ls->gt, fgcode) )
+    ret = -1;
+  else
+    _layersplit_scan( ls, jobs );
+
+  uint32_t chunk;
+  for( chunk=1; (1==ret) && (chunk<ls->chunk_count); chunk++ )
+  {
+    layersplit_chunk_t *c = &ls->chunks[chunk];
+    c->job = ls;
+    c->index = chunk;
+    if( pthread_create( &c->thread, NULL, _layersplit_worker, c ) )
+    {
+      ls->chunk_count = chunk; //previous chunk continues to the end
+      break;
+    }
+    c->started = true;
+  }
+
+  if( 1==ret )
+  {
+    if( !umcwriter_init( tc, fname_umc, heightZ, machine_type ) )
+      ret = -1;
+    else
+    {
+      _layersplit_start( ls, tc );
+      if( !_layersplit_process_chunk(ls, tc, 0) )
+        ret = 0;
+    }
+  }
+
+  for( chunk=1; chunk<ls->chunk_count; chunk++ )
+  {
+    layersplit_chunk_t *c = &ls->chunks[chunk];
+    if( !c->started )
+      continue;
+    pthread_join( c->thread, NULL );
+
+    char name[1024];
+    _layersplit_chunk_name( ls, name, sizeof(name), chunk );
+    if( (1==ret) && !umcwriter_append( tc, name, c->ticks ) )
+      ret = -1;
+    if( (1==ret) && !c->ok )
+      ret = 0;
+    if( 1==ret )
+      gcp_set_state( tc, &c->gcp_end );
+    remove( name );
+  }
+
+  gcodetext_free( &ls->gt );
+  free( ls );
+  return ret;
+}
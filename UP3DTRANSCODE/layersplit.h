@@ -0,0 +1,33 @@
+/*
+  layersplit.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef layersplit_h
+#define layersplit_h
+
+#include "up3dconf.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Transcode fgcode split at layer changes into up to jobs chunks. All but the first chunk are
+// transcoded by worker threads with their own transcoder, then appended to the output of tc.
+// Output is identical to the serial transcode. Returns like transcoder_run().
+int layersplit_transcode(transcoder_t* tc, FILE* fgcode, const char* fname_umc, double heightZ, char machine_type, bool preheat, uint32_t jobs);
+
+#endif //layersplit_h
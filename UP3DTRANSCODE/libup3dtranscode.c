@@ -0,0 +1,183 @@
+/*
+  libup3dtranscode.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "libup3dtranscode.h"
+#include "transcoder.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UP3DTRANSCODE_LINE_LEN 1024 //same line splitting as fgets() of up3dtranscode
+
+struct up3dtranscode {
+  arena_t       arena;
+  transcoder_t* tc;
+  bool          failed;
+  bool          finished;
+  char          line[UP3DTRANSCODE_LINE_LEN];
+  size_t        line_len;
+  bool          preheat_scan;  // start sequence is collected until the preheat temperatures are known
+  char*         held;          // collected lines, each one zero terminated
+  size_t        held_len;
+  size_t        held_alloc;
+};
+
+up3dtranscode_t* up3dtranscode_create(const char* machinetype, double nozzle_height, bool preheat,
+                                      up3dtranscode_sink_t sink, up3dtranscode_sink_t patch, void* user)
+{
+  const settings_t* settings = up3dconf_get_machine_settings(machinetype);
+  if( !settings || !sink )
+    return NULL;
+
+  up3dtranscode_t* t = calloc( 1, sizeof(up3dtranscode_t) );
+  if( !t )
+    return NULL;
+
+  if( !arena_init(&t->arena, TRANSCODER_ARENA_SIZE) || !(t->tc = transcoder_create(&t->arena, settings)) )
+  {
+    arena_free( &t->arena );
+    free( t );
+    return NULL;
+  }
+
+  umcwriter_init_sink( t->tc, sink, patch, user, nozzle_height, machinetype[0] );
+  gcp_reset( t->tc );
+  t->preheat_scan = preheat;
+  return t;
+}
+
+static bool _up3dtranscode_process(up3dtranscode_t* t, const char* line)
+{
+  if( !gcp_process_line(t->tc, line) || umcwriter_sink_failed(t->tc) )
+    t->failed = true;
+  return !t->failed;
+}
+
+static void _up3dtranscode_release_held(up3dtranscode_t* t)
+{
+  t->preheat_scan = false;
+  gcp_preheat_start( t->tc );
+
+  size_t pos;
+  for( pos=0; (pos<t->held_len) && !t->failed; pos += strlen(t->held+pos)+1 )
+    _up3dtranscode_process( t, t->held+pos );
+
+  free( t->held );
+  t->held = NULL;
+  t->held_len = t->held_alloc = 0;
+}
+
+static bool _up3dtranscode_hold(up3dtranscode_t* t, const char* line)
+{
+  size_t len = strlen(line)+1;
+  if( t->held_len+len > t->held_alloc )
+  {
+    size_t alloc = t->held_alloc ? t->held_alloc*2 : 1<<16;
+    char* held = realloc( t->held, alloc );
+    if( !held )
+      return false;
+    t->held = held;
+    t->held_alloc = alloc;
+  }
+  memcpy( t->held+t->held_len, line, len );
+  t->held_len += len;
+  return true;
+}
+
+static void _up3dtranscode_line(up3dtranscode_t* t)
+{
+  t->line[t->line_len] = 0;
+  t->line_len = 0;
+
+  if( !t->preheat_scan )
+  {
+    _up3dtranscode_process( t, t->line );
+    return;
+  }
+
+  if( !_up3dtranscode_hold(t, t->line) )
+    t->failed = true;
+  else if( !gcp_preheat_scan(t->tc, t->line) )
+    _up3dtranscode_release_held( t );
+}
+
+bool up3dtranscode_push(up3dtranscode_t* t, const char* data, size_t len)
+{
+  while( len && !t->failed && !t->finished )
+  {
+    size_t n = UP3DTRANSCODE_LINE_LEN-1-t->line_len;
+    if( n>len )
+      n = len;
+    const char* nl = memchr( data, '\n', n );
+    if( nl )
+      n = (size_t)(nl-data)+1;
+
+    memcpy( t->line+t->line_len, data, n );
+    t->line_len += n;
+    data += n;
+    len -= n;
+
+    if( nl || (UP3DTRANSCODE_LINE_LEN-1 == t->line_len) )
+      _up3dtranscode_line( t );
+  }
+  return !t->failed && !t->finished;
+}
+
+bool up3dtranscode_finish(up3dtranscode_t* t)
+{
+  if( t->failed || t->finished )
+    return false;
+
+  if( t->line_len )
+    _up3dtranscode_line( t );
+  if( t->preheat_scan && !t->failed )
+    _up3dtranscode_release_held( t );
+  if( t->failed )
+    return false;
+
+  t->finished = true;
+  umcwriter_finish( t->tc );
+  return !umcwriter_sink_failed( t->tc );
+}
+
+int32_t up3dtranscode_get_print_time(up3dtranscode_t* t)
+{
+  return umcwriter_get_print_time( t->tc );
+}
+
+int up3dtranscode_get_layer(up3dtranscode_t* t)
+{
+  return gcp_get_layer( t->tc );
+}
+
+double up3dtranscode_get_height(up3dtranscode_t* t)
+{
+  return gcp_get_height( t->tc );
+}
+
+void up3dtranscode_destroy(up3dtranscode_t* t)
+{
+  if( !t )
+    return;
+  umcwriter_abort( t->tc );
+  free( t->held );
+  arena_free( &t->arena );
+  free( t );
+}
@@ -0,0 +1,59 @@
+/*
+  libup3dtranscode.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef libup3dtranscode_h
+#define libup3dtranscode_h
+
+#include "up3ddata.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// In process transcoding: g-code is pushed in buffers of any size, the generated blocks are handed
+// to a sink callback in batches. Blocks are identical to the ones up3dtranscode writes to a file.
+//
+// The time remaining and percent report blocks can only be calculated when the job is complete.
+// At finish the ones already sent are handed to the patch callback again with their final values
+// (same index as before), e.g. to seek and rewrite them in a file or cache. Without a patch callback
+// they keep their initial values. Contexts are independent, each one can be used in its own thread.
+
+typedef struct up3dtranscode up3dtranscode_t;
+
+// blks[0..count-1] are the blocks index..index+count-1 of the output, return false to stop the transcode
+typedef bool (*up3dtranscode_sink_t)(void* user, uint32_t index, const UP3D_BLK* blks, uint32_t count);
+
+// machinetype: mini / classic / plus / box / cetus, returns NULL for unknown machine or out of memory
+up3dtranscode_t* up3dtranscode_create(const char* machinetype, double nozzle_height, bool preheat,
+                                      up3dtranscode_sink_t sink, up3dtranscode_sink_t patch, void* user);
+
+// Transcode the next part of the g-code, lines may span buffers. Returns false on invalid g-code
+// (message is printed) or when a callback stopped the transcode, the context can only be destroyed then.
+bool up3dtranscode_push(up3dtranscode_t* t, const char* data, size_t len);
+
+// End of g-code: transcode a last unterminated line, write the end sequence and patch the reports
+bool up3dtranscode_finish(up3dtranscode_t* t);
+
+// Results, complete after finish
+int32_t up3dtranscode_get_print_time(up3dtranscode_t* t); // seconds
+int     up3dtranscode_get_layer(up3dtranscode_t* t);
+double  up3dtranscode_get_height(up3dtranscode_t* t);
+
+void up3dtranscode_destroy(up3dtranscode_t* t);
+
+#endif //libup3dtranscode_h
@@ -8,35 +8,116 @@ if [ -z "$STRIP" ]; then
     STRIP=strip
 fi
 
+if [ -z "$AR" ]; then
+    AR=ar
+fi
+
+# low memory build for routers without FPU (OpenWrt on TL-WR703N):
+#   SMALL=1 CC=mips-openwrt-linux-gcc STRIP=mips-openwrt-linux-strip AR=mips-openwrt-linux-ar ./make.sh
+# single precision planner/stepper (warns if an expression falls back to double) and a planner lookahead
+# of 256 instead of 8192 moves
+if [ -z "$SMALL" ]; then
+    OPT="-Ofast"
+else
+    OPT="-Os -DUP3D_FLOAT -DBLOCK_BUFFER_SIZE=256 -DPLAN_BATCH_SIZE=16 -Wdouble-promotion"
+fi
+
 # note: for windows get MSYS2, install gcc for mingw using pacman and compile using the mingw shell
 
 if [[ "$OSTYPE" == "msys" ]]; then
 
-$CC -std=c99 -Ofast -fwhole-program -flto \
+$CC -std=c99 $OPT -fwhole-program -flto -D_DEFAULT_SOURCE \
     -I../UP3DCOMMON \
-    -o up3dtranscode.exe up3dconf.c hoststepper.c hostplanner.c gcodeparser.c ../UP3DCOMMON/up3ddata.c umcwriter.c up3dtranscode.c -lm
+    -o up3dtranscode.exe up3dconf.c arena.c hoststepper.c hostplanner.c gcodeparser.c ../UP3DCOMMON/up3ddata.c umcwriter.c umcindex.c umcsim.c ../UP3DCOMMON/umcreader.c transcoder.c gcodetext.c layersplit.c fanout.c umccache.c incremental.c umcoptimize.c umcloop.c up3dtranscode.c -lm -pthread
 
 $STRIP up3dtranscode.exe
 
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dretarget.exe up3dretarget.c ../UP3DCOMMON/umcreader.c -lm -pthread
+$STRIP up3dretarget.exe
+
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dsim.exe up3dsim.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dsim.exe
+
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dprofile.exe up3dprofile.c umcprofile.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dprofile.exe
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dresume.exe up3dresume.c umcresume.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dresume.exe
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3doptimize.exe up3doptimize.c umcoptimize.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3doptimize.exe
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dloop.exe up3dloop.c umcloop.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dloop.exe
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dlink.exe up3dlink.c umclink.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dlink.exe
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3ddiff.exe up3ddiff.c umcdiff.c umcprofile.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3ddiff.exe
+
 elif [[ "$OSTYPE" == "darwin"* ]]; then
 
 
-$CC -std=c99 -Ofast \
+$CC -std=c99 $OPT -D_DEFAULT_SOURCE \
     -I../UP3DCOMMON \
     -framework IOKit \
     -framework CoreFoundation \
     -lobjc \
-    -o up3dtranscode up3dconf.c hoststepper.c hostplanner.c gcodeparser.c ../UP3DCOMMON/up3ddata.c umcwriter.c up3dtranscode.c -lm
+    -o up3dtranscode up3dconf.c arena.c hoststepper.c hostplanner.c gcodeparser.c ../UP3DCOMMON/up3ddata.c umcwriter.c umcindex.c umcsim.c ../UP3DCOMMON/umcreader.c transcoder.c gcodetext.c layersplit.c fanout.c umccache.c incremental.c umcoptimize.c umcloop.c up3dtranscode.c -lm -pthread
 
 $STRIP up3dtranscode
 
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dretarget up3dretarget.c ../UP3DCOMMON/umcreader.c -lm -pthread
+$STRIP up3dretarget
+
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dsim up3dsim.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dsim
+
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dprofile up3dprofile.c umcprofile.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dprofile
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dresume up3dresume.c umcresume.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dresume
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3doptimize up3doptimize.c umcoptimize.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3doptimize
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dloop up3dloop.c umcloop.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dloop
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dlink up3dlink.c umclink.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dlink
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3ddiff up3ddiff.c umcdiff.c umcprofile.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3ddiff
+
 
 elif [[ "$OSTYPE" == "linux-gnu"* ]]; then
 
-$CC -std=c99 -Ofast -fwhole-program -flto \
+$CC -std=c99 $OPT -fwhole-program -flto -D_DEFAULT_SOURCE \
     -I../UP3DCOMMON \
-    -o up3dtranscode up3dconf.c hoststepper.c hostplanner.c gcodeparser.c ../UP3DCOMMON/up3ddata.c umcwriter.c up3dtranscode.c -lm
+    -o up3dtranscode up3dconf.c arena.c hoststepper.c hostplanner.c gcodeparser.c ../UP3DCOMMON/up3ddata.c umcwriter.c umcindex.c umcsim.c ../UP3DCOMMON/umcreader.c transcoder.c gcodetext.c layersplit.c fanout.c umccache.c incremental.c umcoptimize.c umcloop.c up3dtranscode.c -lm -pthread
 
 $STRIP up3dtranscode
 
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dretarget up3dretarget.c ../UP3DCOMMON/umcreader.c -lm -pthread
+$STRIP up3dretarget
+
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dsim up3dsim.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dsim
+
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dprofile up3dprofile.c umcprofile.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dprofile
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dresume up3dresume.c umcresume.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dresume
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3doptimize up3doptimize.c umcoptimize.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3doptimize
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dloop up3dloop.c umcloop.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dloop
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3dlink up3dlink.c umclink.c umcindex.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3dlink
+$CC -std=c99 -Os -D_DEFAULT_SOURCE -I../UP3DCOMMON -o up3ddiff up3ddiff.c umcdiff.c umcprofile.c umcsim.c up3dconf.c ../UP3DCOMMON/umcreader.c ../UP3DCOMMON/up3ddata.c -lm -pthread
+$STRIP up3ddiff
+
 fi
+
+# static library for embedding the transcoder, see libup3dtranscode.h
+
+LIBOBJ=$(mktemp -d)
+for SRC in up3dconf.c arena.c hoststepper.c hostplanner.c gcodeparser.c ../UP3DCOMMON/up3ddata.c umcwriter.c umcindex.c umcsim.c ../UP3DCOMMON/umcreader.c transcoder.c libup3dtranscode.c; do
+    $CC -std=c99 $OPT -D_DEFAULT_SOURCE -I../UP3DCOMMON -c $SRC -o $LIBOBJ/$(basename $SRC .c).o
+done
+rm -f libup3dtranscode.a
+$AR rcs libup3dtranscode.a $LIBOBJ/*.o
+rm -rf $LIBOBJ
@@ -0,0 +1,121 @@
+#!/bin/bash
+
+# golden output regression test for up3dtranscode (run after make.sh):
+#   every g-code file in TESTDATA is transcoded for every machine type, the sha256 of each
+#   output is compared with TESTDATA/golden.sha256 and the transcode time is printed
+#
+#   bash regress.sh              check against the golden hashes
+#   bash regress.sh -u           write new golden hashes (after an intended change of the output)
+#   bash regress.sh -k DIR       keep the outputs in DIR (e.g. of the last commit, as reference)
+#   bash regress.sh -r DIR       outputs with another hash pass if up3ddiff finds every layer of the
+#                                output in DIR ending within TOLERANCE steps (default 2)
+#   bash regress.sh -c FILE      append the transcode times as CSV to FILE
+#
+# The hashes depend on compiler and floating point flags (-Ofast, SMALL builds), they are made
+# with gcc on linux x86-64. Elsewhere keep the outputs of a known good build and use -r.
+
+EXE=""
+if [[ "$OSTYPE" == "msys" ]]; then
+    EXE=".exe"
+fi
+
+if [ -z "$TOLERANCE" ]; then
+    TOLERANCE=2
+fi
+
+MACHINES="mini classic plus box cetus"
+NOZZLE=123.45
+GOLDEN=TESTDATA/golden.sha256
+
+UPDATE=0
+KEEP=""
+REF=""
+CSV=""
+while getopts "uk:r:c:" opt; do
+    case $opt in
+        u) UPDATE=1 ;;
+        k) KEEP="$OPTARG" ;;
+        r) REF="$OPTARG" ;;
+        c) CSV="$OPTARG" ;;
+        *) exit 2 ;;
+    esac
+done
+
+if command -v sha256sum >/dev/null; then
+    SHA="sha256sum"
+else
+    SHA="shasum -a 256"
+fi
+
+OUT="$KEEP"
+if [ -z "$OUT" ]; then
+    OUT=$(mktemp -d 2>/dev/null || mktemp -d -t up3dregress)
+    trap 'rm -rf "$OUT"' EXIT
+fi
+mkdir -p "$OUT"
+
+# test cases: name, options of up3dtranscode, machine, g-code
+CASES=()
+for g in TESTDATA/*.gcode; do
+    f=$(basename "$g" .gcode)
+    for m in $MACHINES; do
+        CASES+=("$m/$f||$m|$g")
+    done
+    CASES+=("mini-p/$f|-p|mini|$g")
+    CASES+=("mini-j4/$f|-j4|mini|$g")
+    CASES+=("mini-OL/$f|-O -L|mini|$g")
+    CASES+=("mini-a/$f|-a2250|mini|$g")
+done
+
+NEW=()
+FAIL=0
+TOTAL=0
+GIT=$(git describe --tags --always 2>/dev/null)
+TIMEFORMAT="%R"
+
+printf "%-24s %8s %10s  %s\n" "Case" "Time(s)" "Blocks" "Result"
+for c in "${CASES[@]}"; do
+    IFS='|' read -r name opts machine gcode <<< "$c"
+    umc="$OUT/${name//\//_}.umc"
+
+    t=$( { time ./up3dtranscode$EXE $opts $machine $gcode "$umc" $NOZZLE >/dev/null 2>&1; } 2>&1 )
+    if [ ! -f "$umc" ]; then
+        printf "%-24s %8s %10s  %s\n" "$name" "$t" "-" "FAIL (no output)"
+        FAIL=$((FAIL+1))
+        continue
+    fi
+    hash=$($SHA "$umc" | cut -d' ' -f1)
+    blocks=$(( $(wc -c < "$umc") / 20 ))
+    NEW+=("$hash  $name")
+    TOTAL=$(awk "BEGIN { print $TOTAL + $t }")
+    if [ -n "$CSV" ]; then
+        echo "$GIT,$name,$blocks,$t" >> "$CSV"
+    fi
+
+    result="ok"
+    if [ $UPDATE -eq 1 ]; then
+        result="updated"
+    elif ! grep -qx "$hash  $name" $GOLDEN 2>/dev/null; then
+        ref="$REF/${name//\//_}.umc"
+        if [ -n "$REF" ] && [ -f "$ref" ] && ./up3ddiff$EXE -t$TOLERANCE $machine "$ref" "$umc" >/dev/null; then
+            result="ok (within $TOLERANCE steps)"
+        else
+            result="FAIL"
+            FAIL=$((FAIL+1))
+        fi
+    fi
+    printf "%-24s %8s %10s  %s\n" "$name" "$t" "$blocks" "$result"
+done
+printf "%-24s %8s\n" "Total" "$TOTAL"
+
+if [ $UPDATE -eq 1 ]; then
+    printf "%s\n" "${NEW[@]}" > $GOLDEN
+    echo "${#NEW[@]} golden hashes written to $GOLDEN"
+    exit 0
+fi
+
+if [ $FAIL -ne 0 ]; then
+    echo "$FAIL of ${#CASES[@]} cases FAILED (compare with up3ddiff to see what changed)"
+    exit 1
+fi
+echo "all ${#CASES[@]} cases passed"
@@ -0,0 +1,52 @@
+/*
+  transcoder.c for UP3DTranscoder
+  UP3DTools contributors 2026, transcode loop from up3dtranscode.c by M. Stohn 2016
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "transcoder.h"
+
+#include <stdio.h>
+#include <string.h>
+
+transcoder_t* transcoder_create(arena_t* arena, const settings_t* settings)
+{
+  transcoder_t* tc = arena_alloc( arena, sizeof(transcoder_t) );
+  if( tc )
+    memcpy( &tc->settings, settings, sizeof(settings_t) );
+  return tc;
+}
+
+int transcoder_run(transcoder_t* tc, FILE* fgcode, const char* fname_umc, double heightZ, char machine_type, bool preheat)
+{
+  if( !umcwriter_init( tc, fname_umc, heightZ, machine_type ) )
+    return -1;
+
+  gcp_reset(tc);
+
+  char line[1024];
+  if( preheat )
+  {
+    while( fgets(line,sizeof(line),fgcode) && gcp_preheat_scan(tc, line) );
+    rewind( fgcode );
+    gcp_preheat_start(tc);
+  }
+
+  while( fgets(line,sizeof(line),fgcode) )
+    if( !gcp_process_line(tc, line) )
+      return 0;
+
+  return 1;
+}
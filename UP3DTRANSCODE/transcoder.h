@@ -0,0 +1,56 @@
+/*
+  transcoder.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef transcoder_h
+#define transcoder_h
+
+#include "up3dconf.h"
+#include "hostplanner.h"
+#include "hoststepper.h"
+#include "gcodeparser.h"
+#include "umcwriter.h"
+#include "arena.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Complete state of one transcoding job. Every function of planner, stepper, parser and writer
+// works on the transcoder passed to it, independent jobs can run in parallel threads.
+struct transcoder {
+  settings_t      settings;
+  plan_ctx_t      plan;
+  st_ctx_t        st;
+  gcp_ctx_t       gcp;
+  umcwriter_ctx_t umc;
+};
+
+// Increase whenever the generated output changes, cached outputs of other versions are not used
+#define TRANSCODER_VERSION 3
+
+// Arena size needed for one transcoder
+#define TRANSCODER_ARENA_SIZE (sizeof(transcoder_t)+1024)
+
+// Create a transcoder for the machine settings inside arena, it is gone with arena_free()
+transcoder_t* transcoder_create(arena_t* arena, const settings_t* settings);
+
+// Transcode a whole g-code file (fname_umc NULL: estimate only). Returns 1: done (umcwriter_finish()
+// still to be called), 0: g-code error (message printed, output is left unfinished), -1: output could not be written
+int transcoder_run(transcoder_t* tc, FILE* fgcode, const char* fname_umc, double heightZ, char machine_type, bool preheat);
+
+#endif //transcoder_h
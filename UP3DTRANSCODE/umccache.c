@@ -0,0 +1,431 @@
+/*
+  umccache.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umccache.h"
+#include "transcoder.h"
+#include "umcindex.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <direct.h>
+#define UMCCACHE_MKDIR(dir) _mkdir(dir)
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#define UMCCACHE_MKDIR(dir) mkdir(dir, 0777)
+#endif
+
+#define UMCCACHE_FNV_INIT  0xcbf29ce484222325ULL
+#define UMCCACHE_FNV_PRIME 0x100000001b3ULL
+
+#define UMCCACHE_COPY_SIZE (1<<16)
+
+typedef struct {
+  char        magic[4];    // "UPIR"
+  uint32_t    version;     // TRANSCODER_VERSION
+  uint64_t    gcode;
+  uint64_t    size;        // bytes of packed commands following
+  gcp_state_t gcp;         // parser results
+} umccache_ir_header_t;
+
+typedef struct {
+  char              magic[4]; // "UPUC"
+  uint32_t          version;
+  umccache_key_t    key;
+  umccache_result_t result;
+} umccache_umc_header_t;
+
+// Packed commands: op (bit 7: wait), then int32 and doubles as used by the op
+static const struct { uint8_t ints; uint8_t doubles; } _umccache_cmd_layout[] = {
+  [UMCWRITER_CMD_HOME]           = { 1, 0 },
+  [UMCWRITER_CMD_VIRTUAL_HOME]   = { 0, 3 },
+  [UMCWRITER_CMD_MOVE_DIRECT]    = { 0, 5 },
+  [UMCWRITER_CMD_SET_POSITION]   = { 0, 3 },
+  [UMCWRITER_CMD_SET_A_POSITION] = { 0, 1 },
+  [UMCWRITER_CMD_PLANNER_ADD]    = { 0, 4 },
+  [UMCWRITER_CMD_PLANNER_SYNC]   = { 0, 0 },
+  [UMCWRITER_CMD_SET_FEATURE]    = { 1, 0 },
+  [UMCWRITER_CMD_EXTRUDER_TEMP]  = { 0, 1 },
+  [UMCWRITER_CMD_BED_TEMP]       = { 1, 0 },
+  [UMCWRITER_CMD_REPORT_DATA]    = { 1, 1 },
+  [UMCWRITER_CMD_PAUSE]          = { 1, 0 },
+  [UMCWRITER_CMD_BEEP]           = { 1, 0 },
+  [UMCWRITER_CMD_USER_PAUSE]     = { 0, 0 },
+};
+
+#define UMCCACHE_CMD_OPS     (sizeof(_umccache_cmd_layout)/sizeof(_umccache_cmd_layout[0]))
+#define UMCCACHE_CMD_WAIT    0x80
+#define UMCCACHE_CMD_MAX_LEN (1+sizeof(int32_t)+5*sizeof(double))
+
+static uint64_t _umccache_hash(const void* data, size_t len, uint64_t hash)
+{
+  const uint8_t* p = data;
+  while( len-- )
+    hash = (hash ^ *p++) * UMCCACHE_FNV_PRIME;
+  return hash;
+}
+
+bool umccache_key(umccache_key_t* key, FILE* fgcode, const settings_t* settings, double heightZ, char machine_type, bool preheat)
+{
+  uint8_t* buf = malloc( UMCCACHE_COPY_SIZE );
+  if( !buf )
+    return false;
+
+  uint64_t hash = UMCCACHE_FNV_INIT;
+  size_t len;
+  while( (len = fread( buf, 1, UMCCACHE_COPY_SIZE, fgcode )) > 0 )
+    hash = _umccache_hash( buf, len, hash );
+  free( buf );
+  bool ok = !ferror( fgcode );
+  rewind( fgcode );
+  key->gcode = hash;
+  key->job = umccache_job_hash( settings, heightZ, machine_type, preheat );
+  return ok;
+}
+
+uint64_t umccache_job_hash(const settings_t* settings, double heightZ, char machine_type, bool preheat)
+{
+  uint32_t version = TRANSCODER_VERSION;
+  uint64_t hash = _umccache_hash( &version, sizeof(version), UMCCACHE_FNV_INIT );
+  hash = _umccache_hash( settings, sizeof(settings_t), hash );
+  hash = _umccache_hash( feature_profiles, sizeof(feature_profiles), hash );
+  hash = _umccache_hash( &heightZ, sizeof(heightZ), hash );
+  hash = _umccache_hash( &machine_type, sizeof(machine_type), hash );
+  hash = _umccache_hash( &preheat, sizeof(preheat), hash );
+  return hash;
+}
+
+uint64_t umccache_text_hash(const void* text, size_t len)
+{
+  return _umccache_hash( text, len, UMCCACHE_FNV_INIT );
+}
+
+static void _umccache_temp_name(char* name, size_t size, const char* path, const void* owner)
+{
+  uint64_t unique = _umccache_hash( &owner, sizeof(owner), UMCCACHE_FNV_INIT );
+  time_t now = time(NULL);
+  clock_t ticks = clock();
+  unique = _umccache_hash( &now, sizeof(now), unique );
+  unique = _umccache_hash( &ticks, sizeof(ticks), unique );
+  snprintf( name, size, "%s.%08" PRIx32 ".tmp", path, (uint32_t)unique );
+}
+
+bool umccache_dir(const char* dir)
+{
+  if( UMCCACHE_MKDIR( dir ) && (EEXIST != errno) )
+    return false;
+
+  char path[1024], temp[1040];
+  snprintf( path, sizeof(path), "%s/check", dir );
+  _umccache_temp_name( temp, sizeof(temp), path, dir );
+  FILE* f = fopen( temp, "wb" );
+  if( !f )
+    return false;
+  fclose( f );
+  remove( temp );
+  return true;
+}
+
+static bool _umccache_commit(const char* temp, const char* path)
+{
+  if( !rename( temp, path ) )
+    return true;
+  remove( temp ); //windows does not replace, another transcoder was faster
+  return false;
+}
+
+static bool _umccache_copy(FILE* from, FILE* to)
+{
+  uint8_t* buf = malloc( UMCCACHE_COPY_SIZE );
+  if( !buf )
+    return false;
+
+  bool ok = true;
+  size_t len;
+  while( ok && ((len = fread( buf, 1, UMCCACHE_COPY_SIZE, from )) > 0) )
+    ok = (len == fwrite( buf, 1, len, to ));
+  free( buf );
+  return ok && !ferror( from );
+}
+
+//copy of a whole file (layer index of a cached output), to is removed if there is no from
+static bool _umccache_copy_file(const char* from, const char* to)
+{
+  FILE* f = fopen( from, "rb" );
+  if( !f )
+  {
+    remove( to );
+    return false;
+  }
+  FILE* t = fopen( to, "wb" );
+  bool ok = t && _umccache_copy( f, t );
+  if( t && fclose( t ) )
+    ok = false;
+  fclose( f );
+  if( !ok )
+    remove( to );
+  return ok;
+}
+
+static void _umccache_umc_path(char* path, size_t size, const char* dir, const umccache_key_t* key)
+{
+  snprintf( path, size, "%s/%016" PRIx64 "-%016" PRIx64 ".umc", dir, key->gcode, key->job );
+}
+
+bool umccache_get_umc(const char* dir, const umccache_key_t* key, const char* fname_umc, umccache_result_t* result)
+{
+  char path[1024];
+  _umccache_umc_path( path, sizeof(path), dir, key );
+  FILE* f = fopen( path, "rb" );
+  if( !f )
+    return false;
+
+  umccache_umc_header_t header;
+  bool ok = (1 == fread( &header, sizeof(header), 1, f )) && !memcmp( header.magic, "UPUC", 4 ) &&
+            (TRANSCODER_VERSION == header.version) && !memcmp( &header.key, key, sizeof(umccache_key_t) );
+  if( ok )
+  {
+    FILE* fumc = fopen( fname_umc, "wb" );
+    ok = fumc && _umccache_copy( f, fumc );
+    if( fumc && fclose( fumc ) )
+      ok = false;
+  }
+  fclose( f );
+
+  if( ok )
+  {
+    char idx[1050], fname_idx[1050];
+    umcindex_name( idx, sizeof(idx), path );
+    umcindex_name( fname_idx, sizeof(fname_idx), fname_umc );
+    _umccache_copy_file( idx, fname_idx );
+    *result = header.result;
+  }
+  return ok;
+}
+
+void umccache_put_umc(const char* dir, const umccache_key_t* key, const char* fname_umc, const umccache_result_t* result)
+{
+  char path[1024], temp[1040];
+  _umccache_umc_path( path, sizeof(path), dir, key );
+  _umccache_temp_name( temp, sizeof(temp), path, result );
+
+  FILE* fumc = fopen( fname_umc, "rb" );
+  if( !fumc )
+    return;
+  FILE* f = fopen( temp, "wb" );
+  if( !f )
+  {
+    fclose( fumc );
+    return;
+  }
+
+  umccache_umc_header_t header = { .magic = "UPUC", .version = TRANSCODER_VERSION, .key = *key, .result = *result };
+  bool ok = (1 == fwrite( &header, sizeof(header), 1, f )) && _umccache_copy( fumc, f );
+  fclose( fumc );
+  if( fclose( f ) || !ok )
+  {
+    remove( temp );
+    return;
+  }
+
+  //layer index first, a reader finding the output finds its index too
+  char idx[1050], idx_temp[1060], fname_idx[1050];
+  umcindex_name( idx, sizeof(idx), path );
+  umcindex_name( idx_temp, sizeof(idx_temp), temp );
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_umc );
+  if( _umccache_copy_file( fname_idx, idx_temp ) )
+    _umccache_commit( idx_temp, idx );
+  _umccache_commit( temp, path );
+}
+
+static void _umccache_ir_path(char* path, size_t size, const char* dir, const umccache_key_t* key, bool preheat)
+{
+  snprintf( path, size, "%s/%016" PRIx64 "-%c.ir", dir, key->gcode, preheat?'p':'n' );
+}
+
+//returns -2 if there is no usable entry, nothing is written then
+static int _umccache_replay(transcoder_t* tc, const char* path, const umccache_key_t* key, const char* fname_umc,
+                            double heightZ, char machine_type)
+{
+  FILE* f = fopen( path, "rb" );
+  if( !f )
+    return -2;
+
+  umccache_ir_header_t header;
+  uint8_t* cmds = NULL;
+  bool ok = (1 == fread( &header, sizeof(header), 1, f )) && !memcmp( header.magic, "UPIR", 4 ) &&
+            (TRANSCODER_VERSION == header.version) && (key->gcode == header.gcode) &&
+            (header.size < SIZE_MAX) && (cmds = malloc( header.size ? header.size : 1 )) &&
+            (header.size == fread( cmds, 1, header.size, f ));
+  fclose( f );
+
+  //check complete entry before writing anything
+  size_t pos = 0;
+  while( ok && (pos<header.size) )
+  {
+    uint8_t op = cmds[pos] & ~UMCCACHE_CMD_WAIT;
+    ok = (op < UMCCACHE_CMD_OPS);
+    if( ok )
+      pos += 1 + _umccache_cmd_layout[op].ints*sizeof(int32_t) + _umccache_cmd_layout[op].doubles*sizeof(double);
+  }
+  if( !ok || (pos != header.size) )
+  {
+    free( cmds );
+    return -2;
+  }
+
+  if( !umcwriter_init( tc, fname_umc, heightZ, machine_type ) )
+  {
+    free( cmds );
+    return -1;
+  }
+
+  for( pos=0; pos<header.size; )
+  {
+    umcwriter_cmd_t cmd;
+    memset( &cmd, 0, sizeof(cmd) );
+    cmd.op = cmds[pos] & ~UMCCACHE_CMD_WAIT;
+    cmd.wait = (cmds[pos++] & UMCCACHE_CMD_WAIT) != 0;
+    if( _umccache_cmd_layout[cmd.op].ints )
+    {
+      memcpy( &cmd.i, cmds+pos, sizeof(int32_t) );
+      pos += sizeof(int32_t);
+    }
+    size_t dlen = _umccache_cmd_layout[cmd.op].doubles*sizeof(double);
+    memcpy( cmd.d, cmds+pos, dlen );
+    pos += dlen;
+
+    umcwriter_replay( tc, &cmd );
+  }
+  free( cmds );
+
+  gcp_set_state( tc, &header.gcp );
+  return 1;
+}
+
+typedef struct {
+  transcoder_t* tc;      // writer the commands are replayed to
+  FILE*         file;    // NULL: not cached
+  uint64_t      size;
+} umccache_recorder_t;
+
+static void _umccache_record(void* user, const umcwriter_cmd_t* cmd)
+{
+  umccache_recorder_t* rec = user;
+  if( rec->file )
+  {
+    uint8_t buf[UMCCACHE_CMD_MAX_LEN];
+    size_t len = 0;
+    buf[len++] = cmd->op | (cmd->wait ? UMCCACHE_CMD_WAIT : 0);
+    if( _umccache_cmd_layout[cmd->op].ints )
+    {
+      memcpy( buf+len, &cmd->i, sizeof(int32_t) );
+      len += sizeof(int32_t);
+    }
+    memcpy( buf+len, cmd->d, _umccache_cmd_layout[cmd->op].doubles*sizeof(double) );
+    len += _umccache_cmd_layout[cmd->op].doubles*sizeof(double);
+
+    if( len != fwrite( buf, 1, len, rec->file ) )
+    {
+      fclose( rec->file );
+      rec->file = NULL;
+    }
+    rec->size += len;
+  }
+
+  umcwriter_replay( rec->tc, cmd );
+}
+
+int umccache_transcode(transcoder_t* tc, const char* dir, const umccache_key_t* key, FILE* fgcode, const char* fname_umc,
+                       double heightZ, char machine_type, bool preheat)
+{
+  char path[1024], temp[1040];
+  _umccache_ir_path( path, sizeof(path), dir, key, preheat );
+
+  int ret = _umccache_replay( tc, path, key, fname_umc, heightZ, machine_type );
+  if( ret > -2 )
+    return ret;
+
+  arena_t arena;
+  transcoder_t* parser;
+  if( !arena_init(&arena, TRANSCODER_ARENA_SIZE) || !(parser = transcoder_create(&arena, &tc->settings)) )
+  {
+    arena_free( &arena );
+    return transcoder_run( tc, fgcode, fname_umc, heightZ, machine_type, preheat );
+  }
+
+  if( !umcwriter_init( tc, fname_umc, heightZ, machine_type ) )
+  {
+    arena_free( &arena );
+    return -1;
+  }
+
+  umccache_ir_header_t header = { .magic = "UPIR", .version = TRANSCODER_VERSION, .gcode = key->gcode };
+  umccache_recorder_t rec = { .tc = tc };
+  _umccache_temp_name( temp, sizeof(temp), path, tc );
+  if( (rec.file = fopen( temp, "wb" )) && (1 != fwrite( &header, sizeof(header), 1, rec.file )) )
+  {
+    fclose( rec.file );
+    rec.file = NULL;
+  }
+
+  umcwriter_init_record( parser, _umccache_record, &rec );
+  gcp_reset( parser );
+
+  char line[1024];
+  if( preheat )
+  {
+    while( fgets(line,sizeof(line),fgcode) && gcp_preheat_scan(parser, line) );
+    rewind( fgcode );
+    gcp_preheat_start( parser );
+  }
+
+  ret = 1;
+  while( fgets(line,sizeof(line),fgcode) )
+    if( !gcp_process_line(parser, line) )
+    {
+      ret = 0;
+      break;
+    }
+
+  gcp_get_state( parser, &header.gcp );
+  gcp_set_state( tc, &header.gcp );
+  arena_free( &arena );
+
+  if( rec.file )
+  {
+    header.size = rec.size;
+    bool ok = (1==ret) && !fseek( rec.file, 0, SEEK_SET ) && (1 == fwrite( &header, sizeof(header), 1, rec.file ));
+    if( fclose( rec.file ) || !ok )
+      remove( temp );
+    else
+      _umccache_commit( temp, path );
+  }
+  else
+    remove( temp );
+
+  return ret;
+}
@@ -0,0 +1,64 @@
+/*
+  umccache.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umccache_h
+#define umccache_h
+
+#include "transcoder.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// On disk transcode cache, two levels in one directory:
+//  <gcode>-<p|n>.ir      writer commands of the parser (see umcwriter_cmd_t), key: g-code content, preheat
+//  <gcode>-<job>.umc     finished output, key: g-code content and the job (settings, machine, nozzle
+//                        height, preheat, TRANSCODER_VERSION)
+// Entries are written to a temporary file and renamed, several transcoders can share a directory.
+
+typedef struct {
+  uint64_t gcode;  // hash of the g-code file
+  uint64_t job;    // hash of everything else the output depends on
+} umccache_key_t;
+
+// Results of a transcode, kept with a cached output
+typedef struct {
+  int64_t     print_ticks;
+  gcp_state_t gcp;
+} umccache_result_t;
+
+// Creates dir if it does not exist, false if no entry can be written to it
+bool umccache_dir(const char* dir);
+
+// Hash fgcode (rewound afterwards) and the job settings
+bool umccache_key(umccache_key_t* key, FILE* fgcode, const settings_t* settings, double heightZ, char machine_type, bool preheat);
+
+// Parts of the key: everything the output depends on besides the g-code, hash of g-code text
+uint64_t umccache_job_hash(const settings_t* settings, double heightZ, char machine_type, bool preheat);
+uint64_t umccache_text_hash(const void* text, size_t len);
+
+// Level 2: copy a cached output to fname_umc, false if there is none
+bool umccache_get_umc(const char* dir, const umccache_key_t* key, const char* fname_umc, umccache_result_t* result);
+void umccache_put_umc(const char* dir, const umccache_key_t* key, const char* fname_umc, const umccache_result_t* result);
+
+// Level 1: like transcoder_run(), replays the cached commands when there are some, otherwise
+// parses fgcode and caches its commands. The parser results are set in tc either way.
+int  umccache_transcode(transcoder_t* tc, const char* dir, const umccache_key_t* key, FILE* fgcode, const char* fname_umc,
+                        double heightZ, char machine_type, bool preheat);
+
+#endif //umccache_h
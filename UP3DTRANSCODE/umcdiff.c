@@ -0,0 +1,305 @@
+/*
+  umcdiff.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcdiff.h"
+#include "umcprofile.h"
+#include "umcsim.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UMCDIFF_SAME   0
+#define UMCDIFF_INSERT 1
+#define UMCDIFF_REMOVE 2
+
+typedef struct {
+  int64_t pos[N_AXIS];
+  double  Z;
+} umcdiff_end_t;
+
+typedef struct {
+  const UP3D_BLK* blks[2];
+  umcdiff_fn      fn;
+  void*           user;
+  int32_t*        trace;     // furthest x of every diagonal k for every number of edits d, at d*d
+  uint8_t*        ops;       // edit script, backwards
+  uint64_t        ops_alloc;
+} umcdiff_ctx_t;
+
+static bool _umcdiff_eq(const UP3D_BLK* a, const UP3D_BLK* b)
+{
+  return !memcmp( a, b, sizeof(UP3D_BLK) );
+}
+
+// position at the end of every layer
+static umcdiff_end_t* _umcdiff_ends(const umcreader_t* r, const settings_t* settings, const umcprofile_layer_t* layers, uint32_t count)
+{
+  umcdiff_end_t* ends = malloc( (count ? count : 1)*sizeof(umcdiff_end_t) );
+  if( !ends )
+    return NULL;
+
+  umcsim_state_t st = UMCSIM_STATE_INIT;
+  uint32_t n;
+  for( n=0; n<count; n++ )
+  {
+    uint64_t i;
+    for( i=layers[n].first_block; i<layers[n].first_block+layers[n].blocks; i++ )
+    {
+      const UP3D_BLK* blk = &r->blks[i];
+      switch( blk->pcmd )
+      {
+        case UP3DPCMD_MoveL:    umcsim_movel( &st, blk ); break;
+        case UP3DPCMD_MoveF:    umcsim_movef( settings, &st, blk ); break;
+        case UP3DPCMD_HomeAxis: umcsim_home( &st, blk ); break;
+        default:                break;
+      }
+    }
+    memcpy( ends[n].pos, st.pos, sizeof(st.pos) );
+    ends[n].Z = st.Z;
+  }
+  return ends;
+}
+
+// a run of changes between equal blocks: pairs are modified, the rest removed or inserted
+static void _umcdiff_changes(umcdiff_ctx_t* ctx, umcdiff_layer_t* l, uint64_t a, uint64_t na, uint64_t b, uint64_t nb)
+{
+  uint64_t m = (na<nb) ? na : nb;
+  l->modified += m;
+  l->removed += na-m;
+  l->inserted += nb-m;
+  if( !ctx->fn )
+    return;
+
+  uint64_t i;
+  for( i=0; i<m; i++ )
+    ctx->fn( ctx->user, l, '~', &ctx->blks[UMCDIFF_A][a+i], a+i, &ctx->blks[UMCDIFF_B][b+i], b+i );
+  for( ; i<na; i++ )
+    ctx->fn( ctx->user, l, '-', &ctx->blks[UMCDIFF_A][a+i], a+i, NULL, 0 );
+  for( i=m; i<nb; i++ )
+    ctx->fn( ctx->user, l, '+', NULL, 0, &ctx->blks[UMCDIFF_B][b+i], b+i );
+}
+
+// Myers: edit script for a[0..n) -> b[0..m) with at most UMCDIFF_MAX_EDITS edits, false if more needed
+static bool _umcdiff_align(umcdiff_ctx_t* ctx, umcdiff_layer_t* l, uint64_t a0, int32_t n, uint64_t b0, int32_t m)
+{
+  const UP3D_BLK* a = &ctx->blks[UMCDIFF_A][a0];
+  const UP3D_BLK* b = &ctx->blks[UMCDIFF_B][b0];
+  int32_t d, k, x, y;
+  bool done = false;
+
+  for( d=0; (d<=UMCDIFF_MAX_EDITS) && !done; d++ )
+  {
+    int32_t* V = &ctx->trace[d*d+d];           //V[k], k=-d..d
+    const int32_t* P = d ? &ctx->trace[(d-1)*(d-1)+d-1] : NULL; //of d-1
+    for( k=-d; k<=d; k+=2 )
+    {
+      if( !d )
+        x = 0;
+      else if( (k == -d) || ((k != d) && (P[k-1] < P[k+1])) )
+        x = P[k+1];   //insert b[y]
+      else
+        x = P[k-1]+1; //remove a[x]
+      y = x-k;
+      while( (x<n) && (y<m) && _umcdiff_eq( &a[x], &b[y] ) )
+        x++, y++;
+      V[k] = x;
+      if( (x>=n) && (y>=m) )
+      {
+        done = true;
+        break;
+      }
+    }
+  }
+  if( !done )
+    return false;
+
+  //back from the end to the start
+  uint64_t len = (uint64_t)n+m;
+  if( len > ctx->ops_alloc )
+  {
+    uint8_t* ops = realloc( ctx->ops, len );
+    if( !ops )
+      return false;
+    ctx->ops = ops;
+    ctx->ops_alloc = len;
+  }
+  uint64_t o = 0;
+  x = n; y = m;
+  for( d--; d>0; d-- )
+  {
+    const int32_t* P = &ctx->trace[(d-1)*(d-1)+d-1];
+    k = x-y;
+    bool insert = (k == -d) || ((k != d) && (P[k-1] < P[k+1]));
+    int32_t px = insert ? P[k+1] : P[k-1];
+    int32_t py = px - (insert ? k+1 : k-1);
+    while( (x>px) && (y>py) )
+      ctx->ops[o++] = UMCDIFF_SAME, x--, y--;
+    ctx->ops[o++] = insert ? UMCDIFF_INSERT : UMCDIFF_REMOVE;
+    x = px; y = py;
+  }
+  while( (x>0) && (y>0) )
+    ctx->ops[o++] = UMCDIFF_SAME, x--, y--;
+
+  //forward: runs of changes
+  uint64_t i = a0, j = b0, na = 0, nb = 0;
+  while( o-- )
+  {
+    switch( ctx->ops[o] )
+    {
+      case UMCDIFF_INSERT: nb++; break;
+      case UMCDIFF_REMOVE: na++; break;
+      default:
+        if( na || nb )
+          _umcdiff_changes( ctx, l, i, na, j, nb );
+        i += na+1; j += nb+1;
+        na = nb = 0;
+        l->same++;
+        break;
+    }
+  }
+  if( na || nb )
+    _umcdiff_changes( ctx, l, i, na, j, nb );
+  return true;
+}
+
+static void _umcdiff_layer(umcdiff_ctx_t* ctx, umcdiff_layer_t* l)
+{
+  const UP3D_BLK* a = &ctx->blks[UMCDIFF_A][l->first_block[UMCDIFF_A]];
+  const UP3D_BLK* b = &ctx->blks[UMCDIFF_B][l->first_block[UMCDIFF_B]];
+  uint64_t n = l->blocks[UMCDIFF_A], m = l->blocks[UMCDIFF_B];
+
+  //common start and end
+  uint64_t s = 0, e = 0;
+  while( (s<n) && (s<m) && _umcdiff_eq( &a[s], &b[s] ) )
+    s++;
+  while( (e<n-s) && (e<m-s) && _umcdiff_eq( &a[n-1-e], &b[m-1-e] ) )
+    e++;
+  l->same = s+e;
+  n -= s+e; m -= s+e;
+  if( !n || !m )
+  {
+    _umcdiff_changes( ctx, l, l->first_block[UMCDIFF_A]+s, n, l->first_block[UMCDIFF_B]+s, m );
+    return;
+  }
+
+  uint64_t same = l->same;
+  if( (n <= INT32_MAX/2) && (m <= INT32_MAX/2) &&
+      _umcdiff_align( ctx, l, l->first_block[UMCDIFF_A]+s, (int32_t)n, l->first_block[UMCDIFF_B]+s, (int32_t)m ) )
+    return;
+
+  //block by block
+  l->approx = true;
+  l->same = same;
+  l->modified = l->inserted = l->removed = 0;
+  uint64_t i, c = (n<m) ? n : m;
+  for( i=0; i<c; i++ )
+  {
+    if( _umcdiff_eq( &a[s+i], &b[s+i] ) )
+      l->same++;
+    else
+      _umcdiff_changes( ctx, l, l->first_block[UMCDIFF_A]+s+i, 1, l->first_block[UMCDIFF_B]+s+i, 1 );
+  }
+  _umcdiff_changes( ctx, l, l->first_block[UMCDIFF_A]+s+c, n-c, l->first_block[UMCDIFF_B]+s+c, m-c );
+}
+
+static umcdiff_layer_t* _umcdiff_add_layer(umcdiff_layer_t** layers, uint32_t* count, uint32_t* alloc)
+{
+  if( *count == *alloc )
+  {
+    uint32_t n = *alloc ? *alloc*2 : 256;
+    umcdiff_layer_t* l = realloc( *layers, n*sizeof(umcdiff_layer_t) );
+    if( !l )
+      return NULL;
+    *layers = l;
+    *alloc = n;
+  }
+  umcdiff_layer_t* l = &(*layers)[(*count)++];
+  memset( l, 0, sizeof(umcdiff_layer_t) );
+  return l;
+}
+
+static void _umcdiff_side(umcdiff_layer_t* l, int s, const umcprofile_layer_t* p, const umcdiff_end_t* end)
+{
+  l->present[s] = true;
+  l->layer = p->layer;
+  if( !l->present[UMCDIFF_A] || (UMCDIFF_A == s) )
+    l->height = (p->height<0) ? 0 : p->height;
+  l->first_block[s] = p->first_block;
+  l->blocks[s] = p->blocks;
+  l->time[s] = umcprofile_time( p );
+  memcpy( l->position[s], end->pos, sizeof(end->pos) );
+  l->Z[s] = end->Z;
+}
+
+bool umcdiff_run(const umcreader_t* ra, const umcreader_t* rb, const settings_t* settings,
+                 umcdiff_fn fn, void* user, umcdiff_layer_t** layers, uint32_t* count)
+{
+  *layers = NULL;
+  *count = 0;
+
+  umcprofile_layer_t* pl[2] = { NULL, NULL };
+  uint32_t pc[2] = { 0, 0 };
+  umcdiff_end_t* ends[2] = { NULL, NULL };
+  umcdiff_ctx_t ctx = { .blks = { ra->blks, rb->blks }, .fn = fn, .user = user,
+                        .trace = malloc( (UMCDIFF_MAX_EDITS+1)*(UMCDIFF_MAX_EDITS+1)*sizeof(int32_t) ) };
+  bool ok = ctx.trace &&
+            umcprofile_run( ra, settings, &pl[UMCDIFF_A], &pc[UMCDIFF_A] ) &&
+            umcprofile_run( rb, settings, &pl[UMCDIFF_B], &pc[UMCDIFF_B] ) &&
+            (ends[UMCDIFF_A] = _umcdiff_ends( ra, settings, pl[UMCDIFF_A], pc[UMCDIFF_A] )) &&
+            (ends[UMCDIFF_B] = _umcdiff_ends( rb, settings, pl[UMCDIFF_B], pc[UMCDIFF_B] ));
+
+  //pair the layers by number, both files count up
+  uint32_t alloc = 0, i = 0, j = 0;
+  while( ok && ((i<pc[UMCDIFF_A]) || (j<pc[UMCDIFF_B])) )
+  {
+    umcdiff_layer_t* l = _umcdiff_add_layer( layers, count, &alloc );
+    if( !l )
+    {
+      ok = false;
+      break;
+    }
+    bool has_a = (i<pc[UMCDIFF_A]), has_b = (j<pc[UMCDIFF_B]);
+    if( has_a && (!has_b || (pl[UMCDIFF_A][i].layer <= pl[UMCDIFF_B][j].layer)) )
+    {
+      _umcdiff_side( l, UMCDIFF_A, &pl[UMCDIFF_A][i], &ends[UMCDIFF_A][i] );
+      i++;
+    }
+    if( has_b && (!l->present[UMCDIFF_A] || (l->layer == pl[UMCDIFF_B][j].layer)) )
+    {
+      _umcdiff_side( l, UMCDIFF_B, &pl[UMCDIFF_B][j], &ends[UMCDIFF_B][j] );
+      j++;
+    }
+    _umcdiff_layer( &ctx, l );
+  }
+
+  free( ctx.trace );
+  free( ctx.ops );
+  free( ends[UMCDIFF_A] );
+  free( ends[UMCDIFF_B] );
+  free( pl[UMCDIFF_A] );
+  free( pl[UMCDIFF_B] );
+  if( !ok )
+  {
+    free( *layers );
+    *layers = NULL;
+    *count = 0;
+  }
+  return ok;
+}
@@ -0,0 +1,64 @@
+/*
+  umcdiff.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umcdiff_h
+#define umcdiff_h
+
+#include "up3dconf.h"
+#include "umcreader.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Structural compare of two UMC files: both are cut into layers like up3dprofile does (at the layer
+// reports), layers are paired by their number. The blocks of a pair are aligned with a shortest
+// edit script (Myers) after the common start and end of the layer are skipped, a removed block
+// followed by an inserted one counts as modified. A layer needing more than UMCDIFF_MAX_EDITS
+// edits is compared block by block (approx).
+
+#define UMCDIFF_MAX_EDITS 1000
+#define UMCDIFF_Z_TOLERANCE 0.0005 // mm, layers compared with a step tolerance have to end at the same Z
+
+#define UMCDIFF_A 0
+#define UMCDIFF_B 1
+
+typedef struct {
+  int32_t  layer;
+  double   height;             // of A (of B if only in B)
+  bool     present[2];
+  uint64_t first_block[2];
+  uint64_t blocks[2];
+  uint64_t same;
+  uint64_t modified;
+  uint64_t inserted;           // only in B
+  uint64_t removed;            // only in A
+  bool     approx;             // too many edits for an alignment
+  double   time[2];            // sec, without heater waits and homing
+  int64_t  position[2][N_AXIS]; // at the end of the layer (steps)
+  double   Z[2];               // mm
+} umcdiff_layer_t;
+
+// changed blocks: op '-' (a only), '+' (b only), '~' (modified, a and b)
+typedef void (*umcdiff_fn)(void* user, const umcdiff_layer_t* l, char op, const UP3D_BLK* a, uint64_t index_a,
+                           const UP3D_BLK* b, uint64_t index_b);
+
+// fn may be NULL, returns false if out of memory, *layers has to be freed
+bool umcdiff_run(const umcreader_t* ra, const umcreader_t* rb, const settings_t* settings,
+                 umcdiff_fn fn, void* user, umcdiff_layer_t** layers, uint32_t* count);
+
+#endif //umcdiff_h
@@ -0,0 +1,165 @@
+/*
+  umcindex.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcindex.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+void umcindex_init(umcindex_t* idx, const settings_t* settings)
+{
+  memset( idx, 0, sizeof(umcindex_t) );
+  idx->settings = settings;
+  idx->st = (umcsim_state_t)UMCSIM_STATE_INIT;
+}
+
+void umcindex_free(umcindex_t* idx)
+{
+  free( idx->layers );
+  idx->layers = NULL;
+  idx->count = idx->alloc = 0;
+}
+
+static void _umcindex_new_layer(umcindex_t* idx, int32_t layer, uint64_t index, int64_t ticks)
+{
+  if( idx->count == idx->alloc )
+  {
+    uint32_t alloc = idx->alloc ? idx->alloc*2 : 256;
+    umcindex_layer_t* layers = realloc( idx->layers, alloc*sizeof(umcindex_layer_t) );
+    if( !layers )
+    {
+      idx->failed = true;
+      return;
+    }
+    idx->layers = layers;
+    idx->alloc = alloc;
+  }
+
+  umcindex_layer_t* l = &idx->layers[idx->count++];
+  memset( l, 0, sizeof(umcindex_layer_t) );
+  l->layer = layer;
+  l->block = index;
+  l->offset = index*sizeof(UP3D_BLK);
+  l->ticks = ticks;
+  int axis;
+  for( axis=0; axis<N_AXIS; axis++ )
+    l->position[axis] = idx->st.pos[axis]/idx->settings->steps_per_mm[axis];
+  idx->has_Z = idx->has_ticks = false;
+}
+
+void umcindex_add(umcindex_t* idx, const UP3D_BLK* blk, uint64_t index, int64_t ticks)
+{
+  if( idx->failed )
+    return;
+
+  switch( blk->pcmd )
+  {
+    case UP3DPCMD_MoveL:
+      umcsim_movel( &idx->st, blk );
+      break;
+
+    case UP3DPCMD_MoveF:
+      umcsim_movef( idx->settings, &idx->st, blk );
+      break;
+
+    case UP3DPCMD_HomeAxis:
+      umcsim_home( &idx->st, blk );
+      break;
+
+    case UP3DPCMD_SetParameter:
+    {
+      umcindex_layer_t* l = idx->count ? &idx->layers[idx->count-1] : NULL;
+      if( PARA_REPORT_LAYER == blk->pdat1.l )
+      {
+        if( !l || (l->layer != blk->pdat2.l) )
+          _umcindex_new_layer( idx, blk->pdat2.l, index, ticks );
+      }
+      else if( l && (PARA_REPORT_HEIGHT == blk->pdat1.l) && !idx->has_Z )
+      {
+        l->Z = blk->pdat2.f;
+        idx->has_Z = true;
+      }
+      else if( l && (PARA_REPORT_TIME_REMAIN == blk->pdat1.l) && !idx->has_ticks )
+      {
+        l->ticks = ticks;
+        idx->has_ticks = true;
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+bool umcindex_write(const umcindex_t* idx, const char* filename, uint64_t blocks, int64_t ticks)
+{
+  if( idx->failed )
+    return false;
+
+  FILE* f = fopen( filename, "wb" );
+  if( !f )
+    return false;
+
+  umcindex_header_t header = { .magic = "UPIX", .version = UMCINDEX_VERSION, .count = idx->count, .blocks = blocks, .ticks = ticks };
+  bool ok = (1 == fwrite( &header, sizeof(header), 1, f )) &&
+            (idx->count == fwrite( idx->layers, sizeof(umcindex_layer_t), idx->count, f ));
+  if( fclose( f ) || !ok )
+  {
+    remove( filename );
+    return false;
+  }
+  return true;
+}
+
+void umcindex_name(char* name, size_t size, const char* fname_umc)
+{
+  snprintf( name, size, "%s.idx", fname_umc );
+}
+
+bool umcindex_read_header(FILE* f, umcindex_header_t* header, uint64_t blocks)
+{
+  return !fseek( f, 0, SEEK_SET ) && (1 == fread( header, sizeof(umcindex_header_t), 1, f )) &&
+         !memcmp( header->magic, "UPIX", 4 ) && (UMCINDEX_VERSION == header->version) &&
+         (!blocks || (blocks == header->blocks));
+}
+
+bool umcindex_read_layer(FILE* f, const umcindex_header_t* header, int32_t layer, umcindex_layer_t* l)
+{
+  if( (layer < 0) || ((uint32_t)layer >= header->count) )
+    return false;
+
+  long pos = (long)(sizeof(umcindex_header_t) + (uint64_t)layer*sizeof(umcindex_layer_t));
+  if( !fseek( f, pos, SEEK_SET ) && (1 == fread( l, sizeof(umcindex_layer_t), 1, f )) && (l->layer == layer) )
+    return true;
+
+  //layer numbers with gaps: search
+  uint32_t n;
+  for( n=0; n<header->count; n++ )
+  {
+    pos = (long)(sizeof(umcindex_header_t) + (uint64_t)n*sizeof(umcindex_layer_t));
+    if( fseek( f, pos, SEEK_SET ) || (1 != fread( l, sizeof(umcindex_layer_t), 1, f )) )
+      return false;
+    if( l->layer == layer )
+      return true;
+  }
+  return false;
+}
@@ -0,0 +1,83 @@
+/*
+  umcindex.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umcindex_h
+#define umcindex_h
+
+#include "up3dconf.h"
+#include "up3ddata.h"
+#include "umcsim.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Layer index of an UMC file, written next to it as file.umc.idx by umcwriter_finish():
+// header, then one record per layer. Layer n is record n, so a layer is found with one seek.
+// A layer starts at its SetParameter(PARA_REPORT_LAYER) block, layer 0 is the start sequence.
+
+#define UMCINDEX_VERSION 1
+
+typedef struct {
+  char     magic[4];   // "UPIX"
+  uint32_t version;    // UMCINDEX_VERSION
+  uint32_t count;      // layer records following
+  uint32_t reserved;
+  uint64_t blocks;     // blocks of the UMC file, the index is stale if the file has another size
+  int64_t  ticks;      // print time (F_CPU ticks)
+} umcindex_header_t;
+
+typedef struct {
+  int32_t  layer;
+  uint32_t reserved;
+  uint64_t block;            // first block of the layer
+  uint64_t offset;           // byte offset of the first block in the UMC file
+  int64_t  ticks;            // print time elapsed at the start of the layer (F_CPU ticks)
+  double   Z;                // reported height (mm)
+  double   position[N_AXIS]; // machine X, Y and A (extruder) at the start of the layer (mm)
+} umcindex_layer_t;
+
+// Builder: fed with every block of the output in order
+typedef struct {
+  const settings_t* settings;
+  umcsim_state_t    st;
+  umcindex_layer_t* layers;
+  uint32_t          count;
+  uint32_t          alloc;
+  bool              has_Z;     // height of the current layer seen
+  bool              has_ticks; // time of the current layer seen
+  bool              failed;    // out of memory
+} umcindex_t;
+
+void umcindex_init(umcindex_t* idx, const settings_t* settings);
+void umcindex_free(umcindex_t* idx);
+// ticks: print time elapsed at blk, taken for the layer at the time report following its layer block
+void umcindex_add(umcindex_t* idx, const UP3D_BLK* blk, uint64_t index, int64_t ticks);
+bool umcindex_write(const umcindex_t* idx, const char* filename, uint64_t blocks, int64_t ticks);
+
+// file.umc -> file.umc.idx
+void umcindex_name(char* name, size_t size, const char* fname_umc);
+
+// Reading: header of an index, false if it is no index or not the one of an UMC with blocks blocks
+// (0: not checked)
+bool umcindex_read_header(FILE* f, umcindex_header_t* header, uint64_t blocks);
+// record of layer from an opened index, false if there is no such layer
+bool umcindex_read_layer(FILE* f, const umcindex_header_t* header, int32_t layer, umcindex_layer_t* l);
+
+#endif //umcindex_h
@@ -0,0 +1,278 @@
+/*
+  umclink.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umclink.h"
+#include "umcindex.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UMCLINK_OUT_BUFFER   (1<<20)
+#define UMCLINK_START_BLOCKS 16 // power on is searched in the first blocks
+#define UMCLINK_HOME_BLOCKS  64 // homing of the start sequence is searched in the first blocks
+#define UMCLINK_END_BLOCKS   8  // power off is searched in the last blocks
+
+// parts of a job
+typedef struct {
+  uint64_t power;      // power on, beeper off, pause
+  int32_t  power_time; // of the pause (sec)
+  uint64_t end;        // first block of the end sequence
+  uint64_t home_Z[2];  // homing of Z in the start sequence
+  uint32_t home_count;
+  int32_t  time;       // print time (sec)
+  int32_t  before;     // print time of the program before this job (sec)
+  int32_t  after;      // print time of the program after this job (sec)
+} umclink_job_t;
+
+typedef struct {
+  FILE*    f;
+  uint64_t blocks;
+  bool     failed;
+  int32_t  total;      // print time of the program
+  int32_t  remain;     // of the last time report
+} umclink_out_t;
+
+static void _umclink_write(umclink_out_t* o, const UP3D_BLK* blks, uint64_t count)
+{
+  if( !count || o->failed )
+    return;
+  o->failed = (count != fwrite( blks, sizeof(UP3D_BLK), count, o->f ));
+  o->blocks += count;
+}
+
+static void _umclink_report(umclink_out_t* o, int32_t remain)
+{
+  UP3D_BLK blk;
+  o->remain = remain;
+  UP3D_PROG_BLK_SetParameter( &blk, PARA_REPORT_TIME_REMAIN, remain );
+  _umclink_write( o, &blk, 1 );
+  UP3D_PROG_BLK_SetParameter( &blk, PARA_REPORT_PERCENT, o->total ? (int32_t)((int64_t)(o->total - remain)*100/o->total) : 100 );
+  _umclink_write( o, &blk, 1 );
+}
+
+static bool _umclink_is_param(const UP3D_BLK* blk, int32_t param)
+{
+  return (UP3DPCMD_SetParameter == blk->pcmd) && (param == blk->pdat1.l);
+}
+
+static bool _umclink_is_state(const UP3D_BLK* blk, int32_t state, int32_t value)
+{
+  return (UP3DPCMD_SetState == blk->pcmd) && (state == blk->pdat1.l) && (value == blk->pdat2.l);
+}
+
+static bool _umclink_job(const umcreader_t* r, umclink_job_t* job)
+{
+  memset( job, 0, sizeof(umclink_job_t) );
+  uint64_t i;
+
+  //start sequence
+  for( i=0; (i<UMCLINK_START_BLOCKS) && (i+2<r->count); i++ )
+    if( _umclink_is_state( &r->blks[i], UP3DPCMD_SetState_StatePower, UP3DPCMD_SetState_ValueOn ) )
+      break;
+  if( (i == UMCLINK_START_BLOCKS) || (i+2 >= r->count) ||
+      !_umclink_is_state( &r->blks[i+1], UP3DPCMD_SetState_StateBeeper, UP3DPCMD_SetState_ValueOff ) ||
+      (UP3DPCMD_Pause != r->blks[i+2].pcmd) )
+    return false;
+  job->power = i;
+  job->power_time = r->blks[i+2].pdat1.l/1000;
+
+  for( i=job->power; (i<UMCLINK_HOME_BLOCKS) && (i<r->count) && (job->home_count<2); i++ )
+    if( (UP3DPCMD_HomeAxis == r->blks[i].pcmd) && (UP3DAXIS_Z == r->blks[i].pdat1.l) )
+      job->home_Z[job->home_count++] = i;
+
+  //end sequence
+  if( UP3DPCMD_Stop != r->blks[r->count-1].pcmd )
+    return false;
+  for( i=r->count-1; (i>0) && (i+UMCLINK_END_BLOCKS>=r->count); i-- )
+    if( _umclink_is_state( &r->blks[i], UP3DPCMD_SetState_StatePower, UP3DPCMD_SetState_ValueOff ) )
+      break;
+  if( !i || !_umclink_is_state( &r->blks[i], UP3DPCMD_SetState_StatePower, UP3DPCMD_SetState_ValueOff ) )
+    return false;
+  if( (i>=2) && _umclink_is_param( &r->blks[i-2], PARA_REPORT_PERCENT ) && _umclink_is_param( &r->blks[i-1], PARA_REPORT_TIME_REMAIN ) )
+    i -= 2;
+  while( (i>=2) && (UP3DPCMD_SetState == r->blks[i-2].pcmd) && (UP3DPCMD_SetState_StateBeeper == r->blks[i-2].pdat1.l) &&
+         (UP3DPCMD_Pause == r->blks[i-1].pcmd) )
+    i -= 2; //done beeps, the interlude beeps itself
+  job->end = i;
+
+  for( i=0; i<r->count; i++ )
+    if( _umclink_is_param( &r->blks[i], PARA_REPORT_TIME_REMAIN ) )
+    {
+      job->time = r->blks[i].pdat2.l;
+      break;
+    }
+  return true;
+}
+
+// blocks first .. end of a job with time and percent reports for the program
+static void _umclink_copy(umclink_out_t* o, const umcreader_t* r, const umclink_job_t* job, uint64_t first, uint64_t end, bool skip_power)
+{
+  uint64_t i, run = first;
+  for( i=first; i<end; i++ )
+  {
+    const UP3D_BLK* blk = &r->blks[i];
+    if( skip_power && (i == job->power) )
+    {
+      _umclink_write( o, &r->blks[run], i-run );
+      i += 2;
+      run = i+1;
+      continue;
+    }
+    if( UP3DPCMD_SetParameter != blk->pcmd )
+      continue;
+
+    UP3D_BLK b = *blk;
+    if( PARA_REPORT_TIME_REMAIN == blk->pdat1.l )
+    {
+      o->remain = blk->pdat2.l + job->after;
+      if( skip_power && (i < job->power) )
+        o->remain -= job->power_time;
+      b.pdat2.l = o->remain;
+    }
+    else if( PARA_REPORT_PERCENT == blk->pdat1.l )
+      b.pdat2.l = o->total ? (int32_t)(((int64_t)job->before*100 + (int64_t)job->time*blk->pdat2.l)/o->total) : 100;
+    else
+      continue;
+
+    _umclink_write( o, &r->blks[run], i-run );
+    _umclink_write( o, &b, 1 );
+    run = i+1;
+  }
+  _umclink_write( o, &r->blks[run], end-run );
+}
+
+static void _umclink_interlude(umclink_out_t* o, const umcreader_t* next, const umclink_job_t* next_job,
+                               const umclink_interlude_t* interlude, int32_t remain)
+{
+  UP3D_BLK blk;
+  _umclink_report( o, remain );
+
+  //heaters off, the end sequence of the job is left out and g-code may not switch them off,
+  //the start sequence of the next job heats up again
+  UP3D_BLK off[4];
+  UP3D_PROG_BLK_SetParameter( &off[0], PARA_NOZZLE1_TEMP, 0 );
+  UP3D_PROG_BLK_SetParameter( &off[1], PARA_HEATER_NOZZLE1_ON, 0 );
+  UP3D_PROG_BLK_SetParameter( &off[2], PARA_BED_TEMP, 0 );
+  UP3D_PROG_BLK_SetParameter( &off[3], PARA_HEATER_BED_ON, 0 );
+  _umclink_write( o, off, 4 );
+
+  if( interlude->cool_temp > 0 )
+  {
+    //wait for the bed to cool down, with a timeout
+    UP3D_BLK blks[7];
+    UP3D_PROG_BLK_SetParameter( &blks[0], PARA_RED_BLUE_BLINK, 400 );
+    UP3D_PROG_BLK_SetParameter( &blks[1], PARA_COUNTER, UMCLINK_COOL_TIMEOUT );
+    UP3D_PROG_BLK_IfNotThenJmp( &blks[2], PARA_GET_BED_TEMP, 0, '<', 1 );                 //bed still warm => wait
+    blks[2].pdat2.f = (float)interlude->cool_temp;
+    UP3D_PROG_BLK_IfNotThenJmp( &blks[3], PARA_COUNTER, 0, '<', 3 );                      //counter is never <0 => leave loop
+    UP3D_PROG_BLK_Pause( &blks[4], 1000 );
+    UP3D_PROG_BLK_AddToParam( &blks[5], PARA_COUNTER, -1 );
+    UP3D_PROG_BLK_IfNotThenJmp( &blks[6], PARA_COUNTER, 1, '<', -5 );                     //no timeout => check again
+    _umclink_write( o, blks, 7 );
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_RED_BLUE_BLINK, 200 );
+    _umclink_write( o, &blk, 1 );
+  }
+
+  //Z away from the part
+  uint32_t h;
+  for( h=0; h<next_job->home_count; h++ )
+    _umclink_write( o, &next->blks[next_job->home_Z[h]], 1 );
+
+  if( interlude->removal_pause )
+  {
+    UP3D_BLK beep[3];
+    UP3D_PROG_BLK_Beeper( &beep[0], true );
+    UP3D_PROG_BLK_Pause( &beep[1], 500 );
+    UP3D_PROG_BLK_Beeper( &beep[2], false );
+    _umclink_write( o, beep, 3 );
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_PAUSE_PROGRAM, 1 );
+    _umclink_write( o, &blk, 1 );
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_PRINT_STATUS, 3 );
+    _umclink_write( o, &blk, 1 );
+    _umclink_write( o, beep, 3 );
+  }
+}
+
+int umclink_run(const umcreader_t* jobs, uint32_t count, const umclink_interlude_t* interlude,
+                const char* fname_out, umclink_result_t* result)
+{
+  memset( result, 0, sizeof(umclink_result_t) );
+  umclink_job_t* job = calloc( count, sizeof(umclink_job_t) );
+  if( !job )
+    return -3;
+
+  uint32_t n;
+  for( n=0; n<count; n++ )
+    if( !jobs[n].count || !_umclink_job( &jobs[n], &job[n] ) )
+    {
+      result->failed_job = n;
+      free( job );
+      return -2;
+    }
+
+  //print time before and after each job, the jobs after the first without their power on
+  int32_t after = 0;
+  for( n=count; n--; )
+  {
+    if( n )
+      job[n].time -= job[n].power_time;
+    job[n].after = after;
+    after += job[n].time + (n ? UMCLINK_INTERLUDE_TIME : 0);
+  }
+  for( n=0; n<count; n++ )
+    job[n].before = after - job[n].after - job[n].time;
+
+  char fname_idx[1050]; //layers of several jobs do not fit into one index
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_out );
+  remove( fname_idx );
+
+  umclink_out_t o = { .f = fopen( fname_out, "wb" ), .total = after };
+  if( !o.f )
+  {
+    free( job );
+    return -1;
+  }
+  char* buf = malloc( UMCLINK_OUT_BUFFER );
+  if( buf )
+    setvbuf( o.f, buf, _IOFBF, UMCLINK_OUT_BUFFER );
+
+  for( n=0; n<count; n++ )
+  {
+    bool last = (n+1 == count);
+    _umclink_copy( &o, &jobs[n], &job[n], 0, last ? jobs[n].count : job[n].end, n>0 );
+    if( !last )
+      _umclink_interlude( &o, &jobs[n+1], &job[n+1], interlude, job[n].after );
+  }
+  free( job );
+
+  if( fclose( o.f ) )
+    o.failed = true;
+  free( buf );
+  if( o.failed )
+  {
+    remove( fname_out );
+    return -1;
+  }
+
+  result->blocks = o.blocks;
+  result->time = o.total;
+  return 0;
+}
@@ -0,0 +1,56 @@
+/*
+  umclink.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umclink_h
+#define umclink_h
+
+#include "umcreader.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Linker for transcoded UMC files: the jobs are copied block by block into one program.
+//  - the end sequence of every job but the last (time/percent done, power off, status, stop) is removed
+//  - the power on of every job but the first (power on, beeper off, 4s pause) is removed, the rest
+//    of its start sequence (parameters, homing of all axes) is kept
+//  - between two jobs an interlude: heaters off, wait until the bed is cool, home Z (away from the part),
+//    pause for removal of the part (continued at the printer)
+//  - time remaining and percent done reports are made for the whole program
+// Cooling and the wait at the printer are not part of the print time.
+
+#define UMCLINK_COOL_TEMP      35.0 // default bed temperature for part removal (°C)
+#define UMCLINK_COOL_TIMEOUT   3600 // sec
+#define UMCLINK_INTERLUDE_TIME 6    // sec: homing Z, beeps and processing of the pause
+
+typedef struct {
+  double cool_temp;      // wait until the bed is below (°C), 0: no wait
+  bool   removal_pause;  // pause for removal of the part
+} umclink_interlude_t;
+
+typedef struct {
+  uint64_t blocks;
+  int32_t  time;         // print time of the program (sec)
+  uint32_t failed_job;   // job which is no complete transcoded UMC (result -2)
+} umclink_result_t;
+
+// returns 0: done, -1: could not write fname_out, -2: job is no complete UMC made by the transcoder,
+//          -3: out of memory
+int umclink_run(const umcreader_t* jobs, uint32_t count, const umclink_interlude_t* interlude,
+                const char* fname_out, umclink_result_t* result);
+
+#endif //umclink_h
@@ -0,0 +1,385 @@
+/*
+  umcloop.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcloop.h"
+#include "umcindex.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define UMCLOOP_OUT_BUFFER (1<<20)
+#define UMCLOOP_OVERHEAD   7 // blocks added for a loop: reports and counter before, counter and jump after
+
+// one layer: from its layer report to the next one
+typedef struct {
+  uint64_t first;
+  uint64_t count;
+  bool     movef_xy; // a MoveF at first is the X/Y half
+  double   Z;        // machine Z at first
+  bool     has_Z;
+  bool     loopable;
+  int32_t  layer;
+  uint64_t hash;
+} umcloop_seg_t;
+
+typedef struct {
+  bool   movef_xy;
+  double Z;
+  bool   has_Z;
+} umcloop_state_t;
+
+static bool _umcloop_is_report(const UP3D_BLK* blk)
+{
+  if( UP3DPCMD_SetParameter != blk->pcmd )
+    return false;
+  switch( blk->pdat1.l )
+  {
+    case PARA_REPORT_LAYER:
+    case PARA_REPORT_HEIGHT:
+    case PARA_REPORT_PERCENT:
+    case PARA_REPORT_TIME_REMAIN:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// block as it is written in a loop body: report values cleared, absolute Z moves made relative
+static void _umcloop_canon(const UP3D_BLK* blk, umcloop_state_t* st, UP3D_BLK* c)
+{
+  *c = *blk;
+  switch( blk->pcmd )
+  {
+    case UP3DPCMD_SetParameter:
+      if( _umcloop_is_report( blk ) )
+        c->pdat2.l = c->pdat3.l = c->pdat4.l = 0;
+      break;
+
+    case UP3DPCMD_MoveF:
+      if( !st->movef_xy )
+      {
+        if( blk->pdat1.f < 0 )
+        {
+          if( st->has_Z )
+          {
+            c->pdat1.f = -blk->pdat1.f;
+            c->pdat2.f = (float)(round( ((double)blk->pdat2.f - st->Z)*10000.0 )/10000.0);
+          }
+          st->Z = blk->pdat2.f;
+          st->has_Z = true;
+        }
+        else if( blk->pdat1.f > 0 )
+          st->Z += (double)blk->pdat2.f;
+      }
+      st->movef_xy = !st->movef_xy;
+      break;
+
+    case UP3DPCMD_HomeAxis:
+      st->has_Z = false;
+      break;
+
+    default:
+      break;
+  }
+}
+
+static uint64_t _umcloop_hash(uint64_t h, const UP3D_BLK* blk)
+{
+  const uint8_t* b = (const uint8_t*)blk;
+  size_t i;
+  for( i=0; i<sizeof(UP3D_BLK); i++ )
+    h = (h ^ b[i]) * 0x100000001B3ULL;
+  return h;
+}
+
+static umcloop_seg_t* _umcloop_segments(const umcreader_t* r, uint32_t* count, bool* failed)
+{
+  umcloop_seg_t* segs = NULL;
+  uint32_t alloc = 0;
+  umcloop_state_t st = { .movef_xy = true };
+  umcloop_seg_t* s = NULL;
+  uint64_t i;
+  *count = 0;
+  *failed = false;
+  for( i=0; i<r->count; i++ )
+  {
+    const UP3D_BLK* blk = &r->blks[i];
+    if( (UP3DPCMD_SetParameter == blk->pcmd) && (PARA_REPORT_LAYER == blk->pdat1.l) )
+    {
+      if( *count == alloc )
+      {
+        alloc = alloc ? alloc*2 : 256;
+        umcloop_seg_t* n = realloc( segs, alloc*sizeof(umcloop_seg_t) );
+        if( !n )
+        {
+          free( segs );
+          *failed = true;
+          return NULL;
+        }
+        segs = n;
+      }
+      s = &segs[(*count)++];
+      s->first = i;
+      s->count = 0;
+      s->movef_xy = st.movef_xy;
+      s->Z = st.Z;
+      s->has_Z = st.has_Z;
+      s->loopable = true;
+      s->layer = blk->pdat2.l;
+      s->hash = 0xCBF29CE484222325ULL;
+    }
+
+    UP3D_BLK c;
+    _umcloop_canon( blk, &st, &c );
+    if( !s )
+      continue;
+    s->count++;
+    s->hash = _umcloop_hash( s->hash, &c );
+    if( (UP3DPCMD_IfNotThenJmp == blk->pcmd) || (UP3DPCMD_AddToParam == blk->pcmd) || (UP3DPCMD_Stop == blk->pcmd) )
+      s->loopable = false;
+  }
+  return segs;
+}
+
+static bool _umcloop_equal(const umcreader_t* r, const umcloop_seg_t* a, const umcloop_seg_t* b)
+{
+  if( (a->count != b->count) || (a->hash != b->hash) || !b->loopable )
+    return false;
+  umcloop_state_t sa = { a->movef_xy, a->Z, a->has_Z };
+  umcloop_state_t sb = { b->movef_xy, b->Z, b->has_Z };
+  uint64_t i;
+  for( i=0; i<a->count; i++ )
+  {
+    UP3D_BLK ca, cb;
+    _umcloop_canon( &r->blks[a->first+i], &sa, &ca );
+    _umcloop_canon( &r->blks[b->first+i], &sb, &cb );
+    if( memcmp( &ca, &cb, sizeof(UP3D_BLK) ) )
+      return false;
+  }
+  return true;
+}
+
+typedef struct {
+  FILE*    f;
+  uint64_t blocks;
+  bool     failed;
+} umcloop_out_t;
+
+static void _umcloop_write(umcloop_out_t* o, const UP3D_BLK* blks, uint64_t count)
+{
+  if( !count || o->failed )
+    return;
+  o->failed = (count != fwrite( blks, sizeof(UP3D_BLK), count, o->f ));
+  o->blocks += count;
+}
+
+// value of the n-th report of param in a layer
+static bool _umcloop_report(const umcreader_t* r, const umcloop_seg_t* s, int32_t param, uint32_t n, int32_t* value)
+{
+  uint64_t i;
+  for( i=s->first; i<s->first+s->count; i++ )
+    if( (UP3DPCMD_SetParameter == r->blks[i].pcmd) && (param == r->blks[i].pdat1.l) && !n-- )
+    {
+      *value = r->blks[i].pdat2.l;
+      return true;
+    }
+  return false;
+}
+
+// layers s[0] .. s[m-1] as loop
+static void _umcloop_emit(const umcreader_t* r, const umcloop_seg_t* s, uint32_t m, umcloop_out_t* o)
+{
+  int32_t dl = s[1].layer - s[0].layer;
+  UP3D_BLK blk;
+
+  //remaining time: the first report of a layer goes down by the average time of a layer
+  //minus the time to the other reports in the layer
+  int32_t t0, tl, t, tp, d0 = 0;
+  bool has_time = _umcloop_report( r, &s[0], PARA_REPORT_TIME_REMAIN, 0, &t0 ) &&
+                  _umcloop_report( r, &s[m-1], PARA_REPORT_TIME_REMAIN, 0, &tl );
+  if( has_time )
+  {
+    d0 = (int32_t)llround( (double)(t0 - tl)/(m-1) );
+    uint32_t p;
+    for( tp=t0, p=1; _umcloop_report( r, &s[0], PARA_REPORT_TIME_REMAIN, p, &t ); tp=t, p++ )
+      d0 -= tp - t;
+  }
+
+  if( dl )
+  {
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_REPORT_LAYER, s[0].layer - dl );
+    _umcloop_write( o, &blk, 1 );
+  }
+  if( _umcloop_report( r, &s[0], PARA_REPORT_HEIGHT, 0, &t ) )
+  {
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_REPORT_HEIGHT, t );
+    _umcloop_write( o, &blk, 1 );
+  }
+  if( has_time )
+  {
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_REPORT_TIME_REMAIN, t0 + d0 );
+    _umcloop_write( o, &blk, 1 );
+  }
+  if( _umcloop_report( r, &s[0], PARA_REPORT_PERCENT, 0, &t ) )
+  {
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_REPORT_PERCENT, t );
+    _umcloop_write( o, &blk, 1 );
+  }
+  UP3D_PROG_BLK_SetParameter( &blk, PARA_COUNTER, (int32_t)m );
+  _umcloop_write( o, &blk, 1 );
+
+  umcloop_state_t st = { s[0].movef_xy, s[0].Z, s[0].has_Z };
+  uint64_t i, body = 0;
+  bool first_time = true;
+  tp = t0;
+  for( i=s[0].first; i<s[0].first+s[0].count; i++ )
+  {
+    const UP3D_BLK* b = &r->blks[i];
+    _umcloop_canon( b, &st, &blk );
+    if( UP3DPCMD_SetParameter == b->pcmd )
+    {
+      switch( b->pdat1.l )
+      {
+        case PARA_REPORT_LAYER:
+          if( dl )
+            UP3D_PROG_BLK_AddToParam( &blk, PARA_REPORT_LAYER, dl );
+          else
+            blk = *b;
+          break;
+
+        case PARA_REPORT_TIME_REMAIN:
+          UP3D_PROG_BLK_AddToParam( &blk, PARA_REPORT_TIME_REMAIN, first_time ? -d0 : b->pdat2.l - tp );
+          tp = b->pdat2.l;
+          first_time = false;
+          break;
+
+        case PARA_REPORT_HEIGHT:
+        case PARA_REPORT_PERCENT:
+          continue;
+
+        default:
+          break;
+      }
+    }
+    _umcloop_write( o, &blk, 1 );
+    body++;
+  }
+
+  UP3D_PROG_BLK_AddToParam( &blk, PARA_COUNTER, -1 );
+  _umcloop_write( o, &blk, 1 );
+  UP3D_PROG_BLK_IfNotThenJmp( &blk, PARA_COUNTER, 1, '<', -(int32_t)(body+2) );
+  _umcloop_write( o, &blk, 1 );
+}
+
+int umcloop_run(const umcreader_t* r, const char* fname_out, umcloop_stats_t* stats)
+{
+  memset( stats, 0, sizeof(umcloop_stats_t) );
+  stats->blocks_in = r->count;
+
+  uint32_t count;
+  bool failed;
+  umcloop_seg_t* segs = _umcloop_segments( r, &count, &failed );
+  if( failed )
+    return -3;
+
+  char fname_idx[1050]; //the layers of the output are not where an index of the input says
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_out );
+  remove( fname_idx );
+
+  umcloop_out_t o = { .f = fopen( fname_out, "wb" ) };
+  if( !o.f )
+  {
+    free( segs );
+    return -1;
+  }
+  char* buf = malloc( UMCLOOP_OUT_BUFFER );
+  if( buf )
+    setvbuf( o.f, buf, _IOFBF, UMCLOOP_OUT_BUFFER );
+
+  uint64_t copied = 0; //blocks of the input written
+  uint32_t n, m;
+  for( n=0; n<count; n+=m )
+  {
+    const umcloop_seg_t* s = &segs[n];
+    m = 1;
+    if( s->loopable && (n+1 < count) )
+    {
+      int32_t dl = segs[n+1].layer - s->layer;
+      while( (n+m < count) && (segs[n+m].layer - segs[n+m-1].layer == dl) && _umcloop_equal( r, s, &segs[n+m] ) )
+        m++;
+    }
+    if( (m < UMCLOOP_MIN_LAYERS) || ((m-1)*s->count <= UMCLOOP_OVERHEAD) )
+    {
+      m = 1;
+      continue;
+    }
+
+    _umcloop_write( &o, &r->blks[copied], s->first-copied );
+    _umcloop_emit( r, s, m, &o );
+    copied = segs[n+m-1].first + segs[n+m-1].count;
+    stats->loops++;
+    stats->layers += m;
+  }
+  _umcloop_write( &o, &r->blks[copied], r->count-copied );
+  free( segs );
+
+  if( fclose( o.f ) )
+    o.failed = true;
+  free( buf );
+  if( o.failed )
+  {
+    remove( fname_out );
+    return -1;
+  }
+  stats->blocks_out = o.blocks;
+  return 0;
+}
+
+bool umcloop_file(const char* fname_umc, umcloop_stats_t* stats)
+{
+  umcreader_t r;
+  if( !umcreader_open( &r, fname_umc ) )
+    return false;
+
+  char fname_temp[1040];
+  snprintf( fname_temp, sizeof(fname_temp), "%s.loop", fname_umc );
+  int ret = umcloop_run( &r, fname_temp, stats );
+  umcreader_close( &r );
+  if( ret )
+    return false;
+  if( !stats->loops ) //same blocks, the index stays valid
+  {
+    remove( fname_temp );
+    return true;
+  }
+
+  char fname_idx[1050];
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_umc );
+  remove( fname_idx );
+  remove( fname_umc ); //windows does not replace files
+  if( rename( fname_temp, fname_umc ) )
+  {
+    remove( fname_temp );
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,54 @@
+/*
+  umcloop.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umcloop_h
+#define umcloop_h
+
+#include "umcreader.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Loop compression of a finished UMC: a run of layers which only differ in their height (prismatic
+// parts, e.g. towers or walls printed with relative extrusion) is written once as a counted loop:
+//
+//   SetParameter(PARA_COUNTER, layers)
+//   body: first layer of the run, Z moved relative
+//   AddToParam(PARA_COUNTER, -1)
+//   IfNotThenJmp(PARA_COUNTER, 1, '<', back to body)
+//
+// Layer number and remaining time reports count on with AddToParam, height and percent are set once
+// before the loop. A layer is compared from its layer report to the next one, it must not contain
+// jumps of its own. Tools reading the layers of a file (index, sim, profile, resume) see a loop
+// as one layer, no layer index is written for the output.
+
+#define UMCLOOP_MIN_LAYERS 3 // layers of a run written as loop
+
+typedef struct {
+  uint64_t blocks_in;
+  uint64_t blocks_out;
+  uint32_t loops;
+  uint32_t layers;     // layers inside loops
+} umcloop_stats_t;
+
+// returns 0: done, -1: could not write fname_out, -3: out of memory
+int  umcloop_run(const umcreader_t* r, const char* fname_out, umcloop_stats_t* stats);
+// compress fname_umc in place, false on any error (the file is kept then)
+bool umcloop_file(const char* fname_umc, umcloop_stats_t* stats);
+
+#endif //umcloop_h
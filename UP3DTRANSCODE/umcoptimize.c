@@ -0,0 +1,388 @@
+/*
+  umcoptimize.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcoptimize.h"
+#include "umcindex.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define UMCOPTIMIZE_OUT_BUFFER (1<<20)
+
+// parameters never removed: layer markers used by index/resume and writes the printer acts on
+static bool _umcoptimize_keep(int32_t param)
+{
+  switch( param )
+  {
+    case PARA_REPORT_LAYER:
+    case PARA_REPORT_HEIGHT:
+    case PARA_PAUSE_PROGRAM:
+    case PARA_x0D:
+    case PARA_x0E:
+    case PARA_PRINT_STATUS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// parameters only written by the program (the printer does not change them)
+static bool _umcoptimize_host_owned(int32_t param)
+{
+  switch( param )
+  {
+    case PARA_REPORT_PERCENT:
+    case PARA_REPORT_TIME_REMAIN:
+    case PARA_x17:
+    case 0x41:
+    case 0x42:
+    case 0x43:
+    case PARA_NOZZLE1_TEMP:
+    case PARA_NOZZLE2_TEMP:
+    case PARA_BED_TEMP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+typedef struct {
+  uint64_t first;
+  uint64_t last;
+} umcoptimize_span_t;
+
+typedef struct {
+  FILE*               f;
+  uint64_t            blocks;
+  bool                failed;
+  UP3D_BLK            pause;   // pause held back to merge the following ones
+  bool                held;
+  umcindex_layer_t*   layers;  // layer index of the input, block numbers are mapped to the output
+  uint32_t            layer_count;
+  uint32_t            layer;
+} umcoptimize_out_t;
+
+static int _umcoptimize_span_cmp(const void* a, const void* b)
+{
+  const umcoptimize_span_t* sa = a;
+  const umcoptimize_span_t* sb = b;
+  return (sa->first > sb->first) - (sa->first < sb->first);
+}
+
+// ranges between jumps and their targets, sorted and merged
+static umcoptimize_span_t* _umcoptimize_spans(const umcreader_t* r, uint32_t* count, bool* failed)
+{
+  umcoptimize_span_t* spans = NULL;
+  uint32_t alloc = 0;
+  uint64_t i;
+  *count = 0;
+  *failed = false;
+  for( i=0; i<r->count; i++ )
+  {
+    if( UP3DPCMD_IfNotThenJmp != r->blks[i].pcmd )
+      continue;
+    if( *count == alloc )
+    {
+      alloc = alloc ? alloc*2 : 16;
+      umcoptimize_span_t* s = realloc( spans, alloc*sizeof(umcoptimize_span_t) );
+      if( !s )
+      {
+        free( spans );
+        *failed = true;
+        return NULL;
+      }
+      spans = s;
+    }
+    int64_t target = (int64_t)i + 1 + r->blks[i].pdat4.l;
+    if( target < 0 )
+      target = 0;
+    if( (uint64_t)target >= r->count )
+      target = r->count-1;
+    spans[*count].first = ((uint64_t)target < i) ? (uint64_t)target : i;
+    spans[*count].last = ((uint64_t)target > i) ? (uint64_t)target : i;
+    (*count)++;
+  }
+  if( !*count )
+    return spans;
+
+  qsort( spans, *count, sizeof(umcoptimize_span_t), _umcoptimize_span_cmp );
+  uint32_t n, m = 0;
+  for( n=1; n<*count; n++ )
+  {
+    if( spans[n].first <= spans[m].last+1 )
+    {
+      if( spans[n].last > spans[m].last )
+        spans[m].last = spans[n].last;
+    }
+    else
+      spans[++m] = spans[n];
+  }
+  *count = m+1;
+  return spans;
+}
+
+static bool _umcoptimize_pinned(const umcoptimize_span_t* spans, uint32_t count, uint64_t index)
+{
+  uint32_t lo = 0, hi = count;
+  while( lo < hi )
+  {
+    uint32_t mid = (lo+hi)/2;
+    if( spans[mid].last < index )
+      lo = mid+1;
+    else
+      hi = mid;
+  }
+  return (lo < count) && (spans[lo].first <= index);
+}
+
+// write of blk overwritten by a following block before anything can see it
+static bool _umcoptimize_overwritten(const umcreader_t* r, const umcoptimize_span_t* spans, uint32_t span_count, uint64_t index)
+{
+  const UP3D_BLK* blk = &r->blks[index];
+  uint64_t i, end = index+1+UMCOPTIMIZE_LOOKAHEAD;
+  if( end > r->count )
+    end = r->count;
+  for( i=index+1; i<end; i++ )
+  {
+    const UP3D_BLK* b = &r->blks[i];
+    if( _umcoptimize_pinned( spans, span_count, i ) )
+      return false;
+    if( UP3DPCMD_SetParameter == b->pcmd )
+    {
+      if( _umcoptimize_keep( b->pdat1.l ) && (PARA_REPORT_LAYER != b->pdat1.l) && (PARA_REPORT_HEIGHT != b->pdat1.l) )
+        return false;
+    }
+    else if( UP3DPCMD_SetState != b->pcmd )
+      return false;
+
+    if( (b->pcmd == blk->pcmd) && (b->pdat1.l == blk->pdat1.l) )
+      return true;
+  }
+  return false;
+}
+
+static void _umcoptimize_write(umcoptimize_out_t* o, const UP3D_BLK* blk)
+{
+  if( !o->failed )
+    o->failed = (1 != fwrite( blk, sizeof(UP3D_BLK), 1, o->f ));
+  o->blocks++;
+}
+
+static void _umcoptimize_emit(umcoptimize_out_t* o, const UP3D_BLK* blk, uint64_t index)
+{
+  if( o->held )
+  {
+    _umcoptimize_write( o, &o->pause );
+    o->held = false;
+  }
+  for( ; (o->layer < o->layer_count) && (o->layers[o->layer].block <= index); o->layer++ )
+  {
+    o->layers[o->layer].block = o->blocks;
+    o->layers[o->layer].offset = o->blocks*sizeof(UP3D_BLK);
+  }
+  if( blk )
+    _umcoptimize_write( o, blk );
+}
+
+// layer records of a valid index next to fname_umc, NULL if there is none
+static umcindex_layer_t* _umcoptimize_read_index(const umcreader_t* r, const char* fname_umc, umcindex_header_t* header)
+{
+  char fname_idx[1050];
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_umc );
+  FILE* f = fopen( fname_idx, "rb" );
+  if( !f )
+    return NULL;
+
+  umcindex_layer_t* layers = NULL;
+  if( umcindex_read_header( f, header, r->count ) && header->count &&
+      (layers = malloc( header->count*sizeof(umcindex_layer_t) )) &&
+      (header->count != fread( layers, sizeof(umcindex_layer_t), header->count, f )) )
+  {
+    free( layers );
+    layers = NULL;
+  }
+  fclose( f );
+  return layers;
+}
+
+int umcoptimize_run(const umcreader_t* r, const char* fname_umc, const char* fname_out, umcoptimize_stats_t* stats)
+{
+  memset( stats, 0, sizeof(umcoptimize_stats_t) );
+  stats->blocks_in = r->count;
+
+  uint32_t span_count;
+  bool failed;
+  umcoptimize_span_t* spans = _umcoptimize_spans( r, &span_count, &failed );
+  if( failed )
+    return -3;
+
+  umcindex_header_t header;
+  umcoptimize_out_t o;
+  memset( &o, 0, sizeof(o) );
+  o.layers = _umcoptimize_read_index( r, fname_umc, &header );
+  o.layer_count = o.layers ? header.count : 0;
+
+  char fname_idx[1050];
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_out );
+  remove( fname_idx );
+
+  if( !(o.f = fopen( fname_out, "wb" )) )
+  {
+    free( spans );
+    free( o.layers );
+    return -1;
+  }
+  char* buf = malloc( UMCOPTIMIZE_OUT_BUFFER );
+  if( buf )
+    setvbuf( o.f, buf, _IOFBF, UMCOPTIMIZE_OUT_BUFFER );
+
+  int32_t known[256];
+  bool    valid[256];
+  memset( valid, 0, sizeof(valid) );
+
+  uint64_t i;
+  for( i=0; i<r->count; i++ )
+  {
+    const UP3D_BLK* blk = &r->blks[i];
+    if( _umcoptimize_pinned( spans, span_count, i ) )
+    {
+      memset( valid, 0, sizeof(valid) );
+      _umcoptimize_emit( &o, blk, i );
+      continue;
+    }
+
+    int32_t p = blk->pdat1.l;
+    switch( blk->pcmd )
+    {
+      case UP3DPCMD_SetParameter:
+        if( !_umcoptimize_keep( p ) && _umcoptimize_overwritten( r, spans, span_count, i ) )
+        {
+          stats->dead++;
+          continue;
+        }
+        if( _umcoptimize_host_owned( p ) && (p>=0) && (p<256) )
+        {
+          if( valid[p] && (known[p] == blk->pdat2.l) )
+          {
+            stats->same++;
+            continue;
+          }
+          known[p] = blk->pdat2.l;
+          valid[p] = true;
+        }
+        break;
+
+      case UP3DPCMD_SetState:
+        if( _umcoptimize_overwritten( r, spans, span_count, i ) )
+        {
+          stats->dead++;
+          continue;
+        }
+        break;
+
+      case UP3DPCMD_Pause:
+        if( blk->pdat2.l || blk->pdat3.l || blk->pdat4.l ) //not a plain timed pause
+          break;
+        if( !blk->pdat1.l )
+        {
+          stats->pauses++;
+          continue;
+        }
+        if( o.held && ((uint32_t)o.pause.pdat1.l + (uint32_t)blk->pdat1.l <= INT32_MAX) )
+        {
+          o.pause.pdat1.l += blk->pdat1.l;
+          stats->pauses++;
+          continue;
+        }
+        _umcoptimize_emit( &o, NULL, i );
+        o.pause = *blk;
+        o.held = true;
+        continue;
+
+      case UP3DPCMD_AddToParam:
+        if( (p>=0) && (p<256) )
+          valid[p] = false;
+        break;
+
+      case UP3DPCMD_Stop:
+        memset( valid, 0, sizeof(valid) );
+        break;
+
+      default:
+        break;
+    }
+    _umcoptimize_emit( &o, blk, i );
+  }
+  _umcoptimize_emit( &o, NULL, r->count );
+
+  if( fclose( o.f ) )
+    o.failed = true;
+  free( buf );
+  free( spans );
+  if( o.failed )
+  {
+    free( o.layers );
+    remove( fname_out );
+    return -1;
+  }
+
+  if( o.layers )
+  {
+    umcindex_t idx = { .layers = o.layers, .count = o.layer_count };
+    umcindex_write( &idx, fname_idx, o.blocks, header.ticks );
+    free( o.layers );
+  }
+  stats->blocks_out = o.blocks;
+  return 0;
+}
+
+bool umcoptimize_file(const char* fname_umc, umcoptimize_stats_t* stats)
+{
+  umcreader_t r;
+  if( !umcreader_open( &r, fname_umc ) )
+    return false;
+
+  char fname_temp[1040], fname_temp_idx[1050], fname_idx[1050];
+  snprintf( fname_temp, sizeof(fname_temp), "%s.opt", fname_umc );
+  umcindex_name( fname_temp_idx, sizeof(fname_temp_idx), fname_temp );
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_umc );
+
+  int ret = umcoptimize_run( &r, fname_umc, fname_temp, stats );
+  umcreader_close( &r );
+  if( ret )
+    return false;
+
+  remove( fname_umc ); //windows does not replace files
+  if( rename( fname_temp, fname_umc ) )
+  {
+    remove( fname_temp );
+    remove( fname_temp_idx );
+    return false;
+  }
+  FILE* f = fopen( fname_temp_idx, "rb" );
+  if( f )
+  {
+    fclose( f );
+    remove( fname_idx );
+    rename( fname_temp_idx, fname_idx );
+  }
+  return true;
+}
@@ -0,0 +1,50 @@
+/*
+  umcoptimize.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umcoptimize_h
+#define umcoptimize_h
+
+#include "umcreader.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Peephole pass over a finished UMC, the printer does the same with fewer blocks:
+//  - SetParameter/SetState overwritten before any block which takes time or reads a parameter
+//  - SetParameter writing the value a host owned parameter (reports, temperatures) already has
+//  - pauses of zero length, adjacent pauses are merged
+// Moves, layer/height reports and commands like pause program are never touched. Blocks between an
+// IfNotThenJmp and its target are kept as they are, so relative jumps stay valid. A layer index
+// next to the input is written for the output with the new block numbers.
+
+#define UMCOPTIMIZE_LOOKAHEAD 16 // instant blocks searched for a write overwriting the current one
+
+typedef struct {
+  uint64_t blocks_in;
+  uint64_t blocks_out;
+  uint64_t dead;     // overwritten writes removed
+  uint64_t same;     // writes of the current value removed
+  uint64_t pauses;   // pauses merged or of zero length removed
+} umcoptimize_stats_t;
+
+// returns 0: done, -1: could not write fname_out, -3: out of memory
+int  umcoptimize_run(const umcreader_t* r, const char* fname_umc, const char* fname_out, umcoptimize_stats_t* stats);
+// optimize fname_umc (and its index) in place, false on any error (the file is kept then)
+bool umcoptimize_file(const char* fname_umc, umcoptimize_stats_t* stats);
+
+#endif //umcoptimize_h
@@ -0,0 +1,207 @@
+/*
+  umcprofile.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcprofile.h"
+#include "umcsim.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+static umcprofile_layer_t* _umcprofile_add_layer(umcprofile_layer_t** layers, uint32_t* count, uint32_t* alloc, int32_t layer, uint64_t first)
+{
+  if( *count == *alloc )
+  {
+    uint32_t n = *alloc ? *alloc*2 : 256;
+    umcprofile_layer_t* l = realloc( *layers, n*sizeof(umcprofile_layer_t) );
+    if( !l )
+      return NULL;
+    *layers = l;
+    *alloc = n;
+  }
+  umcprofile_layer_t* l = &(*layers)[(*count)++];
+  memset( l, 0, sizeof(umcprofile_layer_t) );
+  l->layer = layer;
+  l->height = -1;
+  l->first_block = first;
+  return l;
+}
+
+bool umcprofile_run(const umcreader_t* r, const settings_t* settings, umcprofile_layer_t** layers, uint32_t* count)
+{
+  const double* spm = settings->steps_per_mm;
+  uint32_t alloc = 0;
+  *layers = NULL;
+  *count = 0;
+
+  umcprofile_layer_t* l = _umcprofile_add_layer( layers, count, &alloc, 0, 0 );
+  if( !l )
+    return false;
+
+  umcsim_state_t st = UMCSIM_STATE_INIT;
+  bool in_moves = false;
+  bool pending = false; //X/Y half of a MoveF pair seen
+  double pending_time = 0;
+  bool in_poll = false; //inside a bed temperature poll loop
+  int64_t remain = -1;  //last time remaining report (sec)
+  double since = 0;     //time of moves and pauses since then
+  int64_t heat_layer = -1; //layer with a heater wait since then
+  uint64_t i;
+  for( i=0; i<r->count; i++ )
+  {
+    const UP3D_BLK* blk = &r->blks[i];
+
+    if( (UP3DPCMD_SetParameter == blk->pcmd) && (PARA_REPORT_LAYER == blk->pdat1.l) && (blk->pdat2.l != l->layer) )
+    {
+      if( !(l = _umcprofile_add_layer( layers, count, &alloc, blk->pdat2.l, i )) )
+      {
+        free( *layers );
+        *layers = NULL;
+        return false;
+      }
+    }
+    l->blocks++;
+
+    if( in_moves && (UP3DPCMD_MoveL != blk->pcmd) )
+    {
+      l->syncs++;
+      in_moves = false;
+    }
+
+    switch( blk->pcmd )
+    {
+      case UP3DPCMD_MoveL:
+      {
+        int64_t ticks = (int64_t)(uint16_t)blk->pdat1.s.s1*(uint16_t)blk->pdat1.s.s2;
+        int64_t x = st.pos[X_AXIS], y = st.pos[Y_AXIS], a = st.pos[A_AXIS];
+        umcsim_movel( &st, blk );
+        double dx = (st.pos[X_AXIS]-x)/spm[X_AXIS];
+        double dy = (st.pos[Y_AXIS]-y)/spm[Y_AXIS];
+        l->distance += sqrt( dx*dx + dy*dy );
+        l->extruded += (st.pos[A_AXIS]-a)/spm[A_AXIS];
+        l->move_ticks += ticks;
+        since += (double)ticks/F_CPU;
+        if( ticks < UMCPROFILE_MICRO_TICKS )
+          l->micro_moves++;
+        l->moves++;
+        in_moves = true;
+        break;
+      }
+
+      case UP3DPCMD_MoveF:
+      {
+        bool xy = st.movef_xy;
+        double t = umcsim_movef( settings, &st, blk );
+        if( xy )
+        {
+          if( pending ) //incomplete pair
+          {
+            l->direct_time += pending_time;
+            since += pending_time;
+          }
+          pending = true;
+          pending_time = t;
+        }
+        else
+        {
+          t = pending ? max( pending_time, t ) : t;
+          l->direct_time += t;
+          since += t;
+          l->direct_moves++;
+          pending = false;
+        }
+        break;
+      }
+
+      case UP3DPCMD_HomeAxis:
+        umcsim_home( &st, blk );
+        l->homes++;
+        break;
+
+      case UP3DPCMD_Pause:
+        if( in_poll ) //part of the heater wait
+          break;
+        l->pause_time += blk->pdat1.l/1000.0;
+        since += blk->pdat1.l/1000.0;
+        l->pauses++;
+        break;
+
+      case UP3DPCMD_WaitIfNot:
+        l->waits++;
+        heat_layer = *count-1;
+        break;
+
+      case UP3DPCMD_IfNotThenJmp:
+        if( PARA_GET_BED_TEMP == blk->pdat1.l )
+        {
+          if( !in_poll )
+            l->waits++;
+          in_poll = true;
+          heat_layer = *count-1;
+        }
+        else if( blk->pdat4.l < 0 ) //loop back
+          in_poll = false;
+        break;
+
+      case UP3DPCMD_SetParameter:
+        if( (PARA_REPORT_HEIGHT == blk->pdat1.l) && (l->height < 0) )
+          l->height = blk->pdat2.f;
+        if( PARA_REPORT_TIME_REMAIN == blk->pdat1.l )
+        {
+          if( (heat_layer >= 0) && (remain >= 0) )
+          {
+            //estimated time of the span - what moves and pauses took
+            double heat = (double)(remain - blk->pdat2.l) - since;
+            if( heat > 0 )
+              (*layers)[heat_layer].heat_time += heat;
+          }
+          remain = blk->pdat2.l;
+          since = 0;
+          heat_layer = -1;
+        }
+        break;
+
+      case UP3DPCMD_AddToParam:
+        if( PARA_REPORT_TIME_REMAIN == blk->pdat1.l ) //loop of a file, no absolute time
+        {
+          remain = -1;
+          heat_layer = -1;
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+  if( pending )
+    l->direct_time += pending_time;
+
+  return true;
+}
+
+double umcprofile_time(const umcprofile_layer_t* l)
+{
+  return (double)l->move_ticks/F_CPU + l->direct_time + l->pause_time + l->heat_time;
+}
+
+double umcprofile_feed(const umcprofile_layer_t* l)
+{
+  return l->move_ticks ? l->distance/((double)l->move_ticks/F_CPU) : 0;
+}
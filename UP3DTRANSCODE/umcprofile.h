@@ -0,0 +1,63 @@
+/*
+  umcprofile.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umcprofile_h
+#define umcprofile_h
+
+#include "up3dconf.h"
+#include "umcreader.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Per layer statistics of an UMC: the block stream is split at every SetParameter(PARA_REPORT_LAYER)
+// with a new layer number, blocks before the first one are layer 0 (preamble).
+// Heater waits (WaitIfNot and the bed temperature poll loop) take the time the transcoder estimated
+// for them: the drop of PARA_REPORT_TIME_REMAIN from the report before a wait to the report after it
+// minus the time of the moves and pauses in between. The time of homing is not known, only its number.
+
+// MoveL shorter than this are counted as micro segments (1 ms)
+#define UMCPROFILE_MICRO_TICKS (F_CPU/1000)
+
+typedef struct {
+  int32_t  layer;
+  double   height;       // first PARA_REPORT_HEIGHT of the layer (mm)
+  uint64_t first_block;
+  uint64_t blocks;
+  uint64_t moves;        // MoveL
+  uint64_t micro_moves;  // MoveL shorter than UMCPROFILE_MICRO_TICKS
+  uint64_t syncs;        // runs of MoveL ended by another block (the planner stops there)
+  uint64_t direct_moves; // MoveF pairs
+  uint64_t pauses;
+  uint64_t waits;        // heater waits (WaitIfNot, bed temperature poll loops)
+  uint64_t homes;
+  int64_t  move_ticks;   // MoveL time, sum of p1*p2 (F_CPU ticks)
+  double   direct_time;  // MoveF time (sec)
+  double   pause_time;   // sec, without the pauses of bed temperature poll loops
+  double   heat_time;    // heater waits (sec)
+  double   distance;     // X/Y path of the MoveL (mm)
+  double   extruded;     // change of A by MoveL (mm)
+} umcprofile_layer_t;
+
+// returns false if out of memory, *layers has to be freed
+bool umcprofile_run(const umcreader_t* r, const settings_t* settings, umcprofile_layer_t** layers, uint32_t* count);
+
+double umcprofile_time(const umcprofile_layer_t* l); // sec, without homing
+double umcprofile_feed(const umcprofile_layer_t* l); // average X/Y feed of the MoveL (mm/s)
+
+#endif //umcprofile_h
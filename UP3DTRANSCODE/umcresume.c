@@ -0,0 +1,293 @@
+/*
+  umcresume.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcresume.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define UMCRESUME_OUT_BUFFER (1<<20)
+
+// heater settings carried to the resumed layer, in the order umcwriter writes them
+static const int32_t _umcresume_heater_params[] = {
+  0x17, 0x41, PARA_NOZZLE1_TEMP, PARA_HEATER_NOZZLE1_ON, //nozzle open, temp reached value, temp, on
+  0x43, PARA_BED_TEMP, PARA_HEATER_BED_ON,               //bed temp reached value, temp, on
+};
+#define UMCRESUME_HEATER_PARAMS (sizeof(_umcresume_heater_params)/sizeof(_umcresume_heater_params[0]))
+#define UMCRESUME_NOZZLE_TEMP   2 // PARA_NOZZLE1_TEMP in the list
+
+typedef struct {
+  FILE*    f;
+  uint64_t blocks;
+  bool     failed;
+  int32_t  T;       // print time of the new job (sec)
+  int32_t  elapsed; // of the last time report
+} umcresume_out_t;
+
+static void _umcresume_write(umcresume_out_t* o, const UP3D_BLK* blks, uint64_t count)
+{
+  if( !count || o->failed )
+    return;
+  o->failed = (count != fwrite( blks, sizeof(UP3D_BLK), count, o->f ));
+  o->blocks += count;
+}
+
+// write a time/percent report for elapsed time of the new job
+static bool _umcresume_report(umcresume_out_t* o, const UP3D_BLK* blk, int32_t elapsed)
+{
+  UP3D_BLK b;
+  if( UP3DPCMD_SetParameter != blk->pcmd )
+    return false;
+
+  if( PARA_REPORT_TIME_REMAIN == blk->pdat1.l )
+  {
+    o->elapsed = elapsed;
+    UP3D_PROG_BLK_SetParameter( &b, PARA_REPORT_TIME_REMAIN, o->T - elapsed );
+  }
+  else if( PARA_REPORT_PERCENT == blk->pdat1.l )
+    UP3D_PROG_BLK_SetParameter( &b, PARA_REPORT_PERCENT, o->T ? (int32_t)((int64_t)o->elapsed*100/o->T) : 100 );
+  else
+    return false;
+
+  _umcresume_write( o, &b, 1 );
+  return true;
+}
+
+static bool _umcresume_is_time(const UP3D_BLK* blk)
+{
+  return (UP3DPCMD_SetParameter == blk->pcmd) && (PARA_REPORT_TIME_REMAIN == blk->pdat1.l);
+}
+
+// remaining time (sec) of the first time report at or after index
+static int32_t _umcresume_remain_at(const umcreader_t* r, uint64_t index)
+{
+  for( ; index<r->count; index++ )
+    if( _umcresume_is_time( &r->blks[index] ) )
+      return r->blks[index].pdat2.l;
+  return 0;
+}
+
+// layer record from the index next to the file, or from a scan of the file
+static int _umcresume_find(const umcreader_t* r, const char* fname_umc, const settings_t* settings, int32_t layer,
+                           umcindex_layer_t* l, uint64_t* preamble_end, bool* from_index)
+{
+  umcindex_layer_t first;
+  char fname_idx[1050];
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_umc );
+  FILE* f = fopen( fname_idx, "rb" );
+  if( f )
+  {
+    umcindex_header_t header;
+    *from_index = umcindex_read_header( f, &header, r->count ) && umcindex_read_layer( f, &header, layer, l );
+    if( *from_index && !umcindex_read_layer( f, &header, 1, &first ) )
+      first = *l;
+    fclose( f );
+  }
+  else
+    *from_index = false;
+
+  if( !*from_index )
+  {
+    umcindex_t idx;
+    umcindex_init( &idx, settings );
+    uint64_t i;
+    for( i=0; i<r->count; i++ )
+      umcindex_add( &idx, &r->blks[i], i, 0 );
+    if( idx.failed )
+    {
+      umcindex_free( &idx );
+      return -3;
+    }
+
+    uint32_t n;
+    bool found = false;
+    first.block = r->count;
+    for( n=0; n<idx.count; n++ )
+    {
+      if( (1 == idx.layers[n].layer) && (first.block == r->count) )
+        first = idx.layers[n];
+      if( idx.layers[n].layer == layer )
+      {
+        *l = idx.layers[n];
+        found = true;
+      }
+    }
+    umcindex_free( &idx );
+    if( !found )
+      return -2;
+  }
+
+  *preamble_end = (first.block < l->block) ? first.block : l->block;
+  return 0;
+}
+
+// machine Z set by the last MoveF before index, the last MoveF is always the Z/A half of a pair
+static bool _umcresume_last_Z(const umcreader_t* r, uint64_t index, double* Z)
+{
+  bool za = true;
+  while( index-- )
+  {
+    const UP3D_BLK* blk = &r->blks[index];
+    if( UP3DPCMD_MoveF != blk->pcmd )
+      continue;
+    if( za && (blk->pdat1.f < 0) )
+    {
+      *Z = blk->pdat2.f;
+      return true;
+    }
+    za = !za;
+  }
+  return false;
+}
+
+int umcresume_run(const umcreader_t* r, const char* fname_umc, const settings_t* settings, int32_t layer,
+                  const char* fname_out, umcresume_result_t* result)
+{
+  memset( result, 0, sizeof(umcresume_result_t) );
+  if( layer < 1 )
+    return -2;
+
+  uint64_t preamble_end;
+  int ret = _umcresume_find( r, fname_umc, settings, layer, &result->layer, &preamble_end, &result->from_index );
+  if( ret )
+    return ret;
+  const umcindex_layer_t* l = &result->layer;
+  if( !_umcresume_last_Z( r, l->block, &result->Z ) )
+    return -2;
+
+  //heater settings at the end of the start sequence and at the layer
+  //(the wait for the nozzle is often made in layer 1, after the start sequence)
+  int32_t heater_start[UMCRESUME_HEATER_PARAMS], heater[UMCRESUME_HEATER_PARAMS];
+  bool waited_start = false, waited = false;
+  memset( heater, 0, sizeof(heater) );
+  uint64_t i;
+  uint32_t p;
+  for( i=0; i<l->block; i++ )
+  {
+    if( i == preamble_end )
+    {
+      memcpy( heater_start, heater, sizeof(heater) );
+      waited_start = waited;
+    }
+    const UP3D_BLK* blk = &r->blks[i];
+    if( UP3DPCMD_SetParameter == blk->pcmd )
+    {
+      for( p=0; p<UMCRESUME_HEATER_PARAMS; p++ )
+        if( _umcresume_heater_params[p] == blk->pdat1.l )
+          heater[p] = blk->pdat2.l;
+      if( PARA_NOZZLE1_TEMP == blk->pdat1.l )
+        waited = false;
+    }
+    else if( (UP3DPCMD_WaitIfNot == blk->pcmd) && (PARA_TEMP_REACHED_N1 == blk->pdat1.l) )
+      waited = true;
+  }
+  if( preamble_end == l->block )
+  {
+    memcpy( heater_start, heater, sizeof(heater) );
+    waited_start = waited;
+  }
+
+  //moves to the layer start: X/Y with Z homed, Z fast to the clearance, slowly down to the layer
+  double Z = result->Z;
+  double Zc = min( Z+UMCRESUME_CLEARANCE, 0.0 );
+  double vx = settings->max_rate[X_AXIS]*60.0;
+  double vy = settings->max_rate[Y_AXIS]*60.0;
+  UP3D_BLK moves[6];
+  UP3D_PROG_BLK_MoveF( &moves[0], -vx, l->position[X_AXIS], -vy, l->position[Y_AXIS], 0, 0, 0, 0 );
+  UP3D_PROG_BLK_MoveF( &moves[2], 0, 0, 0, 0, -UMCRESUME_Z_FEED, Zc, 0, 0 );
+  UP3D_PROG_BLK_MoveF( &moves[4], 0, 0, 0, 0, -UMCRESUME_Z_SLOW, Z, 0, 0 );
+  double move_time = max( fabs( l->position[X_AXIS] )/vx, fabs( l->position[Y_AXIS] )/vy )*60.0 +
+                     fabs( Zc )/UMCRESUME_Z_FEED*60.0 + fabs( Zc-Z )/UMCRESUME_Z_SLOW*60.0;
+
+  //new print time: start sequence, moves to the layer, rest of the job
+  int32_t T = _umcresume_remain_at( r, 0 );
+  int32_t start_time = T - _umcresume_remain_at( r, preamble_end );
+  umcresume_out_t o = { .T = start_time + (int32_t)ceil( move_time ) + _umcresume_remain_at( r, l->block ) };
+
+  char fname_idx[1050]; //an index of another job would not fit
+  umcindex_name( fname_idx, sizeof(fname_idx), fname_out );
+  remove( fname_idx );
+
+  if( !(o.f = fopen( fname_out, "wb" )) )
+    return -1;
+  char* buf = malloc( UMCRESUME_OUT_BUFFER );
+  if( buf )
+    setvbuf( o.f, buf, _IOFBF, UMCRESUME_OUT_BUFFER );
+
+  //start sequence without moves
+  for( i=0; i<preamble_end; i++ )
+  {
+    const UP3D_BLK* blk = &r->blks[i];
+    if( (UP3DPCMD_MoveL == blk->pcmd) || (UP3DPCMD_MoveF == blk->pcmd) )
+      continue;
+    if( !_umcresume_report( &o, blk, _umcresume_is_time( blk ) ? T - blk->pdat2.l : 0 ) )
+      _umcresume_write( &o, blk, 1 );
+  }
+
+  //heaters as at the layer
+  UP3D_BLK blk;
+  for( p=0; p<UMCRESUME_HEATER_PARAMS; p++ )
+    if( heater[p] != heater_start[p] )
+    {
+      UP3D_PROG_BLK_SetParameter( &blk, (uint8_t)_umcresume_heater_params[p], heater[p] );
+      _umcresume_write( &o, &blk, 1 );
+    }
+  if( heater[UMCRESUME_NOZZLE_TEMP] && (!waited_start || (heater[UMCRESUME_NOZZLE_TEMP] != heater_start[UMCRESUME_NOZZLE_TEMP])) )
+  {
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_RED_BLUE_BLINK, 100 );
+    _umcresume_write( &o, &blk, 1 );
+    UP3D_PROG_BLK_WaitIfNot( &blk, PARA_TEMP_REACHED_N1, 1, '=' );
+    _umcresume_write( &o, &blk, 1 );
+    UP3D_PROG_BLK_SetParameter( &blk, PARA_RED_BLUE_BLINK, 200 );
+    _umcresume_write( &o, &blk, 1 );
+  }
+
+  _umcresume_write( &o, moves, 6 );
+
+  //rest of the job as it is, runs between the reports are copied at once
+  uint64_t run = l->block;
+  for( i=l->block; i<r->count; i++ )
+  {
+    const UP3D_BLK* b = &r->blks[i];
+    if( UP3DPCMD_SetParameter != b->pcmd )
+      continue;
+    if( (PARA_REPORT_TIME_REMAIN != b->pdat1.l) && (PARA_REPORT_PERCENT != b->pdat1.l) )
+      continue;
+    _umcresume_write( &o, &r->blks[run], i-run );
+    _umcresume_report( &o, b, _umcresume_is_time( b ) ? o.T - b->pdat2.l : 0 );
+    run = i+1;
+  }
+  _umcresume_write( &o, &r->blks[run], r->count-run );
+
+  if( fclose( o.f ) )
+    o.failed = true;
+  free( buf );
+  if( o.failed )
+  {
+    remove( fname_out );
+    return -1;
+  }
+
+  result->blocks = o.blocks;
+  result->time = o.T;
+  return 0;
+}
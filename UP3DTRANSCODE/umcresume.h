@@ -0,0 +1,55 @@
+/*
+  umcresume.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umcresume_h
+#define umcresume_h
+
+#include "up3dconf.h"
+#include "umcreader.h"
+#include "umcindex.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Resume a failed print at a layer: a new UMC is made of
+//  - the start sequence (layer 0) without its moves: power, heaters and their waits, homing
+//  - the heater settings made until the layer, with a wait for the nozzle unless the start sequence has it
+//  - a move to the X/Y position of the layer start with Z still homed, then Z down to the layer
+//    (fast to UMCRESUME_CLEARANCE above it, slow for the rest)
+//  - the original blocks from the layer on, copied as they are
+// The extruder is not moved, its position only matters relative in an UMC. Time and percent
+// reports are recalculated from the remaining times in the file.
+
+#define UMCRESUME_CLEARANCE 2.0   // mm above the layer for the fast Z move
+#define UMCRESUME_Z_FEED    3000  // mm/min
+#define UMCRESUME_Z_SLOW    300   // mm/min
+
+typedef struct {
+  umcindex_layer_t layer;        // start of the resumed layer
+  bool             from_index;   // layer found with the index next to the file (otherwise by a scan)
+  double           Z;            // machine Z of the layer (mm)
+  uint64_t         blocks;       // blocks written
+  int32_t          time;         // print time of the new job (sec)
+} umcresume_result_t;
+
+// returns 0: done, -1: could not write fname_out, -2: no such layer (or no absolute Z before it),
+// -3: out of memory
+int umcresume_run(const umcreader_t* r, const char* fname_umc, const settings_t* settings, int32_t layer,
+                  const char* fname_out, umcresume_result_t* result);
+
+#endif //umcresume_h
@@ -0,0 +1,458 @@
+/*
+  umcsim.c for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcsim.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// MoveL parameters are rounded to integers, speeds and accelerations slightly above the limits
+// of the planner are no error
+#define UMCSIM_LIMIT_TOLERANCE 1.01
+
+typedef struct {
+  umcsim_state_t  sum[2];         // change in the chunk if its first MoveF is the X/Y (0) or Z/A half (1)
+  uint64_t        movef;          // MoveF blocks in the chunk
+  umcsim_state_t  start;          // state at the start of the chunk
+  umcsim_result_t stats;
+  double          lead_za_time;   // chunk starts with the Z/A half of a pair split by the chunk border
+  double          trail_xy_time;  // chunk ends with the X/Y half of a pair
+  bool            lead_za;
+  bool            trail_xy;
+} umcsim_chunk_t;
+
+typedef struct {
+  const settings_t* settings;
+  umcsim_chunk_t*   chunks;
+} umcsim_t;
+
+static double _umcsim_axis_move(int64_t* pos, bool* set, float speed, float target, double steps_per_mm)
+{
+  if( 0 == speed )
+    return 0;
+
+  int64_t to = llround( (double)target*steps_per_mm );
+  int64_t dist = to;
+  if( speed < 0 ) //absolute
+  {
+    dist = to - *pos;
+    *pos = to;
+    *set = true;
+  }
+  else
+    *pos += to;
+  return fabs( dist/steps_per_mm )/(fabs( speed )/60.0);
+}
+
+double umcsim_movef(const settings_t* settings, umcsim_state_t* st, const UP3D_BLK* blk)
+{
+  const double* spm = settings->steps_per_mm;
+  bool xy = st->movef_xy;
+  st->movef_xy = !xy;
+
+  if( xy )
+  {
+    double tx = _umcsim_axis_move( &st->pos[X_AXIS], &st->set[X_AXIS], blk->pdat1.f, blk->pdat2.f, spm[X_AXIS] );
+    double ty = _umcsim_axis_move( &st->pos[Y_AXIS], &st->set[Y_AXIS], blk->pdat3.f, blk->pdat4.f, spm[Y_AXIS] );
+    return max( tx, ty );
+  }
+
+  double tz = 0;
+  if( blk->pdat1.f )
+  {
+    double dist = blk->pdat2.f;
+    if( blk->pdat1.f < 0 )
+    {
+      dist -= st->Z;
+      st->Z = blk->pdat2.f;
+      st->Zset = true;
+    }
+    else
+      st->Z += (double)blk->pdat2.f;
+    tz = fabs( dist )/(fabs( blk->pdat1.f )/60.0);
+  }
+  double ta = _umcsim_axis_move( &st->pos[A_AXIS], &st->set[A_AXIS], blk->pdat3.f, blk->pdat4.f, spm[A_AXIS] );
+  return max( tz, ta );
+}
+
+void umcsim_home(umcsim_state_t* st, const UP3D_BLK* blk)
+{
+  int32_t axis = blk->pdat1.l;
+  if( UP3DAXIS_Z == axis )
+  {
+    st->Z = 0;
+    st->Zset = true;
+  }
+  else if( (axis >= 0) && (axis < UP3DAXIS_Z) )
+  {
+    st->pos[axis] = 0;
+    st->set[axis] = true;
+  }
+}
+
+// MoveL parameters of one axis: speed and acceleration
+static inline void _umcsim_movel_axis(const UP3D_BLK* blk, int axis, int16_t* v, int16_t* a)
+{
+  switch( axis )
+  {
+    case X_AXIS: *v = blk->pdat2.s.s1; *a = blk->pdat3.s.s2; break;
+    case Y_AXIS: *v = blk->pdat2.s.s2; *a = blk->pdat4.s.s1; break;
+    default:     *v = blk->pdat3.s.s1; *a = blk->pdat4.s.s2; break;
+  }
+}
+
+// steps made by a MoveL
+static inline void _umcsim_movel_delta(const UP3D_BLK* blk, int64_t steps[N_AXIS])
+{
+  int64_t n = (uint16_t)blk->pdat1.s.s1;
+  int axis;
+  for( axis=0; axis<N_AXIS; axis++ )
+  {
+    int16_t v, a;
+    _umcsim_movel_axis( blk, axis, &v, &a );
+    steps[axis] = UP3D_PROG_MoveL_Steps( (uint16_t)n, v, a );
+  }
+}
+
+static inline void _umcsim_add(umcsim_state_t* st, const int64_t steps[N_AXIS])
+{
+  int axis;
+  for( axis=0; axis<N_AXIS; axis++ )
+    st->pos[axis] += steps[axis];
+}
+
+void umcsim_movel(umcsim_state_t* st, const UP3D_BLK* blk)
+{
+  int64_t steps[N_AXIS];
+  _umcsim_movel_delta( blk, steps );
+  _umcsim_add( st, steps );
+}
+
+// pass 1: change of the position in a chunk, for both possible MoveF halves at its start
+static void _umcsim_sum_chunk(void* user, const umcreader_t* r, uint64_t chunk, uint64_t first, uint64_t count)
+{
+  umcsim_t* sim = user;
+  umcsim_chunk_t* c = &sim->chunks[chunk];
+
+  memset( c->sum, 0, sizeof(c->sum) );
+  c->sum[0].movef_xy = true;
+  c->movef = 0;
+
+  const UP3D_BLK* blk = r->blks + first;
+  const UP3D_BLK* end = blk + count;
+  for( ; blk<end; blk++ )
+  {
+    switch( blk->pcmd )
+    {
+      case UP3DPCMD_MoveL:
+      {
+        int64_t steps[N_AXIS];
+        _umcsim_movel_delta( blk, steps );
+        _umcsim_add( &c->sum[0], steps );
+        _umcsim_add( &c->sum[1], steps );
+        break;
+      }
+
+      case UP3DPCMD_MoveF:
+        umcsim_movef( sim->settings, &c->sum[0], blk );
+        umcsim_movef( sim->settings, &c->sum[1], blk );
+        c->movef++;
+        break;
+
+      case UP3DPCMD_HomeAxis:
+        umcsim_home( &c->sum[0], blk );
+        umcsim_home( &c->sum[1], blk );
+        break;
+
+      default:
+        break;
+    }
+  }
+}
+
+static void _umcsim_track(umcsim_result_t* s, const umcsim_state_t* st)
+{
+  int axis;
+  for( axis=0; axis<N_AXIS; axis++ )
+  {
+    if( st->pos[axis] < s->min_position[axis] ) s->min_position[axis] = st->pos[axis];
+    if( st->pos[axis] > s->max_position[axis] ) s->max_position[axis] = st->pos[axis];
+  }
+}
+
+// absolute target of a MoveF - simulated position before it
+static void _umcsim_drift(umcsim_result_t* s, int axis, int64_t pos, float target, double steps_per_mm)
+{
+  int64_t d = llround( (double)target*steps_per_mm ) - pos;
+  s->drift[axis] = d;
+  if( llabs( d ) > s->max_drift[axis] )
+    s->max_drift[axis] = llabs( d );
+  s->drift_checks[axis]++;
+}
+
+// X/Y half of a virtual home (X/Y to 0, Z to 0 or not moving and A not moving), it is no position check
+static bool _umcsim_virtual_home(const umcreader_t* r, uint64_t i)
+{
+  const UP3D_BLK* blk = &r->blks[i];
+  if( (blk->pdat2.f != 0) || (blk->pdat4.f != 0) || (i+1 >= r->count) )
+    return false;
+  const UP3D_BLK* za = &r->blks[i+1];
+  return (UP3DPCMD_MoveF == za->pcmd) && (0 == za->pdat2.f) && (0 == za->pdat3.f);
+}
+
+static void _umcsim_movel_limits(const umcsim_t* sim, umcsim_result_t* s, const UP3D_BLK* blk, uint64_t index)
+{
+  uint16_t p1 = (uint16_t)blk->pdat1.s.s1;
+  uint16_t p2 = (uint16_t)blk->pdat1.s.s2;
+  s->move_ticks += (int64_t)p1*p2;
+  if( !p1 || !p2 )
+    return;
+
+  double f = (double)F_CPU/p2; //periods per second
+  int axis;
+  for( axis=0; axis<N_AXIS; axis++ )
+  {
+    int16_t v, a;
+    _umcsim_movel_axis( blk, axis, &v, &a );
+    double spm = sim->settings->steps_per_mm[axis];
+    double v_end = (double)v + (double)a*(p1-1);
+    double speed = max( fabs( (double)v ), fabs( v_end ) )/512.0*f/spm;
+    double acc = fabs( (double)a )/512.0*f*f/spm;
+    if( llabs( UP3D_PROG_MoveL_Steps( p1, v, a ) ) <= 1 ) //single carry step, no real speed
+      continue;
+
+    if( speed > s->peak_speed[axis] )
+    {
+      s->peak_speed[axis] = speed;
+      s->peak_speed_block[axis] = index;
+    }
+    if( acc > s->peak_acceleration[axis] )
+    {
+      s->peak_acceleration[axis] = acc;
+      s->peak_acceleration_block[axis] = index;
+    }
+    if( speed > sim->settings->max_rate[axis]*UMCSIM_LIMIT_TOLERANCE )
+      s->over_speed[axis]++;
+    if( acc > sim->settings->acceleration[axis]*UMCSIM_LIMIT_TOLERANCE )
+      s->over_acceleration[axis]++;
+  }
+}
+
+// pass 2: statistics of a chunk starting at the real position
+static void _umcsim_run_chunk(void* user, const umcreader_t* r, uint64_t chunk, uint64_t first, uint64_t count)
+{
+  umcsim_t* sim = user;
+  umcsim_chunk_t* c = &sim->chunks[chunk];
+  umcsim_result_t* s = &c->stats;
+  umcsim_state_t st = c->start;
+
+  memset( s, 0, sizeof(umcsim_result_t) );
+  memcpy( s->min_position, st.pos, sizeof(st.pos) );
+  memcpy( s->max_position, st.pos, sizeof(st.pos) );
+  _umcsim_track( s, &st );
+  c->lead_za = c->trail_xy = false;
+
+  bool pending = false;
+  double pending_time = 0;
+  uint64_t i;
+  for( i=first; i<first+count; i++ )
+  {
+    const UP3D_BLK* blk = &r->blks[i];
+    switch( blk->pcmd )
+    {
+      case UP3DPCMD_MoveL:
+      {
+        int64_t steps[N_AXIS];
+        _umcsim_movel_limits( sim, s, blk, i );
+        _umcsim_movel_delta( blk, steps );
+        _umcsim_add( &st, steps );
+        _umcsim_track( s, &st );
+        s->moves++;
+        break;
+      }
+
+      case UP3DPCMD_MoveF:
+      {
+        bool xy = st.movef_xy;
+        if( xy && !_umcsim_virtual_home( r, i ) )
+        {
+          const double* spm = sim->settings->steps_per_mm;
+          if( blk->pdat1.f < 0 )
+            _umcsim_drift( s, X_AXIS, st.pos[X_AXIS], blk->pdat2.f, spm[X_AXIS] );
+          if( blk->pdat3.f < 0 )
+            _umcsim_drift( s, Y_AXIS, st.pos[Y_AXIS], blk->pdat4.f, spm[Y_AXIS] );
+        }
+        double t = umcsim_movef( sim->settings, &st, blk );
+        _umcsim_track( s, &st );
+        if( xy )
+        {
+          if( pending ) //incomplete pair
+            s->direct_time += pending_time;
+          pending = true;
+          pending_time = t;
+        }
+        else if( pending )
+        {
+          s->direct_time += max( pending_time, t );
+          s->direct_moves++;
+          pending = false;
+        }
+        else if( i == first ) //X/Y half in the chunk before
+        {
+          c->lead_za = true;
+          c->lead_za_time = t;
+        }
+        else
+          s->direct_time += t;
+        break;
+      }
+
+      case UP3DPCMD_HomeAxis:
+        umcsim_home( &st, blk );
+        _umcsim_track( s, &st );
+        s->homes++;
+        break;
+
+      case UP3DPCMD_Pause:
+        s->pause_time += blk->pdat1.l/1000.0;
+        s->pauses++;
+        break;
+
+      case UP3DPCMD_WaitIfNot:
+        s->waits++;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  if( pending )
+  {
+    c->trail_xy = true;
+    c->trail_xy_time = pending_time;
+  }
+}
+
+// start state after a chunk with the change sum
+static void _umcsim_apply(umcsim_state_t* st, const umcsim_state_t* sum)
+{
+  int axis;
+  for( axis=0; axis<N_AXIS; axis++ )
+  {
+    if( sum->set[axis] )
+      st->pos[axis] = sum->pos[axis];
+    else
+      st->pos[axis] += sum->pos[axis];
+  }
+  if( sum->Zset )
+    st->Z = sum->Z;
+  else
+    st->Z += sum->Z;
+}
+
+bool umcsim_run(const umcreader_t* r, const settings_t* settings, uint32_t threads, umcsim_result_t* result)
+{
+  memset( result, 0, sizeof(umcsim_result_t) );
+  result->blocks = r->count;
+
+  uint64_t chunks = umcreader_chunk_count( r );
+  umcsim_t sim = { .settings = settings };
+  if( !chunks )
+    return true;
+  if( !(sim.chunks = calloc( chunks, sizeof(umcsim_chunk_t) )) )
+    return false;
+
+  umcreader_for_chunks( r, threads, _umcsim_sum_chunk, &sim );
+
+  //prefix sum over the chunks: start state of every chunk
+  umcsim_state_t st = UMCSIM_STATE_INIT;
+  uint64_t c;
+  for( c=0; c<chunks; c++ )
+  {
+    sim.chunks[c].start = st;
+    _umcsim_apply( &st, &sim.chunks[c].sum[st.movef_xy ? 0 : 1] );
+    if( sim.chunks[c].movef & 1 )
+      st.movef_xy = !st.movef_xy;
+  }
+
+  umcreader_for_chunks( r, threads, _umcsim_run_chunk, &sim );
+
+  umcsim_result_t* res = result;
+  memcpy( res->min_position, sim.chunks[0].stats.min_position, sizeof(res->min_position) );
+  memcpy( res->max_position, sim.chunks[0].stats.max_position, sizeof(res->max_position) );
+  for( c=0; c<chunks; c++ )
+  {
+    umcsim_chunk_t* ch = &sim.chunks[c];
+    umcsim_result_t* s = &ch->stats;
+    res->moves += s->moves;
+    res->direct_moves += s->direct_moves;
+    res->homes += s->homes;
+    res->pauses += s->pauses;
+    res->waits += s->waits;
+    res->move_ticks += s->move_ticks;
+    res->direct_time += s->direct_time;
+    res->pause_time += s->pause_time;
+
+    //MoveF pair split by the chunk border
+    if( ch->lead_za )
+    {
+      if( c && sim.chunks[c-1].trail_xy )
+      {
+        res->direct_time += max( sim.chunks[c-1].trail_xy_time, ch->lead_za_time );
+        res->direct_moves++;
+      }
+      else
+        res->direct_time += ch->lead_za_time;
+    }
+    if( ch->trail_xy && !((c+1 < chunks) && sim.chunks[c+1].lead_za) )
+      res->direct_time += ch->trail_xy_time;
+
+    int axis;
+    for( axis=0; axis<N_AXIS; axis++ )
+    {
+      if( s->min_position[axis] < res->min_position[axis] ) res->min_position[axis] = s->min_position[axis];
+      if( s->max_position[axis] > res->max_position[axis] ) res->max_position[axis] = s->max_position[axis];
+      if( s->max_drift[axis] > res->max_drift[axis] ) res->max_drift[axis] = s->max_drift[axis];
+      if( s->drift_checks[axis] ) //chunks are merged in file order
+        res->drift[axis] = s->drift[axis];
+      res->drift_checks[axis] += s->drift_checks[axis];
+      if( s->peak_speed[axis] > res->peak_speed[axis] )
+      {
+        res->peak_speed[axis] = s->peak_speed[axis];
+        res->peak_speed_block[axis] = s->peak_speed_block[axis];
+      }
+      if( s->peak_acceleration[axis] > res->peak_acceleration[axis] )
+      {
+        res->peak_acceleration[axis] = s->peak_acceleration[axis];
+        res->peak_acceleration_block[axis] = s->peak_acceleration_block[axis];
+      }
+      res->over_speed[axis] += s->over_speed[axis];
+      res->over_acceleration[axis] += s->over_acceleration[axis];
+    }
+  }
+
+  memcpy( res->position, st.pos, sizeof(res->position) );
+  res->Z = st.Z;
+
+  free( sim.chunks );
+  return true;
+}
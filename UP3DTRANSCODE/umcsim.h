@@ -0,0 +1,91 @@
+/*
+  umcsim.h for UP3DTranscoder
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef umcsim_h
+#define umcsim_h
+
+#include "up3dconf.h"
+#include "umcreader.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Simulation of the motion blocks of an UMC like the printer executes them:
+//  MoveL: p1 periods of p2 cpu ticks, speed/acceleration in 1/512 steps per period, the steps made
+//         are rounded like the mcu does (UP3D_PROG_MoveL_Steps())
+//  MoveF: pair of X/Y and Z/A half, speed in mm/min, negative speed: absolute position (mm),
+//         positive speed: relative move, zero speed: axis does not move
+//  Home:  sets the axis to 0
+// Axes are the machine axes X, Y, A (extruder) as in settings_t, Z is only moved by MoveF and Home.
+//
+// The file is simulated in chunks on several threads: a first pass sums up the change of the
+// positions in every chunk (a MoveF with absolute position replaces the sum), a prefix sum over
+// the chunks gives the start position of every chunk and a second pass collects the statistics.
+
+// Position state, in a chunk summary the change of the position or the absolute position if set
+typedef struct {
+  int64_t pos[N_AXIS];      // steps
+  bool    set[N_AXIS];      // summary: absolute position set in the chunk
+  double  Z;
+  bool    Zset;
+  bool    movef_xy;         // next MoveF is the X/Y half
+} umcsim_state_t;
+
+#define UMCSIM_STATE_INIT { .movef_xy = true }
+
+typedef struct {
+  uint64_t blocks;
+  uint64_t moves;                              // MoveL blocks
+  uint64_t direct_moves;                       // MoveF pairs
+  uint64_t homes;                              // HomeAxis blocks
+  uint64_t pauses;                             // Pause blocks
+  uint64_t waits;                              // WaitIfNot blocks (heater waits, time unknown)
+
+  int64_t  move_ticks;                         // MoveL time, sum of p1*p2 (F_CPU ticks)
+  double   direct_time;                        // MoveF time from distance and speed (sec)
+  double   pause_time;                         // sec
+
+  int64_t  position[N_AXIS];                   // final position (steps)
+  double   Z;                                  // final Z (mm)
+  int64_t  min_position[N_AXIS];               // travel range (steps)
+  int64_t  max_position[N_AXIS];
+  int64_t  drift[N_AXIS];                      // X/Y target of the last absolute MoveF - simulated
+                                               // position before it (steps), for a layer change
+                                               // without X/Y words the position error of the moves
+  int64_t  max_drift[N_AXIS];                  // largest absolute drift (steps)
+  uint64_t drift_checks[N_AXIS];               // absolute MoveF checked (virtual home is skipped)
+
+  double   peak_speed[N_AXIS];                 // fastest MoveL (mm/s)
+  double   peak_acceleration[N_AXIS];          // (mm/s^2)
+  uint64_t peak_speed_block[N_AXIS];           // block index of the fastest MoveL
+  uint64_t peak_acceleration_block[N_AXIS];
+  uint64_t over_speed[N_AXIS];                 // MoveL blocks above max_rate of the settings
+  uint64_t over_acceleration[N_AXIS];          // MoveL blocks above acceleration of the settings
+                                               // (axes making a single step in a MoveL are not
+                                               // checked, the transcoder puts left over steps there)
+} umcsim_result_t;
+
+// threads: 0 = number of cpus, returns false if out of memory
+bool umcsim_run(const umcreader_t* r, const settings_t* settings, uint32_t threads, umcsim_result_t* result);
+
+// Block by block simulation (from UMCSIM_STATE_INIT at the start of a file)
+void   umcsim_movel(umcsim_state_t* st, const UP3D_BLK* blk);
+double umcsim_movef(const settings_t* settings, umcsim_state_t* st, const UP3D_BLK* blk); // one half of the pair, returns its time (sec)
+void   umcsim_home(umcsim_state_t* st, const UP3D_BLK* blk);
+
+#endif //umcsim_h
@@ -17,87 +17,259 @@
 */
 
 #include "umcwriter.h"
+#include "transcoder.h"
 #include "up3ddata.h"
 #include "up3dconf.h"
 #include "hostplanner.h"
 #include "hoststepper.h"
+#include "umcindex.h"
 
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <math.h>
+#include <string.h>
+#include <stdlib.h>
 
-static FILE*   umcwriter_file;
-static double  umcwriter_Z;
-static double  umcwriter_Z_height;
-static double  umcwriter_print_time;
-static char    umcwriter_machine_type;
-static int32_t umcwriter_bed_temp;
+#define UMCWRITER_TICKS(sec) ((int64_t)((sec)*(double)F_CPU))
 
-static int _umcwriter_write_file(UP3D_BLK* pblks, uint32_t blks )
+#define UMCWRITER_NOZZLE_HEAT_TIME 120 //apx. 2 minutes from cold to printing temperature
+
+#define UMCWRITER_BED_TEMP_WINDOW 2 //bed counts as heated when it is this close to the target
+
+static void _umcwriter_flush_out(transcoder_t* tc)
 {
-  if( umcwriter_file )
-    return (int)fwrite( pblks, blks, sizeof(UP3D_BLK), umcwriter_file );
-  else
+  if( !tc->umc.out_count )
+    return;
+
+  if( tc->umc.file )
+    fwrite( tc->umc.out_blks, sizeof(UP3D_BLK), tc->umc.out_count, tc->umc.file );
+  else if( tc->umc.sink && !tc->umc.sink_failed )
+    tc->umc.sink_failed = !tc->umc.sink( tc->umc.sink_user, (uint32_t)tc->umc.out_index, tc->umc.out_blks, tc->umc.out_count );
+  tc->umc.out_index += tc->umc.out_count;
+  tc->umc.out_count = 0;
+}
+
+//room for count blocks in the output buffer, filled by the caller
+static UP3D_BLK* _umcwriter_reserve(transcoder_t* tc, uint32_t count)
+{
+  if( tc->umc.out_count+count > UMCWRITER_OUT_BLOCKS )
+    _umcwriter_flush_out(tc);
+  return &tc->umc.out_blks[tc->umc.out_count];
+}
+
+static int _umcwriter_write_file(transcoder_t* tc, UP3D_BLK* pblks, uint32_t blks )
+{
+  if( !tc->umc.file && !tc->umc.sink )
     return 0;
+
+  uint32_t i;
+  for( i=0; i<blks; i++ )
+  {
+    *_umcwriter_reserve(tc, 1) = pblks[i];
+    tc->umc.out_count++;
+  }
+  return (int)blks;
+}
+
+//MoveL blocks of the next planner block go straight from the stepper into the output buffer
+static bool _umcwriter_write_next_block(transcoder_t* tc)
+{
+  uint32_t count;
+  if( !st_next_block_up3d(tc, _umcwriter_reserve(tc, ST_BLOCK_SEGMENTS), &count, &tc->umc.print_time) )
+    return false;
+  tc->umc.out_count += count;
+  return true;
+}
+
+// Record mode: a writer call becomes a command for umcwriter_replay() and is not executed
+#define UMCWRITER_RECORD(tc, ...) do { \
+    if( (tc)->umc.record ) { \
+      umcwriter_cmd_t cmd = { __VA_ARGS__ }; \
+      (tc)->umc.record( (tc)->umc.record_user, &cmd ); \
+      return; \
+    } \
+  } while(0)
+
+//no output at all, only the print time is calculated
+static bool _umcwriter_estimate_only(transcoder_t* tc)
+{
+  return !tc->umc.file && !tc->umc.sink;
+}
+
+static void _umcwriter_release_sink(transcoder_t* tc)
+{
+  free( tc->umc.reports );
+  tc->umc.reports = NULL;
+  tc->umc.report_count = tc->umc.report_alloc = 0;
+  tc->umc.sink = tc->umc.patch = NULL;
+  tc->umc.sink_user = NULL;
+  tc->umc.track_reports = false;
+}
+
+//remember where a report block went, a sink gets it rewritten at finish
+static void _umcwriter_track_report(transcoder_t* tc, int64_t ticks)
+{
+  if( !tc->umc.track_reports )
+    return;
+
+  if( tc->umc.report_count == tc->umc.report_alloc )
+  {
+    uint32_t alloc = tc->umc.report_alloc ? tc->umc.report_alloc*2 : 256;
+    umcwriter_report_t* reports = realloc( tc->umc.reports, alloc*sizeof(umcwriter_report_t) );
+    if( !reports )
+    {
+      tc->umc.sink_failed = true;
+      return;
+    }
+    tc->umc.reports = reports;
+    tc->umc.report_alloc = alloc;
+  }
+
+  umcwriter_report_t* r = &tc->umc.reports[tc->umc.report_count++];
+  r->index = umcwriter_get_block_index(tc);
+  r->ticks = ticks;
+}
+
+// Report blocks carry the elapsed time in seconds and additionally in ticks (pdat3/pdat4),
+// finish and append recalculate them from the ticks, finish clears the extra data.
+static void _umcwriter_set_time_marker(UP3D_BLK* pblk, int64_t ticks)
+{
+  UP3D_PROG_BLK_SetParameter(pblk,PARA_REPORT_TIME_REMAIN,(int32_t)(ticks/F_CPU));
+  pblk->pdat3.l = (int32_t)(uint32_t)ticks;
+  pblk->pdat4.l = (int32_t)(ticks>>32);
+}
+
+static int64_t _umcwriter_get_time_marker(const UP3D_BLK* pblk)
+{
+  return ((int64_t)pblk->pdat4.l<<32) | (uint32_t)pblk->pdat3.l;
 }
 
-bool umcwriter_init(const char* filename, const double heightZ, const char machine_type)
+//hand collected moves to the planner, they must be planned before anything else reads or changes planner state
+static void _umcwriter_flush_batch(transcoder_t* tc)
 {
-  umcwriter_Z = 0;
-  umcwriter_Z_height = heightZ;
-  umcwriter_print_time = 0;
-  umcwriter_machine_type = machine_type;
-  umcwriter_bed_temp = 0;
+  if( !tc->umc.batch_count )
+    return;
+
+  plan_batch_prepare(tc, tc->umc.batch, tc->umc.batch_count );
+
+  uint32_t i;
+  for( i=0; i<tc->umc.batch_count; i++ )
+  {
+    while( plan_check_full_buffer(tc) )
+    {
+      if( _umcwriter_estimate_only(tc) )
+      {
+        double t;
+        if( !st_get_next_block_time(tc, &t) )
+          break;
+        tc->umc.print_time += UMCWRITER_TICKS(t);
+        continue;
+      }
+
+      if( !_umcwriter_write_next_block(tc) )
+        break;
+    }
 
-  st_reset();
-  plan_reset();
+    plan_batch_commit(tc);
+  }
 
-  umcwriter_file = fopen(filename,"wb+");
-  if( !umcwriter_file )
+  tc->umc.batch_count = 0;
+}
+
+bool umcwriter_open(transcoder_t* tc, const char* filename, const double heightZ, const char machine_type)
+{
+  tc->umc.Z = 0;
+  tc->umc.Z_height = heightZ;
+  tc->umc.print_time = 0;
+  tc->umc.machine_type = machine_type;
+  tc->umc.bed_temp = 0;
+  tc->umc.nozzle_temp = 0;
+  tc->umc.nozzle_heat_start = -1;
+  tc->umc.feature = FEATURE_DEFAULT;
+  tc->umc.mute = false;
+  tc->umc.batch_count = 0;
+
+  st_reset(tc);
+  plan_reset(tc);
+
+  _umcwriter_release_sink(tc);
+  tc->umc.sink_failed = false;
+  tc->umc.out_index = 0;
+  tc->umc.out_count = 0;
+
+  tc->umc.file = NULL;
+  tc->umc.index_name[0] = 0;
+  if( filename && !(tc->umc.file = fopen(filename,"wb+")) ) //no filename: estimate only
     return false;
 
-  umcwriter_set_report_data( 0, 0 );
+  return true;
+}
+
+void umcwriter_close(transcoder_t* tc)
+{
+  umcwriter_planner_sync(tc);
+
+  _umcwriter_flush_out(tc);
+  if( tc->umc.file )
+    fclose( tc->umc.file );
+  tc->umc.file = NULL;
+}
+
+void umcwriter_abort(transcoder_t* tc)
+{
+  if( tc->umc.file )
+  {
+    _umcwriter_flush_out(tc);
+    fclose( tc->umc.file );
+  }
+  tc->umc.file = NULL;
+  _umcwriter_release_sink(tc);
+}
+
+static void _umcwriter_start(transcoder_t* tc)
+{
+  umcwriter_set_report_data(tc, 0, 0 );
 
   UP3D_BLK blk;
   UP3D_PROG_BLK_Power(&blk,true);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
   UP3D_PROG_BLK_Beeper(&blk,false);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   
-  umcwriter_pause(4000); //wait for power on complete and temperature measurement to stabilize
+  umcwriter_pause(tc, 4000); //wait for power on complete and temperature measurement to stabilize
 
   UP3D_PROG_BLK_SetParameter(&blk,0x41,0);              //TEMP FOR NOZZLE1 TEMP REACHED
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   UP3D_PROG_BLK_SetParameter(&blk,0x42,0);              //TEMP FOR NOZZLE2 TEMP REACHED
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   UP3D_PROG_BLK_SetParameter(&blk,0x43,0);              //TEMP FOR BED TEMP REACHED
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
 // NEEDED?
   UP3D_PROG_BLK_SetParameter(&blk,0x46,13);               //?
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
-  if( 'm' == umcwriter_machine_type )
+  if( 'm' == tc->umc.machine_type )
   {
     UP3D_PROG_BLK_SetParameter(&blk,0x49,80);           //? for up mini only!
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
   }
 
   //home all axis (needed for correct print status
-  umcwriter_home(0);
-  umcwriter_home(1);
-  umcwriter_home(2);
+  umcwriter_home(tc, 0);
+  umcwriter_home(tc, 1);
+  umcwriter_home(tc, 2);
 
   UP3D_PROG_BLK_SetParameter(&blk,PARA_PRINT_STATUS,1); //initialized
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   UP3D_PROG_BLK_SetParameter(&blk,0x11,0);              //no support
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
 // NEEDED ?
   UP3D_PROG_BLK_SetParameter(&blk,0x35,0);              //needed for heat bed!
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 //  UP3D_PROG_BLK_SetParameter(&blk,0x36,103);            //feedback length ?
 //  _umcwriter_write_file(&blk, 1);
 
@@ -107,7 +279,7 @@ bool umcwriter_init(const char* filename, const double heightZ, const char machi
 //  _umcwriter_write_file(&blk, 1);
 
   UP3D_PROG_BLK_SetParameter(&blk,0x17,0);              //nozzle #1 not open
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
 // PROBLEM...
 //  UP3D_PROG_BLK_SetParameter(&blk,PARA_PRINT_STATUS,2); //running ==> PAUSED ???
@@ -116,9 +288,9 @@ bool umcwriter_init(const char* filename, const double heightZ, const char machi
 
 // NEEDED?
   UP3D_PROG_BLK_SetParameter(&blk,0x82,255);            //?
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   UP3D_PROG_BLK_SetParameter(&blk,0x83,255);            //?
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   //DEL UP3D_PROG_BLK_SetParameter(&blk,0x1D,100000);         //feed error length
   //DEL _umcwriter_write_file(&blk, 1);
 
@@ -127,27 +299,82 @@ bool umcwriter_init(const char* filename, const double heightZ, const char machi
   UP3D_PROG_BLK_SetParameter(&blk,0x1C,1);              //printing...
   _umcwriter_write_file(&blk, 1);
 */
+}
+
+bool umcwriter_init(transcoder_t* tc, const char* filename, const double heightZ, const char machine_type)
+{
+  if( !umcwriter_open(tc, filename, heightZ, machine_type) )
+    return false;
+  if( filename )
+    umcindex_name(tc->umc.index_name, sizeof(tc->umc.index_name), filename);
+
+  _umcwriter_start(tc);
   return true;
 }
 
-void umcwriter_finish()
+void umcwriter_init_sink(transcoder_t* tc, umcwriter_sink_t sink, umcwriter_sink_t patch, void* user, const double heightZ, const char machine_type)
+{
+  umcwriter_open(tc, NULL, heightZ, machine_type);
+  tc->umc.sink = sink;
+  tc->umc.patch = patch;
+  tc->umc.sink_user = user;
+  tc->umc.track_reports = (patch != NULL);
+
+  _umcwriter_start(tc);
+}
+
+bool umcwriter_sink_failed(transcoder_t* tc)
 {
-  umcwriter_planner_sync();
+  return tc->umc.sink_failed;
+}
+
+static void _umcwriter_patch_reports(transcoder_t* tc)
+{
+  _umcwriter_flush_out(tc);
+
+  UP3D_BLK blk;
+  uint32_t i;
+  for( i=0; (i<tc->umc.report_count) && !tc->umc.sink_failed; i++ )
+  {
+    const umcwriter_report_t* r = &tc->umc.reports[i];
+    UP3D_PROG_BLK_SetParameter(&blk,PARA_REPORT_TIME_REMAIN,(int32_t)((tc->umc.print_time - r->ticks)/F_CPU));
+    tc->umc.sink_failed = !tc->umc.patch( tc->umc.sink_user, (uint32_t)r->index, &blk, 1 );
+    UP3D_PROG_BLK_SetParameter(&blk,PARA_REPORT_PERCENT,(int32_t)((r->ticks*100)/tc->umc.print_time));
+    if( !tc->umc.sink_failed )
+      tc->umc.sink_failed = !tc->umc.patch( tc->umc.sink_user, (uint32_t)r->index+1, &blk, 1 );
+  }
+}
+
+void umcwriter_finish(transcoder_t* tc)
+{
+  umcwriter_planner_sync(tc);
+
+  tc->umc.print_time += UMCWRITER_TICKS(1.5); //1.5 seconds for end of job
 
-  umcwriter_print_time += 1.5; //1.5 seconds for end of job
+  umcwriter_beep(tc, 200);umcwriter_pause(tc, 200);
+  umcwriter_beep(tc, 200);umcwriter_pause(tc, 200);
+  umcwriter_beep(tc, 200);umcwriter_pause(tc, 500);
 
-  umcwriter_beep(200);umcwriter_pause(200);
-  umcwriter_beep(200);umcwriter_pause(200);
-  umcwriter_beep(200);umcwriter_pause(500);
+  if( _umcwriter_estimate_only(tc) )
+    return;
 
   UP3D_BLK blk;
 
-  //post process time and perecent values
-  rewind( umcwriter_file );
-  double time = 0;
-  for(;;)
+  //post process time and perecent values, the layer index is collected on the way
+  if( tc->umc.sink )
+    _umcwriter_patch_reports(tc);
+  else
+  {
+    _umcwriter_flush_out(tc);
+    rewind( tc->umc.file );
+  }
+  umcindex_t idx;
+  umcindex_init(&idx, &tc->settings);
+  uint64_t index = 0;
+  int64_t time = 0;
+  while( tc->umc.file )
   {
-    if( fread( &blk, sizeof(UP3D_BLK), 1, umcwriter_file ) <= 0 )
+    if( fread( &blk, sizeof(UP3D_BLK), 1, tc->umc.file ) <= 0 )
       break;
 
     if( UP3DPCMD_SetParameter == blk.pcmd )
@@ -155,112 +382,228 @@ void umcwriter_finish()
       bool change = false;
       if( PARA_REPORT_TIME_REMAIN == blk.pdat1.l )
       {
-        time = blk.pdat2.l;
-        blk.pdat2.l = (int32_t)(umcwriter_print_time - time);
+        time = _umcwriter_get_time_marker(&blk);
+        blk.pdat2.l = (int32_t)((tc->umc.print_time - time)/F_CPU);
+        blk.pdat3.l = blk.pdat4.l = 0;
         change=true;
       }
       if( PARA_REPORT_PERCENT == blk.pdat1.l )
       {
-        blk.pdat2.l = (time*100)/umcwriter_print_time;
+        blk.pdat2.l = (int32_t)((time*100)/tc->umc.print_time);
         change=true;
       }
 
       if( change )
       {
-        fseek( umcwriter_file, -sizeof(UP3D_BLK), SEEK_CUR );
-        fwrite( &blk, sizeof(UP3D_BLK), 1, umcwriter_file );
-        fseek( umcwriter_file, 0, SEEK_CUR ); //workaround for windows bug
+        fseek( tc->umc.file, -sizeof(UP3D_BLK), SEEK_CUR );
+        fwrite( &blk, sizeof(UP3D_BLK), 1, tc->umc.file );
+        fseek( tc->umc.file, 0, SEEK_CUR ); //workaround for windows bug
       }
     }
+    umcindex_add(&idx, &blk, index++, time);
   }
 
   UP3D_PROG_BLK_SetParameter(&blk,PARA_REPORT_PERCENT,100);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   UP3D_PROG_BLK_SetParameter(&blk,PARA_REPORT_TIME_REMAIN,0);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
   UP3D_PROG_BLK_Power(&blk,false);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
   UP3D_PROG_BLK_SetParameter(&blk,0x1C,0); //not printing...
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
   UP3D_PROG_BLK_SetParameter(&blk,PARA_PRINT_STATUS,0); //not ready
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
   UP3D_PROG_BLK_Stop(&blk);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
+
+  _umcwriter_flush_out(tc);
+  if( tc->umc.sink )
+  {
+    _umcwriter_release_sink(tc);
+    return;
+  }
+
+  if( tc->umc.index_name[0] && !umcindex_write(&idx, tc->umc.index_name, tc->umc.out_index, tc->umc.print_time) )
+    remove( tc->umc.index_name ); //no stale index of an older output
+  umcindex_free(&idx);
+
+  fclose( tc->umc.file );
+  tc->umc.file = NULL;
+}
+
+void umcwriter_track_reports(transcoder_t* tc)
+{
+  tc->umc.track_reports = true;
+}
+
+const umcwriter_report_t* umcwriter_get_reports(transcoder_t* tc, uint32_t* count)
+{
+  *count = tc->umc.report_count;
+  return tc->umc.reports;
+}
+
+uint64_t umcwriter_get_block_index(transcoder_t* tc)
+{
+  return tc->umc.out_index + tc->umc.out_count;
+}
+
+bool umcwriter_splice(transcoder_t* tc, FILE* from, uint64_t count, const int64_t* report_ticks, uint32_t report_count, int64_t ticks)
+{
+  umcwriter_planner_sync(tc);
+
+  UP3D_BLK blk;
+  uint32_t r = 0;
+  for( ; count; count-- )
+  {
+    if( 1 != fread( &blk, sizeof(UP3D_BLK), 1, from ) )
+      return false;
+    if( (UP3DPCMD_SetParameter == blk.pcmd) && (PARA_REPORT_TIME_REMAIN == blk.pdat1.l) )
+    {
+      if( r == report_count )
+        return false;
+      int64_t t = tc->umc.print_time + report_ticks[r++];
+      _umcwriter_track_report(tc, t);
+      _umcwriter_set_time_marker( &blk, t );
+    }
+    _umcwriter_write_file(tc, &blk, 1);
+  }
+
+  tc->umc.print_time += ticks;
+  return r == report_count;
+}
+
+int32_t umcwriter_get_print_time(transcoder_t* tc)
+{
+  return (int32_t)(tc->umc.print_time/F_CPU);
+}
+
+int64_t umcwriter_get_print_ticks(transcoder_t* tc)
+{
+  return tc->umc.print_time;
+}
+
+bool umcwriter_append(transcoder_t* tc, const char* filename, int64_t ticks)
+{
+  umcwriter_planner_sync(tc);
+
+  FILE* f = fopen(filename,"rb");
+  if( !f )
+    return false;
+
+  UP3D_BLK blk;
+  while( 1 == fread( &blk, sizeof(UP3D_BLK), 1, f ) )
+  {
+    if( (UP3DPCMD_SetParameter == blk.pcmd) && (PARA_REPORT_TIME_REMAIN == blk.pdat1.l) )
+      _umcwriter_set_time_marker( &blk, tc->umc.print_time + _umcwriter_get_time_marker(&blk) );
+    _umcwriter_write_file(tc, &blk, 1);
+  }
+  fclose( f );
+
+  tc->umc.print_time += ticks;
+  return true;
+}
+
+void umcwriter_set_mute(transcoder_t* tc, bool mute)
+{
+  tc->umc.mute = mute;
+}
 
-  fclose( umcwriter_file );
-  umcwriter_file = NULL;
+void umcwriter_get_state(transcoder_t* tc, umcwriter_state_t* state)
+{
+  _umcwriter_flush_batch(tc);
+
+  state->Z = tc->umc.Z;
+  state->bed_temp = tc->umc.bed_temp;
+  state->nozzle_temp = tc->umc.nozzle_temp;
+  state->nozzle_heat_start = tc->umc.nozzle_heat_start;
+  state->feature = tc->umc.feature;
+  plan_get_position(tc, state->position);
 }
 
-int32_t umcwriter_get_print_time()
+void umcwriter_set_state(transcoder_t* tc, const umcwriter_state_t* state)
 {
-  return (int32_t)umcwriter_print_time;
+  umcwriter_planner_sync(tc);
+
+  tc->umc.Z = state->Z;
+  tc->umc.bed_temp = state->bed_temp;
+  tc->umc.nozzle_temp = state->nozzle_temp;
+  tc->umc.nozzle_heat_start = state->nozzle_heat_start;
+  umcwriter_set_feature(tc, state->feature);
+
+  double pos[3];
+  memcpy( pos, state->position, sizeof(pos) );
+  plan_set_position(tc, pos);
+  st_reset(tc);
 }
 
-void umcwriter_home(int32_t axes)
+void umcwriter_home(transcoder_t* tc, int32_t axes)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_HOME, .i=axes);
+  umcwriter_planner_sync(tc);
 
   double pos[3];
-  plan_get_position(pos);
+  plan_get_position(tc, pos);
 
-  umcwriter_print_time += 3; //apx. 3 seconds for homing of one axis
+  tc->umc.print_time += UMCWRITER_TICKS(3); //apx. 3 seconds for homing of one axis
   
   UP3D_BLK blk;
   
   switch( axes )
   {
     case 0:
-      UP3D_PROG_BLK_Home( &blk, settings.y_axes, settings.y_dir, settings.y_hofs_hi, settings.y_hspeed_hi );
-      _umcwriter_write_file(&blk, 1);
-      UP3D_PROG_BLK_Home( &blk, settings.y_axes, settings.y_dir, settings.y_hofs_lo, settings.y_hspeed_lo );
-      _umcwriter_write_file(&blk, 1);
-      pos[settings.y_axes] = 0;
+      UP3D_PROG_BLK_Home( &blk, tc->settings.y_axes, tc->settings.y_dir, tc->settings.y_hofs_hi, tc->settings.y_hspeed_hi );
+      _umcwriter_write_file(tc, &blk, 1);
+      UP3D_PROG_BLK_Home( &blk, tc->settings.y_axes, tc->settings.y_dir, tc->settings.y_hofs_lo, tc->settings.y_hspeed_lo );
+      _umcwriter_write_file(tc, &blk, 1);
+      pos[tc->settings.y_axes] = 0;
       break;
       
     case 1:
-      UP3D_PROG_BLK_Home( &blk, settings.x_axes, settings.x_dir, settings.x_hofs_hi, settings.x_hspeed_hi );
-      _umcwriter_write_file(&blk, 1);
-      UP3D_PROG_BLK_Home( &blk, settings.x_axes, settings.x_dir, settings.x_hofs_lo, settings.x_hspeed_lo );
-      _umcwriter_write_file(&blk, 1);
-      pos[settings.x_axes] = 0;
+      UP3D_PROG_BLK_Home( &blk, tc->settings.x_axes, tc->settings.x_dir, tc->settings.x_hofs_hi, tc->settings.x_hspeed_hi );
+      _umcwriter_write_file(tc, &blk, 1);
+      UP3D_PROG_BLK_Home( &blk, tc->settings.x_axes, tc->settings.x_dir, tc->settings.x_hofs_lo, tc->settings.x_hspeed_lo );
+      _umcwriter_write_file(tc, &blk, 1);
+      pos[tc->settings.x_axes] = 0;
       break;
       
     case 2:
-      UP3D_PROG_BLK_Home( &blk, UP3DAXIS_Z, settings.z_dir, settings.z_hofs_hi, settings.z_hspeed_hi );
-      _umcwriter_write_file(&blk, 1);
-      UP3D_PROG_BLK_Home( &blk, UP3DAXIS_Z, settings.z_dir, settings.z_hofs_lo, settings.z_hspeed_lo );
-      _umcwriter_write_file(&blk, 1);
-      umcwriter_Z = 0;
+      UP3D_PROG_BLK_Home( &blk, UP3DAXIS_Z, tc->settings.z_dir, tc->settings.z_hofs_hi, tc->settings.z_hspeed_hi );
+      _umcwriter_write_file(tc, &blk, 1);
+      UP3D_PROG_BLK_Home( &blk, UP3DAXIS_Z, tc->settings.z_dir, tc->settings.z_hofs_lo, tc->settings.z_hspeed_lo );
+      _umcwriter_write_file(tc, &blk, 1);
+      tc->umc.Z = 0;
       break;
   }
 
-  umcwriter_planner_set_position( pos[settings.x_axes], pos[settings.y_axes], umcwriter_Z );
+  umcwriter_planner_set_position(tc, pos[tc->settings.x_axes], pos[tc->settings.y_axes], tc->umc.Z );
 }
 
-void umcwriter_virtual_home(double speedX, double speedY, double speedZ)
+void umcwriter_virtual_home(transcoder_t* tc, double speedX, double speedY, double speedZ)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_VIRTUAL_HOME, .d={speedX,speedY,speedZ});
+  umcwriter_planner_sync(tc);
 
-  umcwriter_print_time += 5; //apx. 5 seconds for virtual homeing
+  tc->umc.print_time += UMCWRITER_TICKS(5); //apx. 5 seconds for virtual homeing
 
   double speed[2];
-  speed[settings.x_axes] = min(speedX,settings.max_rate[settings.x_axes]*60.0 );
-  speed[settings.y_axes] = min(speedY,settings.max_rate[settings.y_axes]*60.0 );
+  speed[tc->settings.x_axes] = min(speedX,tc->settings.max_rate[tc->settings.x_axes]*60.0 );
+  speed[tc->settings.y_axes] = min(speedY,tc->settings.max_rate[tc->settings.y_axes]*60.0 );
   speedZ = min( speedZ, 50.0*60.0 );
 
   UP3D_BLK blks[2];
   UP3D_PROG_BLK_MoveF( blks, -speed[0],0, -speed[1],0, -speedZ,0, 0,0);
-  _umcwriter_write_file( blks, 2);
-  umcwriter_planner_set_position(0,0,0);
+  _umcwriter_write_file(tc, blks, 2);
+  umcwriter_planner_set_position(tc, 0,0,0);
 }
 
-void umcwriter_move_direct(double X, double Y, double Z, double A, double F)
+void umcwriter_move_direct(transcoder_t* tc, double X, double Y, double Z, double A, double F)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_MOVE_DIRECT, .d={X,Y,Z,A,F});
+  umcwriter_planner_sync(tc);
 
   double feedX = F;
   double feedY = F;
@@ -268,92 +611,106 @@ void umcwriter_move_direct(double X, double Y, double Z, double A, double F)
   double feedA = F;
 
   double pos[3];
-  plan_get_position(pos);
+  plan_get_position(tc, pos);
   double relA = A-pos[A_AXIS];
 
   double tX = fabs(X+pos[1])/feedX;
   double tY = fabs(Y-pos[0])/feedY;
-  double tZ = fabs(umcwriter_Z_height-Z-umcwriter_Z)/feedZ;
+  double tZ = fabs(tc->umc.Z_height-Z-tc->umc.Z)/feedZ;
   //double tA = fabs(relA)/feedA;
 
   double t=0;
   if(tX>t) t=tX; if(tY>t) t=tY; if(tZ>t) t=tZ;
-  umcwriter_print_time += t;
+  tc->umc.print_time += UMCWRITER_TICKS(t);
 
   double topos[2];
-  topos[settings.x_axes] = X * settings.x_dir;
-  topos[settings.y_axes] = Y * settings.y_dir;
+  topos[tc->settings.x_axes] = X * tc->settings.x_dir;
+  topos[tc->settings.y_axes] = Y * tc->settings.y_dir;
 
   double feed[2];
-  feed[settings.x_axes] = feedX;
-  feed[settings.y_axes] = feedY;
+  feed[tc->settings.x_axes] = feedX;
+  feed[tc->settings.y_axes] = feedY;
 
   UP3D_BLK blks[2];
-  UP3D_PROG_BLK_MoveF( blks,-feed[0],topos[0],-feed[1],topos[1],-feedZ,-(umcwriter_Z_height-Z),feedA,relA );
-  _umcwriter_write_file(blks, 2);
+  UP3D_PROG_BLK_MoveF( blks,-feed[0],topos[0],-feed[1],topos[1],-feedZ,-(tc->umc.Z_height-Z),feedA,relA );
+  _umcwriter_write_file(tc, blks, 2);
 
-  umcwriter_planner_set_position(X,Y,A);
-  umcwriter_Z = Z;
+  umcwriter_planner_set_position(tc, X,Y,A);
+  tc->umc.Z = Z;
 }
 
-void umcwriter_planner_set_position(double X, double Y, double A)
+void umcwriter_planner_set_position(transcoder_t* tc, double X, double Y, double A)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_SET_POSITION, .d={X,Y,A});
+  umcwriter_planner_sync(tc);
   double pos[3];
-  pos[settings.x_axes] = X * settings.x_dir;
-  pos[settings.y_axes] = Y * settings.y_dir;
+  pos[tc->settings.x_axes] = X * tc->settings.x_dir;
+  pos[tc->settings.y_axes] = Y * tc->settings.y_dir;
   pos[2] = A;
-  plan_set_position(pos);
-  st_reset();
+  plan_set_position(tc, pos);
+  st_reset(tc);
 }
 
-void umcwriter_planner_set_a_position(double A)
+void umcwriter_planner_set_a_position(transcoder_t* tc, double A)
 {
-  plan_set_e_position(A);
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_SET_A_POSITION, .d={A});
+  _umcwriter_flush_batch(tc);
+  plan_set_e_position(tc, A);
 }
 
-void umcwriter_planner_add(double X, double Y, double A, double F)
+void umcwriter_planner_add(transcoder_t* tc, double X, double Y, double A, double F)
 {
-  while( plan_check_full_buffer() )
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_PLANNER_ADD, .d={X,Y,A,F});
+  if( tc->umc.mute ) //only track the position
   {
-    segment_up3d_t *pseg;
-    if( !st_get_next_segment_up3d(&pseg) )
-      break;
-    UP3D_BLK blk;
-    UP3D_PROG_BLK_MoveL(&blk,pseg->p1,pseg->p2,pseg->p3,pseg->p4,pseg->p5,pseg->p6,pseg->p7,pseg->p8);
-    _umcwriter_write_file(&blk, 1);
+    double pos[3];
+    pos[tc->settings.x_axes] = X * tc->settings.x_dir;
+    pos[tc->settings.y_axes] = Y * tc->settings.y_dir;
+    pos[2] = A;
+    plan_set_position(tc, pos);
+    return;
   }
 
-  double pos[3];
-  pos[settings.x_axes] = X * settings.x_dir;
-  pos[settings.y_axes] = Y * settings.y_dir;
-  pos[2] = A;
-  double feed = F/60;
-  plan_buffer_line( pos, feed, false);
+  plan_line_t *line = &tc->umc.batch[tc->umc.batch_count];
+  line->target[tc->settings.x_axes] = X * tc->settings.x_dir;
+  line->target[tc->settings.y_axes] = Y * tc->settings.y_dir;
+  line->target[2] = A;
+  line->feed_rate = F/60;
+
+  if( ++tc->umc.batch_count == PLAN_BATCH_SIZE )
+    _umcwriter_flush_batch(tc);
 }
 
-void umcwriter_planner_sync()
+void umcwriter_planner_sync(transcoder_t* tc)
 {
-  segment_up3d_t *pseg;
-  for(;;)
-  {
-    while( st_get_next_segment_up3d(&pseg) )
-    {
-      umcwriter_print_time += ((double)pseg->p2*(double)pseg->p1)/F_CPU;
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_PLANNER_SYNC);
+  _umcwriter_flush_batch(tc);
 
-      UP3D_BLK blk;
-      UP3D_PROG_BLK_MoveL(&blk,pseg->p1,pseg->p2,pseg->p3,pseg->p4,pseg->p5,pseg->p6,pseg->p7,pseg->p8);
-      _umcwriter_write_file(&blk, 1);
-    }
-    
-    if( 0 == plan_get_block_buffer_count() )
-      break;
+  if( _umcwriter_estimate_only(tc) ) //take block times from velocity profiles
+  {
+    double t;
+    while( st_get_next_block_time(tc, &t) )
+      tc->umc.print_time += UMCWRITER_TICKS(t);
+    return;
   }
+
+  while( _umcwriter_write_next_block(tc) )
+    ;
+}
+
+void umcwriter_set_feature(transcoder_t* tc, feature_t feature)
+{
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_SET_FEATURE, .i=feature);
+  //no sync needed, planner blocks carry their own acceleration and junction limits
+  _umcwriter_flush_batch(tc);
+  plan_set_feature(tc, feature);
+  tc->umc.feature = feature;
 }
 
-void umcwriter_set_extruder_temp(double temp, bool wait)
+void umcwriter_set_extruder_temp(transcoder_t* tc, double temp, bool wait)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_EXTRUDER_TEMP, .d={temp}, .wait=wait);
+  umcwriter_planner_sync(tc);
 
   UP3D_BLK blk;
 
@@ -361,144 +718,207 @@ void umcwriter_set_extruder_temp(double temp, bool wait)
   {
     //TODO: always ???
     UP3D_PROG_BLK_SetParameter(&blk,0x17,1);              //nozzle #1 open
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
   }
 
   if( temp )
   {
     UP3D_PROG_BLK_SetParameter(&blk,0x41,temp);          //TEMP FOR NOZZLE1_TEMP_REACHED
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
   }
 
   UP3D_PROG_BLK_SetParameter(&blk,PARA_NOZZLE1_TEMP,temp);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   UP3D_PROG_BLK_SetParameter(&blk,PARA_HEATER_NOZZLE1_ON,(temp)?1:0);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
+
+  //remember when a cold nozzle started heating, time passed since then shortens the wait
+  if( !temp )
+    tc->umc.nozzle_heat_start = -1;
+  else if( !tc->umc.nozzle_temp )
+    tc->umc.nozzle_heat_start = tc->umc.print_time;
+  tc->umc.nozzle_temp = temp;
 
   if(wait)
   {
-    umcwriter_print_time += 120; //apx. 2 minutes
+    int64_t heat_time = UMCWRITER_TICKS(UMCWRITER_NOZZLE_HEAT_TIME);
+    if( tc->umc.nozzle_heat_start>=0 )
+      heat_time -= tc->umc.print_time - tc->umc.nozzle_heat_start;
+    if( heat_time>0 )
+      tc->umc.print_time += heat_time;
+    tc->umc.nozzle_heat_start = -1;
   
     UP3D_PROG_BLK_SetParameter(&blk,PARA_RED_BLUE_BLINK,100);
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
 
     UP3D_PROG_BLK_WaitIfNot( &blk, PARA_TEMP_REACHED_N1, 1, '=' );
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
 
     UP3D_PROG_BLK_SetParameter(&blk,PARA_RED_BLUE_BLINK,200);
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
 
-    umcwriter_set_report_data(-1,-1);
+    umcwriter_set_report_data(tc, -1,-1);
   }
 }
 
-void umcwriter_set_bed_temp(int32_t temp, bool wait)
+// Poll the bed temperature inside the printer, the calculated heat up time is only used as timeout.
+// The bed temperature parameter is a float, positive floats keep their order when compared as int.
+static void umcwriter_wait_bed_temp(transcoder_t* tc, int32_t temp, uint32_t timeoutsec)
+{
+  tc->umc.print_time += UMCWRITER_TICKS(timeoutsec); //estimate stays worst case
+
+  UP3D_BLK blks[5];
+  UP3D_PROG_BLK_SetParameter(&blks[0],PARA_COUNTER,timeoutsec);
+  UP3D_PROG_BLK_IfNotThenJmp(&blks[1],PARA_GET_BED_TEMP,0,'<',3);              //bed warm => leave loop
+  blks[1].pdat2.f = (float)temp;
+  UP3D_PROG_BLK_Pause(&blks[2],1000);
+  UP3D_PROG_BLK_AddToParam(&blks[3],PARA_COUNTER,-1);
+  UP3D_PROG_BLK_IfNotThenJmp(&blks[4],PARA_COUNTER,1,'<',-4);                  //no timeout => check again
+  _umcwriter_write_file(tc, blks, 5);
+}
+
+void umcwriter_set_bed_temp(transcoder_t* tc, int32_t temp, bool wait)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_BED_TEMP, .i=temp, .wait=wait);
+  umcwriter_planner_sync(tc);
 
   UP3D_BLK blk;
  
   if( temp )
   {
     UP3D_PROG_BLK_SetParameter(&blk,0x43,temp); //TEMP FOR BED_TEMP_REACHED
-   _umcwriter_write_file(&blk, 1);
+   _umcwriter_write_file(tc, &blk, 1);
   }
 
   UP3D_PROG_BLK_SetParameter(&blk,PARA_BED_TEMP,temp);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
   UP3D_PROG_BLK_SetParameter(&blk,PARA_HEATER_BED_ON,(temp)?1:0);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
-  if(wait && (temp>umcwriter_bed_temp) ) //only wait if new temperature is higher
+  if(wait && (temp>tc->umc.bed_temp) ) //only wait if new temperature is higher
   {
     UP3D_PROG_BLK_SetParameter(&blk,PARA_RED_BLUE_BLINK,400);
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
 
-    uint32_t waitsec = ((temp-umcwriter_bed_temp)/settings.heatbed_wait_factor)*60;
-    umcwriter_pause(waitsec*1000);
+    uint32_t waitsec = ((temp-tc->umc.bed_temp)/tc->settings.heatbed_wait_factor)*60;
+    umcwriter_wait_bed_temp(tc, temp-UMCWRITER_BED_TEMP_WINDOW, waitsec);
 
     UP3D_PROG_BLK_SetParameter(&blk,PARA_RED_BLUE_BLINK,200);
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
 
-    umcwriter_set_report_data(-1,-1);
+    umcwriter_set_report_data(tc, -1,-1);
 
-    umcwriter_bed_temp = temp;
+    tc->umc.bed_temp = temp;
   }
 }
 
-void umcwriter_set_report_data(int32_t layer, double height)
+void umcwriter_set_report_data(transcoder_t* tc, int32_t layer, double height)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_REPORT_DATA, .i=layer, .d={height});
+  umcwriter_planner_sync(tc);
 
   UP3D_BLK blk;
 
   if( layer>=0 )
   {
     UP3D_PROG_BLK_SetParameter(&blk,PARA_REPORT_LAYER,layer);
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
   }
 
   if( height>=0 )
   {
     float h = (float)height;
     UP3D_PROG_BLK_SetParameter(&blk,PARA_REPORT_HEIGHT,*((int32_t*)&h));
-    _umcwriter_write_file(&blk, 1);
+    _umcwriter_write_file(tc, &blk, 1);
   }
 
-  UP3D_PROG_BLK_SetParameter(&blk,PARA_REPORT_TIME_REMAIN,(int32_t)umcwriter_print_time);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_track_report(tc, tc->umc.print_time);
+  _umcwriter_set_time_marker(&blk, tc->umc.print_time);
+  if( tc->umc.sink )
+    blk.pdat3.l = blk.pdat4.l = 0; //ticks are kept in the report list
+  _umcwriter_write_file(tc, &blk, 1);
 
   UP3D_PROG_BLK_SetParameter(&blk,PARA_REPORT_PERCENT,0);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 }
 
-void umcwriter_pause(uint32_t msec)
+void umcwriter_pause(transcoder_t* tc, uint32_t msec)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_PAUSE, .i=(int32_t)msec);
+  umcwriter_planner_sync(tc);
 
-  umcwriter_print_time += msec/1000.0;
+  tc->umc.print_time += (int64_t)msec*(F_CPU/1000);
 
   UP3D_BLK blk;
   UP3D_PROG_BLK_Pause(&blk,msec);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 }
 
-void umcwriter_beep(uint32_t msec)
+void umcwriter_beep(transcoder_t* tc, uint32_t msec)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_BEEP, .i=(int32_t)msec);
+  umcwriter_planner_sync(tc);
 
   UP3D_BLK blk;
   UP3D_PROG_BLK_Beeper(&blk,true);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
-  umcwriter_pause(msec);
+  umcwriter_pause(tc, msec);
 
   UP3D_PROG_BLK_Beeper(&blk,false);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 }
 
-void umcwriter_user_pause()
+void umcwriter_user_pause(transcoder_t* tc)
 {
-  umcwriter_planner_sync();
+  UMCWRITER_RECORD(tc, .op=UMCWRITER_CMD_USER_PAUSE);
+  umcwriter_planner_sync(tc);
 
-  umcwriter_print_time += 2; //2 seconds for processing
+  tc->umc.print_time += UMCWRITER_TICKS(2); //2 seconds for processing
 
   UP3D_BLK blks[2];
   UP3D_PROG_BLK_MoveF( blks,150,0,150,0,10000,30,10000,0 );
-  _umcwriter_write_file(blks, 2);
+  _umcwriter_write_file(tc, blks, 2);
 
-  umcwriter_beep(500);
+  umcwriter_beep(tc, 500);
 
   UP3D_BLK blk;
   
   UP3D_PROG_BLK_SetParameter(&blk,PARA_PAUSE_PROGRAM,1);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
   UP3D_PROG_BLK_SetParameter(&blk,PARA_PRINT_STATUS,3);
-  _umcwriter_write_file(&blk, 1);
+  _umcwriter_write_file(tc, &blk, 1);
 
-  umcwriter_beep(500);
+  umcwriter_beep(tc, 500);
 
   UP3D_PROG_BLK_MoveF( blks,150,0,150,0,10000,-30,10000,0 );
-  _umcwriter_write_file(blks, 2);
+  _umcwriter_write_file(tc, blks, 2);
+}
+
+void umcwriter_init_record(transcoder_t* tc, umcwriter_record_t record, void* user)
+{
+  tc->umc.record = record;
+  tc->umc.record_user = user;
+}
+
+void umcwriter_replay(transcoder_t* tc, const umcwriter_cmd_t* cmd)
+{
+  switch( cmd->op )
+  {
+    case UMCWRITER_CMD_HOME:           umcwriter_home(tc, cmd->i); break;
+    case UMCWRITER_CMD_VIRTUAL_HOME:   umcwriter_virtual_home(tc, cmd->d[0], cmd->d[1], cmd->d[2]); break;
+    case UMCWRITER_CMD_MOVE_DIRECT:    umcwriter_move_direct(tc, cmd->d[0], cmd->d[1], cmd->d[2], cmd->d[3], cmd->d[4]); break;
+    case UMCWRITER_CMD_SET_POSITION:   umcwriter_planner_set_position(tc, cmd->d[0], cmd->d[1], cmd->d[2]); break;
+    case UMCWRITER_CMD_SET_A_POSITION: umcwriter_planner_set_a_position(tc, cmd->d[0]); break;
+    case UMCWRITER_CMD_PLANNER_ADD:    umcwriter_planner_add(tc, cmd->d[0], cmd->d[1], cmd->d[2], cmd->d[3]); break;
+    case UMCWRITER_CMD_PLANNER_SYNC:   umcwriter_planner_sync(tc); break;
+    case UMCWRITER_CMD_SET_FEATURE:    umcwriter_set_feature(tc, (feature_t)cmd->i); break;
+    case UMCWRITER_CMD_EXTRUDER_TEMP:  umcwriter_set_extruder_temp(tc, cmd->d[0], cmd->wait); break;
+    case UMCWRITER_CMD_BED_TEMP:       umcwriter_set_bed_temp(tc, cmd->i, cmd->wait); break;
+    case UMCWRITER_CMD_REPORT_DATA:    umcwriter_set_report_data(tc, cmd->i, cmd->d[0]); break;
+    case UMCWRITER_CMD_PAUSE:          umcwriter_pause(tc, (uint32_t)cmd->i); break;
+    case UMCWRITER_CMD_BEEP:           umcwriter_beep(tc, (uint32_t)cmd->i); break;
+    case UMCWRITER_CMD_USER_PAUSE:     umcwriter_user_pause(tc); break;
+  }
 }
@@ -19,24 +19,139 @@
 #ifndef umcwriter_h
 #define umcwriter_h
 
+#include "up3dconf.h"
+#include "hostplanner.h"
+#include "up3ddata.h"
+
+#include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
 
-bool    umcwriter_init(const char* filename, const double heightZ, const char machine_type);
-void    umcwriter_finish();
-int32_t umcwriter_get_print_time();
-void    umcwriter_home(int32_t axes);
-void    umcwriter_virtual_home(double speedX, double speedY,double speedZ);
-void    umcwriter_move_direct(double X, double Y, double Z, double A, double F);
-void    umcwriter_planner_set_position(double X, double Y, double A);
-void    umcwriter_planner_set_a_position(double A);
-void    umcwriter_planner_add(double X, double Y, double A, double F);
-void    umcwriter_planner_sync();
-void    umcwriter_set_extruder_temp(double temp, bool wait);
-void    umcwriter_set_bed_temp(int32_t temp, bool wait);
-void    umcwriter_set_report_data(int32_t layer, double height);
-void    umcwriter_pause(uint32_t msec);
-void    umcwriter_beep(uint32_t msec);
-void    umcwriter_user_pause();
+// Block output instead of a file: called with count blocks starting at block index of the output,
+// returns false to stop the transcode
+typedef bool (*umcwriter_sink_t)(void* user, uint32_t index, const UP3D_BLK* blks, uint32_t count);
+
+#define UMCWRITER_OUT_BLOCKS 256 // blocks collected before they are written to the file or sink
+
+// Report block of the output with its elapsed time, a sink gets it rewritten with the final time values at finish
+typedef struct {
+  uint64_t index;
+  int64_t  ticks;
+} umcwriter_report_t;
+
+// Writer calls as commands: recorded once from the parser, replayed into the writers of several machines
+typedef enum {
+  UMCWRITER_CMD_HOME = 0,
+  UMCWRITER_CMD_VIRTUAL_HOME,
+  UMCWRITER_CMD_MOVE_DIRECT,
+  UMCWRITER_CMD_SET_POSITION,
+  UMCWRITER_CMD_SET_A_POSITION,
+  UMCWRITER_CMD_PLANNER_ADD,
+  UMCWRITER_CMD_PLANNER_SYNC,
+  UMCWRITER_CMD_SET_FEATURE,
+  UMCWRITER_CMD_EXTRUDER_TEMP,
+  UMCWRITER_CMD_BED_TEMP,
+  UMCWRITER_CMD_REPORT_DATA,
+  UMCWRITER_CMD_PAUSE,
+  UMCWRITER_CMD_BEEP,
+  UMCWRITER_CMD_USER_PAUSE,
+} umcwriter_cmd_op_t;
+
+typedef struct {
+  uint8_t op;
+  bool    wait;
+  int32_t i;
+  double  d[5];
+} umcwriter_cmd_t;
+
+typedef void (*umcwriter_record_t)(void* user, const umcwriter_cmd_t* cmd);
+
+// Writer state of one transcoder
+typedef struct {
+  FILE*       file;
+  char        index_name[1040];  // layer index written by finish next to the file, "": none
+  umcwriter_sink_t sink;
+  umcwriter_sink_t patch;        // receives the rewritten report blocks, NULL: keep them as sent
+  void*       sink_user;
+  bool        sink_failed;
+  uint64_t    out_index;         // blocks written to the file or handed to the sink so far
+  UP3D_BLK    out_blks[UMCWRITER_OUT_BLOCKS];
+  uint32_t    out_count;
+  bool        track_reports;
+  umcwriter_record_t record;      // record mode, see umcwriter_init_record()
+  void*       record_user;
+  umcwriter_report_t* reports;
+  uint32_t    report_count;
+  uint32_t    report_alloc;
+  double      Z;
+  double      Z_height;
+  int64_t     print_time;        // in F_CPU ticks, sums of chunks transcoded separately stay exact
+  char        machine_type;
+  int32_t     bed_temp;
+  double      nozzle_temp;
+  int64_t     nozzle_heat_start;
+  feature_t   feature;
+  bool        mute;
+  plan_line_t batch[PLAN_BATCH_SIZE]; // moves collected for plan_batch_prepare()
+  uint32_t    batch_count;
+} umcwriter_ctx_t;
+
+// State carried from one layer to the next, planner and stepper are empty at layer changes
+typedef struct {
+  double    Z;
+  int32_t   bed_temp;
+  double    nozzle_temp;
+  int64_t   nozzle_heat_start; // print ticks when a cold nozzle was switched on, -1: none
+  feature_t feature;
+  double    position[3];       // planner position (machine axes)
+} umcwriter_state_t;
+
+// filename NULL: estimate only, no blocks are generated and print time is taken from velocity profiles.
+// A file output gets its layer index (see umcindex.h) written by finish.
+bool    umcwriter_init(transcoder_t* tc, const char* filename, const double heightZ, const char machine_type);
+void    umcwriter_init_sink(transcoder_t* tc, umcwriter_sink_t sink, umcwriter_sink_t patch, void* user, const double heightZ, const char machine_type);
+bool    umcwriter_sink_failed(transcoder_t* tc);
+void    umcwriter_finish(transcoder_t* tc);
+int32_t umcwriter_get_print_time(transcoder_t* tc);
+
+// Chunked output: open starts an output without start sequence, close ends it without end sequence
+// and time fix up. Append copies a closed chunk (transcoded for ticks print time) to the current output.
+bool    umcwriter_open(transcoder_t* tc, const char* filename, const double heightZ, const char machine_type);
+void    umcwriter_close(transcoder_t* tc);
+void    umcwriter_abort(transcoder_t* tc); // close without writing pending moves
+int64_t umcwriter_get_print_ticks(transcoder_t* tc);
+bool    umcwriter_append(transcoder_t* tc, const char* filename, int64_t ticks);
+
+// Record mode: all writer calls (as made by the parser) are handed to record instead of being executed
+void    umcwriter_init_record(transcoder_t* tc, umcwriter_record_t record, void* user);
+void    umcwriter_replay(transcoder_t* tc, const umcwriter_cmd_t* cmd);
+
+// Spliced output: copy count blocks of a finished output from the current position of from, the time
+// remaining reports in it get report_ticks (elapsed since the first block) again. ticks is the print time
+// of the blocks. Reports of the output are kept after finish with umcwriter_track_reports().
+bool    umcwriter_splice(transcoder_t* tc, FILE* from, uint64_t count, const int64_t* report_ticks, uint32_t report_count, int64_t ticks);
+void    umcwriter_track_reports(transcoder_t* tc);
+const umcwriter_report_t* umcwriter_get_reports(transcoder_t* tc, uint32_t* count);
+uint64_t umcwriter_get_block_index(transcoder_t* tc);
+
+// Mute: moves only update the position, used to scan for carried state quickly (estimate only)
+void    umcwriter_set_mute(transcoder_t* tc, bool mute);
+void    umcwriter_get_state(transcoder_t* tc, umcwriter_state_t* state);
+void    umcwriter_set_state(transcoder_t* tc, const umcwriter_state_t* state);
+
+void    umcwriter_home(transcoder_t* tc, int32_t axes);
+void    umcwriter_virtual_home(transcoder_t* tc, double speedX, double speedY,double speedZ);
+void    umcwriter_move_direct(transcoder_t* tc, double X, double Y, double Z, double A, double F);
+void    umcwriter_planner_set_position(transcoder_t* tc, double X, double Y, double A);
+void    umcwriter_planner_set_a_position(transcoder_t* tc, double A);
+void    umcwriter_planner_add(transcoder_t* tc, double X, double Y, double A, double F);
+void    umcwriter_planner_sync(transcoder_t* tc);
+void    umcwriter_set_feature(transcoder_t* tc, feature_t feature);
+void    umcwriter_set_extruder_temp(transcoder_t* tc, double temp, bool wait);
+void    umcwriter_set_bed_temp(transcoder_t* tc, int32_t temp, bool wait);
+void    umcwriter_set_report_data(transcoder_t* tc, int32_t layer, double height);
+void    umcwriter_pause(transcoder_t* tc, uint32_t msec);
+void    umcwriter_beep(transcoder_t* tc, uint32_t msec);
+void    umcwriter_user_pause(transcoder_t* tc);
 
 #endif //umcwriter_h
@@ -18,13 +18,25 @@
 
 #include "up3dconf.h"
 
-settings_t settings;
+#include <stddef.h>
+
+feature_profile_t feature_profiles[FEATURE_COUNT] = {
+  [FEATURE_DEFAULT]    = { .acceleration_scale = 1.00, .junction_deviation_scale = 1.0 },
+  [FEATURE_OUTER_WALL] = { .acceleration_scale = 0.50, .junction_deviation_scale = 0.5 },
+  [FEATURE_INNER_WALL] = { .acceleration_scale = 0.75, .junction_deviation_scale = 1.0 },
+  [FEATURE_SKIN]       = { .acceleration_scale = 0.75, .junction_deviation_scale = 1.0 },
+  [FEATURE_INFILL]     = { .acceleration_scale = 1.50, .junction_deviation_scale = 2.0 },
+  [FEATURE_SUPPORT]    = { .acceleration_scale = 1.50, .junction_deviation_scale = 2.0 },
+  [FEATURE_SKIRT]      = { .acceleration_scale = 1.25, .junction_deviation_scale = 2.0 },
+};
 
 settings_t settings_mini = { 
   .steps_per_mm = { 854.0, 854.0, 854.0 },
   .max_rate = { 200, 200, 50 },
   .acceleration = { 1500, 1500, 1500 },
+  .max_acceleration = { 1500, 1500, 1500 },
   .junction_deviation = 0.1,
+  .max_junction_deviation = 0.1,
   .x_axes =  1, .y_axes =  0,
   .x_dir  =  1, .y_dir  = -1, .z_dir  = -1,
   .x_hspeed_hi = 50.0, .y_hspeed_hi = 50.0, .z_hspeed_hi = 50.0, .x_hofs_hi =  4.0, .y_hofs_hi =  4.0, .z_hofs_hi =  6.0,
@@ -36,7 +48,9 @@ settings_t settings_classic_plus = {
   .steps_per_mm = { 644.0, 644.0, 854.0 },
   .max_rate = { 200, 200, 50 },
   .acceleration = { 1500, 1500, 1500 },
+  .max_acceleration = { 1500, 1500, 1500 },
   .junction_deviation = 0.1,
+  .max_junction_deviation = 0.1,
   .x_axes =  1, .y_axes =  0,
   .x_dir  =  1, .y_dir  = -1, .z_dir  = -1,
   .x_hspeed_hi = 50.0, .y_hspeed_hi = 50.0, .z_hspeed_hi = 50.0, .x_hofs_hi =  4.0, .y_hofs_hi =  4.0, .z_hofs_hi =  6.0,
@@ -48,7 +62,9 @@ settings_t settings_box = {
   .steps_per_mm = { 644.0, 644.0, 854.0 },
   .max_rate = { 200, 200, 50 },
   .acceleration = { 1500, 1500, 1500 },
+  .max_acceleration = { 1500, 1500, 1500 },
   .junction_deviation = 0.1,
+  .max_junction_deviation = 0.1,
   .x_axes =  1, .y_axes =  0,
   .x_dir  = -1, .y_dir  =  1, .z_dir  = -1,
   .x_hspeed_hi = 50.0, .y_hspeed_hi = 30.0, .z_hspeed_hi = 30.0, .x_hofs_hi =  4.0, .y_hofs_hi =  4.0, .z_hofs_hi =  6.0,
@@ -60,7 +76,9 @@ settings_t settings_cetus = {
   .steps_per_mm = { 160.0, 160.0, 236.0 },
   .max_rate = { 200, 200, 50 },
   .acceleration = { 1500, 1500, 1500 },
+  .max_acceleration = { 1500, 1500, 1500 },
   .junction_deviation = 0.1,
+  .max_junction_deviation = 0.1,
   .x_axes =  1, .y_axes =  0,
   .x_dir  =  1, .y_dir  = -1, .z_dir  = -1,
   .x_hspeed_hi = 50.0, .y_hspeed_hi = 50.0, .z_hspeed_hi = 50.0, .x_hofs_hi =  4.0, .y_hofs_hi =  4.0, .z_hofs_hi =  6.0,
@@ -68,3 +86,33 @@ settings_t settings_cetus = {
   .heatbed_wait_factor = 20.0,
 };
 
+const settings_t* up3dconf_get_machine_settings(const char* machinetype)
+{
+  switch( machinetype[0] )
+  {
+    case 'm': //mini
+      return &settings_mini;
+
+    case 'c': //classic
+      if( 'e' == machinetype[1] ) // cetus
+        return &settings_cetus;
+      //fall through
+    case 'p': //plus
+      return &settings_classic_plus;
+
+    case 'b': //box
+      return &settings_box;
+  }
+  return NULL;
+}
+
+void up3dconf_set_feature_limit(settings_t* settings, double acceleration)
+{
+  double factor = acceleration/settings->acceleration[X_AXIS];
+  if( factor < 1.0 )
+    factor = 1.0;
+  settings->max_acceleration[X_AXIS] = settings->acceleration[X_AXIS]*factor;
+  settings->max_acceleration[Y_AXIS] = settings->acceleration[Y_AXIS]*factor;
+  settings->max_acceleration[A_AXIS] = settings->acceleration[A_AXIS];
+  settings->max_junction_deviation = settings->junction_deviation*factor;
+}
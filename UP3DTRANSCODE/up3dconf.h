@@ -26,6 +26,21 @@
 
 //#define X_INSERT_STEP_CORRECTIONS
 
+// Planner and stepper precision. Small targets without FPU (OpenWrt routers) build with -DUP3D_FLOAT,
+// step positions stay exact integers, only speeds and times are single precision.
+// Constants in real_t expressions are written REAL(1.0) so they do not promote them to double.
+#ifdef UP3D_FLOAT
+typedef float real_t;
+#define REAL(c)      c##f
+#define real_sqrt(x) sqrtf(x)
+#define real_fabs(x) fabsf(x)
+#else
+typedef double real_t;
+#define REAL(c)      c
+#define real_sqrt(x) sqrt(x)
+#define real_fabs(x) fabs(x)
+#endif
+
 #define N_AXIS 3 // Number of axes (X,Y,A)
 
 #define X_AXIS 0 // Axis indexing value. 
@@ -38,7 +53,9 @@ typedef struct {
   double steps_per_mm[N_AXIS];
   double max_rate[N_AXIS];
   double acceleration[N_AXIS];
+  double max_acceleration[N_AXIS]; // feature profiles may raise acceleration up to it (default: acceleration)
   double junction_deviation;
+  double max_junction_deviation;   // feature profiles may raise junction deviation up to it (default: junction_deviation)
   int    x_axes;
   int    y_axes;
   int    x_dir;
@@ -59,26 +76,56 @@ typedef struct {
   double heatbed_wait_factor;
 } settings_t;
 
-extern settings_t settings;
+// State of one transcoding job, see transcoder.h
+typedef struct transcoder transcoder_t;
+
+// Feature types announced by slicers with ;TYPE: comments
+typedef enum {
+  FEATURE_DEFAULT = 0,   // unknown or no annotation, machine settings apply unchanged
+  FEATURE_OUTER_WALL,    // visible outer perimeter
+  FEATURE_INNER_WALL,    // inner perimeters and gap fill
+  FEATURE_SKIN,          // solid/top/bottom/bridge infill
+  FEATURE_INFILL,        // sparse infill
+  FEATURE_SUPPORT,       // support material and interfaces
+  FEATURE_SKIRT,         // skirt and brim
+  FEATURE_COUNT
+} feature_t;
+
+// Per feature motion overrides, scaling the machine acceleration and junction deviation (capped at
+// max_acceleration and max_junction_deviation, so scales above 1 only apply with a raised limit)
+typedef struct {
+  double acceleration_scale;
+  double junction_deviation_scale;
+} feature_profile_t;
+
+extern feature_profile_t feature_profiles[FEATURE_COUNT];
 
 extern settings_t settings_mini;
 extern settings_t settings_classic_plus;
 extern settings_t settings_box;
 extern settings_t settings_cetus;
 
+// Settings for machine type name (mini / classic / plus / box / cetus), NULL if unknown
+const settings_t* up3dconf_get_machine_settings(const char* machinetype);
+
+// Let the feature profiles raise the X/Y acceleration up to acceleration (mm/s^2) and the junction
+// deviation by the same factor. The extruder keeps its acceleration. Only for printers known to
+// handle more than the tested machine acceleration.
+void up3dconf_set_feature_limit(settings_t* settings, double acceleration);
+
 // Minimum planner junction speed. Sets the default minimum junction speed the planner plans to at
 // every buffer block junction, except for starting from rest and end of the buffer, which are always
 // zero. This value controls how fast the machine moves through junctions with no regard for acceleration
 // limits or angle between neighboring block line move directions. This is useful for machines that can't
 // tolerate the tool dwelling for a split second, i.e. 3d printers or laser cutters. If used, this value
 // should not be much greater than zero or to the minimum value necessary for the machine to work.
-#define MINIMUM_JUNCTION_SPEED 0.0 // (mm/min)
+#define MINIMUM_JUNCTION_SPEED REAL(0.0) // (mm/min)
 
 // Sets the minimum feed rate the planner will allow. Any value below it will be set to this minimum
 // value. This also ensures that a planned motion always completes and accounts for any floating-point
 // round-off errors. Although not recommended, a lower value than 1.0 mm/min will likely work in smaller
 // machines, perhaps to 0.1mm/min, but your success may vary based on multiple factors.
-#define MINIMUM_FEED_RATE 1.0 // (mm/min)
+#define MINIMUM_FEED_RATE REAL(1.0) // (mm/min)
 
 // Useful macros
 #define max(a,b) (((a) > (b)) ? (a) : (b))
@@ -0,0 +1,213 @@
+/*
+  UP3D machine code structural diff
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License.
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "up3dconf.h"
+#include "umcreader.h"
+#include "umcdiff.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <math.h>
+
+void print_usage_and_exit()
+{
+  printf("Usage: up3ddiff [-a] [-v] [-tSTEPS] machinetype a.umc b.umc\n\n");
+  printf("          -a:           print all layers (default: only changed layers)\n");
+  printf("          -v:           print the changed blocks\n");
+  printf("          -tSTEPS:      files match if every layer ends within STEPS steps (X/Y/A) at the same Z\n");
+  printf("          machinetype:  mini / classic / plus / box / cetus (steps/mm)\n");
+  printf("          a.umc b.umc:  up machine code files to compare\n\n");
+  printf("          Same/Mod/Ins/Rem: blocks of the layer aligned, modified, only in b, only in a\n");
+  printf("          dTime: time of the layer b - a, dX dY dA (steps) dZ (mm): position at the end of the layer b - a\n\n");
+  printf("          exit code 0: same blocks (-t: layers match), 1: files differ\n\n");
+  exit(0);
+}
+
+static const char* _cmd_names[] = { "?", "Stop", "SetState", "MoveF", "MoveL", "Pause", "SetParameter",
+                                     "WaitIfNot", "HomeAxis", "IfNotThenJmp", "?", "AddToParam" };
+
+static void _print_blk(char op, const UP3D_BLK* blk, uint64_t index)
+{
+  const char* name = ((blk->pcmd >= 0) && (blk->pcmd < (int32_t)(sizeof(_cmd_names)/sizeof(_cmd_names[0])))) ? _cmd_names[blk->pcmd] : "?";
+  if( UP3DPCMD_MoveF == blk->pcmd )
+    printf("  %c %10"PRIu64" %-12s %10.3f %10.3f %10.3f %10.3f\n", op, index, name, blk->pdat1.f, blk->pdat2.f, blk->pdat3.f, blk->pdat4.f);
+  else
+    printf("  %c %10"PRIu64" %-12s   %08X   %08X   %08X   %08X\n", op, index, name,
+           (uint32_t)blk->pdat1.l, (uint32_t)blk->pdat2.l, (uint32_t)blk->pdat3.l, (uint32_t)blk->pdat4.l);
+}
+
+static void _print_change(void* user, const umcdiff_layer_t* l, char op, const UP3D_BLK* a, uint64_t index_a,
+                          const UP3D_BLK* b, uint64_t index_b)
+{
+  int32_t* layer = (int32_t*)user;
+  if( *layer != l->layer )
+  {
+    printf("Layer %d:\n", l->layer);
+    *layer = l->layer;
+  }
+  if( a )
+    _print_blk( ('~'==op) ? '<' : op, a, index_a );
+  if( b )
+    _print_blk( ('~'==op) ? '>' : op, b, index_b );
+}
+
+static bool _changed(const umcdiff_layer_t* l)
+{
+  return !l->present[UMCDIFF_A] || !l->present[UMCDIFF_B] || l->modified || l->inserted || l->removed;
+}
+
+static bool _within(const umcdiff_layer_t* l, int64_t tolerance)
+{
+  if( !l->present[UMCDIFF_A] || !l->present[UMCDIFF_B] || (fabs(l->Z[UMCDIFF_B]-l->Z[UMCDIFF_A]) > UMCDIFF_Z_TOLERANCE) )
+    return false;
+  int a;
+  for( a=0; a<N_AXIS; a++ )
+    if( llabs(l->position[UMCDIFF_B][a]-l->position[UMCDIFF_A][a]) > tolerance )
+      return false;
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  bool all = false, verbose = false;
+  int64_t tolerance = -1;
+  while( (argc > 1) && ('-' == argv[1][0]) )
+  {
+    if( !strcmp(argv[1], "-a") )
+      all = true;
+    else if( !strcmp(argv[1], "-v") )
+      verbose = true;
+    else if( ('t' == argv[1][1]) && argv[1][2] )
+      tolerance = atoll(&argv[1][2]);
+    else
+      print_usage_and_exit();
+    argv++; argc--;
+  }
+  if( 4 != argc )
+    print_usage_and_exit();
+
+  const settings_t* settings = up3dconf_get_machine_settings(argv[1]);
+  if( !settings )
+  {
+    printf("ERROR: Uknown machine type: %s\n\n", argv[1]);
+    print_usage_and_exit();
+  }
+
+  umcreader_t ra, rb;
+  if( !umcreader_open(&ra, argv[2]) )
+  {
+    printf("ERROR: Could not open %s for reading\n\n", argv[2]);
+    print_usage_and_exit();
+  }
+  if( !umcreader_open(&rb, argv[3]) )
+  {
+    printf("ERROR: Could not open %s for reading\n\n", argv[3]);
+    umcreader_close(&ra);
+    print_usage_and_exit();
+  }
+
+  int32_t verbose_layer = INT32_MIN;
+  umcdiff_layer_t* layers;
+  uint32_t count;
+  bool ok = umcdiff_run(&ra, &rb, settings, verbose ? _print_change : NULL, &verbose_layer, &layers, &count);
+  umcreader_close(&ra);
+  umcreader_close(&rb);
+  if( !ok )
+  {
+    printf("ERROR: Out of memory\n\n");
+    return -1;
+  }
+  if( verbose && (INT32_MIN != verbose_layer) )
+    printf("\n");
+
+  umcdiff_layer_t total = { .present = { true, true } };
+  uint32_t n, changed = 0, outside = 0, only[2] = { 0, 0 };
+  bool header = false;
+  for( n=0; n<count; n++ )
+  {
+    const umcdiff_layer_t* l = &layers[n];
+    total.blocks[UMCDIFF_A] += l->blocks[UMCDIFF_A]; total.blocks[UMCDIFF_B] += l->blocks[UMCDIFF_B];
+    total.same += l->same; total.modified += l->modified; total.inserted += l->inserted; total.removed += l->removed;
+    total.time[UMCDIFF_A] += l->time[UMCDIFF_A]; total.time[UMCDIFF_B] += l->time[UMCDIFF_B];
+    if( !l->present[UMCDIFF_B] ) only[UMCDIFF_A]++;
+    if( !l->present[UMCDIFF_A] ) only[UMCDIFF_B]++;
+    if( _changed(l) ) changed++;
+    if( (tolerance >= 0) && !_within(l, tolerance) ) outside++;
+    if( !all && !_changed(l) )
+      continue;
+
+    if( !header )
+    {
+      printf(" Layer   Height  Blocks A  Blocks B      Same    Mod    Ins    Rem    Time A    Time B    dTime       dX       dY       dA      dZ\n");
+      header = true;
+    }
+    char blocks[2][24];
+    int s;
+    for( s=0; s<2; s++ )
+      if( l->present[s] )
+        snprintf(blocks[s], sizeof(blocks[s]), "%"PRIu64, l->blocks[s]);
+      else
+        strcpy(blocks[s], "-");
+    printf("%6d %8.3f %9s %9s %9"PRIu64" %6"PRIu64" %6"PRIu64" %6"PRIu64" %9.1f %9.1f %+8.1f",
+           l->layer, l->height, blocks[UMCDIFF_A], blocks[UMCDIFF_B], l->same, l->modified, l->inserted, l->removed,
+           l->time[UMCDIFF_A], l->time[UMCDIFF_B], l->time[UMCDIFF_B]-l->time[UMCDIFF_A]);
+    if( l->present[UMCDIFF_A] && l->present[UMCDIFF_B] )
+      printf(" %+8"PRId64" %+8"PRId64" %+8"PRId64" %+7.3f%s\n",
+             l->position[UMCDIFF_B][X_AXIS]-l->position[UMCDIFF_A][X_AXIS],
+             l->position[UMCDIFF_B][Y_AXIS]-l->position[UMCDIFF_A][Y_AXIS],
+             l->position[UMCDIFF_B][A_AXIS]-l->position[UMCDIFF_A][A_AXIS],
+             l->Z[UMCDIFF_B]-l->Z[UMCDIFF_A], l->approx ? " approx" : "");
+    else
+      printf("\n");
+  }
+  if( header )
+    printf("\n");
+
+  printf("Layers: %"PRIu32" (changed: %"PRIu32" / only in a: %"PRIu32" / only in b: %"PRIu32")\n", count, changed, only[UMCDIFF_A], only[UMCDIFF_B]);
+  printf("Blocks: %"PRIu64" -> %"PRIu64" (same: %"PRIu64" / modified: %"PRIu64" / inserted: %"PRIu64" / removed: %"PRIu64")\n",
+         total.blocks[UMCDIFF_A], total.blocks[UMCDIFF_B], total.same, total.modified, total.inserted, total.removed);
+  printf("Time: %.1fs -> %.1fs (%+.1fs, without heater waits and homing)\n", total.time[UMCDIFF_A], total.time[UMCDIFF_B],
+         total.time[UMCDIFF_B]-total.time[UMCDIFF_A]);
+  if( count )
+  {
+    const umcdiff_layer_t* a = NULL, *b = NULL;
+    for( n=0; n<count; n++ )
+    {
+      if( layers[n].present[UMCDIFF_A] ) a = &layers[n];
+      if( layers[n].present[UMCDIFF_B] ) b = &layers[n];
+    }
+    if( a && b )
+      printf("End position b - a: X %+"PRId64" Y %+"PRId64" A %+"PRId64" steps, Z %+.3fmm\n",
+             b->position[UMCDIFF_B][X_AXIS]-a->position[UMCDIFF_A][X_AXIS],
+             b->position[UMCDIFF_B][Y_AXIS]-a->position[UMCDIFF_A][Y_AXIS],
+             b->position[UMCDIFF_B][A_AXIS]-a->position[UMCDIFF_A][A_AXIS],
+             b->Z[UMCDIFF_B]-a->Z[UMCDIFF_A]);
+  }
+
+  if( tolerance >= 0 )
+    printf("Layers outside tolerance (%"PRId64" steps): %"PRIu32"\n", tolerance, outside);
+
+  free(layers);
+  if( tolerance >= 0 )
+    return outside ? 1 : 0;
+  return changed ? 1 : 0;
+}
@@ -0,0 +1,102 @@
+/*
+  UP3D machine code linker
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License.
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcreader.h"
+#include "umclink.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+void print_usage_and_exit()
+{
+  printf("Usage: up3dlink [-cTEMP] [-n] output.umc job1.umc job2.umc [...]\n\n");
+  printf("          -cTEMP:       wait until the bed is below TEMP before the next job (default: %.0f, 0: no wait)\n", UMCLINK_COOL_TEMP);
+  printf("          -n:           no pause for removal of the part between the jobs\n");
+  printf("          output.umc:   up machine code file which will be generated\n");
+  printf("          job1.umc ..:  up machine code files to print one after the other\n\n");
+  exit(0);
+}
+
+int main(int argc, char *argv[])
+{
+  umclink_interlude_t interlude = { .cool_temp = UMCLINK_COOL_TEMP, .removal_pause = true };
+
+  int a = 1;
+  for( ; (a<argc) && ('-' == argv[a][0]); a++ )
+  {
+    switch( argv[a][1] )
+    {
+      case 'c': interlude.cool_temp = atof(&argv[a][2]); break;
+      case 'n': interlude.removal_pause = false; break;
+      default:  print_usage_and_exit();
+    }
+  }
+  if( argc-a < 3 )
+    print_usage_and_exit();
+
+  const char* fname_out = argv[a++];
+  uint32_t count = argc-a;
+  umcreader_t* jobs = calloc( count, sizeof(umcreader_t) );
+  if( !jobs )
+  {
+    printf("ERROR: Out of memory\n\n");
+    return -1;
+  }
+
+  uint32_t n;
+  for( n=0; n<count; n++ )
+    if( !umcreader_open(&jobs[n], argv[a+n]) )
+    {
+      printf("ERROR: Could not open %s for reading\n\n", argv[a+n]);
+      while( n-- )
+        umcreader_close(&jobs[n]);
+      free( jobs );
+      print_usage_and_exit();
+    }
+
+  umclink_result_t res;
+  int ret = umclink_run( jobs, count, &interlude, fname_out, &res );
+  for( n=0; n<count; n++ )
+    umcreader_close(&jobs[n]);
+  free( jobs );
+
+  switch( ret )
+  {
+    case 0:
+      printf("Jobs: %"PRIu32"\n", count);
+      printf("Blocks: %"PRIu64"\n", res.blocks);
+      printf("PrintTime: %02d:%02d:%02d\n", res.time/3600, (res.time/60)%60, res.time%60);
+      return 0;
+
+    case -1:
+      printf("ERROR: Could not write %s\n\n", fname_out);
+      break;
+
+    case -2:
+      printf("ERROR: %s is no complete UMC file made by up3dtranscode\n\n", argv[a+res.failed_job]);
+      break;
+
+    default:
+      printf("ERROR: Out of memory\n\n");
+      break;
+  }
+  return -1;
+}
@@ -0,0 +1,70 @@
+/*
+  UP3D machine code loop compression
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License.
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcreader.h"
+#include "umcloop.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+void print_usage_and_exit()
+{
+  printf("Usage: up3dloop file.umc [output.umc]\n\n");
+  printf("          file.umc:     up machine code file to compress\n");
+  printf("          output.umc:   up machine code file which will be generated (default: replace file.umc)\n\n");
+  exit(0);
+}
+
+int main(int argc, char *argv[])
+{
+  if( (2 != argc) && (3 != argc) )
+    print_usage_and_exit();
+
+  umcloop_stats_t stats;
+  if( 2 == argc )
+  {
+    if( !umcloop_file( argv[1], &stats ) )
+    {
+      printf("ERROR: Could not compress %s\n\n", argv[1]);
+      print_usage_and_exit();
+    }
+  }
+  else
+  {
+    umcreader_t r;
+    if( !umcreader_open(&r, argv[1]) )
+    {
+      printf("ERROR: Could not open %s for reading\n\n", argv[1]);
+      print_usage_and_exit();
+    }
+    int ret = umcloop_run( &r, argv[2], &stats );
+    umcreader_close(&r);
+    if( ret )
+    {
+      printf("ERROR: %s\n\n", (-1==ret) ? "Could not write output" : "Out of memory");
+      print_usage_and_exit();
+    }
+  }
+
+  printf("Blocks: %"PRIu64" -> %"PRIu64" (loops: %"PRIu32" with %"PRIu32" layers)\n",
+         stats.blocks_in, stats.blocks_out, stats.loops, stats.layers);
+  return 0;
+}
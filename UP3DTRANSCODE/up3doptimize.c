@@ -0,0 +1,70 @@
+/*
+  UP3D machine code optimizer
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License.
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "umcreader.h"
+#include "umcoptimize.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+void print_usage_and_exit()
+{
+  printf("Usage: up3doptimize file.umc [output.umc]\n\n");
+  printf("          file.umc:     up machine code file to optimize\n");
+  printf("          output.umc:   up machine code file which will be generated (default: replace file.umc)\n\n");
+  exit(0);
+}
+
+int main(int argc, char *argv[])
+{
+  if( (2 != argc) && (3 != argc) )
+    print_usage_and_exit();
+
+  umcoptimize_stats_t stats;
+  if( 2 == argc )
+  {
+    if( !umcoptimize_file( argv[1], &stats ) )
+    {
+      printf("ERROR: Could not optimize %s\n\n", argv[1]);
+      print_usage_and_exit();
+    }
+  }
+  else
+  {
+    umcreader_t r;
+    if( !umcreader_open(&r, argv[1]) )
+    {
+      printf("ERROR: Could not open %s for reading\n\n", argv[1]);
+      print_usage_and_exit();
+    }
+    int ret = umcoptimize_run( &r, argv[1], argv[2], &stats );
+    umcreader_close(&r);
+    if( ret )
+    {
+      printf("ERROR: %s\n\n", (-1==ret) ? "Could not write output" : "Out of memory");
+      print_usage_and_exit();
+    }
+  }
+
+  printf("Blocks: %"PRIu64" -> %"PRIu64" (overwritten: %"PRIu64" / same value: %"PRIu64" / pauses: %"PRIu64")\n",
+         stats.blocks_in, stats.blocks_out, stats.dead, stats.same, stats.pauses);
+  return 0;
+}
@@ -0,0 +1,116 @@
+/*
+  UP3D machine code per layer profiler
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License.
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "up3dconf.h"
+#include "umcreader.h"
+#include "umcprofile.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+void print_usage_and_exit()
+{
+  printf("Usage: up3dprofile [-c] machinetype file.umc\n\n");
+  printf("          -c:           print CSV instead of a table\n");
+  printf("          machinetype:  mini / classic / plus / box / cetus (steps/mm)\n");
+  printf("          file.umc:     up machine code file to profile\n\n");
+  printf("          Micro: MoveL shorter than 1ms, Syncs: planner stops (MoveL followed by another block)\n");
+  printf("          Heat:  heater waits, estimate of the transcoder from the time remaining reports\n");
+  printf("          Feed:  average X/Y feed of the MoveL, E: filament extruded by the MoveL\n\n");
+  exit(0);
+}
+
+static void _print_layer(const umcprofile_layer_t* l, const char* name, bool csv)
+{
+  double move_time = (double)l->move_ticks/F_CPU;
+  if( csv )
+    printf("%s,%.3f,%"PRIu64",%"PRIu64",%"PRIu64",%"PRIu64",%"PRIu64",%"PRIu64",%.3f,%.3f,%.3f,%.3f,%.3f,%"PRIu64",%"PRIu64",%.3f,%.3f,%.3f\n",
+           name, (l->height<0)?0:l->height, l->first_block, l->blocks, l->moves, l->micro_moves, l->syncs, l->direct_moves,
+           umcprofile_time(l), move_time, l->direct_time, l->pause_time, l->heat_time, l->waits, l->homes,
+           l->distance, umcprofile_feed(l), l->extruded);
+  else
+    printf("%6s %8.3f %9"PRIu64" %8"PRIu64" %8"PRIu64" %7"PRIu64" %6"PRIu64" %5"PRIu64" %9.1f %9.1f %7.1f %7.1f %7.1f %5"PRIu64" %5"PRIu64" %10.1f %6.1f %9.1f\n",
+           name, (l->height<0)?0:l->height, l->first_block, l->blocks, l->moves, l->micro_moves, l->syncs, l->direct_moves,
+           umcprofile_time(l), move_time, l->direct_time, l->pause_time, l->heat_time, l->waits, l->homes,
+           l->distance, umcprofile_feed(l), l->extruded);
+}
+
+int main(int argc, char *argv[])
+{
+  bool csv = false;
+  if( (argc > 1) && !strcmp(argv[1], "-c") )
+  {
+    csv = true;
+    argv++; argc--;
+  }
+  if( 3 != argc )
+    print_usage_and_exit();
+
+  const settings_t* settings = up3dconf_get_machine_settings(argv[1]);
+  if( !settings )
+  {
+    printf("ERROR: Uknown machine type: %s\n\n", argv[1]);
+    print_usage_and_exit();
+  }
+
+  umcreader_t r;
+  if( !umcreader_open(&r, argv[2]) )
+  {
+    printf("ERROR: Could not open %s for reading\n\n", argv[2]);
+    print_usage_and_exit();
+  }
+
+  umcprofile_layer_t* layers;
+  uint32_t count;
+  if( !umcprofile_run(&r, settings, &layers, &count) )
+  {
+    printf("ERROR: Out of memory\n\n");
+    umcreader_close(&r);
+    return -1;
+  }
+  umcreader_close(&r);
+
+  if( csv )
+    printf("layer,height,first_block,blocks,movel,micro,syncs,movef,time,movel_time,movef_time,pause_time,heat_time,waits,homes,distance,feed,extruded\n");
+  else
+    printf(" Layer   Height     Block   Blocks    MoveL   Micro  Syncs MoveF   Time(s)  MoveL(s) MoveF(s) Pause(s) Heat(s) Waits Homes   Dist(mm) Feed/s     E(mm)\n");
+
+  umcprofile_layer_t total = { .height = -1 };
+  uint32_t n;
+  for( n=0; n<count; n++ )
+  {
+    const umcprofile_layer_t* l = &layers[n];
+    char name[16];
+    snprintf(name, sizeof(name), "%d", l->layer);
+    _print_layer(l, name, csv);
+
+    total.blocks += l->blocks; total.moves += l->moves; total.micro_moves += l->micro_moves; total.syncs += l->syncs;
+    total.direct_moves += l->direct_moves; total.pauses += l->pauses; total.waits += l->waits; total.homes += l->homes;
+    total.move_ticks += l->move_ticks; total.direct_time += l->direct_time; total.pause_time += l->pause_time; total.heat_time += l->heat_time;
+    total.distance += l->distance; total.extruded += l->extruded;
+  }
+  if( !csv )
+    _print_layer(&total, "Total", csv);
+
+  free(layers);
+  return 0;
+}
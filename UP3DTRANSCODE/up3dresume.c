@@ -0,0 +1,94 @@
+/*
+  UP3D machine code resume from layer
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License.
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "up3dconf.h"
+#include "umcreader.h"
+#include "umcresume.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+void print_usage_and_exit()
+{
+  printf("Usage: up3dresume machinetype file.umc layer output.umc\n\n");
+  printf("          machinetype:  mini / classic / plus / box / cetus\n");
+  printf("          file.umc:     up machine code file of the failed print\n");
+  printf("          layer:        layer to start with (1 ..)\n");
+  printf("          output.umc:   up machine code file which will be generated\n\n");
+  printf("          Remove the failed layer from the print first, the nozzle is moved down to the\n");
+  printf("          height of the layer at its start position.\n\n");
+  exit(0);
+}
+
+int main(int argc, char *argv[])
+{
+  if( 5 != argc )
+    print_usage_and_exit();
+
+  const settings_t* settings = up3dconf_get_machine_settings(argv[1]);
+  if( !settings )
+  {
+    printf("ERROR: Uknown machine type: %s\n\n", argv[1]);
+    print_usage_and_exit();
+  }
+
+  int32_t layer = atoi(argv[3]);
+  if( layer < 1 )
+  {
+    printf("ERROR: Invalid layer: %s\n\n", argv[3]);
+    print_usage_and_exit();
+  }
+
+  umcreader_t r;
+  if( !umcreader_open(&r, argv[2]) )
+  {
+    printf("ERROR: Could not open %s for reading\n\n", argv[2]);
+    print_usage_and_exit();
+  }
+
+  umcresume_result_t res;
+  int ret = umcresume_run(&r, argv[2], settings, layer, argv[4], &res);
+  umcreader_close(&r);
+
+  switch( ret )
+  {
+    case 0:
+      printf("Layer %d at block %"PRIu64" (%s), height: %.3fmm, X: %.3fmm Y: %.3fmm\n", res.layer.layer, res.layer.block,
+             res.from_index ? "index" : "scan", res.layer.Z, res.layer.position[X_AXIS], res.layer.position[Y_AXIS]);
+      printf("Blocks: %"PRIu64"\n", res.blocks);
+      printf("PrintTime: %02d:%02d:%02d\n", res.time/3600, (res.time/60)%60, res.time%60);
+      return 0;
+
+    case -1:
+      printf("ERROR: Could not write %s\n\n", argv[4]);
+      break;
+
+    case -2:
+      printf("ERROR: No layer %d in %s\n\n", layer, argv[2]);
+      break;
+
+    default:
+      printf("ERROR: Out of memory\n\n");
+      break;
+  }
+  return -1;
+}
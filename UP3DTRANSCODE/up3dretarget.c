@@ -0,0 +1,160 @@
+/*
+  UP3D nozzle height retarget
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License.
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "up3ddata.h"
+#include "umcreader.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <math.h>
+
+
+// The nozzle height only shows up in direct moves: the second block of the MoveF pair holds
+// the absolute (negative speed) Z target -(nozzleheight-Z). Relative Z moves (user pause) are
+// independent of the nozzle height and left as they are, so is virtual home: it moves X/Y to 0
+// and Z to 0 without an A speed, a direct move of the g-code always has one.
+// The nozzle height the file was made for is taken from the layer changes: the direct move to a
+// new layer is followed by the reported layer and height, height - Z target is the nozzle height.
+
+// G-code Z values have at most 4 decimals, this recovers them exactly from the float in the block
+#define RETARGET_Z_RESOLUTION 10000.0
+
+void print_usage_and_exit()
+{
+  printf("Usage: up3dretarget file.umc [oldheight] newheight\n\n");
+  printf("          file.umc:     up machine code file to change in place\n");
+  printf("          oldheight:    nozzle height file.umc was transcoded for, only checked against the file\n");
+  printf("                        (the file is not changed if it was made for another height)\n");
+  printf("          newheight:    new nozzle height (e.g. 123.60)\n\n");
+  exit(0);
+}
+
+static double retarget_round(double v)
+{
+  return round( v*RETARGET_Z_RESOLUTION )/RETARGET_Z_RESOLUTION;
+}
+
+// Z/A half of a direct move with absolute Z target, b is the X/Y half
+static bool retarget_is_direct_z(const UP3D_BLK* b)
+{
+  const UP3D_BLK* pz = b+1;
+  if( (UP3DPCMD_MoveF != pz->pcmd) || (pz->pdat1.f >= 0) )
+    return false;
+  bool virtual_home = (0 == pz->pdat3.f) && (0 == pz->pdat2.f) &&
+                      (b->pdat1.f < 0) && (0 == b->pdat2.f) && (b->pdat3.f < 0) && (0 == b->pdat4.f);
+  return !virtual_home;
+}
+
+// nozzle height from the layer changes, false if there is none or they do not agree
+static bool retarget_find_height(const umcreader_t* map, double* height)
+{
+  int64_t found = -1;
+  const UP3D_BLK* pz = NULL; //Z/A half of the last direct move, until other blocks follow
+  uint64_t b;
+  for( b=0; b<map->count; b++ )
+  {
+    const UP3D_BLK* blk = &map->blks[b];
+    if( (UP3DPCMD_MoveF == blk->pcmd) && (b+1 < map->count) )
+    {
+      pz = retarget_is_direct_z( blk ) ? &map->blks[b+1] : NULL;
+      b++;
+      continue;
+    }
+    if( pz && (UP3DPCMD_SetParameter == blk->pcmd) && (PARA_REPORT_LAYER == blk->pdat1.l) )
+      continue;
+    if( pz && (UP3DPCMD_SetParameter == blk->pcmd) && (PARA_REPORT_HEIGHT == blk->pdat1.l) )
+    {
+      int64_t h = llround( ((double)blk->pdat2.f - pz->pdat2.f)*RETARGET_Z_RESOLUTION );
+      if( (found >= 0) && (h != found) )
+      {
+        printf("ERROR: Layer changes disagree on the nozzle height (%.4fmm / %.4fmm at block %"PRIu64")\n\n",
+               found/RETARGET_Z_RESOLUTION, h/RETARGET_Z_RESOLUTION, b);
+        return false;
+      }
+      found = h;
+    }
+    pz = NULL;
+  }
+  if( found < 0 )
+  {
+    printf("ERROR: No layer change found to take the nozzle height from\n\n");
+    return false;
+  }
+  *height = found/RETARGET_Z_RESOLUTION;
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  if( (3 != argc) && (4 != argc) )
+    print_usage_and_exit();
+
+  double old_height = 0, new_height;
+  if( ((4 == argc) && (1 != sscanf(argv[2],"%lf", &old_height))) || (1 != sscanf(argv[argc-1],"%lf", &new_height)) )
+  {
+    printf("ERROR: Invalid nozzle height\n\n");
+    print_usage_and_exit();
+  }
+
+  umcreader_t map;
+  bool opened = umcreader_open_write( &map, argv[1] );
+  if( !opened || !map.count )
+  {
+    if( opened ) //empty file
+      umcreader_close( &map );
+    printf("ERROR: Could not open %s for writing\n\n", argv[1]);
+    print_usage_and_exit();
+  }
+
+  double file_height;
+  if( !retarget_find_height( &map, &file_height ) )
+  {
+    umcreader_close( &map );
+    return 1;
+  }
+  if( (4 == argc) && (retarget_round( old_height ) != file_height) )
+  {
+    printf("ERROR: %s was transcoded for nozzle height %.4fmm, not %.4fmm, it is not changed\n\n", argv[1], file_height, old_height);
+    umcreader_close( &map );
+    return 1;
+  }
+
+  uint64_t b, changed = 0;
+  for( b=0; b+1<map.count; b++ )
+  {
+    if( UP3DPCMD_MoveF != map.blks[b].pcmd )
+      continue;
+
+    bool direct = retarget_is_direct_z( &map.blks[b] );
+    UP3D_BLK* pz = &map.wblks[++b]; //second block of the pair
+    if( !direct )
+      continue;
+
+    double Z = retarget_round( file_height + pz->pdat2.f );
+    pz->pdat2.f = (float)(-(new_height-Z));
+    changed++;
+  }
+
+  umcreader_close( &map );
+
+  printf("Nozzle Height: %.2fmm -> %.2fmm / Moves: %"PRIu64"\n", file_height, new_height, changed);
+  return 0;
+}
@@ -0,0 +1,121 @@
+/*
+  UP3D machine code simulator
+  UP3DTools contributors 2026
+
+  This is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License.
+  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "up3dconf.h"
+#include "umcreader.h"
+#include "umcsim.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+void print_usage_and_exit()
+{
+  printf("Usage: up3dsim [-jN] machinetype file.umc\n\n");
+  printf("          -jN:          simulate using N threads (default: number of cpus)\n");
+  printf("          machinetype:  mini / classic / plus / box / cetus (steps/mm and limits)\n");
+  printf("          file.umc:     up machine code file to simulate\n\n");
+  printf("          exit code 2:  a MoveL is faster or accelerates more than the machine allows\n\n");
+  exit(0);
+}
+
+static const char* _format_time(char* out, size_t len, double sec)
+{
+  int t = (int)(sec+0.5);
+  int h = t/3600; t -= h*3600;
+  int m = t/60;   t -= m*60;
+  if( h )
+    snprintf(out, len, "%dh:%02dm:%02ds", h, m, t);
+  else
+    snprintf(out, len, "%02dm:%02ds", m, t);
+  return out;
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t threads = 0;
+  if( (argc > 1) && !strncmp(argv[1], "-j", 2) )
+  {
+    if( atoi(argv[1]+2) <= 0 )
+    {
+      printf("ERROR: Invalid number of threads: %s\n\n", argv[1]);
+      print_usage_and_exit();
+    }
+    threads = atoi(argv[1]+2);
+    argv++; argc--;
+  }
+  if( 3 != argc )
+    print_usage_and_exit();
+
+  const settings_t* settings = up3dconf_get_machine_settings(argv[1]);
+  if( !settings )
+  {
+    printf("ERROR: Uknown machine type: %s\n\n", argv[1]);
+    print_usage_and_exit();
+  }
+
+  umcreader_t r;
+  if( !umcreader_open(&r, argv[2]) )
+  {
+    printf("ERROR: Could not open %s for reading\n\n", argv[2]);
+    print_usage_and_exit();
+  }
+
+  umcsim_result_t res;
+  if( !umcsim_run(&r, settings, threads, &res) )
+  {
+    printf("ERROR: Out of memory\n\n");
+    umcreader_close(&r);
+    return -1;
+  }
+  umcreader_close(&r);
+
+  double move_time = (double)res.move_ticks/F_CPU;
+  char t1[32], t2[32], t3[32], t4[32];
+  printf("Blocks: %"PRIu64" / MoveL: %"PRIu64" / MoveF: %"PRIu64" / Home: %"PRIu64" / Pause: %"PRIu64" / Wait: %"PRIu64"\n",
+         res.blocks, res.moves, res.direct_moves, res.homes, res.pauses, res.waits);
+  printf("Time: %s (MoveL: %s / MoveF: %s / Pause: %s, without homing and heater waits)\n",
+         _format_time(t1, sizeof(t1), move_time+res.direct_time+res.pause_time), _format_time(t2, sizeof(t2), move_time),
+         _format_time(t3, sizeof(t3), res.direct_time), _format_time(t4, sizeof(t4), res.pause_time));
+  printf("Z: %.4fmm\n\n", res.Z);
+
+  printf("Axis   Position    Range                      Drift  MaxDrift  PeakSpeed (Block)       Over  PeakAcc (Block)          Over\n");
+  static const char axis_name[N_AXIS] = {'X','Y','A'};
+  bool over = false;
+  int axis;
+  for( axis=0; axis<N_AXIS; axis++ )
+  {
+    double spm = settings->steps_per_mm[axis];
+    char drift[32] = "       -         -";
+    if( res.drift_checks[axis] )
+      snprintf( drift, sizeof(drift), "%8"PRId64"  %8"PRId64, res.drift[axis], res.max_drift[axis] );
+    printf("%c   %10.4fmm  %9.3f ..%9.3fmm  %s  %6.1f/%-4.0fmm/s (%9"PRIu64")  %4"PRIu64"  %7.1f/%-5.0fmm/s^2 (%9"PRIu64")  %4"PRIu64"\n",
+           axis_name[axis], res.position[axis]/spm, res.min_position[axis]/spm, res.max_position[axis]/spm,
+           drift,
+           res.peak_speed[axis], settings->max_rate[axis], res.peak_speed_block[axis], res.over_speed[axis],
+           res.peak_acceleration[axis], settings->acceleration[axis], res.peak_acceleration_block[axis], res.over_acceleration[axis]);
+    over |= res.over_speed[axis] || res.over_acceleration[axis];
+  }
+  printf("\n(drift: target of an absolute move - simulated position before it in steps, last and largest,\n");
+  printf(" for a layer change this is the position error the moves of the layer before left)\n");
+
+  return over ? 2 : 0;
+}
@@ -16,10 +16,13 @@
   If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include "hostplanner.h"
-#include "hoststepper.h"
-#include "gcodeparser.h"
-#include "umcwriter.h"
+#include "transcoder.h"
+#include "layersplit.h"
+#include "fanout.h"
+#include "umccache.h"
+#include "incremental.h"
+#include "umcoptimize.h"
+#include "umcloop.h"
 
 #include <stdio.h>
 #include <stdint.h>
@@ -27,10 +30,27 @@
 #include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 
 void print_usage_and_exit()
 {
-  printf("Usage: up3dtranscode machinetype input.gcode output.umc nozzleheight\n\n");
+  printf("Usage: up3dtranscode [-p] [-aN] [-O] [-L] [-jN] [-cDIR] [-u] machinetype input.gcode output.umc nozzleheight\n");
+  printf("       up3dtranscode -e [-p] [-aN] machinetype input.gcode nozzleheight\n");
+  printf("       up3dtranscode -b [-p] [-aN] [-O] [-L] [-jN] machinetype nozzleheight input.gcode [input.gcode ...]\n");
+  printf("       up3dtranscode -m [-p] [-aN] [-O] [-L] input.gcode machinetype output.umc nozzleheight [machinetype output.umc nozzleheight ...]\n\n");
+  printf("          -p:           preheat, switch on bed and nozzle heaters together at job start\n");
+  printf("          -aN:          infill, support and skirt may accelerate up to N mm/s^2 and corner faster by the\n");
+  printf("                        same factor (default: the machine acceleration, not exceeded by any feature)\n");
+  printf("          -O:           optimize output, remove redundant blocks (see up3doptimize, not with -u)\n");
+  printf("          -L:           compress runs of equal layers into loops (see up3dloop, not with -u)\n");
+  printf("          -e:           estimate only, print height, layers and time without writing output\n");
+  printf("          -cDIR:        use transcode cache in directory DIR (g-code commands and outputs)\n");
+  printf("                        (DIR is created if it does not exist)\n");
+  printf("          -u:           update output.umc, transcode only layers changed since the last update\n");
+  printf("          -b:           batch, transcode all inputs to input.umc using one thread per input\n");
+  printf("          -m:           multiple machines, parse input once and transcode it for all machines\n");
+  printf("          -jN:          transcode using N threads, each one transcoding a range of layers\n");
+  printf("                        (batch: N threads, each one transcoding whole inputs)\n");
   printf("          machinetype:  mini / classic / plus / box / cetus\n");
   printf("          input.gcode:  g-code file from slic3r/cura/simplify\n");
   printf("          output.umc:   up machine code file which will be generated\n");
@@ -38,74 +58,338 @@ void print_usage_and_exit()
   exit(0);
 }
 
-int main(int argc, char *argv[])
+static void print_result(const char* prefix, transcoder_t* tc, int32_t print_time, double nozzle_height)
 {
-  if( 5 != argc )
-    print_usage_and_exit();
+  //build complete line first, batch threads print concurrently
+  char out[256];
+  int len = snprintf(out, sizeof(out), "%sHeight: %5.2fmm / Layer: %3d / Time: ", prefix, gcp_get_height(tc), gcp_get_layer(tc) );
+  int h = print_time/3600; if(h){len += snprintf(out+len, sizeof(out)-len, "%dh:",h); print_time -= h*3600;}
+  int m = print_time/60; len += snprintf(out+len, sizeof(out)-len, "%02dm:",m); print_time -= m*60;
+  len += snprintf(out+len, sizeof(out)-len, "%02ds",print_time);
+  snprintf(out+len, sizeof(out)-len, " / Nozzle Height: %.2fmm\n", nozzle_height);
+  fputs(out, stdout);
+}
 
-  switch( argv[1][0] )
+#define OPTIMIZE_BLOCKS 1 // -O
+#define OPTIMIZE_LOOPS  2 // -L
+
+static void optimize_output(const char* prefix, const char* fname_umc, int optimize)
+{
+  //loops first, the optimizer does not touch blocks inside loops
+  umcloop_stats_t loop_stats;
+  if( (optimize & OPTIMIZE_LOOPS) && !umcloop_file( fname_umc, &loop_stats ) )
+    printf("%sERROR: Could not compress %s\n", prefix, fname_umc);
+  umcoptimize_stats_t stats;
+  if( (optimize & OPTIMIZE_BLOCKS) && !umcoptimize_file( fname_umc, &stats ) )
+    printf("%sERROR: Could not optimize %s\n", prefix, fname_umc);
+}
+
+typedef struct {
+  const settings_t* settings;
+  char              machine_type;
+  double            nozzle_height;
+  bool              preheat;
+  int               optimize;
+  char**            inputs;
+  int               count;
+  int               next;
+  pthread_mutex_t   lock;
+} batch_t;
+
+static void batch_transcode(batch_t* batch, const char* fname_gcode)
+{
+  char fname_umc[1024];
+  const char* ext = strrchr(fname_gcode,'.');
+  int len = (ext && !strchr(ext,'/') && !strchr(ext,'\\')) ? (int)(ext-fname_gcode) : (int)strlen(fname_gcode);
+  snprintf(fname_umc, sizeof(fname_umc), "%.*s.umc", len, fname_gcode);
+
+  FILE* fgcode = fopen( fname_gcode, "r" );
+  if( !fgcode )
   {
-    case 'm': //mini
-      memcpy( &settings, &settings_mini, sizeof(settings) );
-      break;
+    printf("%s: ERROR: Could not open %s for reading\n", fname_gcode, fname_gcode);
+    return;
+  }
 
-    case 'c': //classic
-      if( 'e' == argv[1][1] ) // cetus
-      {
-        memcpy( &settings, &settings_cetus, sizeof(settings) );
-        break;
-      }
-      //fall through
-    case 'p': //plus
-      memcpy( &settings, &settings_classic_plus, sizeof(settings) );
-      break;
-  
-    case 'b': //box
-      memcpy( &settings, &settings_box, sizeof(settings) );
+  arena_t arena;
+  transcoder_t* tc = NULL;
+  int res = -2;
+  if( arena_init(&arena, TRANSCODER_ARENA_SIZE) && (tc = transcoder_create(&arena, batch->settings)) )
+    res = transcoder_run( tc, fgcode, fname_umc, batch->nozzle_height, batch->machine_type, batch->preheat );
+
+  if( res>0 )
+  {
+    umcwriter_finish(tc);
+    char prefix[1040];
+    snprintf(prefix, sizeof(prefix), "%s: ", fname_umc);
+    if( batch->optimize )
+      optimize_output(prefix, fname_umc, batch->optimize);
+    print_result(prefix, tc, umcwriter_get_print_time(tc), batch->nozzle_height);
+  }
+  else if( !res )
+  {
+    umcwriter_abort(tc);
+    printf("%s: ERROR: Invalid g-code, output is incomplete\n", fname_gcode);
+  }
+  else if( -1==res )
+    printf("%s: ERROR: Could not open %s for writing\n", fname_gcode, fname_umc);
+  else
+    printf("%s: ERROR: Out of memory\n", fname_gcode);
+
+  arena_free( &arena );
+  fclose( fgcode );
+}
+
+static void* batch_worker(void* arg)
+{
+  batch_t* batch = arg;
+  for(;;)
+  {
+    pthread_mutex_lock( &batch->lock );
+    int input = batch->next++;
+    pthread_mutex_unlock( &batch->lock );
+
+    if( input>=batch->count )
       break;
+    batch_transcode( batch, batch->inputs[input] );
+  }
+  return NULL;
+}
+
+static int multi_transcode(int argc, char *argv[], bool preheat, int optimize, double feature_limit)
+{
+  if( (argc<4) || ((argc-1)%3) || ((argc-1)/3 > FANOUT_MAX_TARGETS) )
+    print_usage_and_exit();
 
-    default:
-      printf("ERROR: Uknown machine type: %s\n\n",argv[1] );
+  fanout_target_t targets[FANOUT_MAX_TARGETS];
+  settings_t settings[FANOUT_MAX_TARGETS];
+  memset( targets, 0, sizeof(targets) );
+  uint32_t t, count = (argc-1)/3;
+  for( t=0; t<count; t++ )
+  {
+    char** arg = argv+1+3*t;
+    const settings_t* machine = up3dconf_get_machine_settings(arg[0]);
+    if( !machine )
+    {
+      printf("ERROR: Uknown machine type: %s\n\n",arg[0] );
+      print_usage_and_exit();
+    }
+    settings[t] = *machine;
+    if( feature_limit > 0 )
+      up3dconf_set_feature_limit( &settings[t], feature_limit );
+    targets[t].settings = &settings[t];
+    if( 1 != sscanf(arg[2],"%lf", &targets[t].heightZ) )
+    {
+      printf("ERROR: Invalid nozzle height: %s\n\n", arg[2]);
       print_usage_and_exit();
+    }
+    targets[t].machine_type = arg[0][0];
+    targets[t].fname_umc = arg[1];
+  }
+
+  FILE* fgcode = fopen( argv[0], "r" );
+  if( !fgcode )
+  {
+    printf("ERROR: Could not open %s for reading\n\n", argv[0]);
+    print_usage_and_exit();
   }
 
+  int res = fanout_transcode( fgcode, preheat, targets, count );
+  fclose( fgcode );
+
+  for( t=0; t<count; t++ )
+  {
+    if( targets[t].open_failed )
+      printf("ERROR: Could not open %s for writing\n\n", targets[t].fname_umc);
+    else if( res>0 )
+    {
+      char prefix[1040];
+      snprintf(prefix, sizeof(prefix), "%s: ", targets[t].fname_umc);
+      if( optimize )
+        optimize_output(prefix, targets[t].fname_umc, optimize);
+      print_result(prefix, targets[t].tc, umcwriter_get_print_time(targets[t].tc), targets[t].heightZ);
+    }
+    arena_free( &targets[t].arena );
+  }
+  if( -2==res )
+    printf("ERROR: Out of memory\n\n");
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  bool preheat = false;
+  bool estimate = false;
+  bool batchmode = false;
+  bool multimode = false;
+  bool update = false;
+  int  optimize = 0;
+  double feature_limit = 0;
+  const char* cachedir = NULL;
+  int  jobs = 0;
+
+  for( ; (argc>1) && ('-'==argv[1][0]) && argv[1][1]; argc--, argv++ )
+  {
+    switch( argv[1][1] )
+    {
+      case 'p': preheat = true; break;
+      case 'e': estimate = true; break;
+      case 'b': batchmode = true; break;
+      case 'm': multimode = true; break;
+      case 'u': update = true; break;
+      case 'O': optimize |= OPTIMIZE_BLOCKS; break;
+      case 'L': optimize |= OPTIMIZE_LOOPS; break;
+      case 'a':
+        if( (1 != sscanf(argv[1]+2,"%lf", &feature_limit)) || (feature_limit <= 0) )
+        {
+          printf("ERROR: Invalid acceleration: %s\n\n",argv[1] );
+          print_usage_and_exit();
+        }
+        break;
+      case 'c':
+        cachedir = argv[1]+2;
+        if( !*cachedir )
+        {
+          printf("ERROR: Missing cache directory: %s\n\n",argv[1] );
+          print_usage_and_exit();
+        }
+        break;
+      case 'j':
+        jobs = atoi(argv[1]+2);
+        if( jobs<1 )
+        {
+          printf("ERROR: Invalid number of jobs: %s\n\n",argv[1] );
+          print_usage_and_exit();
+        }
+        break;
+      default:
+        printf("ERROR: Unknown option: %s\n\n",argv[1] );
+        print_usage_and_exit();
+    }
+  }
+
+  if( multimode )
+    return multi_transcode(argc-1, argv+1, preheat, optimize, feature_limit);
+
+  if( batchmode ? (argc<4) : ((estimate?4:5) != argc) )
+    print_usage_and_exit();
+
+  const settings_t* machine = up3dconf_get_machine_settings(argv[1]);
+  if( !machine )
+  {
+    printf("ERROR: Uknown machine type: %s\n\n",argv[1] );
+    print_usage_and_exit();
+  }
+  settings_t machine_settings = *machine;
+  if( feature_limit > 0 )
+    up3dconf_set_feature_limit( &machine_settings, feature_limit );
+  const settings_t* settings = &machine_settings;
+
+  const char* nozzle_arg = batchmode?argv[2]:argv[argc-1];
   double nozzle_height;
-  if( 1 != sscanf(argv[4],"%lf", &nozzle_height) )
+  if( 1 != sscanf(nozzle_arg,"%lf", &nozzle_height) )
   {
-    printf("ERROR: Invalid nozzle height: %s\n\n", argv[4]);
+    printf("ERROR: Invalid nozzle height: %s\n\n", nozzle_arg);
     print_usage_and_exit();
   }
 
-  FILE* fgcode = fopen( argv[2], "r" );
-  if( !fgcode )
+  if( batchmode )
   {
-    printf("ERROR: Could not open %s for reading\n\n", argv[2]);
+    batch_t batch = { .settings = settings, .machine_type = argv[1][0], .nozzle_height = nozzle_height,
+                      .preheat = preheat, .optimize = optimize, .inputs = argv+3, .count = argc-3, .next = 0 };
+    pthread_mutex_init( &batch.lock, NULL );
+
+    int threads = (jobs && (jobs<batch.count)) ? jobs : batch.count;
+    pthread_t* workers = calloc( threads, sizeof(pthread_t) );
+    int t, started = 0;
+    for( t=0; workers && (t<threads); t++ )
+      if( !pthread_create( &workers[started], NULL, batch_worker, &batch ) )
+        started++;
+    if( !started )
+      batch_worker( &batch );
+    for( t=0; t<started; t++ )
+      pthread_join( workers[t], NULL );
+
+    free( workers );
+    pthread_mutex_destroy( &batch.lock );
+    return 0;
+  }
+
+  const char* fname_gcode = argv[2];
+  const char* fname_umc   = estimate?NULL:argv[3];
+
+  if( cachedir && !umccache_dir( cachedir ) )
+  {
+    printf("ERROR: Could not create or write to cache directory %s\n\n", cachedir);
     print_usage_and_exit();
   }
 
-  if( !umcwriter_init( argv[3], nozzle_height, argv[1][0] ) )
+  FILE* fgcode = fopen( fname_gcode, "r" );
+  if( !fgcode )
   {
-    printf("ERROR: Could not open %s for writing\n\n", argv[3]);
+    printf("ERROR: Could not open %s for reading\n\n", fname_gcode);
     print_usage_and_exit();
   }
 
-  gcp_reset();
+  arena_t arena;
+  transcoder_t* tc;
+  if( !arena_init(&arena, TRANSCODER_ARENA_SIZE) || !(tc = transcoder_create(&arena, settings)) )
+  {
+    printf("ERROR: Out of memory\n\n");
+    return 0;
+  }
+
+  umccache_key_t key;
+  umccache_result_t cached;
+  //an output taken from the cache would not match its update checkpoint
+  bool cache = cachedir && fname_umc && !update && umccache_key( &key, fgcode, settings, nozzle_height, argv[1][0], preheat );
+  if( cache && umccache_get_umc( cachedir, &key, fname_umc, &cached ) )
+  {
+    fclose( fgcode );
+    gcp_set_state( tc, &cached.gcp );
+    if( optimize )
+      optimize_output("", fname_umc, optimize);
+    print_result("", tc, (int32_t)(cached.print_ticks/F_CPU), nozzle_height);
+    arena_free( &arena );
+    return 0;
+  }
+
+  int res;
+  update = update && fname_umc;
+  if( update )
+    res = incremental_transcode( tc, fgcode, fname_umc, nozzle_height, argv[1][0], preheat );
+  else if( (jobs>1) && fname_umc )
+    res = layersplit_transcode( tc, fgcode, fname_umc, nozzle_height, argv[1][0], preheat, jobs );
+  else if( cache )
+    res = umccache_transcode( tc, cachedir, &key, fgcode, fname_umc, nozzle_height, argv[1][0], preheat );
+  else
+    res = transcoder_run( tc, fgcode, fname_umc, nozzle_height, argv[1][0], preheat );
 
-  char line[1024];
-  while( fgets(line,sizeof(line),fgcode) )
-    if( !gcp_process_line(line) )
-      return 0;
+  if( res<0 )
+  {
+    printf("ERROR: Could not open %s for writing\n\n", fname_umc);
+    print_usage_and_exit();
+  }
+  if( !res )
+    return 0;
 
-  umcwriter_finish();
-  int32_t print_time = umcwriter_get_print_time();
+  if( !update )
+    umcwriter_finish(tc);
 
   fclose( fgcode );
 
-  printf("Height: %5.2fmm / Layer: %3d / Time: ", gcp_get_height(), gcp_get_layer() );
-  int h = print_time/3600; if(h){printf("%dh:",h); print_time -= h*3600;}
-  int m = print_time/60; printf("%02dm:",m); print_time -= m*60;
-  printf("%02ds",print_time);
-  printf(" / Nozzle Height: %.2fmm\n", nozzle_height);
+  if( cache )
+  {
+    cached.print_ticks = umcwriter_get_print_ticks(tc);
+    gcp_get_state( tc, &cached.gcp );
+    umccache_put_umc( cachedir, &key, fname_umc, &cached );
+  }
+
+  //an optimized output would not match the checkpoint of the next update
+  if( optimize && !update && fname_umc )
+    optimize_output("", fname_umc, optimize);
+
+  print_result("", tc, umcwriter_get_print_time(tc), nozzle_height);
 
+  arena_free( &arena );
   return 0;
 }
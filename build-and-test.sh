@@ -48,6 +48,9 @@ cd ..
 
 cd UP3DTRANSCODE
 bash make.sh
+if [ "_$TRAVIS_OS_NAME" = "_linux" ]; then
+    bash regress.sh #golden hashes are made with gcc on linux
+fi
 cd ..
 
 
@@ -64,6 +67,14 @@ if [ "$OSTYPE" == "msys" ]; then
     cp UP3DTOOLS/up3dload.exe $DESTDIR
     cp UP3DTOOLS/up3dshell.exe $DESTDIR
     cp UP3DTRANSCODE/up3dtranscode.exe $DESTDIR
+    cp UP3DTRANSCODE/up3dretarget.exe $DESTDIR
+    cp UP3DTRANSCODE/up3dsim.exe $DESTDIR
+    cp UP3DTRANSCODE/up3dprofile.exe $DESTDIR
+    cp UP3DTRANSCODE/up3dresume.exe $DESTDIR
+    cp UP3DTRANSCODE/up3doptimize.exe $DESTDIR
+    cp UP3DTRANSCODE/up3dloop.exe $DESTDIR
+    cp UP3DTRANSCODE/up3dlink.exe $DESTDIR
+    cp UP3DTRANSCODE/up3ddiff.exe $DESTDIR
 else
     if [[ $OSTYPE =~ darwin.* ]]; then
         OS="MAC"
@@ -72,6 +83,14 @@ else
     cp UP3DTOOLS/up3dload $DESTDIR
     cp UP3DTOOLS/up3dshell $DESTDIR
     cp UP3DTRANSCODE/up3dtranscode $DESTDIR
+    cp UP3DTRANSCODE/up3dretarget $DESTDIR
+    cp UP3DTRANSCODE/up3dsim $DESTDIR
+    cp UP3DTRANSCODE/up3dprofile $DESTDIR
+    cp UP3DTRANSCODE/up3dresume $DESTDIR
+    cp UP3DTRANSCODE/up3doptimize $DESTDIR
+    cp UP3DTRANSCODE/up3dloop $DESTDIR
+    cp UP3DTRANSCODE/up3dlink $DESTDIR
+    cp UP3DTRANSCODE/up3ddiff $DESTDIR
 fi
 
 cd build